@@ -6,7 +6,10 @@
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
 #include <chrono>
+#include <filesystem>
+#include <memory_resource>
 #include <numeric>
 #include <random>
 #include <string>
@@ -15,7 +18,9 @@
 #include <vector>
 
 #include <nfx/containers/ChdHashMap.h>
+#include <nfx/containers/ChdHashMapImage.h>
 #include <nfx/containers/HashMap.h>
+#include <nfx/containers/StaticChdHashMap.h>
 
 namespace nfx::containers::benchmark
 {
@@ -1077,6 +1082,449 @@ namespace nfx::containers::benchmark
 			::benchmark::DoNotOptimize( totalSalary );
 		}
 	}
+
+	//----------------------------------------------
+	// Batched lookup (tryGetValues with prefetch)
+	//----------------------------------------------
+
+	/*
+	 * Each iteration resolves PROBE_COUNT randomly chosen present keys against a map of
+	 * range(0) entries; items_per_second is therefore the per-key lookup rate.
+	 */
+	static constexpr size_t PROBE_COUNT = 4096;
+
+	/*
+	 * CHD cannot separate two keys with the same 32-bit hash, and a million keys already
+	 * hold about a hundred such pairs. Keys sharing a hash with another candidate are
+	 * dropped, keeping the first count survivors in generation order.
+	 */
+	static std::vector<std::string> createDistinctHashKeys( size_t count )
+	{
+		const size_t candidateCount{ count + count / 64 + 16 };
+		std::vector<std::pair<uint32_t, uint32_t>> hashed;
+		hashed.reserve( candidateCount );
+		for ( size_t i = 0; i < candidateCount; ++i )
+		{
+			hashed.emplace_back( ChdHashMap<int>::hash( "k" + std::to_string( i ) ), static_cast<uint32_t>( i ) );
+		}
+		std::sort( hashed.begin(), hashed.end() );
+
+		std::vector<bool> collides( candidateCount, false );
+		for ( size_t i = 1; i < hashed.size(); ++i )
+		{
+			if ( hashed[i].first == hashed[i - 1].first )
+			{
+				collides[hashed[i].second] = true;
+				collides[hashed[i - 1].second] = true;
+			}
+		}
+
+		std::vector<std::string> keys;
+		keys.reserve( count );
+		for ( size_t i = 0; i < candidateCount && keys.size() < count; ++i )
+		{
+			if ( !collides[i] )
+			{
+				keys.emplace_back( "k" + std::to_string( i ) );
+			}
+		}
+
+		return keys;
+	}
+
+	struct BatchLookupFixture
+	{
+		std::vector<std::string> keys;
+		std::vector<std::string_view> probes;
+		ChdHashMap<int> map;
+
+		explicit BatchLookupFixture( size_t count )
+			: keys{ createDistinctHashKeys( count ) }
+		{
+			std::vector<std::pair<std::string, int>> items;
+			items.reserve( count );
+			for ( size_t i = 0; i < count; ++i )
+			{
+				items.emplace_back( keys[i], static_cast<int>( i ) );
+			}
+			map = ChdHashMap<int>{ std::move( items ) };
+
+			std::mt19937_64 gen( 42 );
+			std::uniform_int_distribution<size_t> indexDist( 0, count - 1 );
+			probes.reserve( PROBE_COUNT );
+			for ( size_t i = 0; i < PROBE_COUNT; ++i )
+			{
+				probes.emplace_back( keys[indexDist( gen )] );
+			}
+		}
+	};
+
+	static void BM_ChdHashMap_Lookup_Loop( ::benchmark::State& state )
+	{
+		BatchLookupFixture fixture{ static_cast<size_t>( state.range( 0 ) ) };
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( const auto key : fixture.probes )
+			{
+				int* value = nullptr;
+				if ( fixture.map.tryGetValue( key, value ) )
+				{
+					sum += *value;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * PROBE_COUNT ) );
+	}
+
+	static void BM_ChdHashMap_Lookup_Batch( ::benchmark::State& state )
+	{
+		BatchLookupFixture fixture{ static_cast<size_t>( state.range( 0 ) ) };
+		std::vector<int*> values( PROBE_COUNT, nullptr );
+
+		for ( auto _ : state )
+		{
+			fixture.map.tryGetValues( fixture.probes, values );
+
+			int sum = 0;
+			for ( const int* value : values )
+			{
+				sum += value != nullptr ? *value : 0;
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * PROBE_COUNT ) );
+	}
+
+	/*
+	 * BM_ChdHashMap_Hit_Rate_50 at scale: a map of range(0) keys probed with PROBE_COUNT keys of
+	 * which 40% are present and 60% are other keys of the same shape, as when probing
+	 * user-supplied tokens against a codebook. range(1) selects tryGetValue (0) or tryGetValues (1).
+	 */
+	static void BM_ChdHashMap_Hit_Rate_40( ::benchmark::State& state )
+	{
+		const size_t count{ static_cast<size_t>( state.range( 0 ) ) };
+		const bool batched{ state.range( 1 ) != 0 };
+		const std::vector<std::string> keys{ createDistinctHashKeys( 2 * count ) };
+
+		std::vector<std::pair<std::string, int>> items;
+		items.reserve( count );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			items.emplace_back( keys[i], static_cast<int>( i ) );
+		}
+		ChdHashMap<int> map{ std::move( items ) };
+
+		std::mt19937_64 gen( 42 );
+		std::uniform_int_distribution<size_t> indexDist( 0, count - 1 );
+		std::uniform_int_distribution<int> hitDist( 0, 9 );
+		std::vector<std::string_view> probes;
+		probes.reserve( PROBE_COUNT );
+		for ( size_t i = 0; i < PROBE_COUNT; ++i )
+		{
+			probes.emplace_back( keys[indexDist( gen ) + ( hitDist( gen ) < 4 ? 0 : count )] );
+		}
+		std::vector<int*> values( PROBE_COUNT, nullptr );
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			if ( batched )
+			{
+				map.tryGetValues( probes, values );
+				for ( const int* value : values )
+				{
+					sum += value != nullptr ? *value : 0;
+				}
+			}
+			else
+			{
+				for ( const auto key : probes )
+				{
+					int* value = nullptr;
+					if ( map.tryGetValue( key, value ) )
+					{
+						sum += *value;
+					}
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * PROBE_COUNT ) );
+	}
+
+	//----------------------------------------------
+	// Bulk construction (flat buckets, parallel seed search)
+	//----------------------------------------------
+
+	/*
+	 * Builds a map of range(0) keys with range(1) build threads (0 = automatic);
+	 * items_per_second is the per-key construction rate. Copying the input is not timed.
+	 */
+	static void BM_ChdHashMap_Construction_Bulk( ::benchmark::State& state )
+	{
+		const size_t count{ static_cast<size_t>( state.range( 0 ) ) };
+		const size_t threads{ static_cast<size_t>( state.range( 1 ) ) };
+
+		std::vector<std::pair<std::string, int>> items;
+		items.reserve( count );
+		for ( auto& key : createDistinctHashKeys( count ) )
+		{
+			items.emplace_back( std::move( key ), static_cast<int>( items.size() ) );
+		}
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			auto dataCopy = items;
+			state.ResumeTiming();
+
+			ChdHashMap<int> chd{ std::move( dataCopy ), 100, threads };
+			::benchmark::DoNotOptimize( chd );
+
+			state.PauseTiming();
+			chd = ChdHashMap<int>{};
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * count ) );
+	}
+
+	//----------------------------------------------
+	// Memory footprint
+	//----------------------------------------------
+
+	/** @brief Upstream-forwarding resource recording the bytes currently allocated through it */
+	class CountingResource final : public std::pmr::memory_resource
+	{
+	public:
+		size_t liveBytes{ 0 };
+
+	private:
+		void* do_allocate( size_t bytes, size_t alignment ) override
+		{
+			liveBytes += bytes;
+			return std::pmr::new_delete_resource()->allocate( bytes, alignment );
+		}
+
+		void do_deallocate( void* pointer, size_t bytes, size_t alignment ) override
+		{
+			liveBytes -= bytes;
+			std::pmr::new_delete_resource()->deallocate( pointer, bytes, alignment );
+		}
+
+		bool do_is_equal( const std::pmr::memory_resource& other ) const noexcept override
+		{
+			return this == &other;
+		}
+	};
+
+	/*
+	 * Builds a pmr::ChdHashMap<int> of range(0) keys drawing from a counting resource and
+	 * reports bytes_per_key: entries, slot index, seeds and any out-of-line key storage.
+	 */
+	static void BM_ChdHashMap_Footprint( ::benchmark::State& state )
+	{
+		const size_t count{ static_cast<size_t>( state.range( 0 ) ) };
+		const std::vector<std::string> keys{ createDistinctHashKeys( count ) };
+
+		CountingResource resource;
+		double bytesPerKey{ 0.0 };
+		for ( auto _ : state )
+		{
+			pmr::ChdHashMap<int>::container_type items{ &resource };
+			items.reserve( count );
+			for ( size_t i = 0; i < count; ++i )
+			{
+				items.emplace_back( keys[i], static_cast<int>( i ) );
+			}
+
+			pmr::ChdHashMap<int> chd{ std::move( items ) };
+			bytesPerKey = static_cast<double>( resource.liveBytes ) / static_cast<double>( count );
+			::benchmark::DoNotOptimize( chd );
+		}
+
+		state.counters["bytes_per_key"] = bytesPerKey;
+	}
+
+	//----------------------------------------------
+	// Memory-mapped images
+	//----------------------------------------------
+
+	/** @brief Image of a ChdHashMap<int> over createDistinctHashKeys( count ), deleted on destruction */
+	struct ImageFixture
+	{
+		std::vector<std::string> keys;
+		std::filesystem::path path;
+
+		explicit ImageFixture( size_t count )
+			: keys{ createDistinctHashKeys( count ) },
+			  path{ std::filesystem::temp_directory_path() / ( "nfx_bm_chd_" + std::to_string( count ) + ".chd" ) }
+		{
+			std::vector<std::pair<std::string, int>> items;
+			items.reserve( count );
+			for ( size_t i = 0; i < count; ++i )
+			{
+				items.emplace_back( keys[i], static_cast<int>( i ) );
+			}
+			ChdHashMap<int>{ std::move( items ) }.saveImage( path );
+		}
+
+		~ImageFixture()
+		{
+			std::error_code ignored;
+			std::filesystem::remove( path, ignored );
+		}
+	};
+
+	/*
+	 * Opens an image of range(0) keys, verified when range(1) is 1, and looks up one key.
+	 * Compare with BM_ChdHashMap_Construction_Bulk, the cost of rebuilding the same map.
+	 */
+	static void BM_ChdHashMap_Image_Open( ::benchmark::State& state )
+	{
+		const ImageFixture fixture{ static_cast<size_t>( state.range( 0 ) ) };
+		const bool verify{ state.range( 1 ) != 0 };
+
+		for ( auto _ : state )
+		{
+			const ChdHashMapImage<int> image{ fixture.path, verify };
+			::benchmark::DoNotOptimize( image.at( fixture.keys.back() ) );
+		}
+	}
+
+	/* Random lookups into a mapped image; compare with BM_ChdHashMap_Lookup_Loop */
+	static void BM_ChdHashMap_Image_Lookup( ::benchmark::State& state )
+	{
+		const ImageFixture fixture{ static_cast<size_t>( state.range( 0 ) ) };
+		const ChdHashMapImage<int> image{ fixture.path };
+
+		std::mt19937_64 gen( 42 );
+		std::uniform_int_distribution<size_t> indexDist( 0, fixture.keys.size() - 1 );
+		std::vector<std::string_view> probes;
+		probes.reserve( PROBE_COUNT );
+		for ( size_t i = 0; i < PROBE_COUNT; ++i )
+		{
+			probes.emplace_back( fixture.keys[indexDist( gen )] );
+		}
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( const auto key : probes )
+			{
+				const int* value = nullptr;
+				if ( image.tryGetValue( key, value ) )
+				{
+					sum += *value;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * PROBE_COUNT ) );
+	}
+
+	//----------------------------------------------
+	// Compile-time tables
+	//----------------------------------------------
+
+	/** @brief Unit codebook known at compile time */
+	static constexpr std::pair<std::string_view, int> UNIT_CODES[]{
+		{ "m", 0 }, { "kg", 1 }, { "s", 2 }, { "A", 3 }, { "K", 4 }, { "mol", 5 }, { "cd", 6 }, { "Hz", 7 },
+		{ "N", 8 }, { "Pa", 9 }, { "J", 10 }, { "W", 11 }, { "C", 12 }, { "V", 13 }, { "F", 14 }, { "ohm", 15 },
+		{ "S", 16 }, { "Wb", 17 }, { "T", 18 }, { "H", 19 }, { "degC", 20 }, { "lm", 21 }, { "lx", 22 }, { "Bq", 23 },
+		{ "Gy", 24 }, { "Sv", 25 }, { "kat", 26 }, { "rad", 27 }, { "sr", 28 }, { "L", 29 }, { "t", 30 }, { "min", 31 },
+		{ "h", 32 }, { "d", 33 }, { "bar", 34 }, { "kn", 35 }, { "nmi", 36 }, { "rpm", 37 }, { "kWh", 38 }, { "m3/h", 39 } };
+
+	static constexpr auto STATIC_UNIT_CODES{ makeStaticChdHashMap<int>( UNIT_CODES ) };
+
+	/** @brief PROBE_COUNT unit codes, 60% of them unknown */
+	static std::vector<std::string> createUnitProbes()
+	{
+		std::mt19937_64 gen( 42 );
+		std::uniform_int_distribution<size_t> indexDist( 0, std::size( UNIT_CODES ) - 1 );
+		std::uniform_int_distribution<int> hitDist( 0, 9 );
+		std::vector<std::string> probes;
+		probes.reserve( PROBE_COUNT );
+		for ( size_t i = 0; i < PROBE_COUNT; ++i )
+		{
+			std::string probe{ UNIT_CODES[indexDist( gen )].first };
+			probes.push_back( hitDist( gen ) < 4 ? probe : probe + "_" );
+		}
+
+		return probes;
+	}
+
+	/* Lookups in the compile-time table; compare with BM_ChdHashMap_Runtime_Lookup */
+	static void BM_ChdHashMap_Static_Lookup( ::benchmark::State& state )
+	{
+		const auto probes{ createUnitProbes() };
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( const auto& key : probes )
+			{
+				const int* value = nullptr;
+				if ( STATIC_UNIT_CODES.tryGetValue( key, value ) )
+				{
+					sum += *value;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * PROBE_COUNT ) );
+	}
+
+	/* The same codebook as a ChdHashMap built at run time */
+	static void BM_ChdHashMap_Runtime_Lookup( ::benchmark::State& state )
+	{
+		std::vector<std::pair<std::string, int>> items;
+		for ( const auto& [key, value] : UNIT_CODES )
+		{
+			items.emplace_back( std::string{ key }, value );
+		}
+		ChdHashMap<int> map{ std::move( items ) };
+		const auto probes{ createUnitProbes() };
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( const auto& key : probes )
+			{
+				int* value = nullptr;
+				if ( map.tryGetValue( key, value ) )
+				{
+					sum += *value;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * PROBE_COUNT ) );
+	}
+
+	/* Startup cost the compile-time table removes: building the codebook at run time */
+	static void BM_ChdHashMap_Runtime_Build( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			std::vector<std::pair<std::string, int>> items;
+			for ( const auto& [key, value] : UNIT_CODES )
+			{
+				items.emplace_back( std::string{ key }, value );
+			}
+			ChdHashMap<int> map{ std::move( items ) };
+			::benchmark::DoNotOptimize( map );
+		}
+	}
 } // namespace nfx::containers::benchmark
 
 //=====================================================================
@@ -1233,4 +1681,68 @@ BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Iterator_STLAlgorithm );
 BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Iterator_ArrowOperator );
 BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Iterator_DereferenceOperator );
 
+//----------------------------------------------
+// Batched lookup (tryGetValues with prefetch)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Lookup_Loop )
+	->Arg( 1000 )
+	->Arg( 100000 )
+	->Arg( 10000000 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Lookup_Batch )
+	->Arg( 1000 )
+	->Arg( 100000 )
+	->Arg( 10000000 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Hit_Rate_40 )
+	->Args( { 100000, 0 } )
+	->Args( { 100000, 1 } )
+	->Args( { 1000000, 0 } )
+	->Args( { 1000000, 1 } )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Bulk construction (flat buckets, parallel seed search)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Construction_Bulk )
+	->Args( { 1000000, 1 } )
+	->Args( { 1000000, 0 } )
+	->Args( { 10000000, 1 } )
+	->Args( { 10000000, 0 } )
+	->Unit( benchmark::kMillisecond )
+	->UseRealTime();
+
+//----------------------------------------------
+// Memory footprint
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Footprint )
+	->Arg( 1000 )
+	->Arg( 1000000 )
+	->Unit( benchmark::kMillisecond );
+
+//----------------------------------------------
+// Memory-mapped images
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Image_Open )
+	->Args( { 1000000, 0 } )
+	->Args( { 1000000, 1 } )
+	->Unit( benchmark::kMillisecond )
+	->UseRealTime();
+BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Image_Lookup )
+	->Arg( 100000 )
+	->Arg( 10000000 )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Compile-time tables
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Static_Lookup )->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Runtime_Lookup )->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Runtime_Build )->Unit( benchmark::kMicrosecond );
+
 BENCHMARK_MAIN();
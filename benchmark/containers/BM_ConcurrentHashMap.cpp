@@ -0,0 +1,326 @@
+/**
+ * @file BM_ConcurrentHashMap.cpp
+ * @brief Benchmark ConcurrentHashMap scaling vs a HashMap behind one global mutex
+ * @details Measures read-heavy, mixed and write-heavy throughput as threads scale from 1 to 64,
+ *          plus lock-free SnapshotHashMap readers on a read-only workload
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/containers/ConcurrentHashMap.h>
+#include <nfx/containers/HashMap.h>
+#include <nfx/containers/SnapshotHashMap.h>
+
+namespace nfx::containers::benchmark
+{
+	//=====================================================================
+	// ConcurrentHashMap benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data generation
+	//----------------------------------------------
+
+	static constexpr size_t KEY_COUNT = 100'000;
+	static constexpr size_t OPS_PER_ITERATION = 1'000;
+
+	static const std::vector<std::string>& sharedKeys()
+	{
+		static const std::vector<std::string> keys = []() {
+			std::vector<std::string> result;
+			result.reserve( KEY_COUNT );
+			for ( size_t i = 0; i < KEY_COUNT; ++i )
+			{
+				result.emplace_back( "ingest_key_" + std::to_string( i ) );
+			}
+			return result;
+		}();
+
+		return keys;
+	}
+
+	/**
+	 * @brief Per-thread xorshift generator (no shared state between threads)
+	 */
+	struct FastRandom
+	{
+		std::uint64_t state;
+
+		std::uint64_t next() noexcept
+		{
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+			return state;
+		}
+	};
+
+	//----------------------------------------------
+	// Store adapters
+	//----------------------------------------------
+
+	/**
+	 * @brief Baseline: single HashMap serialized by one global mutex
+	 */
+	class GlobalMutexStore
+	{
+	public:
+		void load( const std::vector<std::string>& keys )
+		{
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				put( keys[i], static_cast<int>( i ) );
+			}
+		}
+
+		bool get( std::string_view key, int& outValue )
+		{
+			std::lock_guard lock{ m_mutex };
+			int* value = nullptr;
+			if ( !m_map.tryGetValue( key, value ) )
+			{
+				return false;
+			}
+			outValue = *value;
+			return true;
+		}
+
+		void put( const std::string& key, int value )
+		{
+			std::lock_guard lock{ m_mutex };
+			m_map.insertOrAssign( key, value );
+		}
+
+	private:
+		std::mutex m_mutex;
+		HashMap<std::string, int> m_map;
+	};
+
+	/**
+	 * @brief Sharded map with per-shard reader/writer locks
+	 */
+	class ShardedStore
+	{
+	public:
+		void load( const std::vector<std::string>& keys )
+		{
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				put( keys[i], static_cast<int>( i ) );
+			}
+		}
+
+		bool get( std::string_view key, int& outValue ) { return m_map.tryGetValue( key, outValue ); }
+
+		void put( const std::string& key, int value ) { m_map.insertOrAssign( key, value ); }
+
+	private:
+		ConcurrentHashMap<std::string, int> m_map;
+	};
+
+	/**
+	 * @brief Copy-on-write map with lock-free readers (writes copy the whole table)
+	 */
+	class SnapshotStore
+	{
+	public:
+		void load( const std::vector<std::string>& keys )
+		{
+			m_map.update( [&keys]( auto& table ) {
+				for ( size_t i = 0; i < keys.size(); ++i )
+				{
+					table.insertOrAssign( keys[i], static_cast<int>( i ) );
+				}
+			} );
+		}
+
+		bool get( std::string_view key, int& outValue ) { return m_map.tryGetValue( key, outValue ); }
+
+		void put( const std::string& key, int value ) { m_map.insertOrAssign( key, value ); }
+
+	private:
+		SnapshotHashMap<std::string, int> m_map;
+	};
+
+	//----------------------------------------------
+	// Workload driver
+	//----------------------------------------------
+
+	/**
+	 * @brief Run a random read/write mix against a store shared by all benchmark threads
+	 * @param readPercent Percentage of operations that are lookups, the rest overwrite existing keys
+	 */
+	template <typename Store>
+	static void runWorkload( ::benchmark::State& state, std::uint64_t readPercent )
+	{
+		static std::unique_ptr<Store> store;
+		const auto& keys = sharedKeys();
+
+		if ( state.thread_index() == 0 )
+		{
+			store = std::make_unique<Store>();
+			store->load( keys );
+		}
+
+		FastRandom rng{ 0x9E3779B97F4A7C15ull * ( static_cast<std::uint64_t>( state.thread_index() ) + 1 ) };
+
+		for ( auto _ : state )
+		{
+			int sink = 0;
+			for ( size_t op = 0; op < OPS_PER_ITERATION; ++op )
+			{
+				const std::uint64_t r = rng.next();
+				const std::string& key = keys[( r >> 8 ) % KEY_COUNT];
+
+				if ( ( r & 0xFF ) % 100 < readPercent )
+				{
+					int value = 0;
+					store->get( key, value );
+					sink += value;
+				}
+				else
+				{
+					store->put( key, static_cast<int>( r ) );
+				}
+			}
+			::benchmark::DoNotOptimize( sink );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * OPS_PER_ITERATION ) );
+
+		if ( state.thread_index() == 0 )
+		{
+			store.reset();
+		}
+	}
+
+	//----------------------------------------------
+	// Read-only (100% lookups)
+	//----------------------------------------------
+
+	static void BM_GlobalMutexHashMap_ReadOnly( ::benchmark::State& state )
+	{
+		runWorkload<GlobalMutexStore>( state, 100 );
+	}
+
+	static void BM_ConcurrentHashMap_ReadOnly( ::benchmark::State& state )
+	{
+		runWorkload<ShardedStore>( state, 100 );
+	}
+
+	static void BM_SnapshotHashMap_ReadOnly( ::benchmark::State& state )
+	{
+		runWorkload<SnapshotStore>( state, 100 );
+	}
+
+	//----------------------------------------------
+	// Read-heavy (95% lookups)
+	//----------------------------------------------
+
+	static void BM_GlobalMutexHashMap_ReadHeavy( ::benchmark::State& state )
+	{
+		runWorkload<GlobalMutexStore>( state, 95 );
+	}
+
+	static void BM_ConcurrentHashMap_ReadHeavy( ::benchmark::State& state )
+	{
+		runWorkload<ShardedStore>( state, 95 );
+	}
+
+	//----------------------------------------------
+	// Mixed (50% lookups)
+	//----------------------------------------------
+
+	static void BM_GlobalMutexHashMap_Mixed( ::benchmark::State& state )
+	{
+		runWorkload<GlobalMutexStore>( state, 50 );
+	}
+
+	static void BM_ConcurrentHashMap_Mixed( ::benchmark::State& state )
+	{
+		runWorkload<ShardedStore>( state, 50 );
+	}
+
+	//----------------------------------------------
+	// Write-heavy (10% lookups)
+	//----------------------------------------------
+
+	static void BM_GlobalMutexHashMap_WriteHeavy( ::benchmark::State& state )
+	{
+		runWorkload<GlobalMutexStore>( state, 10 );
+	}
+
+	static void BM_ConcurrentHashMap_WriteHeavy( ::benchmark::State& state )
+	{
+		runWorkload<ShardedStore>( state, 10 );
+	}
+} // namespace nfx::containers::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Read-only (100% lookups)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_GlobalMutexHashMap_ReadOnly )
+	->ThreadRange( 1, 64 )
+	->UseRealTime()
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_ConcurrentHashMap_ReadOnly )
+	->ThreadRange( 1, 64 )
+	->UseRealTime()
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_SnapshotHashMap_ReadOnly )
+	->ThreadRange( 1, 64 )
+	->UseRealTime()
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Read-heavy (95% lookups)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_GlobalMutexHashMap_ReadHeavy )
+	->ThreadRange( 1, 64 )
+	->UseRealTime()
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_ConcurrentHashMap_ReadHeavy )
+	->ThreadRange( 1, 64 )
+	->UseRealTime()
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Mixed (50% lookups)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_GlobalMutexHashMap_Mixed )
+	->ThreadRange( 1, 64 )
+	->UseRealTime()
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_ConcurrentHashMap_Mixed )
+	->ThreadRange( 1, 64 )
+	->UseRealTime()
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Write-heavy (10% lookups)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_GlobalMutexHashMap_WriteHeavy )
+	->ThreadRange( 1, 64 )
+	->UseRealTime()
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_ConcurrentHashMap_WriteHeavy )
+	->ThreadRange( 1, 64 )
+	->UseRealTime()
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_MAIN();
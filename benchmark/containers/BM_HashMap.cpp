@@ -1,19 +1,32 @@
 /**
  * @file BM_HashMap.cpp
  * @brief Benchmark HashMap performance vs std::unordered_map
- * @details Demonstrates Robin Hood hashing performance and heterogeneous string operations
+ * @details Demonstrates Robin Hood hashing performance, heterogeneous string operations
+ *          and side-by-side comparison with FlatHashMap control-byte group probing
  */
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
 #include <random>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include <nfx/containers/ArenaHashMap.h>
+#include <nfx/containers/FlatHashMap.h>
 #include <nfx/containers/HashMap.h>
+#include <nfx/containers/HugePageAllocator.h>
+#include <nfx/containers/IntHashMap.h>
+#include <nfx/containers/StringMap.h>
 
 namespace nfx::containers::benchmark
 {
@@ -606,6 +619,1308 @@ namespace nfx::containers::benchmark
 			::benchmark::DoNotOptimize( total_length );
 		}
 	}
+
+	//----------------------------------------------
+	// Integer ID maps (IntHashMap side-by-side)
+	//----------------------------------------------
+
+	static std::vector<std::uint64_t> generateRecordIds( size_t count )
+	{
+		std::mt19937_64 rng{ 42 };
+		std::vector<std::uint64_t> ids( count );
+		for ( auto& id : ids )
+		{
+			id = rng() >> 1; // Keep clear of the IntHashMap sentinel
+		}
+
+		return ids;
+	}
+
+	template <typename Map>
+	static void runIdMapInsert( ::benchmark::State& state )
+	{
+		const auto ids{ generateRecordIds( static_cast<size_t>( state.range( 0 ) ) ) };
+
+		for ( auto _ : state )
+		{
+			Map map;
+			for ( size_t i = 0; i < ids.size(); ++i )
+			{
+				map.insertOrAssign( ids[i], static_cast<std::uint64_t>( i ) );
+			}
+			::benchmark::DoNotOptimize( map );
+		}
+
+		state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+	}
+
+	template <typename Map>
+	static void runIdMapLookup( ::benchmark::State& state )
+	{
+		const auto ids{ generateRecordIds( static_cast<size_t>( state.range( 0 ) ) ) };
+		Map map;
+		for ( size_t i = 0; i < ids.size(); ++i )
+		{
+			map.insertOrAssign( ids[i], static_cast<std::uint64_t>( i ) );
+		}
+
+		std::vector<std::uint64_t> probes{ ids };
+		std::shuffle( probes.begin(), probes.end(), std::mt19937_64{ 7 } );
+
+		for ( auto _ : state )
+		{
+			std::uint64_t sum = 0;
+			for ( const std::uint64_t id : probes )
+			{
+				std::uint64_t* value = nullptr;
+				if ( map.tryGetValue( id, value ) )
+				{
+					sum += *value;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+	}
+
+	static void BM_HashMap_IdMap_Insert( ::benchmark::State& state )
+	{
+		runIdMapInsert<nfx::containers::HashMap<std::uint64_t, std::uint64_t>>( state );
+	}
+
+	static void BM_IntHashMap_IdMap_Insert( ::benchmark::State& state )
+	{
+		runIdMapInsert<nfx::containers::IntHashMap<std::uint64_t, std::uint64_t>>( state );
+	}
+
+	static void BM_HashMap_IdMap_Lookup( ::benchmark::State& state )
+	{
+		runIdMapLookup<nfx::containers::HashMap<std::uint64_t, std::uint64_t>>( state );
+	}
+
+	static void BM_IntHashMap_IdMap_Lookup( ::benchmark::State& state )
+	{
+		runIdMapLookup<nfx::containers::IntHashMap<std::uint64_t, std::uint64_t>>( state );
+	}
+
+	//----------------------------------------------
+	// SIMD control-byte probing (FlatHashMap side-by-side)
+	//----------------------------------------------
+
+	static std::vector<std::string> generateNumberedKeys( std::string_view prefix, size_t count )
+	{
+		std::vector<std::string> keys;
+		keys.reserve( count );
+
+		for ( size_t i = 0; i < count; ++i )
+		{
+			keys.emplace_back( std::string{ prefix } + std::to_string( i ) );
+		}
+
+		return keys;
+	}
+
+	static void BM_FlatHashMap_Insert_Int( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			nfx::containers::FlatHashMap<std::string, int> map;
+			for ( size_t i = 0; i < 100; ++i )
+			{
+				map.insertOrAssign( testKeys[i], static_cast<int>( i ) );
+			}
+			::benchmark::DoNotOptimize( map );
+		}
+	}
+
+	static void BM_FlatHashMap_Lookup_String( ::benchmark::State& state )
+	{
+		nfx::containers::FlatHashMap<std::string, int> map;
+		for ( size_t i = 0; i < 100; ++i )
+		{
+			map.insertOrAssign( testKeys[i], static_cast<int>( i ) );
+		}
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( size_t i = 0; i < 100; ++i )
+			{
+				int* value = nullptr;
+				if ( map.tryGetValue( testKeys[i], value ) )
+				{
+					sum += *value;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+	}
+
+	static void BM_FlatHashMap_LargeDataset_Lookup( ::benchmark::State& state )
+	{
+		nfx::containers::FlatHashMap<std::string, int> map;
+		for ( size_t i = 0; i < 1000; ++i )
+		{
+			map.insertOrAssign( testKeys[i], static_cast<int>( i ) );
+		}
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( size_t i = 0; i < 1000; ++i )
+			{
+				int* value = nullptr;
+				if ( map.tryGetValue( testKeys[i], value ) )
+				{
+					sum += *value;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+	}
+
+	/*
+	 * Lookup of absent keys at the highest load each container reaches before growing
+	 * (~75% for HashMap, ~87% for FlatHashMap). Misses are where Robin Hood walks
+	 * several fat buckets while group probing usually stops after one control-byte load.
+	 */
+	template <typename TMap>
+	static void runMissHighLoad( ::benchmark::State& state )
+	{
+		const size_t count{ static_cast<size_t>( state.range( 0 ) ) };
+		const auto keys{ generateNumberedKeys( "present_key_", count ) };
+		const auto missingKeys{ generateNumberedKeys( "missing_key_", count ) };
+
+		TMap map;
+		for ( size_t i = 0; i < count; ++i )
+		{
+			map.insertOrAssign( keys[i], static_cast<int>( i ) );
+		}
+
+		for ( auto _ : state )
+		{
+			size_t found = 0;
+			for ( const auto& key : missingKeys )
+			{
+				int* value = nullptr;
+				found += map.tryGetValue( std::string_view{ key }, value ) ? 1 : 0;
+			}
+			::benchmark::DoNotOptimize( found );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * count ) );
+	}
+
+	static void BM_HashMap_Miss_HighLoad( ::benchmark::State& state )
+	{
+		runMissHighLoad<nfx::containers::HashMap<std::string, int>>( state );
+	}
+
+	static void BM_FlatHashMap_Miss_HighLoad( ::benchmark::State& state )
+	{
+		runMissHighLoad<nfx::containers::FlatHashMap<std::string, int>>( state );
+	}
+
+	template <typename TMap>
+	static void runHitHighLoad( ::benchmark::State& state )
+	{
+		const size_t count{ static_cast<size_t>( state.range( 0 ) ) };
+		const auto keys{ generateNumberedKeys( "present_key_", count ) };
+
+		TMap map;
+		for ( size_t i = 0; i < count; ++i )
+		{
+			map.insertOrAssign( keys[i], static_cast<int>( i ) );
+		}
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( const auto& key : keys )
+			{
+				int* value = nullptr;
+				if ( map.tryGetValue( std::string_view{ key }, value ) )
+				{
+					sum += *value;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * count ) );
+	}
+
+	static void BM_HashMap_Hit_HighLoad( ::benchmark::State& state )
+	{
+		runHitHighLoad<nfx::containers::HashMap<std::string, int>>( state );
+	}
+
+	static void BM_FlatHashMap_Hit_HighLoad( ::benchmark::State& state )
+	{
+		runHitHighLoad<nfx::containers::FlatHashMap<std::string, int>>( state );
+	}
+
+	//----------------------------------------------
+	// Bucket layout (interleaved vs split metadata)
+	//----------------------------------------------
+
+	struct LargeRecord
+	{
+		std::array<std::uint64_t, 32> payload{}; // 256 bytes
+	};
+
+	template <typename TKey, typename TValue>
+	using SplitHashMap = nfx::containers::HashMap<TKey, TValue,
+		core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS,
+		core::hashing::constants::DEFAULT_FNV_PRIME,
+		nfx::containers::HashMapLayout::Split>;
+
+	template <typename TMap>
+	static void runLargeValueInsert( ::benchmark::State& state )
+	{
+		const size_t count{ static_cast<size_t>( state.range( 0 ) ) };
+		const auto keys{ generateNumberedKeys( "record_", count ) };
+
+		for ( auto _ : state )
+		{
+			TMap map;
+			for ( size_t i = 0; i < count; ++i )
+			{
+				LargeRecord record;
+				record.payload[0] = i;
+				map.insertOrAssign( keys[i], std::move( record ) );
+			}
+			::benchmark::DoNotOptimize( map );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * count ) );
+	}
+
+	template <typename TMap>
+	static void runLargeValueMiss( ::benchmark::State& state )
+	{
+		const size_t count{ static_cast<size_t>( state.range( 0 ) ) };
+		const auto keys{ generateNumberedKeys( "record_", count ) };
+		const auto missingKeys{ generateNumberedKeys( "absent_", count ) };
+
+		TMap map;
+		for ( size_t i = 0; i < count; ++i )
+		{
+			map.insertOrAssign( keys[i], LargeRecord{} );
+		}
+
+		for ( auto _ : state )
+		{
+			size_t found = 0;
+			for ( const auto& key : missingKeys )
+			{
+				LargeRecord* value = nullptr;
+				found += map.tryGetValue( std::string_view{ key }, value ) ? 1 : 0;
+			}
+			::benchmark::DoNotOptimize( found );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * count ) );
+	}
+
+	template <typename TMap>
+	static void runLargeValueHit( ::benchmark::State& state )
+	{
+		const size_t count{ static_cast<size_t>( state.range( 0 ) ) };
+		const auto keys{ generateNumberedKeys( "record_", count ) };
+
+		TMap map;
+		for ( size_t i = 0; i < count; ++i )
+		{
+			LargeRecord record;
+			record.payload[0] = i;
+			map.insertOrAssign( keys[i], std::move( record ) );
+		}
+
+		for ( auto _ : state )
+		{
+			std::uint64_t sum = 0;
+			for ( const auto& key : keys )
+			{
+				LargeRecord* value = nullptr;
+				if ( map.tryGetValue( std::string_view{ key }, value ) )
+				{
+					sum += value->payload[0];
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * count ) );
+	}
+
+	static void BM_HashMap_LargeValue_Insert_Interleaved( ::benchmark::State& state )
+	{
+		runLargeValueInsert<nfx::containers::HashMap<std::string, LargeRecord>>( state );
+	}
+
+	static void BM_HashMap_LargeValue_Insert_Split( ::benchmark::State& state )
+	{
+		runLargeValueInsert<SplitHashMap<std::string, LargeRecord>>( state );
+	}
+
+	static void BM_HashMap_LargeValue_Miss_Interleaved( ::benchmark::State& state )
+	{
+		runLargeValueMiss<nfx::containers::HashMap<std::string, LargeRecord>>( state );
+	}
+
+	static void BM_HashMap_LargeValue_Miss_Split( ::benchmark::State& state )
+	{
+		runLargeValueMiss<SplitHashMap<std::string, LargeRecord>>( state );
+	}
+
+	static void BM_HashMap_LargeValue_Hit_Interleaved( ::benchmark::State& state )
+	{
+		runLargeValueHit<nfx::containers::HashMap<std::string, LargeRecord>>( state );
+	}
+
+	static void BM_HashMap_LargeValue_Hit_Split( ::benchmark::State& state )
+	{
+		runLargeValueHit<SplitHashMap<std::string, LargeRecord>>( state );
+	}
+
+	//----------------------------------------------
+	// Resize latency (stop-the-world vs incremental)
+	//----------------------------------------------
+
+	/*
+	 * Inserts range(1) keys with incremental step range(0) (0 = stop-the-world resize)
+	 * and reports the slowest single insertOrAssign() call alongside total throughput.
+	 */
+	static void BM_HashMap_Insert_ResizeLatency( ::benchmark::State& state )
+	{
+		const size_t step{ static_cast<size_t>( state.range( 0 ) ) };
+		const size_t count{ static_cast<size_t>( state.range( 1 ) ) };
+		const auto keys{ generateNumberedKeys( "latency_", count ) };
+
+		double worstNs = 0.0;
+		for ( auto _ : state )
+		{
+			nfx::containers::HashMap<std::string, int> map;
+			map.setIncrementalRehash( step );
+
+			for ( size_t i = 0; i < count; ++i )
+			{
+				const auto start{ std::chrono::steady_clock::now() };
+				map.insertOrAssign( keys[i], static_cast<int>( i ) );
+				const auto end{ std::chrono::steady_clock::now() };
+
+				worstNs = std::max( worstNs, std::chrono::duration<double, std::nano>( end - start ).count() );
+			}
+			::benchmark::DoNotOptimize( map );
+		}
+
+		state.counters["max_insert_ns"] = worstNs;
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * count ) );
+	}
+
+	//----------------------------------------------
+	// Batched lookup (tryGetValues with prefetch)
+	//----------------------------------------------
+
+	/*
+	 * Each iteration resolves PROBE_COUNT randomly chosen present keys against a map of
+	 * range(0) entries; items_per_second is therefore the per-key lookup rate.
+	 */
+	static constexpr size_t PROBE_COUNT = 4096;
+
+	struct BatchLookupFixture
+	{
+		std::vector<std::string> keys;
+		std::vector<std::string_view> probes;
+		nfx::containers::HashMap<std::string, int> map;
+
+		explicit BatchLookupFixture( size_t count )
+			: keys{ generateNumberedKeys( "k", count ) }
+		{
+			map.reserve( count + count / 2 );
+			for ( size_t i = 0; i < count; ++i )
+			{
+				map.insertOrAssign( keys[i], static_cast<int>( i ) );
+			}
+
+			std::mt19937_64 gen( 42 );
+			std::uniform_int_distribution<size_t> indexDist( 0, count - 1 );
+			probes.reserve( PROBE_COUNT );
+			for ( size_t i = 0; i < PROBE_COUNT; ++i )
+			{
+				probes.emplace_back( keys[indexDist( gen )] );
+			}
+		}
+	};
+
+	static void BM_HashMap_Lookup_Loop( ::benchmark::State& state )
+	{
+		BatchLookupFixture fixture{ static_cast<size_t>( state.range( 0 ) ) };
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( const auto key : fixture.probes )
+			{
+				int* value = nullptr;
+				if ( fixture.map.tryGetValue( key, value ) )
+				{
+					sum += *value;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * PROBE_COUNT ) );
+	}
+
+	static void BM_HashMap_Lookup_Batch( ::benchmark::State& state )
+	{
+		BatchLookupFixture fixture{ static_cast<size_t>( state.range( 0 ) ) };
+		std::vector<int*> values( PROBE_COUNT, nullptr );
+
+		for ( auto _ : state )
+		{
+			fixture.map.tryGetValues<std::string_view>( fixture.probes, values );
+
+			int sum = 0;
+			for ( const int* value : values )
+			{
+				sum += value != nullptr ? *value : 0;
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * PROBE_COUNT ) );
+	}
+
+	//----------------------------------------------
+	// Heterogeneous update (string_view counters)
+	//----------------------------------------------
+
+	/*
+	 * Update-dominated counters workload: every probe hits an existing key held as a
+	 * std::string_view. Key names exceed the small-string buffer, so materializing a
+	 * std::string per call costs one heap allocation.
+	 */
+	struct CounterFixture
+	{
+		std::vector<std::string> keys;
+		std::vector<std::string_view> probes;
+		nfx::containers::HashMap<std::string, int> map;
+
+		CounterFixture()
+			: keys{ generateNumberedKeys( "ingest.counter.with.a.long.name.", 1000 ) }
+		{
+			for ( const auto& key : keys )
+			{
+				map.insertOrAssign( key, 0 );
+			}
+
+			std::mt19937_64 gen( 42 );
+			std::uniform_int_distribution<size_t> indexDist( 0, keys.size() - 1 );
+			probes.reserve( PROBE_COUNT );
+			for ( size_t i = 0; i < PROBE_COUNT; ++i )
+			{
+				probes.emplace_back( keys[indexDist( gen )] );
+			}
+		}
+	};
+
+	static void BM_HashMap_CounterUpdate_MaterializedKey( ::benchmark::State& state )
+	{
+		CounterFixture fixture;
+
+		for ( auto _ : state )
+		{
+			int i = 0;
+			for ( const auto key : fixture.probes )
+			{
+				fixture.map.insertOrAssign( std::string{ key }, ++i );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * PROBE_COUNT ) );
+	}
+
+	static void BM_HashMap_CounterUpdate_Heterogeneous( ::benchmark::State& state )
+	{
+		CounterFixture fixture;
+
+		for ( auto _ : state )
+		{
+			int i = 0;
+			for ( const auto key : fixture.probes )
+			{
+				fixture.map.insertOrAssign( key, ++i );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * PROBE_COUNT ) );
+	}
+
+	static void BM_HashMap_CounterUpdate_TryEmplace( ::benchmark::State& state )
+	{
+		CounterFixture fixture;
+
+		for ( auto _ : state )
+		{
+			for ( const auto key : fixture.probes )
+			{
+				++*fixture.map.tryEmplace( key ).first;
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * PROBE_COUNT ) );
+	}
+
+	//----------------------------------------------
+	// Per-request arena (std::pmr)
+	//----------------------------------------------
+
+	/*
+	 * Build a short-lived map per request and tear it down. With the default allocator every
+	 * key (longer than the small-string buffer) and every resize is a separate malloc/free;
+	 * with a monotonic arena over a reused buffer teardown is a single release().
+	 */
+	static constexpr size_t REQUEST_KEY_COUNT = 1000;
+	static constexpr size_t REQUEST_ARENA_BYTES = 1 << 20;
+
+	static void BM_HashMap_PerRequest_DefaultAllocator( ::benchmark::State& state )
+	{
+		const auto keys{ generateNumberedKeys( "request.attribute.with.a.long.name.", REQUEST_KEY_COUNT ) };
+
+		for ( auto _ : state )
+		{
+			HashMap<std::string, int> map;
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				map.insertOrAssign( std::string_view{ keys[i] }, static_cast<int>( i ) );
+			}
+			::benchmark::DoNotOptimize( map.size() );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * REQUEST_KEY_COUNT ) );
+	}
+
+	static void BM_HashMap_PerRequest_MonotonicArena( ::benchmark::State& state )
+	{
+		const auto keys{ generateNumberedKeys( "request.attribute.with.a.long.name.", REQUEST_KEY_COUNT ) };
+		std::vector<std::byte> buffer( REQUEST_ARENA_BYTES );
+
+		for ( auto _ : state )
+		{
+			std::pmr::monotonic_buffer_resource arena{ buffer.data(), buffer.size() };
+			pmr::HashMap<std::pmr::string, int> map( &arena );
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				map.insertOrAssign( std::string_view{ keys[i] }, static_cast<int>( i ) );
+			}
+			::benchmark::DoNotOptimize( map.size() );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * REQUEST_KEY_COUNT ) );
+	}
+
+	static void BM_StringMap_PerRequest_DefaultAllocator( ::benchmark::State& state )
+	{
+		const auto keys{ generateNumberedKeys( "request.attribute.with.a.long.name.", REQUEST_KEY_COUNT ) };
+
+		for ( auto _ : state )
+		{
+			StringMap<int> map;
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				map.insert_or_assign( std::string_view{ keys[i] }, static_cast<int>( i ) );
+			}
+			::benchmark::DoNotOptimize( map.size() );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * REQUEST_KEY_COUNT ) );
+	}
+
+	static void BM_StringMap_PerRequest_MonotonicArena( ::benchmark::State& state )
+	{
+		const auto keys{ generateNumberedKeys( "request.attribute.with.a.long.name.", REQUEST_KEY_COUNT ) };
+		std::vector<std::byte> buffer( REQUEST_ARENA_BYTES );
+
+		for ( auto _ : state )
+		{
+			std::pmr::monotonic_buffer_resource arena{ buffer.data(), buffer.size() };
+			pmr::StringMap<int> map( &arena );
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				map.insert_or_assign( std::string_view{ keys[i] }, static_cast<int>( i ) );
+			}
+			::benchmark::DoNotOptimize( map.size() );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * REQUEST_KEY_COUNT ) );
+	}
+
+	//----------------------------------------------
+	// Path catalog (arena-stored keys)
+	//----------------------------------------------
+
+	/*
+	 * Large catalog of path-like keys, well past the small-string buffer. HashMap<std::string>
+	 * pays one malloc per key and drags 32-byte strings through every rehash and scan;
+	 * ArenaHashMap copies key bytes once into packed blocks and moves 16-byte views.
+	 */
+	static const std::vector<std::string>& catalogKeys( size_t count )
+	{
+		static std::vector<std::string> keys;
+		if ( keys.size() != count )
+		{
+			keys = generateNumberedKeys( "/srv/data/catalog/partition/object_", count );
+		}
+
+		return keys;
+	}
+
+	static void BM_HashMap_PathCatalog_Build_StdString( ::benchmark::State& state )
+	{
+		const auto& keys{ catalogKeys( static_cast<size_t>( state.range( 0 ) ) ) };
+
+		for ( auto _ : state )
+		{
+			HashMap<std::string, int> map;
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				map.insertOrAssign( std::string_view{ keys[i] }, static_cast<int>( i ) );
+			}
+			::benchmark::DoNotOptimize( map.size() );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+	}
+
+	static void BM_HashMap_PathCatalog_Build_Arena( ::benchmark::State& state )
+	{
+		const auto& keys{ catalogKeys( static_cast<size_t>( state.range( 0 ) ) ) };
+
+		for ( auto _ : state )
+		{
+			ArenaHashMap<int> map;
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				map.insertOrAssign( keys[i], static_cast<int>( i ) );
+			}
+			::benchmark::DoNotOptimize( map.size() );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+	}
+
+	static void BM_HashMap_PathCatalog_Iterate_StdString( ::benchmark::State& state )
+	{
+		const auto& keys{ catalogKeys( static_cast<size_t>( state.range( 0 ) ) ) };
+		HashMap<std::string, int> map;
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			map.insertOrAssign( std::string_view{ keys[i] }, static_cast<int>( i ) );
+		}
+
+		for ( auto _ : state )
+		{
+			size_t sum{ 0 };
+			for ( const auto& [key, value] : map )
+			{
+				sum += key.size() + static_cast<size_t>( value );
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+	}
+
+	static void BM_HashMap_PathCatalog_Iterate_Arena( ::benchmark::State& state )
+	{
+		const auto& keys{ catalogKeys( static_cast<size_t>( state.range( 0 ) ) ) };
+		ArenaHashMap<int> map;
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			map.insertOrAssign( keys[i], static_cast<int>( i ) );
+		}
+
+		for ( auto _ : state )
+		{
+			size_t sum{ 0 };
+			for ( const auto& [key, value] : map )
+			{
+				sum += key.size() + static_cast<size_t>( value );
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+	}
+
+	static void BM_HashMap_PathCatalog_Lookup_StdString( ::benchmark::State& state )
+	{
+		const auto& keys{ catalogKeys( static_cast<size_t>( state.range( 0 ) ) ) };
+		HashMap<std::string, int> map;
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			map.insertOrAssign( std::string_view{ keys[i] }, static_cast<int>( i ) );
+		}
+
+		for ( auto _ : state )
+		{
+			for ( const auto& key : keys )
+			{
+				int* value = nullptr;
+				::benchmark::DoNotOptimize( map.tryGetValue( std::string_view{ key }, value ) );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+	}
+
+	static void BM_HashMap_PathCatalog_Lookup_Arena( ::benchmark::State& state )
+	{
+		const auto& keys{ catalogKeys( static_cast<size_t>( state.range( 0 ) ) ) };
+		ArenaHashMap<int> map;
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			map.insertOrAssign( keys[i], static_cast<int>( i ) );
+		}
+
+		for ( auto _ : state )
+		{
+			for ( const auto& key : keys )
+			{
+				int* value = nullptr;
+				::benchmark::DoNotOptimize( map.tryGetValue( key, value ) );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+	}
+
+	//----------------------------------------------
+	// Hash policy x key length matrix
+	//----------------------------------------------
+
+	/*
+	 * Every policy at 8/32/128/1024-byte keys: raw hashing of the key set, then hits on a map
+	 * holding those keys. Long keys (paths, URLs) are where hashing dominates lookup cost.
+	 */
+	static constexpr size_t POLICY_KEY_COUNT = 4096;
+
+	/**
+	 * @brief POLICY_KEY_COUNT distinct keys of exactly length bytes (path-like filler, unique tail)
+	 */
+	static std::vector<std::string> generateFixedLengthKeys( size_t length )
+	{
+		std::vector<std::string> keys;
+		keys.reserve( POLICY_KEY_COUNT );
+		for ( size_t i = 0; i < POLICY_KEY_COUNT; ++i )
+		{
+			std::string key( length, '/' );
+			for ( size_t c = 0; c < length; ++c )
+			{
+				key[c] = "abcdefghijklmnopqrstuvwxyz/"[( c * 7 + c / 5 ) % 27];
+			}
+			const std::string id{ std::to_string( i ) };
+			key.replace( length - id.size(), id.size(), id );
+			keys.push_back( std::move( key ) );
+		}
+		return keys;
+	}
+
+	template <typename Hasher>
+	static void runHashPolicyHash( ::benchmark::State& state )
+	{
+		const size_t length{ static_cast<size_t>( state.range( 0 ) ) };
+		const auto keys{ generateFixedLengthKeys( length ) };
+		const Hasher hasher{};
+
+		for ( auto _ : state )
+		{
+			size_t sum{ 0 };
+			for ( const auto& key : keys )
+			{
+				sum += hasher( std::string_view{ key } );
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * keys.size() * length ) );
+	}
+
+	template <typename Hasher>
+	static void runHashPolicyLookup( ::benchmark::State& state )
+	{
+		const size_t length{ static_cast<size_t>( state.range( 0 ) ) };
+		const auto keys{ generateFixedLengthKeys( length ) };
+
+		HashMap<std::string, int, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Interleaved, std::allocator<std::pair<const std::string, int>>, Hasher>
+			map;
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			map.insertOrAssign( std::string_view{ keys[i] }, static_cast<int>( i ) );
+		}
+
+		for ( auto _ : state )
+		{
+			for ( const auto& key : keys )
+			{
+				int* value = nullptr;
+				::benchmark::DoNotOptimize( map.tryGetValue( std::string_view{ key }, value ) );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * keys.size() * length ) );
+	}
+
+	static void BM_HashPolicy_Hash_Default( ::benchmark::State& state )
+	{
+		runHashPolicyHash<HashMapHash<core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS>>( state );
+	}
+
+	static void BM_HashPolicy_Hash_Crc32( ::benchmark::State& state )
+	{
+		runHashPolicyHash<Crc32Hash>( state );
+	}
+
+	static void BM_HashPolicy_Hash_WyHash( ::benchmark::State& state )
+	{
+		runHashPolicyHash<WyHash>( state );
+	}
+
+	static void BM_HashPolicy_Hash_Xxh3( ::benchmark::State& state )
+	{
+		runHashPolicyHash<Xxh3Hash>( state );
+	}
+
+	static void BM_HashPolicy_Lookup_Default( ::benchmark::State& state )
+	{
+		runHashPolicyLookup<HashMapHash<core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS>>( state );
+	}
+
+	static void BM_HashPolicy_Lookup_Crc32( ::benchmark::State& state )
+	{
+		runHashPolicyLookup<Crc32Hash>( state );
+	}
+
+	static void BM_HashPolicy_Lookup_WyHash( ::benchmark::State& state )
+	{
+		runHashPolicyLookup<WyHash>( state );
+	}
+
+	static void BM_HashPolicy_Lookup_Xxh3( ::benchmark::State& state )
+	{
+		runHashPolicyLookup<Xxh3Hash>( state );
+	}
+
+	static void BM_HashPolicy_Hash_SipHash13( ::benchmark::State& state )
+	{
+		runHashPolicyHash<SipHash13>( state );
+	}
+
+	static void BM_HashPolicy_Lookup_SipHash13( ::benchmark::State& state )
+	{
+		runHashPolicyLookup<SipHash13>( state );
+	}
+
+	//----------------------------------------------
+	// Hash flooding (precomputed colliding keys)
+	//----------------------------------------------
+
+	/*
+	 * Keys an attacker precomputed against the default FNV hash: all share the low bits that
+	 * select the home bucket at the map's final capacity, so every insert and lookup walks one
+	 * cluster. The SipHash13 map never sees them collide and its guard caps any chain anyway.
+	 */
+	static std::vector<std::string> generateFloodKeys( size_t count )
+	{
+		const HashMapHash<core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS> hasher{};
+		const std::uint32_t mask{ static_cast<std::uint32_t>( std::bit_ceil( count * 2 ) - 1 ) };
+
+		std::vector<std::string> keys;
+		keys.reserve( count );
+		for ( size_t i = 0; keys.size() < count; ++i )
+		{
+			std::string key{ "{\"field_" + std::to_string( i ) + "\"" };
+			if ( ( static_cast<std::uint32_t>( hasher( std::string_view{ key } ) ) & mask ) == 0 )
+			{
+				keys.push_back( std::move( key ) );
+			}
+		}
+		return keys;
+	}
+
+	template <typename Hasher>
+	static void runHashFlooding( ::benchmark::State& state )
+	{
+		const auto keys{ generateFloodKeys( static_cast<size_t>( state.range( 0 ) ) ) };
+
+		for ( auto _ : state )
+		{
+			HashMap<std::string, int, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+				HashMapLayout::Interleaved, std::allocator<std::pair<const std::string, int>>, Hasher>
+				map;
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				map.insertOrAssign( std::string_view{ keys[i] }, static_cast<int>( i ) );
+			}
+			for ( const auto& key : keys )
+			{
+				int* value = nullptr;
+				::benchmark::DoNotOptimize( map.tryGetValue( std::string_view{ key }, value ) );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+	}
+
+	static void BM_HashFlooding_Default( ::benchmark::State& state )
+	{
+		runHashFlooding<HashMapHash<core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS>>( state );
+	}
+
+	static void BM_HashFlooding_SipHash13( ::benchmark::State& state )
+	{
+		runHashFlooding<SipHash13>( state );
+	}
+
+	//----------------------------------------------
+	// Sparse maps (occupancy bitmap)
+	//----------------------------------------------
+
+	static void BM_HashMap_Sparse_Iterate( ::benchmark::State& state )
+	{
+		// Filled to 70%, then drained to 10%: the capacity stays at its peak
+		const size_t capacity{ static_cast<size_t>( state.range( 0 ) ) };
+		HashMap<std::uint64_t, std::uint64_t> map{ capacity };
+		for ( std::uint64_t i = 0; i < capacity * 7 / 10; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+		for ( std::uint64_t i = 0; i < capacity * 7 / 10; ++i )
+		{
+			if ( i % 7 != 0 )
+			{
+				map.erase( i );
+			}
+		}
+
+		for ( auto _ : state )
+		{
+			std::uint64_t sum{ 0 };
+			for ( const auto& [key, value] : map )
+			{
+				sum += key + value;
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * map.size() ) );
+	}
+
+	static void BM_HashMap_Sparse_Clear( ::benchmark::State& state )
+	{
+		const size_t capacity{ static_cast<size_t>( state.range( 0 ) ) };
+		HashMap<std::uint64_t, std::string> map{ capacity };
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			for ( std::uint64_t i = 0; i < capacity / 10; ++i )
+			{
+				map.insertOrAssign( i * 7919, "a flushed value that does not fit SSO" );
+			}
+			state.ResumeTiming();
+
+			map.clear();
+			::benchmark::DoNotOptimize( map.size() );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * ( capacity / 10 ) ) );
+	}
+
+	//----------------------------------------------
+	// TTL purge (bulk erase of 40%)
+	//----------------------------------------------
+
+	static HashMap<std::string, std::uint64_t> makeTtlMap( size_t count )
+	{
+		HashMap<std::string, std::uint64_t> map;
+		for ( std::uint64_t i = 0; i < count; ++i )
+		{
+			// Value is an expiry timestamp in [0, 100)
+			map.insertOrAssign( "session:" + std::to_string( i * 7919 ), ( i * 37 ) % 100 );
+		}
+		return map;
+	}
+
+	static void BM_HashMap_TtlPurge_CollectAndErase( ::benchmark::State& state )
+	{
+		const auto source{ makeTtlMap( static_cast<size_t>( state.range( 0 ) ) ) };
+		std::vector<std::string> expired;
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			auto map{ source };
+			expired.clear();
+			state.ResumeTiming();
+
+			for ( const auto& [key, expiry] : map )
+			{
+				if ( expiry < 40 )
+				{
+					expired.push_back( key );
+				}
+			}
+			// Copies: erase shifts the remaining keys, so views into the map would dangle
+			for ( const std::string& key : expired )
+			{
+				map.erase( key );
+			}
+			::benchmark::DoNotOptimize( map.size() );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * source.size() ) );
+	}
+
+	static void BM_HashMap_TtlPurge_EraseIf( ::benchmark::State& state )
+	{
+		const auto source{ makeTtlMap( static_cast<size_t>( state.range( 0 ) ) ) };
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			auto map{ source };
+			state.ResumeTiming();
+
+			map.eraseIf( []( const std::string&, const std::uint64_t& expiry ) { return expiry < 40; } );
+			::benchmark::DoNotOptimize( map.size() );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * source.size() ) );
+	}
+
+	//----------------------------------------------
+	// Configuration snapshots (equality and diff)
+	//----------------------------------------------
+
+	static std::pair<HashMap<std::string, std::string>, HashMap<std::string, std::string>> makeSnapshots( size_t count )
+	{
+		HashMap<std::string, std::string> before;
+		for ( size_t i = 0; i < count; ++i )
+		{
+			before.insertOrAssign( "service.setting." + std::to_string( i ), std::to_string( i * 31 ) );
+		}
+
+		// 1% of the keys change value, 0.5% are removed and 0.5% are added
+		HashMap<std::string, std::string> after{ before };
+		for ( size_t i = 0; i < count; i += 100 )
+		{
+			after.insertOrAssign( "service.setting." + std::to_string( i ), "changed" );
+			after.erase( "service.setting." + std::to_string( i + 1 ) );
+			after.insertOrAssign( "service.added." + std::to_string( i ), "new" );
+		}
+		return { std::move( before ), std::move( after ) };
+	}
+
+	static void BM_HashMap_Snapshot_Equal( ::benchmark::State& state )
+	{
+		const auto [before, after]{ makeSnapshots( static_cast<size_t>( state.range( 0 ) ) ) };
+		const HashMap<std::string, std::string> copy{ before };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( before == copy );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * before.size() ) );
+	}
+
+	static void BM_HashMap_Snapshot_Diff( ::benchmark::State& state )
+	{
+		const auto [before, after]{ makeSnapshots( static_cast<size_t>( state.range( 0 ) ) ) };
+
+		for ( auto _ : state )
+		{
+			const auto changes{ before.diff( after ) };
+			::benchmark::DoNotOptimize( changes.changed.size() );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * ( before.size() + after.size() ) ) );
+	}
+
+	//----------------------------------------------
+	// Growth policy (load factor and growth factor)
+	//----------------------------------------------
+
+	/** @brief Past 75% of 2^20 but below 90%: the default policy needs 2^21 buckets */
+	static constexpr std::uint64_t GROWTH_POLICY_ELEMENTS{ 900000 };
+
+	static HashMap<std::uint64_t, std::uint64_t> makeGrowthPolicyMap( const ::benchmark::State& state )
+	{
+		HashMap<std::uint64_t, std::uint64_t> map;
+		map.setGrowthPolicy( { static_cast<std::uint32_t>( state.range( 0 ) ), static_cast<std::uint32_t>( state.range( 1 ) ) } );
+		for ( std::uint64_t i = 0; i < GROWTH_POLICY_ELEMENTS; ++i )
+		{
+			map.insertOrAssign( i * 0x9E3779B97F4A7C15ull, i );
+		}
+
+		return map;
+	}
+
+	static void BM_HashMap_GrowthPolicy_Insert( ::benchmark::State& state )
+	{
+		size_t capacity{ 0 };
+		for ( auto _ : state )
+		{
+			auto map{ makeGrowthPolicyMap( state ) };
+			capacity = map.capacity();
+			::benchmark::DoNotOptimize( map );
+		}
+
+		state.counters["buckets_per_element"] = static_cast<double>( capacity ) / static_cast<double>( GROWTH_POLICY_ELEMENTS );
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * GROWTH_POLICY_ELEMENTS ) );
+	}
+
+	static void BM_HashMap_GrowthPolicy_Lookup( ::benchmark::State& state )
+	{
+		auto map{ makeGrowthPolicyMap( state ) };
+
+		for ( auto _ : state )
+		{
+			std::uint64_t sum{ 0 };
+			for ( std::uint64_t i = 0; i < GROWTH_POLICY_ELEMENTS; ++i )
+			{
+				std::uint64_t* value = nullptr;
+				if ( map.tryGetValue( i * 0x9E3779B97F4A7C15ull, value ) )
+				{
+					sum += *value;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.counters["buckets_per_element"] = static_cast<double>( map.capacity() ) / static_cast<double>( GROWTH_POLICY_ELEMENTS );
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * GROWTH_POLICY_ELEMENTS ) );
+	}
+
+	//----------------------------------------------
+	// Cached hash width (32-bit vs 64-bit)
+	//----------------------------------------------
+
+	template <typename Map>
+	static void runCachedHashLookup( ::benchmark::State& state )
+	{
+		const size_t count{ static_cast<size_t>( state.range( 0 ) ) };
+		std::vector<std::string> keys;
+		keys.reserve( count * 2 );
+		for ( size_t i = 0; i < count * 2; ++i )
+		{
+			keys.push_back( "tenant/0042/object/" + std::to_string( i ) );
+		}
+
+		Map map;
+		map.reserve( count * 2 );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			map.insertOrAssign( keys[i], i );
+		}
+
+		// Half hits, half misses, in a fixed shuffled order
+		std::vector<size_t> order( count * 2 );
+		for ( size_t i = 0; i < order.size(); ++i )
+		{
+			order[i] = i;
+		}
+		std::shuffle( order.begin(), order.end(), std::mt19937_64{ 99 } );
+
+		for ( auto _ : state )
+		{
+			size_t found{ 0 };
+			for ( const size_t index : order )
+			{
+				size_t* value = nullptr;
+				found += map.tryGetValue( std::string_view{ keys[index] }, value ) ? 1 : 0;
+			}
+			::benchmark::DoNotOptimize( found );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * order.size() ) );
+	}
+
+	static void BM_HashMap_CachedHash32_Lookup( ::benchmark::State& state )
+	{
+		runCachedHashLookup<HashMap<std::string, size_t, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Interleaved, std::allocator<std::pair<const std::string, size_t>>, Xxh3Hash>>( state );
+	}
+
+	static void BM_HashMap_CachedHash64_Lookup( ::benchmark::State& state )
+	{
+		runCachedHashLookup<HashMap64<std::string, size_t>>( state );
+	}
+
+	//----------------------------------------------
+	// Huge page backed buckets
+	//----------------------------------------------
+
+	/*
+	 * range(0) keys in a table reserved at 50% load, so 1 << 25 keys span 1 << 26 buckets
+	 * (well over 1 GiB). Each iteration looks up 1 << 20 random present keys; at that size
+	 * nearly every probe misses the TLB with 4 KiB pages.
+	 */
+	template <typename Map>
+	static void runLargeTableLookup( ::benchmark::State& state )
+	{
+		const std::uint64_t count{ static_cast<std::uint64_t>( state.range( 0 ) ) };
+
+		Map map( static_cast<size_t>( count * 2 ) );
+		for ( std::uint64_t i = 0; i < count; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		std::mt19937_64 gen( 42 );
+		std::uniform_int_distribution<std::uint64_t> keyDist( 0, count - 1 );
+		std::vector<std::uint64_t> probes( size_t{ 1 } << 20 );
+		for ( auto& probe : probes )
+		{
+			probe = keyDist( gen );
+		}
+
+		for ( auto _ : state )
+		{
+			std::uint64_t sum{ 0 };
+			for ( const std::uint64_t key : probes )
+			{
+				std::uint64_t* value{ nullptr };
+				if ( map.tryGetValue( key, value ) )
+				{
+					sum += *value;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * probes.size() ) );
+	}
+
+	static void BM_HashMap_LargeTable_StdAllocator_Lookup( ::benchmark::State& state )
+	{
+		runLargeTableLookup<HashMap<std::uint64_t, std::uint64_t>>( state );
+	}
+
+	static void BM_HashMap_LargeTable_HugePages_Lookup( ::benchmark::State& state )
+	{
+		runLargeTableLookup<HashMap<std::uint64_t, std::uint64_t, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Interleaved, HugePageAllocator<std::pair<const std::uint64_t, std::uint64_t>>>>( state );
+	}
 } // namespace nfx::containers::benchmark
 
 //=====================================================================
@@ -718,4 +2033,318 @@ BENCHMARK( nfx::containers::benchmark::BM_HashMap_IntKey_Insert )
 BENCHMARK( nfx::containers::benchmark::BM_HashMap_IntKey_Lookup )
 	->Unit( benchmark::kMicrosecond );
 
+//----------------------------------------------
+// Integer ID maps (IntHashMap side-by-side)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_IdMap_Insert )
+	->Arg( 100000 )
+	->Arg( 1000000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_IntHashMap_IdMap_Insert )
+	->Arg( 100000 )
+	->Arg( 1000000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_IdMap_Lookup )
+	->Arg( 100000 )
+	->Arg( 1000000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_IntHashMap_IdMap_Lookup )
+	->Arg( 100000 )
+	->Arg( 1000000 )
+	->Unit( benchmark::kMillisecond );
+
+//----------------------------------------------
+// SIMD control-byte probing (FlatHashMap side-by-side)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_FlatHashMap_Insert_Int )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_FlatHashMap_Lookup_String )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_FlatHashMap_LargeDataset_Lookup )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_Miss_HighLoad )
+	->Arg( 24 * 1024 )
+	->Arg( 768 * 1024 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_FlatHashMap_Miss_HighLoad )
+	->Arg( 28 * 1024 )
+	->Arg( 896 * 1024 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_Hit_HighLoad )
+	->Arg( 24 * 1024 )
+	->Arg( 768 * 1024 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_FlatHashMap_Hit_HighLoad )
+	->Arg( 28 * 1024 )
+	->Arg( 896 * 1024 )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Bucket layout (interleaved vs split metadata)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_LargeValue_Insert_Interleaved )
+	->Arg( 1024 )
+	->Arg( 100000 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_LargeValue_Insert_Split )
+	->Arg( 1024 )
+	->Arg( 100000 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_LargeValue_Miss_Interleaved )
+	->Arg( 1024 )
+	->Arg( 100000 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_LargeValue_Miss_Split )
+	->Arg( 1024 )
+	->Arg( 100000 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_LargeValue_Hit_Interleaved )
+	->Arg( 1024 )
+	->Arg( 100000 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_LargeValue_Hit_Split )
+	->Arg( 1024 )
+	->Arg( 100000 )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Resize latency (stop-the-world vs incremental)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_Insert_ResizeLatency )
+	->Args( { 0, 1 << 20 } )
+	->Args( { 8, 1 << 20 } )
+	->Args( { 64, 1 << 20 } )
+	->Unit( benchmark::kMillisecond );
+
+//----------------------------------------------
+// Batched lookup (tryGetValues with prefetch)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_Lookup_Loop )
+	->Arg( 1000 )
+	->Arg( 100000 )
+	->Arg( 10000000 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_Lookup_Batch )
+	->Arg( 1000 )
+	->Arg( 100000 )
+	->Arg( 10000000 )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Heterogeneous update (string_view counters)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_CounterUpdate_MaterializedKey )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_CounterUpdate_Heterogeneous )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_CounterUpdate_TryEmplace )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Per-request arena (std::pmr)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_PerRequest_DefaultAllocator )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_PerRequest_MonotonicArena )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_StringMap_PerRequest_DefaultAllocator )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_StringMap_PerRequest_MonotonicArena )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Path catalog (arena-stored keys)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_PathCatalog_Build_StdString )
+	->Arg( 100'000 )
+	->Arg( 1'000'000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_PathCatalog_Build_Arena )
+	->Arg( 100'000 )
+	->Arg( 1'000'000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_PathCatalog_Iterate_StdString )
+	->Arg( 100'000 )
+	->Arg( 1'000'000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_PathCatalog_Iterate_Arena )
+	->Arg( 100'000 )
+	->Arg( 1'000'000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_PathCatalog_Lookup_StdString )
+	->Arg( 100'000 )
+	->Arg( 1'000'000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_PathCatalog_Lookup_Arena )
+	->Arg( 100'000 )
+	->Arg( 1'000'000 )
+	->Unit( benchmark::kMillisecond );
+
+//----------------------------------------------
+// Hash policy x key length matrix
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashPolicy_Hash_Default )
+	->Arg( 8 )
+	->Arg( 32 )
+	->Arg( 128 )
+	->Arg( 1024 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashPolicy_Hash_Crc32 )
+	->Arg( 8 )
+	->Arg( 32 )
+	->Arg( 128 )
+	->Arg( 1024 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashPolicy_Hash_WyHash )
+	->Arg( 8 )
+	->Arg( 32 )
+	->Arg( 128 )
+	->Arg( 1024 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashPolicy_Hash_Xxh3 )
+	->Arg( 8 )
+	->Arg( 32 )
+	->Arg( 128 )
+	->Arg( 1024 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashPolicy_Lookup_Default )
+	->Arg( 8 )
+	->Arg( 32 )
+	->Arg( 128 )
+	->Arg( 1024 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashPolicy_Lookup_Crc32 )
+	->Arg( 8 )
+	->Arg( 32 )
+	->Arg( 128 )
+	->Arg( 1024 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashPolicy_Lookup_WyHash )
+	->Arg( 8 )
+	->Arg( 32 )
+	->Arg( 128 )
+	->Arg( 1024 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashPolicy_Lookup_Xxh3 )
+	->Arg( 8 )
+	->Arg( 32 )
+	->Arg( 128 )
+	->Arg( 1024 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::containers::benchmark::BM_HashPolicy_Hash_SipHash13 )
+	->Arg( 8 )
+	->Arg( 32 )
+	->Arg( 128 )
+	->Arg( 1024 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashPolicy_Lookup_SipHash13 )
+	->Arg( 8 )
+	->Arg( 32 )
+	->Arg( 128 )
+	->Arg( 1024 )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Hash flooding (precomputed colliding keys)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashFlooding_Default )
+	->Arg( 1'000 )
+	->Arg( 4'000 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashFlooding_SipHash13 )
+	->Arg( 1'000 )
+	->Arg( 4'000 )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Sparse maps (occupancy bitmap)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_Sparse_Iterate )
+	->Arg( 1 << 16 )
+	->Arg( 1 << 20 )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_Sparse_Clear )
+	->Arg( 1 << 16 )
+	->Arg( 1 << 20 )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// TTL purge (bulk erase of 40%)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_TtlPurge_CollectAndErase )
+	->Arg( 100000 )
+	->Arg( 1000000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_TtlPurge_EraseIf )
+	->Arg( 100000 )
+	->Arg( 1000000 )
+	->Unit( benchmark::kMillisecond );
+
+//----------------------------------------------
+// Configuration snapshots (equality and diff)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_Snapshot_Equal )
+	->Arg( 10000 )
+	->Arg( 1000000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_Snapshot_Diff )
+	->Arg( 10000 )
+	->Arg( 1000000 )
+	->Unit( benchmark::kMillisecond );
+
+//----------------------------------------------
+// Growth policy (max load %, growth %) at 900k elements
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_GrowthPolicy_Insert )
+	->Args( { 75, 200 } )
+	->Args( { 90, 200 } )
+	->Args( { 90, 150 } )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_GrowthPolicy_Lookup )
+	->Args( { 75, 200 } )
+	->Args( { 90, 200 } )
+	->Args( { 90, 150 } )
+	->Unit( benchmark::kMillisecond );
+
+//----------------------------------------------
+// Cached hash width (half hits, half misses)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_CachedHash32_Lookup )
+	->Arg( 1 << 16 )
+	->Arg( 1 << 22 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_CachedHash64_Lookup )
+	->Arg( 1 << 16 )
+	->Arg( 1 << 22 )
+	->Unit( benchmark::kMillisecond );
+
+//----------------------------------------------
+// Huge page backed buckets (random lookup)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_LargeTable_StdAllocator_Lookup )
+	->Arg( 1 << 20 )
+	->Arg( 1 << 25 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashMap_LargeTable_HugePages_Lookup )
+	->Arg( 1 << 20 )
+	->Arg( 1 << 25 )
+	->Unit( benchmark::kMillisecond );
+
 BENCHMARK_MAIN();
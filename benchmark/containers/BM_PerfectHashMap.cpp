@@ -0,0 +1,333 @@
+/**
+ * @file BM_PerfectHashMap.cpp
+ * @brief Benchmark PerfectHashMap engines vs ChdHashMap and std::unordered_map on large key sets
+ * @details Space, build time and lookup rate of the minimal perfect hash engines at 1M and 10M
+ *          keys. Build benchmarks report the index size as bits per key next to the build rate;
+ *          lookup benchmarks probe present keys (range(1) = 0) or absent keys of the same shape
+ *          (range(1) = 1).
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <nfx/containers/ChdHashMap.h>
+#include <nfx/containers/PerfectHashMap.h>
+
+namespace nfx::containers::benchmark
+{
+	//=====================================================================
+	// PerfectHashMap benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Key sets
+	//----------------------------------------------
+
+	/*
+	 * Each lookup iteration resolves PROBE_COUNT randomly chosen keys; items_per_second is
+	 * therefore the per-key lookup rate.
+	 */
+	static constexpr size_t PROBE_COUNT = 4096;
+
+	/*
+	 * Every container is built over the same keys. ChdHashMap cannot separate two keys with
+	 * the same 32-bit hash, so keys sharing a hash with another candidate are dropped, as in
+	 * BM_ChdHashMap.cpp.
+	 */
+	static std::vector<std::string> createDistinctHashKeys( size_t count )
+	{
+		const size_t candidateCount{ count + count / 64 + 16 };
+		std::vector<std::pair<uint32_t, uint32_t>> hashed;
+		hashed.reserve( candidateCount );
+		for ( size_t i = 0; i < candidateCount; ++i )
+		{
+			hashed.emplace_back( ChdHashMap<int>::hash( "k" + std::to_string( i ) ), static_cast<uint32_t>( i ) );
+		}
+		std::sort( hashed.begin(), hashed.end() );
+
+		std::vector<bool> collides( candidateCount, false );
+		for ( size_t i = 1; i < hashed.size(); ++i )
+		{
+			if ( hashed[i].first == hashed[i - 1].first )
+			{
+				collides[hashed[i].second] = true;
+				collides[hashed[i - 1].second] = true;
+			}
+		}
+
+		std::vector<std::string> keys;
+		keys.reserve( count );
+		for ( size_t i = 0; i < candidateCount && keys.size() < count; ++i )
+		{
+			if ( !collides[i] )
+			{
+				keys.emplace_back( "k" + std::to_string( i ) );
+			}
+		}
+
+		return keys;
+	}
+
+	/** @brief The first count keys with their index as value */
+	static std::vector<std::pair<std::string, int>> createItems( const std::vector<std::string>& keys, size_t count )
+	{
+		std::vector<std::pair<std::string, int>> items;
+		items.reserve( count );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			items.emplace_back( keys[i], static_cast<int>( i ) );
+		}
+
+		return items;
+	}
+
+	/** @brief 2 × range(0) keys: the first half goes into the map, probes come from either half */
+	struct LookupFixture
+	{
+		size_t count;
+		std::vector<std::string> keys;
+		std::vector<std::string_view> probes;
+
+		explicit LookupFixture( const ::benchmark::State& state )
+			: count{ static_cast<size_t>( state.range( 0 ) ) },
+			  keys{ createDistinctHashKeys( 2 * count ) }
+		{
+			const size_t first{ state.range( 1 ) != 0 ? count : 0 };
+
+			std::mt19937_64 gen( 42 );
+			std::uniform_int_distribution<size_t> indexDist( 0, count - 1 );
+			probes.reserve( PROBE_COUNT );
+			for ( size_t i = 0; i < PROBE_COUNT; ++i )
+			{
+				probes.emplace_back( keys[first + indexDist( gen )] );
+			}
+		}
+	};
+
+	/** @brief Times lookup( key ) over the fixture's probes */
+	template <typename Lookup>
+	static void runProbes( ::benchmark::State& state, const LookupFixture& fixture, Lookup&& lookup )
+	{
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( const auto key : fixture.probes )
+			{
+				sum += lookup( key );
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * PROBE_COUNT ) );
+	}
+
+	//----------------------------------------------
+	// Build (time and space)
+	//----------------------------------------------
+
+	/*
+	 * Builds a map of range(0) keys; items_per_second is the per-key construction rate.
+	 * mphf_bits_per_key is the engine alone, index_bits_per_key adds the 16-bit fingerprints.
+	 * Copying the input is not timed.
+	 */
+	template <typename Engine>
+	static void runPerfectHashMapBuild( ::benchmark::State& state )
+	{
+		const size_t count{ static_cast<size_t>( state.range( 0 ) ) };
+		const auto items{ createItems( createDistinctHashKeys( count ), count ) };
+
+		double mphfBits{ 0.0 };
+		double indexBits{ 0.0 };
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			auto dataCopy = items;
+			state.ResumeTiming();
+
+			PerfectHashMap<int, Engine> map{ std::move( dataCopy ) };
+			::benchmark::DoNotOptimize( map );
+
+			state.PauseTiming();
+			mphfBits = static_cast<double>( map.engine().sizeInBytes() * 8 ) / static_cast<double>( count );
+			indexBits = static_cast<double>( map.indexSizeInBytes() * 8 ) / static_cast<double>( count );
+			map = PerfectHashMap<int, Engine>{};
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * count ) );
+		state.counters["mphf_bits_per_key"] = mphfBits;
+		state.counters["index_bits_per_key"] = indexBits;
+	}
+
+	static void BM_PerfectHashMap_Build_PtHash( ::benchmark::State& state )
+	{
+		runPerfectHashMapBuild<PtHashEngine>( state );
+	}
+
+	static void BM_PerfectHashMap_Build_BbHash( ::benchmark::State& state )
+	{
+		runPerfectHashMapBuild<BbHashEngine>( state );
+	}
+
+	/*
+	 * index_bits_per_key counts CHD's slot index and seeds: 2 × n rounded up to a power of 2
+	 * slots of one ChdSlot and one 16-bit seed each.
+	 */
+	static void BM_ChdHashMap_Build( ::benchmark::State& state )
+	{
+		const size_t count{ static_cast<size_t>( state.range( 0 ) ) };
+		const auto items{ createItems( createDistinctHashKeys( count ), count ) };
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			auto dataCopy = items;
+			state.ResumeTiming();
+
+			ChdHashMap<int> map{ std::move( dataCopy ) };
+			::benchmark::DoNotOptimize( map );
+
+			state.PauseTiming();
+			map = ChdHashMap<int>{};
+			state.ResumeTiming();
+		}
+
+		const double slots{ static_cast<double>( std::bit_ceil( 2 * count ) ) };
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * count ) );
+		state.counters["index_bits_per_key"] = slots * ( sizeof( detail::ChdSlot ) + sizeof( uint16_t ) ) * 8 / static_cast<double>( count );
+	}
+
+	static void BM_std_unordered_map_Build( ::benchmark::State& state )
+	{
+		const size_t count{ static_cast<size_t>( state.range( 0 ) ) };
+		const auto items{ createItems( createDistinctHashKeys( count ), count ) };
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			auto dataCopy = items;
+			state.ResumeTiming();
+
+			std::unordered_map<std::string, int> map;
+			map.reserve( count );
+			for ( auto& [key, value] : dataCopy )
+			{
+				map.emplace( std::move( key ), value );
+			}
+			::benchmark::DoNotOptimize( map );
+
+			state.PauseTiming();
+			map = {};
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * count ) );
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename Engine>
+	static void runPerfectHashMapLookup( ::benchmark::State& state )
+	{
+		const LookupFixture fixture{ state };
+		const PerfectHashMap<int, Engine> map{ createItems( fixture.keys, fixture.count ) };
+
+		runProbes( state, fixture, [&map]( std::string_view key ) {
+			const int* value = nullptr;
+			return map.tryGetValue( key, value ) ? *value : 0;
+		} );
+	}
+
+	static void BM_PerfectHashMap_Lookup_PtHash( ::benchmark::State& state )
+	{
+		runPerfectHashMapLookup<PtHashEngine>( state );
+	}
+
+	static void BM_PerfectHashMap_Lookup_BbHash( ::benchmark::State& state )
+	{
+		runPerfectHashMapLookup<BbHashEngine>( state );
+	}
+
+	static void BM_ChdHashMap_Lookup( ::benchmark::State& state )
+	{
+		const LookupFixture fixture{ state };
+		ChdHashMap<int> map{ createItems( fixture.keys, fixture.count ) };
+
+		runProbes( state, fixture, [&map]( std::string_view key ) {
+			int* value = nullptr;
+			return map.tryGetValue( key, value ) ? *value : 0;
+		} );
+	}
+
+	static void BM_std_unordered_map_Lookup( ::benchmark::State& state )
+	{
+		const LookupFixture fixture{ state };
+		std::unordered_map<std::string, int> map;
+		map.reserve( fixture.count );
+		for ( auto& [key, value] : createItems( fixture.keys, fixture.count ) )
+		{
+			map.emplace( std::move( key ), value );
+		}
+
+		// No transparent hasher: each probe builds a std::string, as in BM_ChdHashMap.cpp
+		runProbes( state, fixture, [&map]( std::string_view key ) {
+			const auto it = map.find( std::string{ key } );
+			return it != map.end() ? it->second : 0;
+		} );
+	}
+} // namespace nfx::containers::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Build (time and space)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Build_PtHash )
+	->Arg( 1000000 )
+	->Arg( 10000000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Build_BbHash )
+	->Arg( 1000000 )
+	->Arg( 10000000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Build )
+	->Arg( 1000000 )
+	->Arg( 10000000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_Build )
+	->Arg( 1000000 )
+	->Arg( 10000000 )
+	->Unit( benchmark::kMillisecond );
+
+//----------------------------------------------
+// Lookup
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Lookup_PtHash )
+	->ArgsProduct( { { 1000000, 10000000 }, { 0, 1 } } )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Lookup_BbHash )
+	->ArgsProduct( { { 1000000, 10000000 }, { 0, 1 } } )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_ChdHashMap_Lookup )
+	->ArgsProduct( { { 1000000, 10000000 }, { 0, 1 } } )
+	->Unit( benchmark::kMicrosecond );
+BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_Lookup )
+	->ArgsProduct( { { 1000000, 10000000 }, { 0, 1 } } )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_MAIN();
@@ -1,7 +1,8 @@
 /**
  * @file BM_StringSet.cpp
  * @brief Benchmark StringSet performance vs std::unordered_set<std::string>
- * @details Demonstrates zero-copy heterogeneous lookups and set operations performance
+ * @details Demonstrates zero-copy heterogeneous lookups and set operations performance,
+ *          and compares node-based StringSet with open-addressing HashSet on deduplication
  */
 
 #include <benchmark/benchmark.h>
@@ -13,6 +14,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include <nfx/containers/HashSet.h>
 #include <nfx/containers/StringSet.h>
 
 namespace nfx::containers::benchmark
@@ -629,6 +631,167 @@ namespace nfx::containers::benchmark
 			::benchmark::DoNotOptimize( set );
 		}
 	}
+
+	//----------------------------------------------
+	// HashSet head-to-head (deduplication stage)
+	//----------------------------------------------
+
+	struct DedupStream
+	{
+		std::vector<std::string> distinct;
+		std::vector<std::string_view> stream;
+	};
+
+	/** @brief count keys drawn from count / 2 distinct 12-32 character keys, so about half are duplicates */
+	static DedupStream generateDedupStream( size_t count )
+	{
+		DedupStream data;
+		data.distinct.reserve( count / 2 );
+
+		std::mt19937 gen( 1234 );
+		std::uniform_int_distribution<> lengthDist( 12, 32 );
+		std::uniform_int_distribution<> charDist( 'a', 'z' );
+		for ( size_t i = 0; i < count / 2; ++i )
+		{
+			std::string key{ std::to_string( i ) + ':' };
+			while ( key.size() < static_cast<size_t>( lengthDist( gen ) ) )
+			{
+				key.push_back( static_cast<char>( charDist( gen ) ) );
+			}
+			data.distinct.emplace_back( std::move( key ) );
+		}
+
+		std::uniform_int_distribution<size_t> pick( 0, data.distinct.size() - 1 );
+		data.stream.reserve( count );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			data.stream.emplace_back( data.distinct[pick( gen )] );
+		}
+
+		return data;
+	}
+
+	static void BM_StringSet_Dedup( ::benchmark::State& state )
+	{
+		const auto data{ generateDedupStream( static_cast<size_t>( state.range( 0 ) ) ) };
+
+		for ( auto _ : state )
+		{
+			nfx::containers::StringSet set;
+			for ( const std::string_view key : data.stream )
+			{
+				set.insert( key );
+			}
+			::benchmark::DoNotOptimize( set );
+		}
+
+		state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+	}
+
+	static void BM_HashSet_Dedup( ::benchmark::State& state )
+	{
+		const auto data{ generateDedupStream( static_cast<size_t>( state.range( 0 ) ) ) };
+
+		for ( auto _ : state )
+		{
+			nfx::containers::HashSet<std::string> set;
+			for ( const std::string_view key : data.stream )
+			{
+				set.insert( key );
+			}
+			::benchmark::DoNotOptimize( set );
+		}
+
+		state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+	}
+
+	static void BM_HashSet_Dedup_InsertRange( ::benchmark::State& state )
+	{
+		const auto data{ generateDedupStream( static_cast<size_t>( state.range( 0 ) ) ) };
+
+		for ( auto _ : state )
+		{
+			nfx::containers::HashSet<std::string> set;
+			set.insertRange( data.stream );
+			::benchmark::DoNotOptimize( set );
+		}
+
+		state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+	}
+
+	static void BM_StringSet_Dedup_Contains( ::benchmark::State& state )
+	{
+		const auto data{ generateDedupStream( static_cast<size_t>( state.range( 0 ) ) ) };
+		nfx::containers::StringSet set{ data.distinct.begin(), data.distinct.end() };
+
+		for ( auto _ : state )
+		{
+			size_t found = 0;
+			for ( const std::string_view key : data.stream )
+			{
+				found += set.contains( key ) ? 1 : 0;
+			}
+			::benchmark::DoNotOptimize( found );
+		}
+
+		state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+	}
+
+	static void BM_HashSet_Dedup_Contains( ::benchmark::State& state )
+	{
+		const auto data{ generateDedupStream( static_cast<size_t>( state.range( 0 ) ) ) };
+		nfx::containers::HashSet<std::string> set;
+		set.insertRange( data.distinct );
+
+		for ( auto _ : state )
+		{
+			size_t found = 0;
+			for ( const std::string_view key : data.stream )
+			{
+				found += set.contains( key ) ? 1 : 0;
+			}
+			::benchmark::DoNotOptimize( found );
+		}
+
+		state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+	}
+
+	static void BM_StringSet_Intersection( ::benchmark::State& state )
+	{
+		const auto data{ generateDedupStream( static_cast<size_t>( state.range( 0 ) ) ) };
+		const size_t half{ data.distinct.size() / 2 };
+		const nfx::containers::StringSet left{ data.distinct.begin(), data.distinct.begin() + half + half / 2 };
+		const nfx::containers::StringSet right{ data.distinct.begin() + half, data.distinct.end() };
+
+		for ( auto _ : state )
+		{
+			nfx::containers::StringSet result;
+			for ( const auto& key : right )
+			{
+				if ( left.contains( key ) )
+				{
+					result.insert( key );
+				}
+			}
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_HashSet_Intersection( ::benchmark::State& state )
+	{
+		const auto data{ generateDedupStream( static_cast<size_t>( state.range( 0 ) ) ) };
+		const size_t half{ data.distinct.size() / 2 };
+		nfx::containers::HashSet<std::string> left;
+		nfx::containers::HashSet<std::string> right;
+		left.insertRange( data.distinct.begin(), data.distinct.begin() + half + half / 2 );
+		right.insertRange( data.distinct.begin() + half, data.distinct.end() );
+
+		for ( auto _ : state )
+		{
+			auto result{ left.intersectionWith( right ) };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
 } // namespace nfx::containers::benchmark
 
 //=====================================================================
@@ -764,4 +927,35 @@ BENCHMARK( nfx::containers::benchmark::BM_StringSet_ZeroAlloc_Lookup )
 BENCHMARK( nfx::containers::benchmark::BM_StringSet_DuplicateHandling )
 	->Unit( benchmark::kMicrosecond );
 
+//----------------------------------------------
+// HashSet head-to-head (deduplication stage)
+//----------------------------------------------
+
+BENCHMARK( nfx::containers::benchmark::BM_StringSet_Dedup )
+	->Arg( 100000 )
+	->Arg( 1000000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashSet_Dedup )
+	->Arg( 100000 )
+	->Arg( 1000000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashSet_Dedup_InsertRange )
+	->Arg( 100000 )
+	->Arg( 1000000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_StringSet_Dedup_Contains )
+	->Arg( 100000 )
+	->Arg( 1000000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashSet_Dedup_Contains )
+	->Arg( 100000 )
+	->Arg( 1000000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_StringSet_Intersection )
+	->Arg( 100000 )
+	->Unit( benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_HashSet_Intersection )
+	->Arg( 100000 )
+	->Unit( benchmark::kMillisecond );
+
 BENCHMARK_MAIN();
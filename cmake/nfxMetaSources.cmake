@@ -18,21 +18,47 @@ if(NFX_META_WITH_CONTAINERS)
 	list(APPEND PUBLIC_HEADERS
 		# --- Container functors ---
 		${NFX_META_INCLUDE_DIR}/nfx/containers/functors/HashMapHashFunctor.h
+		${NFX_META_INCLUDE_DIR}/nfx/containers/functors/HashPolicies.h
+		${NFX_META_INCLUDE_DIR}/nfx/containers/functors/PerfectHashEngines.h
 		${NFX_META_INCLUDE_DIR}/nfx/containers/functors/StringFunctors.h
 
 		# --- Container headers ---
+		${NFX_META_INCLUDE_DIR}/nfx/containers/ArenaHashMap.h
 		${NFX_META_INCLUDE_DIR}/nfx/containers/ChdHashMap.h
+		${NFX_META_INCLUDE_DIR}/nfx/containers/ChdHashMapImage.h
+		${NFX_META_INCLUDE_DIR}/nfx/containers/ConcurrentHashMap.h
+		${NFX_META_INCLUDE_DIR}/nfx/containers/FlatHashMap.h
 		${NFX_META_INCLUDE_DIR}/nfx/containers/HashMap.h
+		${NFX_META_INCLUDE_DIR}/nfx/containers/HashSet.h
+		${NFX_META_INCLUDE_DIR}/nfx/containers/HugePageAllocator.h
+		${NFX_META_INCLUDE_DIR}/nfx/containers/IntHashMap.h
+		${NFX_META_INCLUDE_DIR}/nfx/containers/PerfectHashMap.h
+		${NFX_META_INCLUDE_DIR}/nfx/containers/SnapshotHashMap.h
+		${NFX_META_INCLUDE_DIR}/nfx/containers/StaticChdHashMap.h
+		${NFX_META_INCLUDE_DIR}/nfx/containers/StringArena.h
 		${NFX_META_INCLUDE_DIR}/nfx/containers/StringMap.h
 		${NFX_META_INCLUDE_DIR}/nfx/containers/StringSet.h
 
 		# --- Container functors implementations ---
 		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/functors/HashMapHashFunctor.inl
+		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/functors/HashPolicies.inl
+		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/functors/PerfectHashEngines.inl
 		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/functors/StringFunctors.inl
 
 		# --- Container inline implementations ---
+		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/ArenaHashMap.inl
 		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/ChdHashMap.inl
+		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/ChdHashMapImage.inl
+		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/ConcurrentHashMap.inl
+		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/FlatHashMap.inl
 		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/HashMap.inl
+		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/HashSet.inl
+		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/HugePageAllocator.inl
+		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/IntHashMap.inl
+		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/PerfectHashMap.inl
+		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/SnapshotHashMap.inl
+		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/StaticChdHashMap.inl
+		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/StringArena.inl
 		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/StringMap.inl
 		${NFX_META_INCLUDE_DIR}/nfx/detail/containers/StringSet.inl
 	)
@@ -174,6 +200,11 @@ function(configure_target target_name)
 		target_link_libraries(${target_name} PUBLIC $<BUILD_INTERFACE:nfx-core::nfx-core>)
 	endif()
 
+	# --- Diagnostics ---
+	if(NFX_META_HASHMAP_STATS)
+		target_compile_definitions(${target_name} PUBLIC NFX_META_HASHMAP_STATS=1)
+	endif()
+
 	# --- Properties ---
 	set_target_properties(${target_name} PROPERTIES
 		CXX_STANDARD 20
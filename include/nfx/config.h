@@ -36,6 +36,15 @@
 #	define NFX_META_INLINE inline
 #endif
 
+/** @brief Cross-compiler read prefetch hint into all cache levels (no-op where unsupported) */
+#if defined( _MSC_VER )
+#	define NFX_META_PREFETCH( addr ) _mm_prefetch( reinterpret_cast<const char*>( addr ), _MM_HINT_T0 )
+#elif defined( __GNUC__ ) || defined( __clang__ )
+#	define NFX_META_PREFETCH( addr ) __builtin_prefetch( addr, 0, 3 )
+#else
+#	define NFX_META_PREFETCH( addr ) ( (void)( addr ) )
+#endif
+
 //----------------------------------------------
 // Compiler-specific C++20 feature support
 //----------------------------------------------
@@ -101,3 +110,17 @@
 /** @brief Includes code only when native 128-bit integer support is NOT available */
 #	define NFX_META_IF_NO_INT128( code ) code
 #endif
+
+//----------------------------------------------
+// Container diagnostics
+//----------------------------------------------
+
+/**
+ * @brief Record HashMap lookup, resize and rehash counters reported by HashMap::stats()
+ * @details Off by default: the counters cost a few relaxed atomic increments per lookup and
+ *          two clock reads per rehash step. Enable with the NFX_META_HASHMAP_STATS CMake
+ *          option, or define it to 1 before including any container header.
+ */
+#ifndef NFX_META_HASHMAP_STATS
+#	define NFX_META_HASHMAP_STATS 0
+#endif
@@ -0,0 +1,316 @@
+/**
+ * @file ArenaHashMap.h
+ * @brief String-keyed hash map whose key bytes live in one container-owned arena
+ * @details Buckets hold a std::string_view into a StringArena instead of an owning
+ *          std::string, so a bucket is 16 bytes of key rather than 32 and no key ever
+ *          needs its own heap block. Keys are copied into the arena once, on insertion;
+ *          rehashing and copying buckets only move the views.
+ *
+ * ## Memory Layout:
+ *
+ * ```
+ * ArenaHashMap Internal Structure:
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  m_map  HashMap<std::string_view, TValue>                   │
+ * │ ┌─────────────────────────────────────────────────────────┐ │
+ * │ │ [0] │ {ptr,len} │ Value │ Hash │ Dist │ Occupied │      │ │
+ * │ │ [1] │ {ptr,len} │ Value │ Hash │ Dist │ Occupied │      │ │
+ * │ │ ... │    │      │  ...  │ ...  │ ...  │   ...    │      │ │
+ * │ └──────────┼──────────────────────────────────────────────┘ │
+ * │            ↓                                                │
+ * │  m_keys  StringArena                                        │
+ * │ ┌─────────────────────────────────────────────────────────┐ │
+ * │ │ /srv/a/b.txt│/srv/a/c.txt│/srv/d/e.bin│...              │ │ ← Packed key bytes
+ * │ └─────────────────────────────────────────────────────────┘ │
+ * └─────────────────────────────────────────────────────────────┘
+ * ```
+ *
+ * Per key (40-byte keys, std::string vs arena):
+ *   HashMap<std::string, int>  : 48-byte bucket + 56-byte malloc'd key block
+ *   ArenaHashMap<int>          : 32-byte bucket + 40 packed arena bytes
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#include "nfx/core/Hashing.h"
+#include "functors/HashMapHashFunctor.h"
+#include "HashMap.h"
+#include "StringArena.h"
+
+#include "nfx/config.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// ArenaHashMap class
+	//=====================================================================
+
+	/**
+	 * @brief Hash map with string keys stored contiguously in a container-owned arena
+	 * @details Wraps HashMap<std::string_view, TValue> and a StringArena. Lookups take a
+	 *          std::string_view and never allocate. Erasing a key removes its bucket but
+	 *          leaves its bytes in the arena until compact() rebuilds the map, which suits
+	 *          build-once, read-many catalogs (paths, symbols, identifiers).
+	 *
+	 * @tparam TValue Value type
+	 * @tparam FnvOffsetBasis FNV-1a offset basis constant (default: 0x811C9DC5)
+	 * @tparam FnvPrime FNV-1a prime constant (default: 0x01000193)
+	 * @tparam Layout Bucket storage layout (default: HashMapLayout::Interleaved)
+	 *
+	 * Features:
+	 * - One allocation per arena block instead of one per key longer than the SSO buffer
+	 * - Smaller buckets: faster iteration and rehashing, better cache utilization
+	 * - Zero-copy string_view lookups
+	 * - Copies are compacted: only live keys are copied into the new arena
+	 */
+	template <typename TValue,
+		uint32_t FnvOffsetBasis = core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS,
+		uint32_t FnvPrime = core::hashing::constants::DEFAULT_FNV_PRIME,
+		HashMapLayout Layout = HashMapLayout::Interleaved>
+	class ArenaHashMap final
+	{
+	public:
+		//----------------------------------------------
+		// STL-compatible type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type (views into the arena) */
+		using key_type = std::string_view;
+
+		/** @brief Type alias for mapped value type */
+		using mapped_type = TValue;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		/** @brief Type alias for the underlying bucket map */
+		using map_type = HashMap<std::string_view, TValue, FnvOffsetBasis, FnvPrime, Layout>;
+
+		/** @brief Type alias for mutable iterator over (key, value) pairs */
+		using iterator = decltype( std::declval<map_type&>().begin() );
+
+		/** @brief Type alias for const iterator over (key, value) pairs */
+		using const_iterator = decltype( std::declval<const map_type&>().begin() );
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor with default bucket capacity and arena block size
+		 */
+		NFX_META_INLINE ArenaHashMap();
+
+		/**
+		 * @brief Constructor with specified initial capacity
+		 * @param initialCapacity Initial bucket capacity (rounded up to power of 2)
+		 * @param arenaBlockSize Size of each key storage block in bytes
+		 */
+		NFX_META_INLINE explicit ArenaHashMap( size_t initialCapacity, size_t arenaBlockSize = StringArena::DEFAULT_BLOCK_SIZE );
+
+		/**
+		 * @brief Copy constructor
+		 * @details Copies only the keys still present into a fresh arena
+		 */
+		NFX_META_INLINE ArenaHashMap( const ArenaHashMap& other );
+
+		/** @brief Move constructor, key views stay valid as the arena blocks move with them */
+		ArenaHashMap( ArenaHashMap&& ) noexcept = default;
+
+		/** @brief Copy assignment */
+		NFX_META_INLINE ArenaHashMap& operator=( const ArenaHashMap& other );
+
+		/** @brief Move assignment */
+		ArenaHashMap& operator=( ArenaHashMap&& ) noexcept = default;
+
+		/** @brief Destructor */
+		~ArenaHashMap() = default;
+
+		//----------------------------------------------
+		// Core operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Fast lookup with string_view key
+		 * @param key The key to search for
+		 * @param outValue Pointer to the found value (nullptr if not found)
+		 * @return true if the key was found, false otherwise
+		 */
+		NFX_META_INLINE bool tryGetValue( std::string_view key, TValue*& outValue ) noexcept;
+
+		/**
+		 * @brief Fast const lookup with string_view key
+		 * @param key The key to search for
+		 * @param outValue Pointer to the found value (nullptr if not found)
+		 * @return true if the key was found, false otherwise
+		 */
+		NFX_META_INLINE bool tryGetValue( std::string_view key, const TValue*& outValue ) const noexcept;
+
+		/**
+		 * @brief Batched lookup with software prefetching
+		 * @param keys Keys to search for
+		 * @param outValues Receives a pointer to each key's value, or nullptr if absent
+		 * @return Number of keys found
+		 * @details See HashMap::tryGetValues()
+		 */
+		NFX_META_INLINE size_t tryGetValues( std::span<const std::string_view> keys, std::span<TValue*> outValues ) noexcept;
+
+		/**
+		 * @brief Check whether a key is present
+		 * @param key The key to search for
+		 * @return true if the key was found, false otherwise
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool contains( std::string_view key ) const noexcept;
+
+		//----------------------------------------------
+		// Insertion
+		//----------------------------------------------
+
+		/**
+		 * @brief Insert or update a key-value pair
+		 * @tparam ValueType Deduced value type supporting move/copy semantics
+		 * @param key The key to insert or update, copied into the arena only if new
+		 * @param value The value to associate with the key
+		 */
+		template <typename ValueType>
+			requires std::is_assignable_v<TValue&, ValueType&&> && std::is_constructible_v<TValue, ValueType&&>
+		NFX_META_INLINE void insertOrAssign( std::string_view key, ValueType&& value );
+
+		/**
+		 * @brief Insert a value constructed in place if the key is absent
+		 * @param key The key to look up or insert, copied into the arena only if new
+		 * @param args Arguments forwarded to the TValue constructor on insertion only
+		 * @return Pointer to the value and true if a new element was inserted
+		 * @details Probes once before copying the key so existing keys never consume
+		 *          arena space, then inserts with the same precomputed hash
+		 */
+		template <typename... Args>
+		NFX_META_INLINE std::pair<TValue*, bool> tryEmplace( std::string_view key, Args&&... args );
+
+		//----------------------------------------------
+		// Capacity and memory management
+		//----------------------------------------------
+
+		/**
+		 * @brief Reserve bucket capacity for at least the specified number of elements
+		 * @param minCapacity Minimum capacity to reserve
+		 */
+		NFX_META_INLINE void reserve( size_t minCapacity );
+
+		/**
+		 * @brief Remove a key-value pair from the map
+		 * @param key The key to remove
+		 * @return true if the key was found and removed, false otherwise
+		 * @details The key's bytes stay in the arena until compact() or clear()
+		 */
+		NFX_META_INLINE bool erase( std::string_view key ) noexcept;
+
+		/**
+		 * @brief Remove every element and release the arena
+		 */
+		NFX_META_INLINE void clear();
+
+		/**
+		 * @brief Rebuild the arena with only the keys still present
+		 * @details Reclaims the bytes of erased keys; invalidates every iterator and key view
+		 */
+		NFX_META_INLINE void compact();
+
+		//----------------------------------------------
+		// State inspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of elements in the map
+		 * @return Number of key-value pairs currently stored
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t size() const noexcept;
+
+		/**
+		 * @brief Get the current bucket capacity
+		 * @return Number of buckets allocated
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t capacity() const noexcept;
+
+		/**
+		 * @brief Check if the map is empty
+		 * @return true if the map contains no elements, false otherwise
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Get the key storage arena
+		 * @return Arena holding the bytes of every key inserted since the last compaction
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE const StringArena& keyArena() const noexcept;
+
+		//----------------------------------------------
+		// Iteration
+		//----------------------------------------------
+
+		/**
+		 * @brief Get iterator to first element
+		 * @return Iterator over (std::string_view key, TValue) pairs
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE iterator begin() noexcept;
+
+		/**
+		 * @brief Get const iterator to first element
+		 * @return Const iterator over (std::string_view key, TValue) pairs
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE const_iterator begin() const noexcept;
+
+		/**
+		 * @brief Get iterator to end
+		 * @return Iterator past the last element
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE iterator end() noexcept;
+
+		/**
+		 * @brief Get const iterator to end
+		 * @return Const iterator past the last element
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE const_iterator end() const noexcept;
+
+		//----------------------------------------------
+		// Comparison
+		//----------------------------------------------
+
+		/**
+		 * @brief Compare two ArenaHashMaps for equality
+		 * @param other The other ArenaHashMap to compare with
+		 * @return true if both maps contain the same key-value pairs (arena layout is ignored)
+		 */
+		[[nodiscard]] NFX_META_INLINE bool operator==( const ArenaHashMap& other ) const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Private member variables
+		//----------------------------------------------
+
+		StringArena m_keys; ///< Owns the bytes every bucket key points into
+		map_type m_map;		///< Buckets keyed by views into m_keys
+
+		/**
+		 * @brief Hash function object with zero-space optimization
+		 * @details Same functor as m_map, so the hash computed here can be handed to it
+		 */
+		NFX_META_NO_UNIQUE_ADDRESS typename map_type::hasher m_hasher;
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/ArenaHashMap.inl"
@@ -36,25 +36,27 @@
  * │                      ChdHashMap<TValue>                     │
  * ├─────────────────────────────────────────────────────────────┤
  * │ ┌─────────────────────────────────────────────────────────┐ │
- * │ │                       m_table                           │ │ ← Primary storage
- * │ │                std::vector<std::pair>                   │ │
+ * │ │                       m_table                           │ │ ← Dense entries
+ * │ │        std::vector<std::pair>, n items, input order     │ │
  * │ │ ┌─────────────────────────────────────────────────────┐ │ │
  * │ │ │           [0] │ "key1"     │ value1     │           │ │ │ ← Key-value pairs
  * │ │ │           [1] │ "key2"     │ value2     │           │ │ │
- * │ │ │           [2] │ "key3"     │ value3     │           │ │ │
  * │ │ │           ... │ ...        │ ...        │           │ │ │
- * │ │ │           [n] │ "keyN"     │ valueN     │           │ │ │
+ * │ │ │         [n-1] │ "keyN"     │ valueN     │           │ │ │
+ * │ │ └─────────────────────────────────────────────────────┘ │ │
+ * │ └─────────────────────────────────────────────────────────┘ │
+ * │ ┌─────────────────────────────────────────────────────────┐ │
+ * │ │                       m_slots                           │ │ ← Slot → entry
+ * │ │   std::vector<{entry, key hash}>, 2n rounded to 2^k     │ │
+ * │ │ ┌─────────────────────────────────────────────────────┐ │ │
+ * │ │ │  [0] │ 1, h1   [1] │ EMPTY   [2] │ 0, h0  ...       │ │ │
  * │ │ └─────────────────────────────────────────────────────┘ │ │
  * │ └─────────────────────────────────────────────────────────┘ │
  * │ ┌─────────────────────────────────────────────────────────┐ │
  * │ │                      m_seeds                            │ │ ← CHD seeds
- * │ │                  std::vector<int>                       │ │
+ * │ │         std::vector<uint16_t>, one per bucket           │ │
  * │ │ ┌─────────────────────────────────────────────────────┐ │ │
- * │ │ │           [0] │ seed_0  │ ← Maps to table[0]        │ │ │
- * │ │ │           [1] │ seed_1  │ ← Maps to table[1]        │ │ │
- * │ │ │           [2] │ seed_2  │ ← Maps to table[2]        │ │ │
- * │ │ │           ... │ ...     │                           │ │ │
- * │ │ │           [n] │ seed_n  │ ← Maps to table[n]        │ │ │
+ * │ │ │    [0] │ seed_0  [1] │ 0 (no keys)  ...             │ │ │
  * │ │ └─────────────────────────────────────────────────────┘ │ │
  * │ └─────────────────────────────────────────────────────────┘ │
  * └─────────────────────────────────────────────────────────────┘
@@ -70,9 +72,11 @@
  * │                            ↓                                │
  * │  2. Index Mapping: idx = hash & (size - 1)                  │
  * │                            ↓                                │
- * │  3. Seed Mixing: final = seedMix(seeds[idx], hash, size)    │
+ * │  3. Seed Mixing: slot = seedMix(seeds[idx], hash, size)     │
  * │                            ↓                                │
- * │  4. Direct Access: return table[final]                      │
+ * │  4. Early Reject: slots[slot].fingerprint != hash → miss    │
+ * │                            ↓                                │
+ * │  5. Direct Access: compare key of table[slots[slot].entry]  │
  * │                            ↓                                │
  * │  Result: O(1) guaranteed lookup with zero collisions        │
  * └─────────────────────────────────────────────────────────────┘
@@ -87,13 +91,17 @@
  * ├─────────────────────────────────────────────────────────────┤
  * │  Input: vector<pair<string, TValue>>                        │
  * │                            ↓                                │
- * │  1. Hash all keys with CRC32 || FNV-1a                      │
- * │  2. Group keys by hash collision buckets                    │
- * │  3. For each bucket with collisions:                        │
+ * │  1. Hash all keys with CRC32 || FNV-1a (parallel chunks)    │
+ * │  2. Group keys by bucket: counting sort into one flat array │
+ * │  3. Order buckets by size, largest first                    │
+ * │  4. For each bucket with collisions:                        │
  * │     - Search for seed value (up to MAX_SEED_SEARCH × size)  │
  * │     - Seed creates collision-free sub-mapping               │
- * │  4. Store seeds aligned with final table positions          │
- * │  5. Verify: All keys map to unique table positions          │
+ * │     - Occupied slots tracked in a bitset                    │
+ * │     - Batches searched speculatively on worker threads,     │
+ * │       committed in bucket order                             │
+ * │  5. Same search for single-key buckets (usually 1-2 seeds)  │
+ * │  6. Keep the input vector as the dense entry array          │
  * │                            ↓                                │
  * │  Result: Perfect hash function with zero collisions         │
  * └─────────────────────────────────────────────────────────────┘
@@ -105,13 +113,20 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include "nfx/config.h"
+#include "nfx/containers/ChdHashMapImage.h"
 #include "nfx/core/Hashing.h"
 
 namespace nfx::containers
@@ -136,14 +151,44 @@ namespace nfx::containers
 	 * @tparam TValue The type of values stored in the dictionary.
 	 * @tparam FnvOffsetBasis FNV-1a offset basis constant for hash calculation (default: 0x811C9DC5)
 	 * @tparam FnvPrime FNV-1a prime constant for hash calculation (default: 0x01000193)
+	 * @tparam Allocator Allocator for the key-value table, also rebound for key characters and seeds.
+	 *         With std::pmr::polymorphic_allocator keys become std::pmr::string (see pmr::ChdHashMap).
 	 *
 	 * @see https://en.wikipedia.org/wiki/Perfect_hash_function#CHD_algorithm
 	 */
 	template <typename TValue,
-		uint32_t FnvOffsetBasis = core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS>
+		uint32_t FnvOffsetBasis = core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS,
+		typename Allocator = std::allocator<std::pair<std::string, TValue>>>
 	class ChdHashMap final
 	{
+		/** @brief Allocator rebound to an internal storage element type */
+		template <typename T>
+		using RebindAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
 	public:
+		//----------------------------------------------
+		// Type aliases
+		//----------------------------------------------
+
+		/** @brief Allocator type */
+		using allocator_type = Allocator;
+
+		/** @brief Key string type, allocated with the map's allocator (std::string by default) */
+		using key_type = std::basic_string<char, std::char_traits<char>, RebindAllocator<char>>;
+
+		/** @brief Stored key-value pair type */
+		using value_type = std::pair<key_type, TValue>;
+
+		/** @brief Key-value table type, also accepted by the constructor */
+		using container_type = std::vector<value_type, RebindAllocator<value_type>>;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Smallest input the constructor builds on several threads when buildThreads is 0 */
+		static constexpr size_t PARALLEL_BUILD_THRESHOLD = size_t{ 1 } << 16;
+
 		//----------------------------------------------
 		// Forward declarations
 		//----------------------------------------------
@@ -158,9 +203,19 @@ namespace nfx::containers
 		/**
 		 * @brief Constructs the dictionary from a vector of key-value pairs.
 		 * @param[in] items A vector of key-value pairs. The keys must be unique.
+		 *            The table and seeds are allocated with items' allocator.
 		 * @param[in] maxSeedSearchMultiplier Maximum multiplier for seed search iterations in CHD construction (default: 100).
+		 *            Seeds are 16-bit, so the search never goes past 65535 whatever the multiplier.
+		 * @param[in] buildThreads Threads used for hashing and seed search. 0 (default) uses every hardware
+		 *            thread for inputs of at least PARALLEL_BUILD_THRESHOLD keys and one thread below that.
+		 *            The resulting layout does not depend on the thread count.
 		 * @throws std::invalid_argument if duplicate keys are found.
+		 * @throws std::length_error if items holds 2^32 - 1 entries or more.
 		 * @throws std::runtime_error if perfect hash construction fails.
+		 * @details Worker threads search seeds for a batch of collision buckets against the occupancy
+		 *          at the start of the batch. Seeds are then committed in bucket order; a seed invalidated
+		 *          by an earlier bucket of the same batch is searched again from where the worker stopped,
+		 *          so every bucket gets the same seed as in a single-threaded build.
 		 *
 		 * @todo Consider implementing auto-adaptive seed search multiplier:
 		 *       - Progressive approach: try multipliers [50, 100, 200, 500, 1000] until success
@@ -168,7 +223,7 @@ namespace nfx::containers
 		 *       - Would improve UX by eliminating need for manual tuning in edge cases
 		 *       - Could add overload: ChdHashMap(items) for auto-adaptive, ChdHashMap(items, multiplier) for explicit control
 		 */
-		inline explicit ChdHashMap( std::vector<std::pair<std::string, TValue>>&& items, uint32_t maxSeedSearchMultiplier = 100 );
+		inline explicit ChdHashMap( container_type&& items, uint32_t maxSeedSearchMultiplier = 100, size_t buildThreads = 0 );
 
 		/**
 		 * @brief Default constructor - creates an empty ChdHashMap
@@ -282,6 +337,13 @@ namespace nfx::containers
 		 */
 		[[nodiscard]] inline uint32_t maxSeedSearchMultiplier() const noexcept;
 
+		/**
+		 * @brief Returns a copy of the allocator used for the table and seeds.
+		 * @return The allocator taken from the items vector at construction.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline allocator_type allocator() const noexcept;
+
 		//----------------------------------------------
 		// State inspection methods
 		//----------------------------------------------
@@ -302,6 +364,8 @@ namespace nfx::containers
 		 * @details Performs a lookup using the perfect hash function. If the key is found, the output
 		 *          parameter `outValue` is updated to point to the associated value within the dictionary's
 		 *          internal storage, allowing in-place modification of the retrieved value.
+		 *          A missing key is almost always rejected by the key hash stored in its slot, without
+		 *          reading the entry; only a matching hash leads to a key comparison.
 		 * @param[in] key The key whose associated value is to be retrieved.
 		 * @param[out] outValue A reference to a mutable pointer to TValue. On success, this pointer will be
 		 *                      set to the address of the found value, enabling direct modification. On failure, it will be set to `nullptr`.
@@ -310,6 +374,21 @@ namespace nfx::containers
 		 */
 		[[nodiscard]] NFX_META_INLINE bool tryGetValue( std::string_view key, TValue*& outValue ) noexcept;
 
+		/**
+		 * @brief Batched lookup overlapping cache misses across keys.
+		 * @details Keys are processed in blocks of BATCH_LOOKUP_SIZE in four passes: hash every key and
+		 *          prefetch its `m_seeds` entry, resolve every slot and prefetch its `m_slots` entry,
+		 *          prefetch every candidate entry whose slot holds the key's hash, then compare keys. Memory latency is thus paid roughly
+		 *          once per block instead of three times per key. Only min(keys.size(), outValues.size())
+		 *          keys are processed.
+		 * @tparam KeyType Element type of the key span (anything convertible to std::string_view).
+		 * @param[in] keys The keys whose associated values are to be retrieved.
+		 * @param[out] outValues Receives a pointer to each key's value, or `nullptr` if absent (same index as keys).
+		 * @return The number of keys found.
+		 */
+		template <typename KeyType = std::string_view>
+		NFX_META_INLINE size_t tryGetValues( std::span<const std::type_identity_t<KeyType>> keys, std::span<TValue*> outValues ) noexcept;
+
 		//----------------------------------------------
 		// Iteration
 		//----------------------------------------------
@@ -342,6 +421,23 @@ namespace nfx::containers
 		 */
 		[[nodiscard]] inline Enumerator enumerator() const noexcept;
 
+		//----------------------------------------------
+		// Persistence
+		//----------------------------------------------
+
+		/**
+		 * @brief Saves the built map as a binary image that ChdHashMapImage maps back without rebuilding.
+		 * @details Seeds, slot index, key bytes and values are written as lookups read them, with a versioned
+		 *          header and a checksum (see ChdHashMapImage.h for the layout). The file is written under a
+		 *          temporary name and renamed over `path`, so processes mapping the previous image are unaffected.
+		 *          Values are stored as raw bytes and must not hold pointers.
+		 * @param[in] path Destination file, replaced if it exists.
+		 * @throws std::runtime_error if the file cannot be written.
+		 * @throws std::filesystem::filesystem_error if the temporary file cannot be renamed to `path`.
+		 */
+		inline void saveImage( const std::filesystem::path& path ) const
+			requires std::is_trivially_copyable_v<TValue>;
+
 		//---------------------------
 		// Hashing
 		//---------------------------
@@ -447,7 +543,7 @@ namespace nfx::containers
 			using iterator_category = std::forward_iterator_tag;
 
 			/** @brief STL value type - the type of object pointed to by the iterator */
-			using value_type = std::pair<std::string, TValue>;
+			using value_type = ChdHashMap::value_type;
 
 			/** @brief STL difference type - the type for representing iterator distances */
 			using difference_type = std::ptrdiff_t;
@@ -468,7 +564,7 @@ namespace nfx::containers
 			 * @param[in] index The index within the table this iterator should point to.
 			 * @note If index >= table->size(), the iterator represents an end iterator.
 			 */
-			inline explicit Iterator( const std::vector<std::pair<std::string, TValue>>* table, size_t index ) noexcept;
+			inline explicit Iterator( const container_type* table, size_t index ) noexcept;
 
 			/** @brief Default constructor */
 			Iterator() = default;
@@ -510,17 +606,17 @@ namespace nfx::containers
 
 			/**
 			 * @brief Dereferences the iterator to access the current key-value pair.
-			 * @return A constant reference to the `std::pair<std::string, TValue>` at the current position.
+			 * @return A constant reference to the `value_type` at the current position.
 			 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 			 */
-			[[nodiscard]] inline const std::pair<std::string, TValue>& operator*() const;
+			[[nodiscard]] inline const value_type& operator*() const;
 
 			/**
 			 * @brief Provides member access to the current key-value pair.
-			 * @return A constant pointer to the `std::pair<std::string, TValue>` at the current position.
+			 * @return A constant pointer to the `value_type` at the current position.
 			 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 			 */
-			[[nodiscard]] inline const std::pair<std::string, TValue>* operator->() const;
+			[[nodiscard]] inline const value_type* operator->() const;
 
 			/**
 			 * @brief Advances the iterator to the next element (pre-increment).
@@ -562,7 +658,7 @@ namespace nfx::containers
 			//---------------------------
 
 			/** @brief Pointer to the dictionary's internal data table. Null for default-constructed iterators. */
-			const std::vector<std::pair<std::string, TValue>>* m_table = nullptr;
+			const container_type* m_table = nullptr;
 
 			/** @brief Current index within the `m_table`. */
 			size_t m_index = 0;
@@ -612,7 +708,7 @@ namespace nfx::containers
 			 * @brief Constructs an enumerator for the given dictionary table.
 			 * @param table Pointer to the dictionary's internal storage vector.
 			 */
-			explicit Enumerator( const std::vector<std::pair<std::string, TValue>>* table ) noexcept;
+			explicit Enumerator( const container_type* table ) noexcept;
 
 			/** @brief Default constructor */
 			Enumerator() = delete;
@@ -665,11 +761,11 @@ namespace nfx::containers
 			 * @details Returns the element that the enumerator is currently positioned on.
 			 *          The enumerator must be positioned on a valid element by calling `next()`
 			 *          and ensuring it returned `true`.
-			 * @return A constant reference to the current `std::pair<std::string, TValue>`.
+			 * @return A constant reference to the current `value_type`.
 			 * @throws InvalidOperationException if the enumerator is not positioned on a valid element.
 			 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 			 */
-			[[nodiscard]] inline const std::pair<std::string, TValue>& current() const;
+			[[nodiscard]] inline const value_type& current() const;
 
 			/** @brief Resets the enumerator to its initial position. */
 			inline void reset() noexcept;
@@ -680,7 +776,7 @@ namespace nfx::containers
 			//----------------------------
 
 			/** @brief Pointer to the dictionary's internal data table. */
-			const std::vector<std::pair<std::string, TValue>>* m_table = nullptr;
+			const container_type* m_table = nullptr;
 
 			/** @brief Current index within the table.*/
 			size_t m_index;
@@ -728,6 +824,53 @@ namespace nfx::containers
 			[[noreturn]] inline static void throwInvalidOperationException();
 		};
 
+		//----------------------------------------------
+		// Private constants
+		//----------------------------------------------
+
+		/** @brief Number of keys hashed and prefetched ahead of comparison in tryGetValues(). */
+		static constexpr size_t BATCH_LOOKUP_SIZE = 16;
+
+		/** @brief Buckets handed to each thread per speculative seed search batch. */
+		static constexpr size_t SEED_SEARCH_BATCH_PER_THREAD = 4096;
+
+		/** @brief `ChdSlot::entry` of a slot without an entry. */
+		static constexpr uint32_t EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+
+		//----------------------------------------------
+		// Private type aliases
+		//----------------------------------------------
+
+		/** @brief Per-bucket displacement seed; 0 marks a bucket without keys. */
+		using seed_type = uint16_t;
+
+		/** @brief Largest seed a bucket can be assigned. */
+		static constexpr uint64_t MAX_SEED = std::numeric_limits<seed_type>::max();
+
+		//----------------------------------------------
+		// Private lookup helpers
+		//----------------------------------------------
+
+		/**
+		 * @brief Resolve a key to its entry
+		 * @param[in] key Key to look up in a non-empty map
+		 * @return Index into `m_table`, or EMPTY_SLOT if the key is absent
+		 */
+		[[nodiscard]] NFX_META_INLINE uint32_t entryIndex( std::string_view key ) const noexcept;
+
+		//----------------------------------------------
+		// Private construction helpers
+		//----------------------------------------------
+
+		/**
+		 * @brief Run a function on threadCount threads, the calling thread included
+		 * @param[in] threadCount Number of invocations; each receives its index in [0, threadCount)
+		 * @param[in] function Callable taking the thread index
+		 * @details Indices whose thread cannot be started run on the calling thread instead.
+		 */
+		template <typename Function>
+		static void runOnThreads( size_t threadCount, const Function& function );
+
 		//----------------------------------------------
 		// Private member variables
 		//----------------------------------------------
@@ -735,12 +878,34 @@ namespace nfx::containers
 		/** @brief Maximum multiplier for seed search iterations in CHD construction. */
 		uint32_t m_maxSeedSearchMultiplier;
 
-		/** @brief The primary storage table containing the key-value pairs. Order determined during construction. */
-		std::vector<std::pair<std::string, TValue>> m_table;
+		/** @brief The key-value pairs, dense and in the order they were passed to the constructor. */
+		container_type m_table;
+
+		/**
+		 * @brief Index into `m_table` of the entry in each slot (or EMPTY_SLOT) and the hash of its key.
+		 *        Twice as many slots as entries, rounded to a power of 2.
+		 */
+		std::vector<detail::ChdSlot, RebindAllocator<detail::ChdSlot>> m_slots;
 
-		/** @brief The seed values used by the CHD perfect hash function to resolve hash collisions. Size matches `m_table`. */
-		std::vector<int> m_seeds;
+		/** @brief The seed values used by the CHD perfect hash function to resolve hash collisions, one per bucket. Size matches `m_slots`. */
+		std::vector<seed_type, RebindAllocator<seed_type>> m_seeds;
 	};
+
+	//=====================================================================
+	// Polymorphic allocator aliases
+	//=====================================================================
+
+	namespace pmr
+	{
+		/**
+		 * @brief ChdHashMap whose table, seeds and std::pmr::string keys share one memory resource
+		 * @details The resource is taken from the container_type passed to the constructor.
+		 */
+		template <typename TValue,
+			uint32_t FnvOffsetBasis = core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS>
+		using ChdHashMap = containers::ChdHashMap<TValue, FnvOffsetBasis,
+			std::pmr::polymorphic_allocator<std::pair<std::pmr::string, TValue>>>;
+	} // namespace pmr
 } // namespace nfx::containers
 
 #include "nfx/detail/containers/ChdHashMap.inl"
@@ -0,0 +1,573 @@
+/**
+ * @file ChdHashMapImage.h
+ * @brief Read-only, memory-mapped view of a ChdHashMap saved with ChdHashMap::saveImage()
+ * @details A built ChdHashMap is written once as a binary image: seeds, slot index, values and
+ *          key bytes laid out exactly as lookups read them. Opening the image maps the file and
+ *          checks its header; there is nothing to parse, hash or allocate per key, and every
+ *          process mapping the same file shares its pages through the page cache.
+ *
+ * ## Image File Layout (format version 2):
+ *
+ * ```
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │ Header (ChdImageHeader, padded to 128 bytes)                │
+ * │   magic "NFXCHDIM" │ version │ byte order │ hash probes     │
+ * │   value size/align │ entry, slot, key byte counts           │
+ * │   file size        │ checksum of everything below           │
+ * ├─────────────────────────────────────────────────────────────┤
+ * │ seeds       uint16_t[slotCount]       │ ← Same as m_seeds   │
+ * ├─────────────────────────────────────────────────────────────┤
+ * │ slots       ChdSlot[slotCount]        │ ← Same as m_slots:  │
+ * │                                       │   entry, key hash   │
+ * ├─────────────────────────────────────────────────────────────┤
+ * │ keyOffsets  uint64_t[entryCount + 1]  │ ← Key i spans       │
+ * │                                       │   [off[i], off[i+1])│
+ * ├─────────────────────────────────────────────────────────────┤
+ * │ values      TValue[entryCount]        │ ← Raw object bytes  │
+ * ├─────────────────────────────────────────────────────────────┤
+ * │ keys        char[keyBytes]            │ ← Concatenated keys │
+ * └─────────────────────────────────────────────────────────────┘
+ *   Every section starts on a 64-byte boundary; the file is padded to one.
+ * ```
+ *
+ * Integers are stored in the byte order of the writer and values as their object
+ * representation, so an image is only readable on a platform with the same byte order,
+ * hash function and TValue layout. The header records enough to reject any other.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "nfx/config.h"
+#include "nfx/core/Hashing.h"
+
+namespace nfx::containers
+{
+	namespace detail
+	{
+		//=====================================================================
+		// ChdHashMap image format
+		//=====================================================================
+
+		/** @brief First eight bytes of every image, "NFXCHDIM" */
+		inline constexpr uint64_t CHD_IMAGE_MAGIC = 0x4D4944484358464EULL;
+
+		/** @brief Current image format version; 2 added the key hash to every slot */
+		inline constexpr uint32_t CHD_IMAGE_VERSION = 2;
+
+		/** @brief Written as a native integer; reads back differently on a machine of the other byte order */
+		inline constexpr uint32_t CHD_IMAGE_BYTE_ORDER = 0x01020304;
+
+		/** @brief Alignment of every section and of the file size */
+		inline constexpr uint64_t CHD_IMAGE_SECTION_ALIGNMENT = 64;
+
+		/** @brief Key hashed into the header so images built with another hash function are rejected */
+		inline constexpr std::string_view CHD_IMAGE_HASH_PROBE_KEY = "nfx::containers::ChdHashMapImage";
+
+		/**
+		 * @brief Fixed-size image header, stored at offset 0
+		 * @details Section offsets are not stored: they follow from the counts (see chdImageLayout()).
+		 */
+		struct ChdImageHeader
+		{
+			/** @brief CHD_IMAGE_MAGIC */
+			uint64_t magic;
+
+			/** @brief CHD_IMAGE_VERSION of the writer */
+			uint32_t version;
+
+			/** @brief CHD_IMAGE_BYTE_ORDER as seen by the writer */
+			uint32_t byteOrder;
+
+			/** @brief Key hash of CHD_IMAGE_HASH_PROBE_KEY */
+			uint32_t hashProbe;
+
+			/** @brief seedMix() of the key hash probe, which fixes the slot function as well */
+			uint32_t seedMixProbe;
+
+			/** @brief sizeof( TValue ) */
+			uint32_t valueSize;
+
+			/** @brief alignof( TValue ) */
+			uint32_t valueAlignment;
+
+			/** @brief Number of key-value pairs */
+			uint64_t entryCount;
+
+			/** @brief Number of slots and seeds, a power of 2 (0 for an empty map) */
+			uint64_t slotCount;
+
+			/** @brief Total length of all keys */
+			uint64_t keyBytes;
+
+			/** @brief Size of the whole file */
+			uint64_t fileSize;
+
+			/** @brief chdImageChecksum() of the bytes from the first section to the end of the file */
+			uint64_t checksum;
+		};
+
+		static_assert( std::is_trivially_copyable_v<ChdImageHeader> && sizeof( ChdImageHeader ) <= CHD_IMAGE_SECTION_ALIGNMENT * 2 );
+
+		/**
+		 * @brief One slot of the CHD table, as held by ChdHashMap and stored in images
+		 * @details The key hash lets a lookup reject a different key landing on the slot
+		 *          without reading the entry.
+		 */
+		struct ChdSlot
+		{
+			/** @brief Index of the entry in this slot, UINT32_MAX for an empty slot */
+			uint32_t entry;
+
+			/** @brief Full 32-bit hash of the entry's key, 0 for an empty slot */
+			uint32_t fingerprint;
+		};
+
+		static_assert( std::is_trivially_copyable_v<ChdSlot> && sizeof( ChdSlot ) == 2 * sizeof( uint32_t ) );
+
+		/** @brief Byte offsets of the sections of an image */
+		struct ChdImageLayout
+		{
+			/** @brief Offset of the seeds section */
+			uint64_t seedsOffset;
+
+			/** @brief Offset of the slots section */
+			uint64_t slotsOffset;
+
+			/** @brief Offset of the key offsets section */
+			uint64_t keyOffsetsOffset;
+
+			/** @brief Offset of the values section */
+			uint64_t valuesOffset;
+
+			/** @brief Offset of the key bytes section */
+			uint64_t keysOffset;
+
+			/** @brief Total file size */
+			uint64_t fileSize;
+		};
+
+		/**
+		 * @brief Compute where each section of an image lives
+		 * @param entryCount Number of key-value pairs
+		 * @param slotCount Number of slots and seeds
+		 * @param keyBytes Total length of all keys
+		 * @param valueSize sizeof( TValue )
+		 * @return Section offsets and file size
+		 */
+		[[nodiscard]] NFX_META_INLINE constexpr ChdImageLayout chdImageLayout(
+			uint64_t entryCount, uint64_t slotCount, uint64_t keyBytes, uint64_t valueSize ) noexcept;
+
+		/**
+		 * @brief Hash probes identifying the key hash and slot functions in use
+		 * @return { hash of CHD_IMAGE_HASH_PROBE_KEY, seedMix() of that hash }
+		 */
+		template <uint32_t FnvOffsetBasis>
+		[[nodiscard]] NFX_META_INLINE std::pair<uint32_t, uint32_t> chdImageHashProbes() noexcept;
+
+		/**
+		 * @brief Checksum of an image body
+		 * @details Four independent multiply-xorshift lanes over 8-byte words, so a large image is
+		 *          verified at memory bandwidth. Detects corruption and truncation; not a cryptographic hash.
+		 * @param bytes Bytes to checksum
+		 * @return 64-bit checksum
+		 */
+		[[nodiscard]] NFX_META_INLINE uint64_t chdImageChecksum( std::span<const std::byte> bytes ) noexcept;
+
+		/**
+		 * @brief Unique sibling of path to write an image under before renaming it
+		 * @param path Destination file
+		 * @return path followed by a random 64-bit hex suffix and ".tmp"
+		 */
+		[[nodiscard]] inline std::filesystem::path chdImageTemporaryPath( const std::filesystem::path& path );
+
+		/**
+		 * @brief Write an image next to path, then rename it over path
+		 * @details Processes still mapping the previous file keep their view of it; new opens see the new one.
+		 *          Each call writes its own temporary file, so concurrent saves to one path do not interleave.
+		 * @param path Destination file
+		 * @param image Complete image bytes
+		 * @throws std::runtime_error if the temporary file cannot be written
+		 * @throws std::filesystem::filesystem_error if the rename fails
+		 */
+		inline void writeChdImageFile( const std::filesystem::path& path, std::span<const std::byte> image );
+
+		/**
+		 * @brief Map a file read-only, shared with every other process mapping it
+		 * @details Falls back to reading the file into a 64-byte aligned heap buffer where mmap is unavailable.
+		 * @param path File to map
+		 * @param[out] bytes Size of the file
+		 * @return Start of the mapping, nullptr for an empty file
+		 * @throws std::system_error if the file cannot be opened or mapped
+		 */
+		[[nodiscard]] inline const std::byte* mapChdImageFile( const std::filesystem::path& path, size_t& bytes );
+
+		/**
+		 * @brief Release a mapping returned by mapChdImageFile()
+		 * @param address Start of the mapping
+		 * @param bytes Size returned by mapChdImageFile()
+		 */
+		inline void unmapChdImageFile( const std::byte* address, size_t bytes ) noexcept;
+	} // namespace detail
+
+	//=====================================================================
+	// ChdHashMapImage class
+	//=====================================================================
+
+	/**
+	 * @class ChdHashMapImage
+	 * @brief Read-only perfect hash map backed by an image file written by ChdHashMap::saveImage()
+	 * @details Keys are std::string_view and values const references into the mapping, valid as long
+	 *          as the image is alive. Lookups take the same path as ChdHashMap: one seed, one slot, one
+	 *          key comparison. Entries iterate in the order they were passed to the ChdHashMap.
+	 *
+	 *          TValue must be trivially copyable and must not hold pointers: its bytes are stored as is.
+	 *
+	 * @tparam TValue Value type, identical to the one of the saved ChdHashMap
+	 * @tparam FnvOffsetBasis FNV-1a offset basis of the saved ChdHashMap
+	 */
+	template <typename TValue,
+		uint32_t FnvOffsetBasis = core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS>
+	class ChdHashMapImage final
+	{
+		static_assert( std::is_trivially_copyable_v<TValue>, "ChdHashMapImage values are stored as raw bytes and must be trivially copyable" );
+		static_assert( alignof( TValue ) <= detail::CHD_IMAGE_SECTION_ALIGNMENT, "ChdHashMapImage values cannot be over-aligned" );
+
+	public:
+		//----------------------------------------------
+		// Type aliases
+		//----------------------------------------------
+
+		/** @brief Key type, pointing into the mapping */
+		using key_type = std::string_view;
+
+		/** @brief Key-value pair produced by iteration */
+		using value_type = std::pair<std::string_view, const TValue&>;
+
+		//----------------------------------------------
+		// Forward declarations
+		//----------------------------------------------
+
+		class Iterator;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Default constructor - an empty image not backed by any file */
+		ChdHashMapImage() noexcept = default;
+
+		/**
+		 * @brief Map an image file
+		 * @param[in] path File written by ChdHashMap<TValue, FnvOffsetBasis>::saveImage()
+		 * @param[in] verify When true (default), checksum the whole file and check every slot and key
+		 *            offset, touching every page once. When false only the header is checked, which
+		 *            opens in constant time; use it for files from a trusted source.
+		 * @throws std::system_error if the file cannot be opened or mapped
+		 * @throws InvalidImageException if the file is not a valid image for this TValue and hash function
+		 */
+		inline explicit ChdHashMapImage( const std::filesystem::path& path, bool verify = true );
+
+		/** @brief Copying would share or duplicate the mapping; move instead */
+		ChdHashMapImage( const ChdHashMapImage& ) = delete;
+
+		/**
+		 * @brief Move constructor
+		 * @param[in] other Image to take the mapping from; left empty
+		 */
+		inline ChdHashMapImage( ChdHashMapImage&& other ) noexcept;
+
+		//----------------------------------------------
+		// Destruction
+		//----------------------------------------------
+
+		/** @brief Destructor, unmaps the file */
+		inline ~ChdHashMapImage();
+
+		//----------------------------------------------
+		// Assignment
+		//----------------------------------------------
+
+		/** @brief Copying would share or duplicate the mapping; move instead */
+		ChdHashMapImage& operator=( const ChdHashMapImage& ) = delete;
+
+		/**
+		 * @brief Move assignment operator
+		 * @param[in] other Image to take the mapping from; left empty
+		 * @return Reference to this image
+		 */
+		inline ChdHashMapImage& operator=( ChdHashMapImage&& other ) noexcept;
+
+		//----------------------------------------------
+		// Lookup methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Accesses the value associated with the specified key
+		 * @param[in] key The key whose associated value is to be retrieved
+		 * @return A constant reference into the mapping
+		 * @throws KeyNotFoundException if the key is not in the image
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline const TValue& at( std::string_view key ) const;
+
+		/**
+		 * @brief Attempts to retrieve the value associated with the specified key without throwing
+		 * @param[in] key The key whose associated value is to be retrieved
+		 * @param[out] outValue Set to the value in the mapping on success, `nullptr` otherwise
+		 * @return `true` if the key was found
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool tryGetValue( std::string_view key, const TValue*& outValue ) const noexcept;
+
+		/**
+		 * @brief Checks whether the image contains a key
+		 * @param[in] key The key to look for
+		 * @return `true` if the key was found
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool contains( std::string_view key ) const noexcept;
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Returns the number of key-value pairs
+		 * @return Entry count recorded in the image
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline size_t size() const noexcept;
+
+		/**
+		 * @brief Checks if the image holds no entries
+		 * @return `true` for an empty or default-constructed image
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Returns the size of the mapped file
+		 * @return Bytes mapped, 0 for a default-constructed image
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline size_t mappedBytes() const noexcept;
+
+		//----------------------------------------------
+		// Iteration
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets an iterator to the first entry
+		 * @return An `Iterator` at the first entry, equal to `end()` for an empty image
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline Iterator begin() const noexcept;
+
+		/**
+		 * @brief Gets an iterator past the last entry
+		 * @return An `Iterator` that must not be dereferenced
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline Iterator end() const noexcept;
+
+		//----------------------------------------------
+		// Exception classes
+		//----------------------------------------------
+
+		//----------------------------
+		// ChdHashMapImage::KeyNotFoundException
+		//----------------------------
+
+		/** @brief Exception thrown by at() when the key is not in the image */
+		class KeyNotFoundException : public std::runtime_error
+		{
+		public:
+			/**
+			 * @brief Constructs a key not found exception
+			 * @param[in] key The key that was not found
+			 */
+			inline explicit KeyNotFoundException( std::string_view key );
+		};
+
+		//----------------------------
+		// ChdHashMapImage::InvalidImageException
+		//----------------------------
+
+		/** @brief Exception thrown when a file is not a valid image for this map type */
+		class InvalidImageException : public std::runtime_error
+		{
+		public:
+			/**
+			 * @brief Constructs an invalid image exception
+			 * @param[in] path The file that was rejected
+			 * @param[in] reason What was wrong with it
+			 */
+			inline InvalidImageException( const std::filesystem::path& path, std::string_view reason );
+		};
+
+		//----------------------------------------------
+		// ChdHashMapImage::Iterator class
+		//----------------------------------------------
+
+		/**
+		 * @class Iterator
+		 * @brief Forward iterator over the entries, in input order
+		 * @details Dereferencing yields a value_type by value: the key view and a reference to the value.
+		 */
+		class Iterator final
+		{
+		public:
+			//----------------------------
+			// Type aliases
+			//----------------------------
+
+			/** @brief Iterator category */
+			using iterator_category = std::forward_iterator_tag;
+
+			/** @brief Type of elements */
+			using value_type = ChdHashMapImage::value_type;
+
+			/** @brief Difference type */
+			using difference_type = std::ptrdiff_t;
+
+			/** @brief Produced by value */
+			using reference = value_type;
+
+			//----------------------------
+			// Construction
+			//----------------------------
+
+			/** @brief Default constructor */
+			Iterator() noexcept = default;
+
+			/**
+			 * @brief Constructs an iterator at an entry
+			 * @param[in] image Image being iterated
+			 * @param[in] index Entry index
+			 */
+			inline Iterator( const ChdHashMapImage* image, size_t index ) noexcept;
+
+			//----------------------------
+			// Operations
+			//----------------------------
+
+			/**
+			 * @brief Dereference operator
+			 * @return The key and value of the current entry
+			 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+			 */
+			[[nodiscard]] inline value_type operator*() const noexcept;
+
+			/**
+			 * @brief Pre-increment operator
+			 * @return Reference to this iterator after advancing
+			 */
+			inline Iterator& operator++() noexcept;
+
+			/**
+			 * @brief Post-increment operator
+			 * @return Copy of the iterator before advancing
+			 */
+			inline Iterator operator++( int ) noexcept;
+
+			//----------------------------
+			// Comparison
+			//----------------------------
+
+			/**
+			 * @brief Equality comparison operator
+			 * @param[in] other Iterator to compare with
+			 * @return `true` if both point to the same entry of the same image
+			 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+			 */
+			[[nodiscard]] inline bool operator==( const Iterator& other ) const noexcept;
+
+		private:
+			/** @brief Image being iterated */
+			const ChdHashMapImage* m_image{ nullptr };
+
+			/** @brief Current entry index */
+			size_t m_index{ 0 };
+		};
+
+	private:
+		//----------------------------------------------
+		// Private constants
+		//----------------------------------------------
+
+		/** @brief Slot value of a slot without an entry, as in ChdHashMap */
+		static constexpr uint32_t EMPTY_SLOT = UINT32_MAX;
+
+		//----------------------------------------------
+		// Private helpers
+		//----------------------------------------------
+
+		/**
+		 * @brief Key of an entry
+		 * @param[in] entry Index below size()
+		 * @return View into the key bytes section
+		 */
+		[[nodiscard]] NFX_META_INLINE std::string_view keyAt( size_t entry ) const noexcept;
+
+		/**
+		 * @brief Resolve a key to its entry
+		 * @param[in] key Key to look up in a non-empty image
+		 * @return Entry index, or EMPTY_SLOT if the key is absent
+		 */
+		[[nodiscard]] NFX_META_INLINE uint32_t entryIndex( std::string_view key ) const noexcept;
+
+		/**
+		 * @brief Check the header against this map type and the file, then point the sections into the mapping
+		 * @param[in] path File name for error messages
+		 * @param[in] verify Also checksum the body and check slots and key offsets
+		 * @throws InvalidImageException on any mismatch
+		 */
+		inline void attach( const std::filesystem::path& path, bool verify );
+
+		/** @brief Unmap the file and reset to the empty state */
+		inline void release() noexcept;
+
+		//----------------------------------------------
+		// Private member variables
+		//----------------------------------------------
+
+		/** @brief Start of the mapping, nullptr when empty */
+		const std::byte* m_mapping{ nullptr };
+
+		/** @brief Size of the mapping */
+		size_t m_mappedBytes{ 0 };
+
+		/** @brief Number of entries */
+		size_t m_size{ 0 };
+
+		/** @brief Number of slots and seeds, a power of 2 */
+		size_t m_slotCount{ 0 };
+
+		/** @brief Seeds section */
+		const uint16_t* m_seeds{ nullptr };
+
+		/** @brief Slots section */
+		const detail::ChdSlot* m_slots{ nullptr };
+
+		/** @brief Key offsets section, m_size + 1 entries */
+		const uint64_t* m_keyOffsets{ nullptr };
+
+		/** @brief Values section */
+		const TValue* m_values{ nullptr };
+
+		/** @brief Key bytes section */
+		const char* m_keys{ nullptr };
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/ChdHashMapImage.inl"
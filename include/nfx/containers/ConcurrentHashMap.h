@@ -0,0 +1,297 @@
+/**
+ * @file ConcurrentHashMap.h
+ * @brief Thread-safe map built from independently locked HashMap shards
+ * @details Keys are distributed over a power-of-2 number of HashMap shards using the
+ *          high bits of their hash. Each shard is guarded by its own reader/writer lock,
+ *          so threads touching different shards never contend and readers of the same
+ *          shard proceed in parallel.
+ *
+ * ## Memory Layout & Shard Selection:
+ *
+ * ```
+ * ConcurrentHashMap Internal Structure:
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │                ConcurrentHashMap<TKey, TValue>              │
+ * ├─────────────────────────────────────────────────────────────┤
+ * │  m_shards  std::unique_ptr<Shard[]>  (cache-line aligned)   │
+ * │ ┌─────────────────────────────────────────────────────────┐ │
+ * │ │ [0] │ shared_mutex │ HashMap<TKey, TValue> │ padding    │ │ ← One lock per shard
+ * │ │ [1] │ shared_mutex │ HashMap<TKey, TValue> │ padding    │ │
+ * │ │ ... │ ...          │ ...                   │ ...        │ │
+ * │ │ [n] │ shared_mutex │ HashMap<TKey, TValue> │ padding    │ │
+ * │ └─────────────────────────────────────────────────────────┘ │
+ * │  m_shardCount: 64          m_shardShift: 26                 │ ← Metadata
+ * └─────────────────────────────────────────────────────────────┘
+ *                              ↓
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  1. hash  = <CRC32 || FNV-1a>(key)                          │
+ * │  2. shard = hash >> (32 - log2(shardCount))   ← high bits   │
+ * │  3. Lock shard (shared for reads, exclusive for writes)     │
+ * │  4. HashMap probes with hash & mask           ← low bits    │
+ * └─────────────────────────────────────────────────────────────┘
+ * ```
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+#include "nfx/core/Hashing.h"
+#include "functors/HashMapHashFunctor.h"
+#include "HashMap.h"
+
+#include "nfx/config.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// ConcurrentHashMap class
+	//=====================================================================
+
+	/**
+	 * @brief Sharded hash map with per-shard reader/writer locking
+	 * @details Wraps N independent HashMap instances. A key always maps to the same shard,
+	 *          chosen from the high bits of its hash so that shard selection is independent of
+	 *          the low bits each HashMap uses for bucket indexing. Values are returned by copy
+	 *          (or accessed through a callback while the lock is held) because a pointer into a
+	 *          shard may be invalidated by a concurrent insertion as soon as the lock is released.
+	 *
+	 * @tparam TKey Key type (automatically optimized for std::string/string_view)
+	 * @tparam TValue Value type
+	 * @tparam FnvOffsetBasis FNV-1a offset basis constant (default: 0x811C9DC5)
+	 * @tparam FnvPrime FNV-1a prime constant (default: 0x01000193)
+	 * @tparam Layout Bucket storage layout of each shard (default: HashMapLayout::Interleaved)
+	 *
+	 * Features:
+	 * - Lock striping: contention limited to operations hitting the same shard
+	 * - Shared locks for lookups, exclusive locks for insertions and erasures
+	 * - Zero-copy string_view lookups for string keys
+	 * - Cache-line aligned shards to avoid false sharing between locks
+	 */
+	template <typename TKey, typename TValue,
+		uint32_t FnvOffsetBasis = core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS,
+		uint32_t FnvPrime = core::hashing::constants::DEFAULT_FNV_PRIME,
+		HashMapLayout Layout = HashMapLayout::Interleaved>
+	class ConcurrentHashMap final
+	{
+	public:
+		//----------------------------------------------
+		// STL-compatible type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type */
+		using key_type = TKey;
+
+		/** @brief Type alias for mapped value type */
+		using mapped_type = TValue;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		/** @brief Type alias for the per-shard map type */
+		using shard_type = HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor with DEFAULT_SHARD_COUNT shards
+		 */
+		NFX_META_INLINE ConcurrentHashMap();
+
+		/**
+		 * @brief Constructor with specified shard count
+		 * @param shardCount Number of shards (rounded up to power of 2, clamped to [1, 65536])
+		 * @details A shard count of roughly 2-4x the number of writer threads keeps the
+		 *          probability of two writers colliding on one lock low
+		 */
+		NFX_META_INLINE explicit ConcurrentHashMap( size_t shardCount );
+
+		/** @brief Copy constructor (deleted, shards own their locks) */
+		ConcurrentHashMap( const ConcurrentHashMap& ) = delete;
+
+		/** @brief Move constructor (deleted, shards own their locks) */
+		ConcurrentHashMap( ConcurrentHashMap&& ) = delete;
+
+		/** @brief Copy assignment (deleted, shards own their locks) */
+		ConcurrentHashMap& operator=( const ConcurrentHashMap& ) = delete;
+
+		/** @brief Move assignment (deleted, shards own their locks) */
+		ConcurrentHashMap& operator=( ConcurrentHashMap&& ) = delete;
+
+		/** @brief Destructor */
+		~ConcurrentHashMap() = default;
+
+		//----------------------------------------------
+		// Core operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Thread-safe lookup copying the value out under a shared lock
+		 * @param key The key to search for (supports heterogeneous lookup)
+		 * @param outValue Receives a copy of the value if found, left untouched otherwise
+		 * @return true if the key was found, false otherwise
+		 */
+		template <typename KeyType = TKey>
+		NFX_META_INLINE bool tryGetValue( const KeyType& key, TValue& outValue ) const;
+
+		/**
+		 * @brief Check whether a key is present
+		 * @param key The key to search for (supports heterogeneous lookup)
+		 * @return true if the key was found, false otherwise
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <typename KeyType = TKey>
+		[[nodiscard]] NFX_META_INLINE bool contains( const KeyType& key ) const;
+
+		/**
+		 * @brief Invoke a callback on a value while its shard is read-locked
+		 * @param key The key to search for (supports heterogeneous lookup)
+		 * @param fn Callable invoked as fn( const TValue& ) if the key is found
+		 * @return true if the key was found and fn was invoked
+		 * @details Avoids copying large values. fn must not access this map.
+		 */
+		template <typename KeyType = TKey, typename Fn>
+		NFX_META_INLINE bool visit( const KeyType& key, Fn&& fn ) const;
+
+		/**
+		 * @brief Invoke a callback on a value while its shard is write-locked
+		 * @param key The key to search for (supports heterogeneous lookup)
+		 * @param fn Callable invoked as fn( TValue& ) if the key is found
+		 * @return true if the key was found and fn was invoked
+		 * @details Atomic read-modify-write of a single value (e.g. counters). fn must not access this map.
+		 */
+		template <typename KeyType = TKey, typename Fn>
+		NFX_META_INLINE bool update( const KeyType& key, Fn&& fn );
+
+		//----------------------------------------------
+		// Insertion
+		//----------------------------------------------
+
+		/**
+		 * @brief Insert or update a key-value pair (move semantics)
+		 * @param key The key to insert or update
+		 * @param value The value to associate with the key (moved)
+		 */
+		NFX_META_INLINE void insertOrAssign( const TKey& key, TValue&& value );
+
+		/**
+		 * @brief Insert or update a key-value pair (copy semantics)
+		 * @param key The key to insert or update
+		 * @param value The value to associate with the key (copied)
+		 */
+		NFX_META_INLINE void insertOrAssign( const TKey& key, const TValue& value );
+
+		//----------------------------------------------
+		// Capacity and memory management
+		//----------------------------------------------
+
+		/**
+		 * @brief Reserve capacity for at least the specified number of elements
+		 * @param minCapacity Minimum total capacity, spread evenly over all shards
+		 * @details Locks one shard at a time; concurrent operations on other shards proceed
+		 */
+		NFX_META_INLINE void reserve( size_t minCapacity );
+
+		/**
+		 * @brief Remove a key-value pair from the map
+		 * @param key The key to remove (supports heterogeneous lookup)
+		 * @return true if the key was found and removed, false otherwise
+		 */
+		template <typename KeyType = TKey>
+		NFX_META_INLINE bool erase( const KeyType& key );
+
+		//----------------------------------------------
+		// Aggregation across shards
+		//----------------------------------------------
+
+		/**
+		 * @brief Visit every key-value pair
+		 * @param fn Callable invoked as fn( const TKey&, const TValue& )
+		 * @details Shards are read-locked one at a time, so the traversal is consistent per
+		 *          shard but not a global snapshot: writers may modify shards already visited
+		 *          or not yet reached. fn must not access this map.
+		 */
+		template <typename Fn>
+		NFX_META_INLINE void forEach( Fn&& fn ) const;
+
+		/**
+		 * @brief Get the number of elements in the map
+		 * @return Sum of all shard sizes
+		 * @details Each shard is read-locked in turn: exact when no writer is active,
+		 *          otherwise a value between the sizes before and after concurrent writes
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t size() const;
+
+		/**
+		 * @brief Check if the map contains no elements
+		 * @return true if every shard is empty
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool isEmpty() const;
+
+		/**
+		 * @brief Get the number of shards
+		 * @return Power-of-2 shard count fixed at construction
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t shardCount() const noexcept;
+
+		/**
+		 * @brief Default number of shards
+		 * @details Enough independent locks for a few dozen writer threads
+		 */
+		static constexpr size_t DEFAULT_SHARD_COUNT = 64;
+
+	private:
+		//----------------------------------------------
+		// Shard structure
+		//----------------------------------------------
+
+		/**
+		 * @brief Assumed cache line size used to pad shards
+		 * @details Literal rather than std::hardware_destructive_interference_size, whose value
+		 *          is not ABI-stable across compiler flags
+		 */
+		static constexpr size_t CACHE_LINE_SIZE = 64;
+
+		/**
+		 * @brief One independently locked partition of the key space
+		 * @details Aligned to a cache line so that locking one shard never invalidates the
+		 *          line holding a neighbouring shard's mutex
+		 */
+		struct alignas( CACHE_LINE_SIZE ) Shard
+		{
+			mutable std::shared_mutex mutex; ///< Reader/writer lock guarding map
+			shard_type map;					 ///< Elements whose hash selects this shard
+		};
+
+		std::unique_ptr<Shard[]> m_shards; ///< Shard array
+		size_t m_shardCount{};			   ///< Number of shards (power of 2)
+		unsigned m_shardShift{};		   ///< Right shift extracting the shard index from a 32-bit hash
+
+		/**
+		 * @brief Hash function object with zero-space optimization
+		 * @details Same functor as the shards, so shard selection agrees with the shard's own hashing
+		 */
+		NFX_META_NO_UNIQUE_ADDRESS typename shard_type::hasher m_hasher;
+
+		//----------------------------------------------
+		// Internal implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Select the shard owning a hash
+		 * @param hash Hash of the key, also handed to the shard so the key is hashed only once
+		 * @return Shard selected by the high bits of the hash
+		 */
+		NFX_META_INLINE Shard& shardFor( std::uint32_t hash ) const noexcept;
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/ConcurrentHashMap.inl"
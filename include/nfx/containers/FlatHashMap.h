@@ -0,0 +1,658 @@
+/**
+ * @file FlatHashMap.h
+ * @brief Map with SIMD control-byte group probing
+ * @details Open-addressing hash map keeping a dense array of 1-byte control tags
+ *          alongside the key-value slots. Lookups compare 16 (SSE2) or 32 (AVX2)
+ *          control bytes at once and only touch slot payloads on a 7-bit tag match.
+ *
+ * ## Memory Layout & Control-Byte Structure:
+ *
+ * ```
+ * FlatHashMap Internal Structure:
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │                    FlatHashMap<TKey, TValue>                │
+ * ├─────────────────────────────────────────────────────────────┤
+ * │ ┌─────────────────────────────────────────────────────────┐ │
+ * │ │                       m_ctrl                            │ │ ← Probing metadata
+ * │ │                std::vector<std::int8_t>                 │ │
+ * │ │ ┌─────────────────────────────────────────────────────┐ │ │
+ * │ │ │ [0] h2 │ [1] EMPTY │ [2] h2 │ [3] DELETED │ ...     │ │ │ ← 1 byte per slot
+ * │ │ │ [n] h2 │ clone[0..GROUP_WIDTH-1]                    │ │ │ ← Wrap-around copy
+ * │ │ └─────────────────────────────────────────────────────┘ │ │
+ * │ └─────────────────────────────────────────────────────────┘ │
+ * │ ┌─────────────────────────────────────────────────────────┐ │
+ * │ │                       m_slots                           │ │ ← Payload storage
+ * │ │                  std::vector<Slot>                      │ │
+ * │ │ ┌─────────────────────────────────────────────────────┐ │ │
+ * │ │ │  [0] │ key1    │ value1  │                          │ │ │ ← Touched on tag match
+ * │ │ │  [1] │ empty   │ empty   │                          │ │ │
+ * │ │ │  ... │ ...     │ ...     │                          │ │ │
+ * │ │ └─────────────────────────────────────────────────────┘ │ │
+ * │ └─────────────────────────────────────────────────────────┘ │
+ * │  m_size: 4     m_capacity: 32     m_growthLeft: 24          │ ← Metadata
+ * └─────────────────────────────────────────────────────────────┘
+ *                              ↓
+ *                    Group Probing Process
+ *                              ↓
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │                  Control-Byte Hash Resolution               │
+ * ├─────────────────────────────────────────────────────────────┤
+ * │  Input: "search_key"                                        │
+ * │                            ↓                                │
+ * │  1. Primary Hash: hash = <CRC32 || FNV-1a>(key)             │
+ * │     - h1 = hash & (capacity - 1)   → group start            │
+ * │     - h2 = hash >> 25              → 7-bit control tag      │
+ * │                            ↓                                │
+ * │  2. Group Load: 16/32 control bytes in one SIMD register    │
+ * │                            ↓                                │
+ * │  3. Match: cmpeq(group, h2) → bitmask of candidates         │
+ * │     - Compare keys only for set bits                        │
+ * │     - Any EMPTY byte in group: key absent, stop             │
+ * │     - Otherwise: triangular jump to next group              │
+ * │                            ↓                                │
+ * │  4. Result: ~1 cache line of metadata per miss              │
+ * └─────────────────────────────────────────────────────────────┘
+ * ```
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "nfx/core/Hashing.h"
+#include "functors/StringFunctors.h"
+#include "functors/HashMapHashFunctor.h"
+
+#include "nfx/config.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// FlatHashMap class
+	//=====================================================================
+
+	/**
+	 * @brief Hash table with SIMD control-byte group probing
+	 * @details Alternative probing engine to HashMap exposing the same API. Each slot owns a
+	 *          1-byte control tag (7 bits of the cached hash or an EMPTY/DELETED marker) kept in
+	 *          a dense array, so a probe inspects a whole group of slots with a single vector
+	 *          compare before any key is dereferenced.
+	 *
+	 * @tparam TKey Key type (automatically optimized for std::string/string_view)
+	 * @tparam TValue Value type
+	 * @tparam FnvOffsetBasis FNV-1a offset basis constant (default: 0x811C9DC5)
+	 * @tparam FnvPrime FNV-1a prime constant (default: 0x01000193)
+	 *
+	 * Features:
+	 * - 16-wide SSE2 or 32-wide AVX2 group matching, scalar fallback elsewhere
+	 * - Zero-copy string_view lookups for string keys
+	 * - Tombstone-aware erase that reverts to EMPTY whenever no probe chain crosses the slot
+	 * - 87.5% maximum load factor
+	 */
+	template <typename TKey, typename TValue,
+		uint32_t FnvOffsetBasis = core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS,
+		uint32_t FnvPrime = core::hashing::constants::DEFAULT_FNV_PRIME>
+	class FlatHashMap final
+	{
+		//----------------------------------------------
+		// Forward declarations for iterator support
+		//----------------------------------------------
+
+		class iterator;
+		class const_iterator;
+
+	public:
+		//----------------------------------------------
+		// STL-compatible type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type */
+		using key_type = TKey;
+
+		/** @brief Type alias for mapped value type */
+		using mapped_type = TValue;
+
+		/** @brief Type alias for key-value pair type */
+		using value_type = std::pair<const TKey, TValue>;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		/** @brief Type alias for difference type */
+		using difference_type = std::ptrdiff_t;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor with initial capacity of 32 slots
+		 */
+		NFX_META_INLINE FlatHashMap();
+
+		/**
+		 * @brief Constructor with specified initial capacity
+		 * @param initialCapacity Minimum initial capacity (rounded up to power of 2, at least one group)
+		 */
+		NFX_META_INLINE explicit FlatHashMap( size_t initialCapacity );
+
+		//----------------------------------------------
+		// Core operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Fast lookup with heterogeneous key types
+		 * @param key The key to search for
+		 * @param outValue Reference to pointer that will be set to the found value (or nullptr if not found)
+		 * @return true if the key was found, false otherwise
+		 */
+		template <typename KeyType = TKey>
+		NFX_META_INLINE bool tryGetValue( const KeyType& key, TValue*& outValue ) noexcept;
+
+		//----------------------------------------------
+		// Insertion
+		//----------------------------------------------
+
+		/**
+		 * @brief Insert or update a key-value pair (move semantics)
+		 * @param key The key to insert or update
+		 * @param value The value to associate with the key (moved)
+		 */
+		NFX_META_INLINE void insertOrAssign( const TKey& key, TValue&& value );
+
+		/**
+		 * @brief Insert or update a key-value pair (copy semantics)
+		 * @param key The key to insert or update
+		 * @param value The value to associate with the key (copied)
+		 */
+		NFX_META_INLINE void insertOrAssign( const TKey& key, const TValue& value );
+
+		//----------------------------------------------
+		// Capacity and memory management
+		//----------------------------------------------
+
+		/**
+		 * @brief Reserve capacity for at least the specified number of elements
+		 * @param minCapacity Minimum number of elements to hold without triggering a rehash
+		 * @details Accounts for the 87.5% maximum load factor when sizing the slot array.
+		 */
+		NFX_META_INLINE void reserve( size_t minCapacity );
+
+		/**
+		 * @brief Remove a key-value pair from the map
+		 * @param key The key to remove (supports heterogeneous lookup)
+		 * @return true if the key was found and removed, false otherwise
+		 * @details The slot becomes EMPTY when no full group surrounds it, otherwise it is
+		 *          marked DELETED so that probe sequences passing through it stay intact.
+		 */
+		template <typename KeyType = TKey>
+		NFX_META_INLINE bool erase( const KeyType& key ) noexcept;
+
+		//----------------------------------------------
+		// State inspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of elements in the map
+		 * @return Current number of key-value pairs stored
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t size() const noexcept;
+
+		/**
+		 * @brief Get the current capacity of the hash table
+		 * @return Number of slots (always power of 2)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t capacity() const noexcept;
+
+		/**
+		 * @brief Check if the map contains no elements
+		 * @return true if size() == 0, false otherwise
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool isEmpty() const noexcept;
+
+		//----------------------------------------------
+		// STL-compatible iteration support
+		//----------------------------------------------
+
+		/**
+		 * @brief Get iterator to beginning of occupied slots
+		 * @return Iterator pointing to first key-value pair
+		 */
+		[[nodiscard]] iterator begin() noexcept;
+
+		/**
+		 * @brief Get const iterator to beginning of occupied slots
+		 * @return Const iterator pointing to first key-value pair
+		 */
+		[[nodiscard]] const_iterator begin() const noexcept;
+
+		/**
+		 * @brief Get iterator to end (past last occupied slot)
+		 * @return Iterator pointing past the last key-value pair
+		 */
+		[[nodiscard]] iterator end() noexcept;
+
+		/**
+		 * @brief Get const iterator to end (past last occupied slot)
+		 * @return Const iterator pointing past the last key-value pair
+		 */
+		[[nodiscard]] const_iterator end() const noexcept;
+
+		/**
+		 * @brief Compare two FlatHashMaps for equality
+		 * @param other The other FlatHashMap to compare with
+		 * @return true if both maps contain the same key-value pairs
+		 */
+		[[nodiscard]] bool operator==( const FlatHashMap& other ) const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Control bytes and slot structure
+		//----------------------------------------------
+
+		/** @brief Control byte marking a never-used slot (terminates probing) */
+		static constexpr std::int8_t CTRL_EMPTY = -128;
+
+		/** @brief Control byte marking an erased slot (probing continues past it) */
+		static constexpr std::int8_t CTRL_DELETED = -2;
+
+		/**
+		 * @brief Slot structure holding the key-value payload
+		 * @details Layout-compatible with std::pair<const TKey, TValue> for iterator access
+		 */
+		struct Slot
+		{
+			TKey key{};		///< The stored key
+			TValue value{}; ///< The associated value
+		};
+
+		/**
+		 * @brief SIMD view over GROUP_WIDTH consecutive control bytes
+		 * @details Every match function returns a bitmask where bit i refers to slot (start + i)
+		 */
+		struct Group
+		{
+#if defined( __AVX2__ )
+			/** @brief Number of control bytes compared at once */
+			static constexpr size_t WIDTH = 32;
+
+			__m256i ctrl; ///< Loaded control bytes
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+			/** @brief Number of control bytes compared at once */
+			static constexpr size_t WIDTH = 16;
+
+			__m128i ctrl; ///< Loaded control bytes
+#else
+			/** @brief Number of control bytes compared at once */
+			static constexpr size_t WIDTH = 16;
+
+			const std::int8_t* ctrl; ///< Control bytes (scalar fallback)
+#endif
+
+			/**
+			 * @brief Load a group starting at the given control byte
+			 * @param pos Pointer to the first control byte of the group
+			 */
+			NFX_META_INLINE explicit Group( const std::int8_t* pos ) noexcept;
+
+			/**
+			 * @brief Find slots whose control byte equals the given tag
+			 * @param h2 7-bit hash tag to match
+			 * @return Bitmask of matching slots
+			 */
+			[[nodiscard]] NFX_META_INLINE std::uint32_t match( std::int8_t h2 ) const noexcept;
+
+			/**
+			 * @brief Find EMPTY slots
+			 * @return Bitmask of empty slots
+			 */
+			[[nodiscard]] NFX_META_INLINE std::uint32_t maskEmpty() const noexcept;
+
+			/**
+			 * @brief Find EMPTY or DELETED slots
+			 * @return Bitmask of slots available for insertion
+			 */
+			[[nodiscard]] NFX_META_INLINE std::uint32_t maskEmptyOrDeleted() const noexcept;
+		};
+
+		/** @brief Group width used for probing and control byte cloning */
+		static constexpr size_t GROUP_WIDTH = Group::WIDTH;
+
+		/**
+		 * @brief Initial hash table capacity (power of 2, at least one group)
+		 */
+		static constexpr size_t INITIAL_CAPACITY = std::max<size_t>( 32, GROUP_WIDTH );
+
+		/**
+		 * @brief Load factor threshold expressed in eighths (87.5%)
+		 * @details Group probing tolerates higher load than per-slot probing because
+		 *          the cost of a probe step is one vector compare rather than one slot
+		 */
+		static constexpr size_t MAX_LOAD_FACTOR_EIGHTHS = 7;
+
+		/**
+		 * @brief Control bytes, one per slot plus GROUP_WIDTH cloned bytes
+		 * @details The trailing clone of the first GROUP_WIDTH bytes lets a group load that starts
+		 *          near the end of the table read the wrapped-around slots without branching
+		 */
+		std::vector<std::int8_t> m_ctrl;
+
+		/** @brief Key-value payload storage, parallel to m_ctrl */
+		std::vector<Slot> m_slots;
+
+		size_t m_size{};					   ///< Current number of elements
+		size_t m_capacity{ INITIAL_CAPACITY }; ///< Current number of slots
+		size_t m_mask{ INITIAL_CAPACITY - 1 }; ///< Bitwise mask for hash modulo
+		size_t m_growthLeft{};				   ///< Insertions into EMPTY slots allowed before rehash
+
+		/**
+		 * @brief Hash function object with zero-space optimization
+		 */
+		NFX_META_NO_UNIQUE_ADDRESS HashMapHash<FnvOffsetBasis, FnvPrime> m_hasher;
+
+		//----------------------------------------------
+		// Internal implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Extract the 7-bit control tag from a hash
+		 * @param hash Full 32-bit hash
+		 * @return Tag stored in the control byte of a full slot
+		 */
+		[[nodiscard]] static NFX_META_INLINE std::int8_t h2( std::uint32_t hash ) noexcept;
+
+		/**
+		 * @brief Locate the slot holding a key
+		 * @param key The key to search for
+		 * @param hash Precomputed hash of the key
+		 * @return Slot index, or m_capacity if the key is absent
+		 */
+		template <typename KeyType>
+		NFX_META_INLINE size_t findIndex( const KeyType& key, std::uint32_t hash ) const noexcept;
+
+		/**
+		 * @brief Find the first EMPTY or DELETED slot on the probe sequence of a hash
+		 * @param hash Hash of the key being inserted
+		 * @return Slot index available for insertion
+		 */
+		NFX_META_INLINE size_t findFirstNonFull( std::uint32_t hash ) const noexcept;
+
+		/**
+		 * @brief Write a control byte, mirroring it into the cloned tail when required
+		 * @param pos Slot index
+		 * @param ctrl Control byte value
+		 */
+		NFX_META_INLINE void setCtrl( size_t pos, std::int8_t ctrl ) noexcept;
+
+		/**
+		 * @brief Internal insert or assign implementation with perfect forwarding
+		 * @tparam ValueType Deduced value type supporting move/copy semantics
+		 * @param key The key to insert or update
+		 * @param value The value to forward (preserves value category)
+		 */
+		template <typename ValueType>
+		inline void insertOrAssignInternal( const TKey& key, ValueType&& value );
+
+		/**
+		 * @brief Rebuild the table with the given slot count, dropping all tombstones
+		 * @param newCapacity New slot count (power of 2, at least GROUP_WIDTH)
+		 */
+		inline void rehash( size_t newCapacity );
+
+		/**
+		 * @brief Compare keys with heterogeneous lookup support for string types
+		 * @tparam KeyType1 First key type
+		 * @tparam KeyType2 Second key type
+		 * @param k1 First key to compare
+		 * @param k2 Second key to compare
+		 * @return true if keys are equal, false otherwise
+		 */
+		template <typename KeyType1, typename KeyType2>
+		NFX_META_INLINE bool keysEqual( const KeyType1& k1, const KeyType2& k2 ) const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Iterator class definitions
+		//----------------------------------------------
+
+		/**
+		 * @brief Iterator for FlatHashMap that skips non-full slots
+		 */
+		class iterator
+		{
+		public:
+			/** @brief STL iterator category (forward iterator) */
+			using iterator_category = std::forward_iterator_tag;
+
+			/** @brief STL iterator value type (key-value pair) */
+			using value_type = std::pair<const TKey, TValue>;
+
+			/** @brief STL iterator difference type */
+			using difference_type = std::ptrdiff_t;
+
+			/** @brief STL iterator pointer type */
+			using pointer = value_type*;
+
+			/** @brief STL iterator reference type */
+			using reference = value_type&;
+
+			/**
+			 * @brief Default constructor creates an invalid iterator
+			 */
+			iterator() = default;
+
+			/**
+			 * @brief Construct iterator from slot range
+			 * @param slot Starting slot pointer
+			 * @param ctrl Control byte of the starting slot
+			 * @param ctrlEnd Control byte one past the last slot
+			 */
+			iterator( Slot* slot, const std::int8_t* ctrl, const std::int8_t* ctrlEnd )
+				: m_slot( slot ), m_ctrl( ctrl ), m_ctrlEnd( ctrlEnd )
+			{
+				skipToFull();
+			}
+
+			/**
+			 * @brief Dereference operator to access key-value pair
+			 * @return Reference to current key-value pair
+			 */
+			reference operator*() const
+			{
+				return reinterpret_cast<reference>( *m_slot );
+			}
+
+			/**
+			 * @brief Arrow operator to access key-value pair members
+			 * @return Pointer to current key-value pair
+			 */
+			pointer operator->() const
+			{
+				return reinterpret_cast<pointer>( m_slot );
+			}
+
+			/**
+			 * @brief Pre-increment operator to advance to next full slot
+			 * @return Reference to this iterator after advancement
+			 */
+			iterator& operator++()
+			{
+				++m_slot;
+				++m_ctrl;
+				skipToFull();
+				return *this;
+			}
+
+			/**
+			 * @brief Post-increment operator to advance to next full slot
+			 * @return Copy of iterator before advancement
+			 */
+			iterator operator++( int )
+			{
+				iterator tmp = *this;
+				++( *this );
+				return tmp;
+			}
+
+			/**
+			 * @brief Equality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to the same slot
+			 */
+			bool operator==( const iterator& other ) const { return m_slot == other.m_slot; }
+
+			/**
+			 * @brief Inequality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to different slots
+			 */
+			bool operator!=( const iterator& other ) const { return m_slot != other.m_slot; }
+
+		private:
+			/**
+			 * @brief Skip to next full slot
+			 * @details Full slots have a non-negative control byte
+			 */
+			void skipToFull()
+			{
+				while ( m_ctrl != m_ctrlEnd && *m_ctrl < 0 )
+				{
+					++m_slot;
+					++m_ctrl;
+				}
+			}
+
+			Slot* m_slot = nullptr;
+			const std::int8_t* m_ctrl = nullptr;
+			const std::int8_t* m_ctrlEnd = nullptr;
+			friend class FlatHashMap;
+			friend class const_iterator;
+		};
+
+		/**
+		 * @brief Const iterator for FlatHashMap that skips non-full slots
+		 */
+		class const_iterator
+		{
+		public:
+			/** @brief STL iterator category (forward iterator) */
+			using iterator_category = std::forward_iterator_tag;
+
+			/** @brief STL iterator value type (const key-value pair) */
+			using value_type = std::pair<const TKey, TValue>;
+
+			/** @brief STL iterator difference type */
+			using difference_type = std::ptrdiff_t;
+
+			/** @brief STL iterator pointer type */
+			using pointer = const value_type*;
+
+			/** @brief STL iterator reference type */
+			using reference = const value_type&;
+
+			/**
+			 * @brief Default constructor creates an invalid iterator
+			 */
+			const_iterator() = default;
+
+			/**
+			 * @brief Construct const iterator from slot range
+			 * @param slot Starting slot pointer
+			 * @param ctrl Control byte of the starting slot
+			 * @param ctrlEnd Control byte one past the last slot
+			 */
+			const_iterator( const Slot* slot, const std::int8_t* ctrl, const std::int8_t* ctrlEnd )
+				: m_slot( slot ), m_ctrl( ctrl ), m_ctrlEnd( ctrlEnd )
+			{
+				skipToFull();
+			}
+
+			/**
+			 * @brief Convert from non-const iterator
+			 * @param it Non-const iterator to convert from
+			 */
+			const_iterator( const iterator& it ) : m_slot( it.m_slot ), m_ctrl( it.m_ctrl ), m_ctrlEnd( it.m_ctrlEnd ) {}
+
+			/**
+			 * @brief Dereference operator to access key-value pair
+			 * @return Const reference to current key-value pair
+			 */
+			reference operator*() const
+			{
+				return reinterpret_cast<reference>( *m_slot );
+			}
+
+			/**
+			 * @brief Arrow operator to access key-value pair members
+			 * @return Const pointer to current key-value pair
+			 */
+			pointer operator->() const
+			{
+				return reinterpret_cast<pointer>( m_slot );
+			}
+
+			/**
+			 * @brief Pre-increment operator to advance to next full slot
+			 * @return Reference to this iterator after advancement
+			 */
+			const_iterator& operator++()
+			{
+				++m_slot;
+				++m_ctrl;
+				skipToFull();
+				return *this;
+			}
+
+			/**
+			 * @brief Post-increment operator to advance to next full slot
+			 * @return Copy of iterator before advancement
+			 */
+			const_iterator operator++( int )
+			{
+				const_iterator tmp = *this;
+				++( *this );
+				return tmp;
+			}
+
+			/**
+			 * @brief Equality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to the same slot
+			 */
+			bool operator==( const const_iterator& other ) const { return m_slot == other.m_slot; }
+
+			/**
+			 * @brief Inequality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to different slots
+			 */
+			bool operator!=( const const_iterator& other ) const { return m_slot != other.m_slot; }
+
+		private:
+			/**
+			 * @brief Skip to next full slot
+			 * @details Full slots have a non-negative control byte
+			 */
+			void skipToFull()
+			{
+				while ( m_ctrl != m_ctrlEnd && *m_ctrl < 0 )
+				{
+					++m_slot;
+					++m_ctrl;
+				}
+			}
+
+			const Slot* m_slot = nullptr;
+			const std::int8_t* m_ctrl = nullptr;
+			const std::int8_t* m_ctrlEnd = nullptr;
+			friend class FlatHashMap;
+		};
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/FlatHashMap.inl"
@@ -35,16 +35,48 @@
  * │  1. Primary Hash: hash = <CRC32 || FNV-1a>(key)             │
  * │                            ↓                                │
  * │  2. Index Mapping: idx = hash & (capacity - 1)              │
+ * │     (non-power-of-2 capacity: (hash * capacity) >> 32)      │
  * │                            ↓                                │
  * │  3. Linear Probe: while(bucket[idx].occupied)               │
  * │     - Compare: if(key == bucket[idx].key) return found      │
  * │     - Robin Hood: if(distance > bucket[idx].distance) stop  │
- * │     - Continue: idx = (idx + 1) & mask                      │
+ * │     - Continue: idx = (idx + 1) mod capacity                │
  * │                            ↓                                │
  * │  4. Result: O(1) average, O(log n) worst-case               │
  * └─────────────────────────────────────────────────────────────┘
  * ```
  *
+ * ## Split (Structure-of-Arrays) Layout:
+ *
+ * ```
+ * HashMap<TKey, TValue, ..., HashMapLayout::Split>:
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  m_table.metadata  std::vector<Metadata>  (8 bytes/bucket)  │ ← Probed on every step
+ * │ ┌─────────────────────────────────────────────────────────┐ │
+ * │ │ [0] hash1 dist1 ✓ │ [1] hash2 dist2 ✓ │ [2] 0 0 ✗ │ ...  │ │
+ * │ └─────────────────────────────────────────────────────────┘ │
+ * │  m_table.slots     std::vector<Slot>      (parallel array)  │ ← Touched on hash match
+ * │ ┌─────────────────────────────────────────────────────────┐ │
+ * │ │ [0] key1 value1   │ [1] key2 value2   │ [2] empty │ ...  │ │
+ * │ └─────────────────────────────────────────────────────────┘ │
+ * └─────────────────────────────────────────────────────────────┘
+ *  Misses and Robin Hood distance checks read only the metadata
+ *  array, so large keys/values stay out of cache until needed.
+ * ```
+ *
+ * ## Incremental Resize (opt-in via setIncrementalRehash):
+ *
+ * ```
+ *   load ≥ 50%         load ≥ 75%               every insert/erase
+ * ┌──────────────┐   ┌──────────────────┐   ┌──────────────────────────┐
+ * │ build next   │ → │ m_table → old    │ → │ migrate N old buckets    │
+ * │ table in     │   │ next → m_table   │   │ (whole clusters), lookups│
+ * │ chunks       │   │ (O(1) swap)      │   │ probe new, then old      │
+ * └──────────────┘   └──────────────────┘   └──────────────────────────┘
+ *                                             drained → old buckets
+ *                                             destroyed in chunks
+ * ```
+ *
  * ## Robin Hood Insertion Algorithm:
  *
  * ```
@@ -73,18 +105,176 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <concepts>
 #include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "nfx/core/Hashing.h"
 #include "functors/StringFunctors.h"
 #include "functors/HashMapHashFunctor.h"
+#include "functors/HashPolicies.h"
 #include "StringMap.h"
 
 #include "nfx/config.h"
 
 namespace nfx::containers
 {
+	//=====================================================================
+	// HashMapLayout enumeration
+	//=====================================================================
+
+	/**
+	 * @brief Bucket storage layout used by HashMap
+	 * @details Interleaved keeps key, value and probe metadata in one bucket, which is
+	 *          the most compact choice for small payloads. Split stores the hash, distance
+	 *          and occupancy in a dedicated metadata array with keys and values in a
+	 *          parallel array, so probing never pulls large payloads into cache.
+	 */
+	enum class HashMapLayout : std::uint8_t
+	{
+		Interleaved = 0, ///< Key, value, hash, distance and occupancy stored together
+		Split			 ///< Packed metadata array plus parallel key/value array
+	};
+
+	//=====================================================================
+	// HashMapGrowthPolicy structure
+	//=====================================================================
+
+	/**
+	 * @brief Load factor and growth factor applied by HashMap when it resizes
+	 * @details The default (75% load, doubling) keeps power-of-2 capacities, where the home
+	 *          bucket is hash & (capacity - 1). Any other growth factor produces arbitrary
+	 *          capacities, which map the hash with a multiply-shift ((hash * capacity) >> 32)
+	 *          and therefore rely on the high bits of the hash.
+	 */
+	struct HashMapGrowthPolicy final
+	{
+		static constexpr std::uint32_t MIN_LOAD_FACTOR_PERCENT = 50;  ///< Lowest accepted maxLoadFactorPercent
+		static constexpr std::uint32_t MAX_LOAD_FACTOR_PERCENT = 95;  ///< Highest accepted maxLoadFactorPercent
+		static constexpr std::uint32_t MIN_GROWTH_PERCENT = 125;	  ///< Lowest accepted growthPercent
+		static constexpr std::uint32_t MAX_GROWTH_PERCENT = 200;	  ///< Highest accepted growthPercent
+
+		std::uint32_t maxLoadFactorPercent{ 75 }; ///< Grow once size reaches this percentage of capacity
+		std::uint32_t growthPercent{ 200 };		  ///< New capacity as a percentage of the old one (200 = doubling)
+
+		/** @brief Compare policies field by field */
+		friend bool operator==( const HashMapGrowthPolicy&, const HashMapGrowthPolicy& ) noexcept = default;
+	};
+
+	//=====================================================================
+	// HashMapStats structure
+	//=====================================================================
+
+	/**
+	 * @brief Snapshot of a HashMap's table shape and, when recorded, its operation counters
+	 * @details The shape fields are computed by HashMap::stats() from the buckets and are always
+	 *          available. The counters are only maintained when the library is built with
+	 *          NFX_META_HASHMAP_STATS=1 (CMake option NFX_META_HASHMAP_STATS); otherwise
+	 *          recorded is false and they stay zero.
+	 */
+	struct HashMapStats final
+	{
+		//----------------------------------------------
+		// Table shape
+		//----------------------------------------------
+
+		size_t size{};			///< Number of elements
+		size_t capacity{};		///< Number of buckets in the current table
+		double loadFactor{};	///< size / capacity
+		size_t emptyBuckets{};	///< Buckets allocated but unused (capacity - elements in the current table)
+		size_t maxDistance{};	///< Longest Robin Hood distance of any element
+		double meanDistance{};	///< Average Robin Hood distance over all elements
+
+		/**
+		 * @brief Probes a hit takes on average if every key is looked up equally often
+		 * @details meanDistance + 1
+		 */
+		double expectedSuccessfulProbes{};
+
+		/**
+		 * @brief Probes a miss takes on average, over every possible home bucket
+		 * @details A miss stops at an empty bucket or at an element closer to its home than
+		 *          the probe is to the miss's home
+		 */
+		double expectedUnsuccessfulProbes{};
+
+		/** @brief Element count per Robin Hood distance: distanceHistogram[d] elements sit d buckets past home */
+		std::vector<size_t> distanceHistogram;
+
+		//----------------------------------------------
+		// Recorded counters (NFX_META_HASHMAP_STATS)
+		//----------------------------------------------
+
+		bool recorded{};				   ///< Whether the counters below were maintained
+		std::uint64_t lookups{};		   ///< Key lookups (tryGetValue, tryGetValues, contains-style reads)
+		std::uint64_t hits{};			   ///< Lookups that found their key
+		double meanSuccessfulProbes{};	   ///< Measured buckets examined per hit
+		double meanUnsuccessfulProbes{};   ///< Measured buckets examined per miss
+		std::uint64_t resizes{};		   ///< Capacity growths, from load factor or reserve()
+		std::uint64_t reseeds{};		   ///< Rebuilds under a new key after a probe-length alarm
+		std::chrono::nanoseconds rehashTime{}; ///< Wall time spent moving elements and building tables
+	};
+
+	//=====================================================================
+	// HashMapDiff structure
+	//=====================================================================
+
+	/**
+	 * @brief Keys that differ between two HashMaps, as reported by HashMap::diff()
+	 * @tparam TKey Key type of the compared maps
+	 * @details Relative to the map diff() is called on: applying added, removed and changed
+	 *          from the other map turns it into a copy of the other map. Keys are listed in
+	 *          bucket order, not sorted.
+	 */
+	template <typename TKey>
+	struct HashMapDiff final
+	{
+		std::vector<TKey> added;   ///< Keys only present in the other map
+		std::vector<TKey> removed; ///< Keys only present in this map
+		std::vector<TKey> changed; ///< Keys present in both maps with different values
+
+		/**
+		 * @brief Check whether the compared maps were equal
+		 * @return true if no key was added, removed or changed
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] bool isEmpty() const noexcept
+		{
+			return added.empty() && removed.empty() && changed.empty();
+		}
+	};
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	class ConcurrentHashMap;
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	class ArenaHashMap;
+
+	//=====================================================================
+	// CachedHashType concept
+	//=====================================================================
+
+	/**
+	 * @brief Width of the hash HashMap caches in every bucket
+	 * @details std::uint32_t (default) keeps probe metadata at 8 bytes per bucket.
+	 *          std::uint64_t doubles that to 16 bytes, but keeps index and fingerprint
+	 *          bits to spare for tables of hundreds of millions of elements.
+	 */
+	template <typename T>
+	concept CachedHashType = std::same_as<T, std::uint32_t> || std::same_as<T, std::uint64_t>;
+
 	//=====================================================================
 	// HashMap class
 	//=====================================================================
@@ -99,6 +289,12 @@ namespace nfx::containers
 	 * @tparam TValue Value type
 	 * @tparam FnvOffsetBasis FNV-1a offset basis constant (default: 0x811C9DC5)
 	 * @tparam FnvPrime FNV-1a prime constant (default: 0x01000193)
+	 * @tparam Layout Bucket storage layout (default: HashMapLayout::Interleaved)
+	 * @tparam Allocator Allocator for key-value pairs, rebound for bucket storage (default: std::allocator)
+	 * @tparam Hasher Hash functor (default: HashMapHash; see HashPolicies.h for Crc32Hash, WyHash, Xxh3Hash
+	 *         and the flooding-resistant SipHash13)
+	 * @tparam CachedHash Width of the hash stored per bucket: std::uint32_t (default) or std::uint64_t
+	 *         (see HashMap64). The stored hash doubles as a fingerprint compared before any key.
 	 *
 	 * Features:
 	 * - Robin Hood hashing for consistent performance
@@ -106,10 +302,21 @@ namespace nfx::containers
 	 * - Bounded probe distances for predictable cache behavior
 	 * - Configurable FNV hash constants for ecosystem-wide hash compatibility
 	 * - Template specialization for optimal string handling
+	 * - Optional split metadata layout for large keys or values
+	 * - Allocator-aware: with pmr::HashMap, buckets and allocator-aware keys/values
+	 *   (e.g. std::pmr::string) all draw from one std::pmr::memory_resource
+	 * - Pluggable hash policy; the low 32 bits of its result are stored and probed, or all 64 with
+	 *   CachedHash = std::uint64_t
+	 * - Collision-attack guard: with a ReseedableHasher (e.g. SipHash13), an insertion that
+	 *   probes MAX_PROBE_DISTANCE buckets rebuilds the table under a freshly drawn key
 	 */
 	template <typename TKey, typename TValue,
 		uint32_t FnvOffsetBasis = core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS,
-		uint32_t FnvPrime = core::hashing::constants::DEFAULT_FNV_PRIME>
+		uint32_t FnvPrime = core::hashing::constants::DEFAULT_FNV_PRIME,
+		HashMapLayout Layout = HashMapLayout::Interleaved,
+		typename Allocator = std::allocator<std::pair<const TKey, TValue>>,
+		typename Hasher = HashMapHash<FnvOffsetBasis, FnvPrime>,
+		CachedHashType CachedHash = std::uint32_t>
 	class HashMap final
 	{
 		//----------------------------------------------
@@ -139,6 +346,15 @@ namespace nfx::containers
 		/** @brief Type alias for difference type */
 		using difference_type = std::ptrdiff_t;
 
+		/** @brief Type alias for allocator type (enables uses-allocator construction) */
+		using allocator_type = Allocator;
+
+		/** @brief Type alias for hash functor type */
+		using hasher = Hasher;
+
+		/** @brief Type alias for the hash cached per bucket */
+		using cached_hash_type = CachedHash;
+
 		//----------------------------------------------
 		// Construction
 		//----------------------------------------------
@@ -158,6 +374,35 @@ namespace nfx::containers
 		 */
 		NFX_META_INLINE explicit HashMap( size_t initialCapacity );
 
+		/**
+		 * @brief Constructor with initial capacity of 32 elements and a specific allocator
+		 * @param allocator Allocator used for bucket storage and allocator-aware keys/values
+		 */
+		NFX_META_INLINE explicit HashMap( const Allocator& allocator );
+
+		/**
+		 * @brief Constructor with specified initial capacity and a specific allocator
+		 * @param initialCapacity Minimum initial capacity (rounded up to power of 2)
+		 * @param allocator Allocator used for bucket storage and allocator-aware keys/values
+		 */
+		NFX_META_INLINE HashMap( size_t initialCapacity, const Allocator& allocator );
+
+		/**
+		 * @brief Allocator-extended copy constructor
+		 * @param other The map to copy
+		 * @param allocator Allocator for the copy; elements are copied into its storage
+		 */
+		NFX_META_INLINE HashMap( const HashMap& other, const Allocator& allocator );
+
+		/**
+		 * @brief Allocator-extended move constructor
+		 * @param other The map to move from
+		 * @param allocator Allocator for the new map
+		 * @details Steals the storage when allocator compares equal to other's allocator,
+		 *          otherwise moves element by element into storage from allocator
+		 */
+		NFX_META_INLINE HashMap( HashMap&& other, const Allocator& allocator );
+
 		//----------------------------------------------
 		// Core operations
 		//----------------------------------------------
@@ -171,6 +416,20 @@ namespace nfx::containers
 		template <typename KeyType = TKey>
 		NFX_META_INLINE bool tryGetValue( const KeyType& key, TValue*& outValue ) noexcept;
 
+		/**
+		 * @brief Batched lookup overlapping cache misses across keys
+		 * @tparam KeyType Key type of the input span (explicit for heterogeneous lookup, e.g. std::string_view)
+		 * @param keys Keys to search for
+		 * @param outValues Receives a pointer to each key's value, or nullptr if absent (same index as keys)
+		 * @return Number of keys found
+		 * @details Keys are processed in blocks of BATCH_LOOKUP_SIZE: every key of a block is hashed
+		 *          and its home bucket prefetched before any of them is probed, so memory latency is
+		 *          paid once per block instead of once per key. Only min(keys.size(), outValues.size())
+		 *          keys are processed.
+		 */
+		template <typename KeyType = TKey>
+		NFX_META_INLINE size_t tryGetValues( std::span<const std::type_identity_t<KeyType>> keys, std::span<TValue*> outValues ) noexcept;
+
 		//----------------------------------------------
 		// Insertion
 		//----------------------------------------------
@@ -193,6 +452,35 @@ namespace nfx::containers
 		 */
 		NFX_META_INLINE void insertOrAssign( const TKey& key, const TValue& value );
 
+		/**
+		 * @brief Insert or update a key-value pair using a heterogeneous key
+		 * @tparam KeyType Key type hashing like TKey (e.g. std::string_view or const char* for std::string keys)
+		 * @tparam ValueType Type TValue can be assigned from and constructed from
+		 * @param key The key to insert or update
+		 * @param value The value to assign or construct the new element from (forwarded)
+		 * @details String views of string keys probe as given: an existing entry is updated without
+		 *          constructing a TKey, which is only materialized when a new bucket is created.
+		 *          Other keys are converted to TKey before hashing.
+		 */
+		template <typename KeyType, typename ValueType>
+			requires( !std::is_same_v<KeyType, TKey> && std::is_constructible_v<TKey, const KeyType&> )
+		NFX_META_INLINE void insertOrAssign( const KeyType& key, ValueType&& value );
+
+		/**
+		 * @brief Construct a value in place if the key is absent
+		 * @tparam KeyType Key type hashing like TKey (e.g. std::string_view or const char* for std::string keys)
+		 * @tparam Args Constructor argument types of TValue
+		 * @param key The key to look up or insert
+		 * @param args Arguments forwarded to the TValue constructor, only when a new element is created
+		 * @return Pointer to the existing or newly created value, and true if an element was inserted
+		 * @details An existing value is left untouched and, for string views of string keys, neither
+		 *          a TKey nor a TValue is constructed. Other keys are converted to TKey before hashing.
+		 *          The pointer stays valid until the next insertion or erasure.
+		 */
+		template <typename KeyType, typename... Args>
+			requires std::is_constructible_v<TKey, const KeyType&>
+		NFX_META_INLINE std::pair<TValue*, bool> tryEmplace( const KeyType& key, Args&&... args );
+
 		//----------------------------------------------
 		// Capacity and memory management
 		//----------------------------------------------
@@ -201,11 +489,37 @@ namespace nfx::containers
 		 * @brief Reserve capacity for at least the specified number of elements
 		 * @param minCapacity Minimum capacity to reserve
 		 * @details Resizes hash table to accommodate at least minCapacity elements
-		 *          without triggering automatic resize. Capacity rounded to power of 2.
+		 *          without triggering automatic resize. Capacity rounded to power of 2
+		 *          under the doubling growth policy, used as is otherwise.
 		 *          Rehashes all existing elements to new table layout.
 		 */
 		NFX_META_INLINE void reserve( size_t minCapacity );
 
+		/**
+		 * @brief Release buckets not needed to hold the current elements
+		 * @details Rebuilds the table at the smallest capacity that keeps the load below the
+		 *          policy's maximum (rounded to a power of 2 under the doubling policy).
+		 *          Finishes any incremental resize and drops a prebuilt next table.
+		 *          Does nothing if the table is already that small.
+		 */
+		NFX_META_INLINE void shrinkToFit();
+
+		/**
+		 * @brief Change the load factor and growth factor used by future resizes
+		 * @param policy Requested policy; fields are clamped to the HashMapGrowthPolicy limits
+		 * @details Rebuilds the table right away if the current load already exceeds the new
+		 *          maximum. A lower load factor trades memory for shorter probe sequences,
+		 *          a growth factor below 200% trades more frequent resizes for less slack.
+		 */
+		NFX_META_INLINE void setGrowthPolicy( const HashMapGrowthPolicy& policy );
+
+		/**
+		 * @brief Get the load factor and growth factor in effect
+		 * @return The clamped policy
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE const HashMapGrowthPolicy& growthPolicy() const noexcept;
+
 		/**
 		 * @brief Remove a key-value pair from the map
 		 * @param key The key to remove (supports heterogeneous lookup)
@@ -216,6 +530,63 @@ namespace nfx::containers
 		template <typename KeyType = TKey>
 		NFX_META_INLINE bool erase( const KeyType& key ) noexcept;
 
+		/**
+		 * @brief Remove every element for which a predicate returns true
+		 * @tparam Predicate Callable invoked as predicate( const TKey&, const TValue& ) -> bool
+		 * @param predicate Selects the elements to remove; must not access this map
+		 * @return Number of elements removed
+		 * @details Sweeps the bucket array once, starting after an empty bucket so that each
+		 *          cluster is seen whole, and slides every kept element back over the buckets
+		 *          freed before it in its cluster (never in front of its home bucket). Robin Hood
+		 *          distances are repaired in the same pass, instead of one lookup and backward
+		 *          shift per removed key. Finishes any incremental resize first.
+		 *          If predicate throws, the cluster being swept is compacted without further
+		 *          removals, elements removed so far stay removed and the exception propagates.
+		 */
+		template <typename Predicate>
+		NFX_META_INLINE size_t eraseIf( Predicate&& predicate );
+
+		/**
+		 * @brief Keep only the elements for which a predicate returns true
+		 * @tparam Predicate Callable invoked as predicate( const TKey&, const TValue& ) -> bool
+		 * @param predicate Selects the elements to keep; must not access this map
+		 * @return Number of elements removed
+		 * @details Single-pass sweep and compaction, see eraseIf()
+		 */
+		template <typename Predicate>
+		NFX_META_INLINE size_t retain( Predicate&& predicate );
+
+		/**
+		 * @brief Remove every element, keeping the current capacity
+		 * @details Only the occupied buckets found through the occupancy bitmap are reset,
+		 *          so clearing a sparsely filled map costs O(size + capacity / 64).
+		 *          Ends any incremental resize in progress.
+		 */
+		NFX_META_INLINE void clear() noexcept;
+
+		//----------------------------------------------
+		// Incremental rehashing
+		//----------------------------------------------
+
+		/**
+		 * @brief Enable or disable incremental (latency-bounded) resizing
+		 * @param bucketsPerStep Old-table buckets migrated per mutating operation (0 disables)
+		 * @details When enabled, a resize allocates the grown table but leaves existing
+		 *          elements in the old table. Every insertOrAssign() and erase() then migrates
+		 *          up to bucketsPerStep old buckets, and lookups consult both tables until the
+		 *          old one is drained. Values below 2 are raised to 2 so migration always
+		 *          completes before the new table reaches its own load threshold.
+		 *          Disabling finishes any migration in progress.
+		 */
+		NFX_META_INLINE void setIncrementalRehash( size_t bucketsPerStep );
+
+		/**
+		 * @brief Migrate all remaining elements of an in-progress incremental resize
+		 * @details No-op when no migration is pending. Useful to pay the remaining cost
+		 *          at a convenient point (e.g. outside a latency-sensitive section).
+		 */
+		NFX_META_INLINE void completeRehash();
+
 		//----------------------------------------------
 		// State insspection
 		//----------------------------------------------
@@ -230,7 +601,7 @@ namespace nfx::containers
 
 		/**
 		 * @brief Get the current capacity of the hash table
-		 * @return Maximum elements before resize (always power of 2)
+		 * @return Maximum elements before resize (power of 2 under the default growth policy)
 		 * @details Actual capacity for efficient bitwise operations and optimal
 		 *          memory allocation patterns
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
@@ -245,6 +616,96 @@ namespace nfx::containers
 		 */
 		[[nodiscard]] NFX_META_INLINE bool isEmpty() const noexcept;
 
+		/**
+		 * @brief Check if an incremental resize is currently migrating elements
+		 * @return true while elements still live in the previous (smaller) table
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool isRehashing() const noexcept;
+
+		//----------------------------------------------
+		// Set algebra
+		//----------------------------------------------
+
+		/**
+		 * @brief Insert or overwrite every element of another map
+		 * @param other Map whose elements are copied; its values win on common keys
+		 * @details O(other.size()). When both maps hash identically (stateless hasher, or
+		 *          seeded hashers sharing a key) the cached hashes of other are reused and no
+		 *          key is hashed again. Merging a map into itself is a no-op.
+		 */
+		NFX_META_INLINE void mergeFrom( const HashMap& other );
+
+		/**
+		 * @brief Remove every element whose key is absent from another map
+		 * @param other Map whose key set is kept; values of this map are left untouched
+		 * @return Number of elements removed
+		 * @details O(size()), one eraseIf() sweep probing other with the cached hashes
+		 */
+		NFX_META_INLINE size_t intersectWith( const HashMap& other );
+
+		/**
+		 * @brief Build a map of the elements whose key is absent from another map
+		 * @param other Map whose keys are excluded
+		 * @return New map with this map's allocator and hash functor
+		 * @details O(size()); neither map is modified
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE HashMap difference( const HashMap& other ) const;
+
+		/**
+		 * @brief List the keys added, removed or changed in another map relative to this one
+		 * @param other Map to compare against (e.g. a newer configuration snapshot)
+		 * @return Added, removed and changed keys
+		 * @details O(size() + other.size()): every element of each map is probed once in the
+		 *          other map using its cached hash. Values are compared with operator==.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE HashMapDiff<TKey> diff( const HashMap& other ) const;
+
+		//----------------------------------------------
+		// Statistics
+		//----------------------------------------------
+
+		/**
+		 * @brief Inspect probe lengths, occupancy and (when recorded) operation counters
+		 * @return Table shape computed from the buckets plus the counters since construction
+		 *         or the last resetStats()
+		 * @details Walks every bucket: O(capacity) time, intended for periodic export to a
+		 *          metrics pipeline rather than per-operation use. Safe to call concurrently
+		 *          with lookups, not with modifications.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline HashMapStats stats() const;
+
+		/**
+		 * @brief Zero the recorded counters
+		 * @details No effect unless NFX_META_HASHMAP_STATS is enabled
+		 */
+		NFX_META_INLINE void resetStats() noexcept;
+
+		//----------------------------------------------
+		// Allocator support
+		//----------------------------------------------
+
+		/**
+		 * @brief Get a copy of the allocator used by this map
+		 * @return The allocator the map was constructed with
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE allocator_type allocator() const noexcept;
+
+		//----------------------------------------------
+		// Hashing
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the hash functor used by this map
+		 * @return The functor, including its current key for seeded policies
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE const hasher& hashFunction() const noexcept;
+
 		//----------------------------------------------
 		// STL-compatible iteration support
 		//----------------------------------------------
@@ -277,28 +738,265 @@ namespace nfx::containers
 		 * @brief Compare two HashMaps for equality
 		 * @param other The other HashMap to compare with
 		 * @return true if both maps contain the same key-value pairs
+		 * @details O(size()): each element is looked up in other with its cached hash
 		 */
 		[[nodiscard]] bool operator==( const HashMap& other ) const noexcept;
 
 	private:
+		/** @brief Sharded wrapper reuses the hash it computed for shard selection */
+		template <typename, typename, uint32_t, uint32_t, HashMapLayout>
+		friend class ConcurrentHashMap;
+
+		/** @brief Arena wrapper probes before copying a key, then inserts with the same hash */
+		template <typename, uint32_t, uint32_t, HashMapLayout>
+		friend class ArenaHashMap;
+
+		/** @brief Set wrapper sizes bulk insertions with the map's load factor */
+		template <typename, uint32_t, uint32_t, typename, typename>
+		friend class HashSet;
+
 		//----------------------------------------------
 		// Robin Hood Hashing bucket structure
 		//----------------------------------------------
 
 		/**
-		 * @brief Bucket structure for Robin Hood hashing algorithm
+		 * @brief Probe metadata for one bucket
+		 * @details Everything the Robin Hood probe loop inspects before it needs the key:
+		 *          8 bytes per bucket with 32-bit cached hashes, so a cache line covers 8 consecutive
+		 *          buckets in split layout (16 bytes and 4 buckets with 64-bit cached hashes)
+		 */
+		struct Metadata
+		{
+			CachedHash hash{};		  ///< Cached hash value for fast comparison
+			std::uint16_t distance{}; ///< Robin Hood displacement distance
+			bool occupied{};		  ///< Bucket occupancy flag
+		};
+
+		/**
+		 * @brief Key-value payload for one bucket
+		 * @details Layout-compatible with std::pair<const TKey, TValue> for iterator access.
+		 *          The allocator-extended constructors let scoped allocators (std::pmr) hand
+		 *          their memory resource down to allocator-aware keys and values.
+		 */
+		struct Slot
+		{
+			using allocator_type = Allocator;
+
+			TKey key{};		///< The stored key
+			TValue value{}; ///< The associated value
+
+			Slot() = default;
+
+			Slot( std::allocator_arg_t, const Allocator& allocator )
+				: key( std::make_obj_using_allocator<TKey>( allocator ) ),
+				  value( std::make_obj_using_allocator<TValue>( allocator ) )
+			{
+			}
+
+			template <typename KeyArg, typename... ValueArgs>
+				requires std::is_constructible_v<TKey, const KeyArg&>
+			Slot( std::allocator_arg_t, const Allocator& allocator, const KeyArg& keyArg, ValueArgs&&... valueArgs )
+				: key( std::make_obj_using_allocator<TKey>( allocator, keyArg ) ),
+				  value( std::make_obj_using_allocator<TValue>( allocator, std::forward<ValueArgs>( valueArgs )... ) )
+			{
+			}
+
+			Slot( std::allocator_arg_t, const Allocator& allocator, const Slot& other )
+				: key( std::make_obj_using_allocator<TKey>( allocator, other.key ) ),
+				  value( std::make_obj_using_allocator<TValue>( allocator, other.value ) )
+			{
+			}
+
+			Slot( std::allocator_arg_t, const Allocator& allocator, Slot&& other )
+				: key( std::make_obj_using_allocator<TKey>( allocator, std::move( other.key ) ) ),
+				  value( std::make_obj_using_allocator<TValue>( allocator, std::move( other.value ) ) )
+			{
+			}
+		};
+
+		/**
+		 * @brief Bucket structure for Robin Hood hashing algorithm (interleaved layout)
 		 * @details Each bucket stores key-value pair with cached hash and displacement
 		 *          distance for optimal cache performance and probe sequence bounds
 		 */
 		struct Bucket
 		{
-			TKey key{};				  ///< The stored key
-			TValue value{};			  ///< The associated value
-			std::uint32_t hash{};	  ///< Cached hash value for fast comparison
-			std::uint16_t distance{}; ///< Robin Hood displacement distance
-			bool occupied{};		  ///< Bucket occupancy flag
+			using allocator_type = Allocator;
+
+			Slot slot{};	 ///< Key-value payload
+			Metadata meta{}; ///< Probe metadata
+
+			Bucket() = default;
+
+			Bucket( std::allocator_arg_t, const Allocator& allocator )
+				: slot( std::allocator_arg, allocator )
+			{
+			}
+
+			Bucket( std::allocator_arg_t, const Allocator& allocator, const Bucket& other )
+				: slot( std::allocator_arg, allocator, other.slot ),
+				  meta( other.meta )
+			{
+			}
+
+			Bucket( std::allocator_arg_t, const Allocator& allocator, Bucket&& other )
+				: slot( std::allocator_arg, allocator, std::move( other.slot ) ),
+				  meta( other.meta )
+			{
+			}
+		};
+
+		/** @brief Allocator rebound to a bucket storage element type */
+		template <typename T>
+		using RebindAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+		/**
+		 * @brief One bit per bucket, set while the bucket holds an element
+		 * @details Iteration, clear() and full rehashes scan 64 buckets per word and jump
+		 *          to the next element with countr_zero instead of loading every bucket's
+		 *          metadata, so their cost follows the element count rather than the capacity
+		 */
+		struct OccupancyBitmap
+		{
+			std::vector<std::uint64_t, RebindAllocator<std::uint64_t>> words; ///< Bucket i is bit i % 64 of word i / 64
+
+			explicit OccupancyBitmap( const Allocator& allocator )
+				: words( RebindAllocator<std::uint64_t>( allocator ) )
+			{
+			}
+			OccupancyBitmap( const OccupancyBitmap& other, const Allocator& allocator )
+				: words( other.words, RebindAllocator<std::uint64_t>( allocator ) )
+			{
+			}
+			OccupancyBitmap( OccupancyBitmap&& other, const Allocator& allocator )
+				: words( std::move( other.words ), RebindAllocator<std::uint64_t>( allocator ) )
+			{
+			}
+
+			void reserve( size_t capacity ) { words.reserve( ( capacity + 63 ) / 64 ); }
+			void resize( size_t capacity ) { words.resize( ( capacity + 63 ) / 64 ); }
+			void set( size_t pos ) noexcept { words[pos >> 6] |= std::uint64_t{ 1 } << ( pos & 63 ); }
+			void reset( size_t pos ) noexcept { words[pos >> 6] &= ~( std::uint64_t{ 1 } << ( pos & 63 ) ); }
+
+			/** @brief First occupied bucket in [pos, end), or end if there is none */
+			size_t next( size_t pos, size_t end ) const noexcept
+			{
+				if ( pos >= end )
+				{
+					return end;
+				}
+
+				const size_t lastWord{ ( end - 1 ) >> 6 };
+				size_t index{ pos >> 6 };
+				std::uint64_t word{ words[index] & ( ~std::uint64_t{ 0 } << ( pos & 63 ) ) };
+				while ( word == 0 )
+				{
+					if ( ++index > lastWord )
+					{
+						return end;
+					}
+					word = words[index];
+				}
+
+				return std::min( end, ( index << 6 ) + static_cast<size_t>( std::countr_zero( word ) ) );
+			}
+		};
+
+		/**
+		 * @brief Bucket storage with key, value and metadata in a single array
+		 */
+		struct InterleavedTable
+		{
+			std::vector<Bucket, RebindAllocator<Bucket>> buckets; ///< Contiguous bucket array
+			OccupancyBitmap occupancy;							  ///< Occupied buckets, same index as buckets
+
+			explicit InterleavedTable( const Allocator& allocator )
+				: buckets( RebindAllocator<Bucket>( allocator ) ),
+				  occupancy( allocator )
+			{
+			}
+			InterleavedTable( const InterleavedTable& other, const Allocator& allocator )
+				: buckets( other.buckets, RebindAllocator<Bucket>( allocator ) ),
+				  occupancy( other.occupancy, allocator )
+			{
+			}
+			InterleavedTable( InterleavedTable&& other, const Allocator& allocator )
+				: buckets( std::move( other.buckets ), RebindAllocator<Bucket>( allocator ) ),
+				  occupancy( std::move( other.occupancy ), allocator )
+			{
+			}
+
+			Allocator allocator() const noexcept { return Allocator( buckets.get_allocator() ); }
+
+			void reserve( size_t capacity )
+			{
+				buckets.reserve( capacity );
+				occupancy.reserve( capacity );
+			}
+			void resize( size_t capacity )
+			{
+				buckets.resize( capacity );
+				occupancy.resize( capacity );
+			}
+			size_t size() const noexcept { return buckets.size(); }
+			Metadata& meta( size_t pos ) noexcept { return buckets[pos].meta; }
+			const Metadata& meta( size_t pos ) const noexcept { return buckets[pos].meta; }
+			Slot& slot( size_t pos ) noexcept { return buckets[pos].slot; }
+			const Slot& slot( size_t pos ) const noexcept { return buckets[pos].slot; }
+		};
+
+		/**
+		 * @brief Bucket storage with metadata and key-value payload in parallel arrays
+		 */
+		struct SplitTable
+		{
+			std::vector<Metadata, RebindAllocator<Metadata>> metadata; ///< Packed probe metadata
+			std::vector<Slot, RebindAllocator<Slot>> slots;			   ///< Key-value payload, same index as metadata
+			OccupancyBitmap occupancy;								   ///< Occupied buckets, same index as metadata
+
+			explicit SplitTable( const Allocator& allocator )
+				: metadata( RebindAllocator<Metadata>( allocator ) ),
+				  slots( RebindAllocator<Slot>( allocator ) ),
+				  occupancy( allocator )
+			{
+			}
+			SplitTable( const SplitTable& other, const Allocator& allocator )
+				: metadata( other.metadata, RebindAllocator<Metadata>( allocator ) ),
+				  slots( other.slots, RebindAllocator<Slot>( allocator ) ),
+				  occupancy( other.occupancy, allocator )
+			{
+			}
+			SplitTable( SplitTable&& other, const Allocator& allocator )
+				: metadata( std::move( other.metadata ), RebindAllocator<Metadata>( allocator ) ),
+				  slots( std::move( other.slots ), RebindAllocator<Slot>( allocator ) ),
+				  occupancy( std::move( other.occupancy ), allocator )
+			{
+			}
+
+			Allocator allocator() const noexcept { return Allocator( metadata.get_allocator() ); }
+
+			void reserve( size_t capacity )
+			{
+				metadata.reserve( capacity );
+				slots.reserve( capacity );
+				occupancy.reserve( capacity );
+			}
+			void resize( size_t capacity )
+			{
+				metadata.resize( capacity );
+				slots.resize( capacity );
+				occupancy.resize( capacity );
+			}
+			size_t size() const noexcept { return metadata.size(); }
+			Metadata& meta( size_t pos ) noexcept { return metadata[pos]; }
+			const Metadata& meta( size_t pos ) const noexcept { return metadata[pos]; }
+			Slot& slot( size_t pos ) noexcept { return slots[pos]; }
+			const Slot& slot( size_t pos ) const noexcept { return slots[pos]; }
 		};
 
+		/** @brief Bucket storage selected by the Layout template parameter */
+		using Table = std::conditional_t<Layout == HashMapLayout::Split, SplitTable, InterleavedTable>;
+
 		/**
 		 * @brief Initial hash table capacity (power of 2 for bitwise operations)
 		 * @details 32 elements provides good balance between memory usage and
@@ -307,30 +1005,179 @@ namespace nfx::containers
 		static constexpr size_t INITIAL_CAPACITY = 32;
 
 		/**
-		 * @brief Load factor threshold as percentage (75%)
-		 * @details Resize triggered when (size * 100) >= (capacity * 75)
-		 *          Balances space efficiency with probe sequence performance
+		 * @brief Default load factor threshold as percentage (75%)
+		 * @details Resize triggered when (size * 100) >= (capacity * 75) under the default
+		 *          HashMapGrowthPolicy. Balances space efficiency with probe sequence performance
 		 */
 		static constexpr size_t MAX_LOAD_FACTOR_PERCENT = 75;
 
+		/**
+		 * @brief Minimum buckets migrated per operation in incremental mode
+		 * @details Under the default policy a resize starts at 37.5% load of the doubled table
+		 *          and the next one is due at 75%, leaving at least 0.75 * oldCapacity insertions
+		 *          to drain oldCapacity buckets: 2 buckets per operation always finishes in time.
+		 *          Smaller growth factors may leave a migration unfinished, which the next
+		 *          resize then completes before swapping tables.
+		 *          The next table is constructed in chunks from two thirds of the maximum load
+		 *          on, so that allocation is not paid by the insert that triggers resize.
+		 */
+		static constexpr size_t MIN_REHASH_STEP = 2;
+
+		/**
+		 * @brief Buckets constructed (next table) or destroyed (drained table) per migration step
+		 * @details 2 * capacity buckets must be built within 0.25 * capacity insertions: with
+		 *          MIN_REHASH_STEP = 2, 8 buckets per step unit covers that with no slack needed
+		 */
+		static constexpr size_t BUILD_BUCKETS_PER_STEP = 8;
+
+		/**
+		 * @brief Number of keys hashed and prefetched ahead of probing in tryGetValues()
+		 * @details Roughly the number of outstanding L1 misses a modern core can track
+		 */
+		static constexpr size_t BATCH_LOOKUP_SIZE = 16;
+
+		/**
+		 * @brief Probe distance that makes a ReseedableHasher draw a new key
+		 * @details Robin Hood probes stay in the low tens at 75% load even for millions of
+		 *          elements, so reaching 128 means the keys were chosen to collide. Reseeding also keeps
+		 *          the 16-bit distance counter far from overflow.
+		 */
+		static constexpr std::uint16_t MAX_PROBE_DISTANCE = 128;
+
+		/** @brief Sentinel position returned when a key is not found */
+		static constexpr size_t NPOS = static_cast<size_t>( -1 );
+
+		/**
+		 * @brief Whether a heterogeneous key is hashed and compared as given
+		 * @details Only string views of string keys hash like TKey. Any other key, e.g. an int for
+		 *          std::uint32_t keys, is converted to TKey first: the hasher's integer overload is
+		 *          a template on the argument type and would hash the unconverted bits.
+		 */
+		template <typename KeyType>
+		static constexpr bool IS_TRANSPARENT_KEY = std::is_convertible_v<const TKey&, std::string_view> &&
+												   std::is_convertible_v<const KeyType&, std::string_view>;
+
 		/**
 		 * @brief Main bucket storage with contiguous memory layout
-		 * @details Vector provides cache-friendly linear probing and automatic
+		 * @details Vector-backed storage provides cache-friendly linear probing and automatic
 		 *          memory management with strong exception safety guarantees
 		 */
-		std::vector<Bucket> m_buckets;
+		Table m_table;
 
-		size_t m_size{};					   ///< Current number of elements
+		size_t m_size{};					   ///< Current number of elements (both tables)
 		size_t m_capacity{ INITIAL_CAPACITY }; ///< Current hash table capacity
-		size_t m_mask{ INITIAL_CAPACITY - 1 }; ///< Bitwise mask for hash modulo
+		size_t m_mask{ INITIAL_CAPACITY - 1 }; ///< Bitwise mask for hash modulo (0 for non-power-of-2 capacity)
+
+		/**
+		 * @brief Previous table being drained by an incremental resize
+		 * @details Probed by lookups only while isRehashing(). Elements are migrated a whole
+		 *          cluster at a time, so probe chains of the remaining elements never cross a
+		 *          migrated (now empty) bucket. Once drained, its buckets are destroyed in chunks.
+		 */
+		Table m_oldTable;
+
+		/**
+		 * @brief Doubled table under construction for the next incremental resize
+		 * @details Storage is reserved once, then buckets are default-constructed in chunks
+		 */
+		Table m_nextTable;
+
+		size_t m_oldCapacity{};		 ///< Capacity of m_oldTable (0 when not rehashing)
+		size_t m_oldMask{};			 ///< Bitwise mask for m_oldTable (0 for non-power-of-2 capacity)
+		size_t m_migratePos{};		 ///< Next m_oldTable bucket to migrate
+		size_t m_migrateRemaining{}; ///< m_oldTable buckets not yet visited by migration
+		size_t m_rehashStep{};		 ///< Buckets migrated per mutating operation (0 = stop-the-world resize)
+		HashMapGrowthPolicy m_growth{}; ///< Load factor and growth factor for resizes
 
 		/**
 		 * @brief Hash function object with zero-space optimization
-		 * @details Uses high-performance HashMapHash functor providing string hashing
+		 * @details Defaults to the HashMapHash functor providing string hashing
 		 *          and proper integer mixing for optimal Robin Hood performance.
 		 *          Supports heterogeneous lookup while maintaining excellent hash distribution.
 		 */
-		NFX_META_NO_UNIQUE_ADDRESS HashMapHash<FnvOffsetBasis> m_hasher;
+		NFX_META_NO_UNIQUE_ADDRESS Hasher m_hasher;
+
+		//----------------------------------------------
+		// Statistics recording
+		//----------------------------------------------
+
+#if NFX_META_HASHMAP_STATS
+		/**
+		 * @brief Operation counters behind HashMapStats
+		 * @details Relaxed atomics: lookups run concurrently under ConcurrentHashMap's shared
+		 *          locks and SnapshotHashMap's readers. Copies take a snapshot of the values.
+		 */
+		struct StatsCounters
+		{
+			std::atomic<std::uint64_t> lookups{};
+			std::atomic<std::uint64_t> hits{};
+			std::atomic<std::uint64_t> hitProbes{};
+			std::atomic<std::uint64_t> missProbes{};
+			std::atomic<std::uint64_t> resizes{};
+			std::atomic<std::uint64_t> reseeds{};
+			std::atomic<std::uint64_t> rehashNanoseconds{};
+
+			StatsCounters() = default;
+			StatsCounters( const StatsCounters& other ) noexcept { *this = other; }
+			StatsCounters& operator=( const StatsCounters& other ) noexcept
+			{
+				lookups = other.lookups.load( std::memory_order_relaxed );
+				hits = other.hits.load( std::memory_order_relaxed );
+				hitProbes = other.hitProbes.load( std::memory_order_relaxed );
+				missProbes = other.missProbes.load( std::memory_order_relaxed );
+				resizes = other.resizes.load( std::memory_order_relaxed );
+				reseeds = other.reseeds.load( std::memory_order_relaxed );
+				rehashNanoseconds = other.rehashNanoseconds.load( std::memory_order_relaxed );
+				return *this;
+			}
+		};
+
+		mutable StatsCounters m_stats; ///< Counters reported by stats()
+
+		/**
+		 * @brief Adds the lifetime of a scope to the rehash time counter
+		 */
+		class RehashTimer
+		{
+		public:
+			explicit RehashTimer( const HashMap& map ) noexcept
+				: m_counter{ map.m_stats.rehashNanoseconds },
+				  m_start{ std::chrono::steady_clock::now() }
+			{
+			}
+			~RehashTimer()
+			{
+				const auto elapsed{ std::chrono::steady_clock::now() - m_start };
+				m_counter.fetch_add( static_cast<std::uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count() ), std::memory_order_relaxed );
+			}
+			RehashTimer( const RehashTimer& ) = delete;
+			RehashTimer& operator=( const RehashTimer& ) = delete;
+
+		private:
+			std::atomic<std::uint64_t>& m_counter;
+			std::chrono::steady_clock::time_point m_start;
+		};
+#else
+		/** @brief No-op stand-in when statistics are compiled out */
+		class RehashTimer
+		{
+		public:
+			explicit RehashTimer( const HashMap& ) noexcept {}
+		};
+#endif
+
+		/**
+		 * @brief Count one lookup and the buckets it examined
+		 * @param hit Whether the key was found
+		 * @param probes Buckets examined across both tables
+		 */
+		NFX_META_INLINE void recordLookup( bool hit, size_t probes ) const noexcept;
+
+		/** @brief Count one capacity growth */
+		NFX_META_INLINE void recordResize() noexcept;
+
+		/** @brief Count one rebuild under a new hash key */
+		NFX_META_INLINE void recordReseed() noexcept;
 
 		//----------------------------------------------
 		// Internal implementation
@@ -338,39 +1185,219 @@ namespace nfx::containers
 
 		/**
 		 * @brief Internal insert or assign implementation with perfect forwarding
+		 * @tparam KeyType Key type (TKey or a heterogeneous equivalent)
 		 * @tparam ValueType Deduced value type supporting move/copy semantics
 		 * @param key The key to insert or update
+		 * @param hash Precomputed hash of the key
 		 * @param value The value to forward (preserves value category)
+		 * @details Updates the value found by emplaceInternal(), which only consumes value
+		 *          when it creates a new element.
+		 */
+		template <typename KeyType, typename ValueType>
+		inline void insertOrAssignInternal( const KeyType& key, CachedHash hash, ValueType&& value );
+
+		/**
+		 * @brief Find a key or insert it with a value constructed from args
+		 * @tparam KeyType Key type (TKey or a heterogeneous equivalent)
+		 * @tparam Args Constructor argument types of TValue
+		 * @param key The key to look up or insert
+		 * @param hash Precomputed hash of the key
+		 * @param args Arguments forwarded to the TValue constructor on insertion only
+		 * @return Pointer to the value and true if a new element was inserted
 		 * @details Core Robin Hood hashing implementation with displacement algorithm.
-		 *          Handles both insertion of new elements and updates of existing keys.
+		 *          TKey and TValue are constructed only once the key is known to be absent.
+		 */
+		template <typename KeyType, typename... Args>
+		inline std::pair<TValue*, bool> emplaceInternal( const KeyType& key, CachedHash hash, Args&&... args );
+
+		/**
+		 * @brief Internal erase implementation
+		 * @param key The key to remove
+		 * @param hash Precomputed hash of the key
+		 * @return true if the key was found and removed, false otherwise
+		 */
+		template <typename KeyType>
+		NFX_META_INLINE bool eraseInternal( const KeyType& key, CachedHash hash ) noexcept;
+
+		/**
+		 * @brief Locate a key's value in the current and (while rehashing) previous table
+		 * @param key The key to search for
+		 * @param hash Precomputed hash of the key
+		 * @return Pointer to the value, or nullptr if absent
+		 */
+		template <typename KeyType>
+		NFX_META_INLINE TValue* lookup( const KeyType& key, CachedHash hash ) noexcept;
+
+		/**
+		 * @brief Locate a key in the given table
+		 * @param table Bucket storage to probe
+		 * @param capacity Number of buckets in that table
+		 * @param mask Bitwise mask of that table (0 for non-power-of-2 capacity)
+		 * @param key The key to search for
+		 * @param hash Precomputed hash of the key
+		 * @return Bucket position of the key, or NPOS if absent
+		 */
+		template <typename KeyType>
+		NFX_META_INLINE size_t findPosition( const Table& table, size_t capacity, size_t mask, const KeyType& key, CachedHash hash ) const noexcept;
+
+		/**
+		 * @brief Locate a key in the given table and report the probe length
+		 * @param table Bucket storage to probe
+		 * @param capacity Number of buckets in that table
+		 * @param mask Bitwise mask of that table (0 for non-power-of-2 capacity)
+		 * @param key The key to search for
+		 * @param hash Precomputed hash of the key
+		 * @param probes Receives the number of buckets examined
+		 * @return Bucket position of the key, or NPOS if absent
+		 */
+		template <typename KeyType>
+		NFX_META_INLINE size_t findPosition( const Table& table, size_t capacity, size_t mask, const KeyType& key, CachedHash hash, size_t& probes ) const noexcept;
+
+		/**
+		 * @brief Locate a key's bucket without touching the recorded counters
+		 * @param key The key to search for
+		 * @param hash Hash of the key under this map's hash functor
+		 * @return Pointer to the key-value payload, or nullptr if absent
+		 */
+		NFX_META_INLINE const Slot* findSlot( const TKey& key, CachedHash hash ) const noexcept;
+
+		/**
+		 * @brief Check whether stored hashes of another map are valid in this one
+		 * @param other Map whose cached hashes would be reused
+		 * @return true if the hash functors are stateless or compare equal
+		 */
+		NFX_META_INLINE bool sharesHashWith( const HashMap& other ) const noexcept;
+
+		/**
+		 * @brief Hash of a key taken from another map, reusing its cached hash when possible
+		 * @param source Map the key is stored in
+		 * @param key The stored key
+		 * @param sourceHash Hash cached for the key in source
+		 * @return Hash of key under this map's hash functor
+		 */
+		NFX_META_INLINE CachedHash hashFrom( const HashMap& source, const TKey& key, CachedHash sourceHash ) const noexcept;
+
+		/**
+		 * @brief Visit every occupied bucket of the old and current table
+		 * @tparam Fn Callable invoked as fn( const Slot&, CachedHash hash ) -> bool
+		 * @param fn Visitor; returning false stops the walk
+		 * @return false if fn stopped the walk, true otherwise
+		 */
+		template <typename Fn>
+		NFX_META_INLINE bool forEachOccupied( Fn&& fn ) const;
+
+		/**
+		 * @brief Single-pass bulk erase behind eraseIf() and intersectWith()
+		 * @tparam Predicate Callable invoked as predicate( const Slot&, CachedHash hash ) -> bool
+		 * @param predicate Selects the elements to remove
+		 * @return Number of elements removed
 		 */
-		template <typename ValueType>
-		inline void insertOrAssignInternal( const TKey& key, ValueType&& value );
+		template <typename Predicate>
+		NFX_META_INLINE size_t eraseWhere( Predicate&& predicate );
+
+		/**
+		 * @brief Robin Hood placement of an element known to be absent from m_table
+		 * @param pos Starting probe position
+		 * @param slot Key-value payload (moved into the table)
+		 * @param meta Metadata with hash and distance matching pos
+		 * @return Largest probe distance written, for the element or any element it displaced
+		 * @details Shared by regular insertion, full rehash and incremental migration;
+		 *          reuses the cached hash instead of rehashing the key. Does not touch m_size.
+		 */
+		NFX_META_INLINE std::uint16_t placeNew( size_t pos, Slot&& slot, Metadata meta );
+
+		/**
+		 * @brief Migrate up to budget buckets from m_oldTable into m_table
+		 * @param budget Number of old buckets to process
+		 * @details A cluster that has been started is always finished, so the budget may be
+		 *          exceeded by at most the length of one probe cluster
+		 */
+		NFX_META_INLINE void migrateBuckets( size_t budget );
+
+		/**
+		 * @brief Perform one bounded unit of incremental resize work
+		 * @details Migrates old buckets, destroys a chunk of a drained table and builds a
+		 *          chunk of the next table, depending on the current state
+		 */
+		NFX_META_INLINE void advanceRehash();
 
 		/**
 		 * @brief Check if resize is needed based on load factor
-		 * @return true if current load exceeds MAX_LOAD_FACTOR_PERCENT threshold
+		 * @return true if current load reaches the growth policy's maximum load factor
 		 * @details Uses integer arithmetic to avoid floating-point operations:
-		 *          resize when (size * 100) >= (capacity * 75)
+		 *          resize when (size * 100) >= (capacity * maxLoadFactorPercent)
+		 *          or when one more element would leave no empty bucket
 		 */
 		inline bool shouldResize() const noexcept;
 
 		/**
-		 * @brief Resize hash table to double capacity and rehash all elements
-		 * @details Doubles capacity, allocates new bucket array, and rehashes all
-		 *          existing elements. Provides strong exception safety - original
-		 *          data preserved if rehashing fails.
+		 * @brief Grow the hash table by the growth policy's factor
+		 * @details Stop-the-world mode rehashes all elements immediately. Incremental
+		 *          mode finishes any pending migration, swaps in the prebuilt next table
+		 *          and lets subsequent operations drain the previous one.
 		 */
 		NFX_META_INLINE void resize();
 
+		/**
+		 * @brief Rehash all elements into a freshly allocated table
+		 * @param newCapacity New capacity (at least 1, any value)
+		 */
+		NFX_META_INLINE void rehashAll( size_t newCapacity );
+
+		/**
+		 * @brief Capacity the next resize grows to under the growth policy
+		 * @return Doubled capacity, or capacity * growthPercent / 100 (at least one more bucket)
+		 */
+		NFX_META_INLINE size_t grownCapacity() const noexcept;
+
+		/**
+		 * @brief Capacity used for an explicit size request under the growth policy
+		 * @param minCapacity Requested number of buckets
+		 * @return Next power of 2 under the doubling policy, minCapacity otherwise (at least 1)
+		 */
+		NFX_META_INLINE size_t capacityFor( size_t minCapacity ) const noexcept;
+
+		/**
+		 * @brief Bitwise mask used for a capacity
+		 * @param capacity Number of buckets
+		 * @return capacity - 1 for a power of 2, 0 otherwise (selects the multiply-shift mapping)
+		 */
+		static NFX_META_INLINE size_t maskFor( size_t capacity ) noexcept;
+
+		/**
+		 * @brief Home bucket of a hash
+		 * @param hash Cached 32-bit hash
+		 * @param capacity Number of buckets in the table
+		 * @param mask Bitwise mask of the table, 0 for non-power-of-2 capacity
+		 * @return hash & mask, or (hash * capacity) >> 32 when mask is 0
+		 */
+		static NFX_META_INLINE size_t homeBucket( CachedHash hash, size_t capacity, size_t mask ) noexcept;
+
+		/**
+		 * @brief Bucket after pos in probe order
+		 * @param pos Current bucket
+		 * @param capacity Number of buckets in the table
+		 * @return pos + 1, wrapping to 0 at capacity
+		 */
+		static NFX_META_INLINE size_t nextBucket( size_t pos, size_t capacity ) noexcept;
+
+		/**
+		 * @brief Draw a new hash key and rebuild the table at the same capacity
+		 * @details Only instantiated for a ReseedableHasher. Finishes any incremental
+		 *          migration first, since the old table's hashes are invalidated too.
+		 */
+		inline void reseedAndRebuild();
+
 		/**
 		 * @brief Erase element at specific position using backward shift deletion
+		 * @param table Bucket storage containing the element
+		 * @param capacity Number of buckets in that table
 		 * @param pos Position in bucket array to erase
 		 * @details Implements Robin Hood backward shift to maintain compact
 		 *          representation without tombstones. Adjusts displacement distances
 		 *          of shifted elements to preserve algorithm invariants.
 		 */
-		NFX_META_INLINE void eraseAtPosition( size_t pos ) noexcept;
+		static NFX_META_INLINE void eraseAtPosition( Table& table, size_t capacity, size_t pos ) noexcept;
 
 		/**
 		 * @brief Compare keys with heterogeneous lookup support for string types
@@ -418,10 +1445,14 @@ namespace nfx::containers
 
 			/**
 			 * @brief Construct iterator from bucket range
-			 * @param bucket Starting bucket pointer
-			 * @param end End bucket pointer (one past last bucket)
+			 * @param table Bucket storage being iterated
+			 * @param pos Starting bucket position
+			 * @param end End bucket position (one past last bucket)
+			 * @param next Table to continue with after end (old-then-new during incremental rehash)
+			 * @param nextEnd End bucket position of next
 			 */
-			iterator( Bucket* bucket, Bucket* end ) : m_bucket( bucket ), m_end( end )
+			iterator( Table* table, size_t pos, size_t end, Table* next = nullptr, size_t nextEnd = 0 )
+				: m_table( table ), m_next( next ), m_pos( pos ), m_end( end ), m_nextEnd( nextEnd )
 			{
 				skipToOccupied();
 			}
@@ -432,7 +1463,7 @@ namespace nfx::containers
 			 */
 			reference operator*() const
 			{
-				return reinterpret_cast<reference>( *m_bucket );
+				return reinterpret_cast<reference>( m_table->slot( m_pos ) );
 			}
 
 			/**
@@ -441,7 +1472,7 @@ namespace nfx::containers
 			 */
 			pointer operator->() const
 			{
-				return reinterpret_cast<pointer>( m_bucket );
+				return reinterpret_cast<pointer>( &m_table->slot( m_pos ) );
 			}
 
 			/**
@@ -450,7 +1481,7 @@ namespace nfx::containers
 			 */
 			iterator& operator++()
 			{
-				++m_bucket;
+				++m_pos;
 				skipToOccupied();
 				return *this;
 			}
@@ -471,30 +1502,44 @@ namespace nfx::containers
 			 * @param other Iterator to compare with
 			 * @return true if iterators point to the same bucket
 			 */
-			bool operator==( const iterator& other ) const { return m_bucket == other.m_bucket; }
+			bool operator==( const iterator& other ) const { return m_pos == other.m_pos && m_table == other.m_table; }
 
 			/**
 			 * @brief Inequality comparison operator
 			 * @param other Iterator to compare with
 			 * @return true if iterators point to different buckets
 			 */
-			bool operator!=( const iterator& other ) const { return m_bucket != other.m_bucket; }
+			bool operator!=( const iterator& other ) const { return !( *this == other ); }
 
 		private:
 			/**
 			 * @brief Skip to next occupied bucket
-			 * @details Advances bucket pointer until an occupied bucket is found or end is reached
+			 * @details Jumps through the occupancy bitmap to the next occupied bucket or end,
+			 *          continuing into the next table when the current one is exhausted
 			 */
 			void skipToOccupied()
 			{
-				while ( m_bucket != m_end && !m_bucket->occupied )
+				for ( ;; )
 				{
-					++m_bucket;
+					m_pos = m_table->occupancy.next( m_pos, m_end );
+
+					if ( m_pos != m_end || m_next == nullptr )
+					{
+						return;
+					}
+
+					m_table = m_next;
+					m_end = m_nextEnd;
+					m_pos = 0;
+					m_next = nullptr;
 				}
 			}
 
-			Bucket* m_bucket = nullptr;
-			Bucket* m_end = nullptr;
+			Table* m_table = nullptr;
+			Table* m_next = nullptr;
+			size_t m_pos = 0;
+			size_t m_end = 0;
+			size_t m_nextEnd = 0;
 			friend class HashMap;
 			friend class const_iterator;
 		};
@@ -527,10 +1572,14 @@ namespace nfx::containers
 
 			/**
 			 * @brief Construct const iterator from bucket range
-			 * @param bucket Starting bucket pointer
-			 * @param end End bucket pointer (one past last bucket)
+			 * @param table Bucket storage being iterated
+			 * @param pos Starting bucket position
+			 * @param end End bucket position (one past last bucket)
+			 * @param next Table to continue with after end (old-then-new during incremental rehash)
+			 * @param nextEnd End bucket position of next
 			 */
-			const_iterator( const Bucket* bucket, const Bucket* end ) : m_bucket( bucket ), m_end( end )
+			const_iterator( const Table* table, size_t pos, size_t end, const Table* next = nullptr, size_t nextEnd = 0 )
+				: m_table( table ), m_next( next ), m_pos( pos ), m_end( end ), m_nextEnd( nextEnd )
 			{
 				skipToOccupied();
 			}
@@ -539,7 +1588,10 @@ namespace nfx::containers
 			 * @brief Convert from non-const iterator
 			 * @param it Non-const iterator to convert from
 			 */
-			const_iterator( const iterator& it ) : m_bucket( it.m_bucket ), m_end( it.m_end ) {}
+			const_iterator( const iterator& it )
+				: m_table( it.m_table ), m_next( it.m_next ), m_pos( it.m_pos ), m_end( it.m_end ), m_nextEnd( it.m_nextEnd )
+			{
+			}
 
 			// Allow conversion from non-const iterator
 			friend class iterator;
@@ -550,7 +1602,7 @@ namespace nfx::containers
 			 */
 			reference operator*() const
 			{
-				return reinterpret_cast<reference>( *m_bucket );
+				return reinterpret_cast<reference>( m_table->slot( m_pos ) );
 			}
 
 			/**
@@ -559,7 +1611,7 @@ namespace nfx::containers
 			 */
 			pointer operator->() const
 			{
-				return reinterpret_cast<pointer>( m_bucket );
+				return reinterpret_cast<pointer>( &m_table->slot( m_pos ) );
 			}
 
 			/**
@@ -568,7 +1620,7 @@ namespace nfx::containers
 			 */
 			const_iterator& operator++()
 			{
-				++m_bucket;
+				++m_pos;
 				skipToOccupied();
 				return *this;
 			}
@@ -589,33 +1641,89 @@ namespace nfx::containers
 			 * @param other Iterator to compare with
 			 * @return true if iterators point to the same bucket
 			 */
-			bool operator==( const const_iterator& other ) const { return m_bucket == other.m_bucket; }
+			bool operator==( const const_iterator& other ) const { return m_pos == other.m_pos && m_table == other.m_table; }
 
 			/**
 			 * @brief Inequality comparison operator
 			 * @param other Iterator to compare with
 			 * @return true if iterators point to different buckets
 			 */
-			bool operator!=( const const_iterator& other ) const { return m_bucket != other.m_bucket; }
+			bool operator!=( const const_iterator& other ) const { return !( *this == other ); }
 
 		private:
 			/**
 			 * @brief Skip to next occupied bucket
-			 * @details Advances bucket pointer until an occupied bucket is found or end is reached
+			 * @details Jumps through the occupancy bitmap to the next occupied bucket or end,
+			 *          continuing into the next table when the current one is exhausted
 			 */
 			void skipToOccupied()
 			{
-				while ( m_bucket != m_end && !m_bucket->occupied )
+				for ( ;; )
 				{
-					++m_bucket;
+					m_pos = m_table->occupancy.next( m_pos, m_end );
+
+					if ( m_pos != m_end || m_next == nullptr )
+					{
+						return;
+					}
+
+					m_table = m_next;
+					m_end = m_nextEnd;
+					m_pos = 0;
+					m_next = nullptr;
 				}
 			}
 
-			const Bucket* m_bucket = nullptr;
-			const Bucket* m_end = nullptr;
+			const Table* m_table = nullptr;
+			const Table* m_next = nullptr;
+			size_t m_pos = 0;
+			size_t m_end = 0;
+			size_t m_nextEnd = 0;
 			friend class HashMap;
 		};
 	};
+
+	//=====================================================================
+	// 64-bit cached hash alias
+	//=====================================================================
+
+	/**
+	 * @brief HashMap caching full 64-bit hashes, for tables of hundreds of millions of elements
+	 * @details With 32-bit cached hashes, past a few hundred million elements many unrelated keys
+	 *          share a cached hash, so the hash pre-check stops filtering and probes fall through to
+	 *          key comparisons. Caching all 64 bits keeps that fingerprint selective and leaves index
+	 *          bits for tables beyond 2^32 buckets, at 8 more bytes of metadata per bucket.
+	 *          Hasher should produce 64 significant bits, as the Xxh3Hash, WyHash and SipHash13
+	 *          string hashes do; the FNV-1a and CRC32 string hashes only produce 32.
+	 */
+	template <typename TKey, typename TValue,
+		typename Hasher = Xxh3Hash,
+		HashMapLayout Layout = HashMapLayout::Interleaved,
+		typename Allocator = std::allocator<std::pair<const TKey, TValue>>>
+	using HashMap64 = HashMap<TKey, TValue, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+		Layout, Allocator, Hasher, std::uint64_t>;
+
+	//=====================================================================
+	// Polymorphic allocator aliases
+	//=====================================================================
+
+	namespace pmr
+	{
+		/**
+		 * @brief HashMap drawing all of its memory from a std::pmr::memory_resource
+		 * @details Construct with the resource (e.g. a per-request std::pmr::monotonic_buffer_resource)
+		 *          and use std::pmr::string keys so key characters come from the same resource.
+		 *          Releasing the resource then frees the whole map at once.
+		 */
+		template <typename TKey, typename TValue,
+			uint32_t FnvOffsetBasis = core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS,
+			uint32_t FnvPrime = core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout Layout = HashMapLayout::Interleaved,
+			typename Hasher = HashMapHash<FnvOffsetBasis, FnvPrime>,
+			CachedHashType CachedHash = std::uint32_t>
+		using HashMap = containers::HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout,
+			std::pmr::polymorphic_allocator<std::pair<const TKey, TValue>>, Hasher, CachedHash>;
+	} // namespace pmr
 } // namespace nfx::containers
 
 #include "nfx/detail/containers/HashMap.inl"
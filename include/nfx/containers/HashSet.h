@@ -0,0 +1,425 @@
+/**
+ * @file HashSet.h
+ * @brief Open-addressing set on top of HashMap's Robin Hood engine
+ * @details Stores keys directly in HashMap buckets with an empty mapped type, so the set
+ *          inherits Robin Hood probing, backward-shift deletion, heterogeneous string lookup
+ *          and allocator support, and performs one allocation per table instead of one per key.
+ *
+ * ## Memory Layout:
+ *
+ * ```
+ * HashSet Internal Structure:
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  m_map  HashMap<TKey, detail::SetPresence>                  │
+ * │ ┌─────────────────────────────────────────────────────────┐ │
+ * │ │ [0] │ Key │ Hash │ Dist │ Occupied │                    │ │ ← Contiguous buckets
+ * │ │ [1] │ Key │ Hash │ Dist │ Occupied │                    │ │
+ * │ │ ... │ ... │ ...  │ ...  │   ...    │                    │ │
+ * │ └─────────────────────────────────────────────────────────┘ │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * StringSet (std::unordered_set) : bucket array + one heap node per key
+ * HashSet<std::string>           : one bucket array, keys stored inline
+ * ```
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <utility>
+
+#include "nfx/core/Hashing.h"
+#include "functors/HashMapHashFunctor.h"
+#include "HashMap.h"
+
+#include "nfx/config.h"
+
+namespace nfx::containers
+{
+	namespace detail
+	{
+		/**
+		 * @brief Empty mapped type of the buckets behind HashSet
+		 */
+		struct SetPresence final
+		{
+			/** @brief All presence markers are equal */
+			friend constexpr bool operator==( SetPresence, SetPresence ) noexcept = default;
+		};
+	} // namespace detail
+
+	//=====================================================================
+	// HashSet class
+	//=====================================================================
+
+	/**
+	 * @brief Robin Hood hash set with heterogeneous lookup and set algebra
+	 * @details Wraps HashMap<TKey, detail::SetPresence>. String keys accept std::string_view
+	 *          and const char* for lookup, insertion and erase, and a std::string is built
+	 *          only when a new key is inserted.
+	 *
+	 * @tparam TKey Key type (automatically optimized for std::string/string_view)
+	 * @tparam FnvOffsetBasis FNV-1a offset basis constant (default: 0x811C9DC5)
+	 * @tparam FnvPrime FNV-1a prime constant (default: 0x01000193)
+	 * @tparam Allocator Allocator for keys, rebound for bucket storage (default: std::allocator)
+	 * @tparam Hasher Hash functor (default: HashMapHash, see HashMap)
+	 *
+	 * Features:
+	 * - No per-key node allocation, unlike std::unordered_set based StringSet
+	 * - Bulk insertRange() reserving once for sized ranges
+	 * - Union, intersection and difference probing the larger operand
+	 */
+	template <typename TKey,
+		uint32_t FnvOffsetBasis = core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS,
+		uint32_t FnvPrime = core::hashing::constants::DEFAULT_FNV_PRIME,
+		typename Allocator = std::allocator<TKey>,
+		typename Hasher = HashMapHash<FnvOffsetBasis, FnvPrime>>
+	class HashSet final
+	{
+	public:
+		//----------------------------------------------
+		// STL-compatible type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type */
+		using key_type = TKey;
+
+		/** @brief Type alias for element type */
+		using value_type = TKey;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		/** @brief Type alias for allocator type */
+		using allocator_type = Allocator;
+
+		/** @brief Type alias for the underlying bucket map */
+		using map_type = HashMap<TKey, detail::SetPresence, FnvOffsetBasis, FnvPrime, HashMapLayout::Interleaved,
+			typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const TKey, detail::SetPresence>>, Hasher>;
+
+		/** @brief Type alias for the underlying bucket map's const iterator */
+		using map_const_iterator = decltype( std::declval<const map_type&>().begin() );
+
+		class const_iterator;
+
+		/** @brief Type alias for iterator (keys are immutable) */
+		using iterator = const_iterator;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor with initial capacity of 32 buckets
+		 */
+		NFX_META_INLINE HashSet();
+
+		/**
+		 * @brief Constructor with specified initial capacity
+		 * @param initialCapacity Minimum initial capacity (rounded up to power of 2)
+		 */
+		NFX_META_INLINE explicit HashSet( size_t initialCapacity );
+
+		/**
+		 * @brief Constructor with initial capacity of 32 buckets and a specific allocator
+		 * @param allocator Allocator used for bucket storage and allocator-aware keys
+		 */
+		NFX_META_INLINE explicit HashSet( const Allocator& allocator );
+
+		/**
+		 * @brief Constructor with specified initial capacity and allocator
+		 * @param initialCapacity Minimum initial capacity (rounded up to power of 2)
+		 * @param allocator Allocator used for bucket storage and allocator-aware keys
+		 */
+		NFX_META_INLINE HashSet( size_t initialCapacity, const Allocator& allocator );
+
+		/**
+		 * @brief Construct from a list of keys, duplicates are ignored
+		 * @param keys Keys to insert
+		 */
+		NFX_META_INLINE HashSet( std::initializer_list<TKey> keys );
+
+		//----------------------------------------------
+		// Core operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Check whether a key is present
+		 * @param key The key to search for (supports heterogeneous lookup)
+		 * @return true if the key was found, false otherwise
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <typename KeyType = TKey>
+		[[nodiscard]] NFX_META_INLINE bool contains( const KeyType& key ) const noexcept;
+
+		//----------------------------------------------
+		// Insertion
+		//----------------------------------------------
+
+		/**
+		 * @brief Insert a key if it is absent
+		 * @param key The key to insert (supports heterogeneous insertion)
+		 * @return true if the key was inserted, false if it was already present
+		 * @details For string views of string keys the stored TKey is constructed only on insertion;
+		 *          other keys are converted to TKey before hashing
+		 */
+		template <typename KeyType = TKey>
+		NFX_META_INLINE bool insert( const KeyType& key );
+
+		/**
+		 * @brief Insert every key of an iterator range
+		 * @param first Iterator to the first key
+		 * @param last Iterator past the last key
+		 * @return Number of keys that were not already present
+		 * @details Reserves for the whole range up front when its length is known in O(1)
+		 */
+		template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+		NFX_META_INLINE size_t insertRange( InputIt first, Sentinel last );
+
+		/**
+		 * @brief Insert every key of a range
+		 * @param keys Range of keys (e.g. std::vector<std::string_view>)
+		 * @return Number of keys that were not already present
+		 */
+		template <std::ranges::input_range Range>
+		NFX_META_INLINE size_t insertRange( Range&& keys );
+
+		//----------------------------------------------
+		// Capacity and memory management
+		//----------------------------------------------
+
+		/**
+		 * @brief Reserve capacity for at least the specified number of keys
+		 * @param minCapacity Minimum capacity to reserve
+		 */
+		NFX_META_INLINE void reserve( size_t minCapacity );
+
+		/**
+		 * @brief Remove a key from the set
+		 * @param key The key to remove (supports heterogeneous lookup)
+		 * @return true if the key was found and removed, false otherwise
+		 */
+		template <typename KeyType = TKey>
+		NFX_META_INLINE bool erase( const KeyType& key ) noexcept;
+
+		/**
+		 * @brief Remove every key, keeping the current capacity
+		 */
+		NFX_META_INLINE void clear() noexcept;
+
+		//----------------------------------------------
+		// Set algebra
+		//----------------------------------------------
+
+		/**
+		 * @brief Keys present in either set
+		 * @param other The other set
+		 * @return New set using this set's allocator
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE HashSet unionWith( const HashSet& other ) const;
+
+		/**
+		 * @brief Keys present in both sets
+		 * @param other The other set
+		 * @return New set using this set's allocator
+		 * @details Walks the smaller set and probes the larger one
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE HashSet intersectionWith( const HashSet& other ) const;
+
+		/**
+		 * @brief Keys present in this set but not in the other
+		 * @param other The set whose keys are excluded
+		 * @return New set using this set's allocator
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE HashSet differenceWith( const HashSet& other ) const;
+
+		/**
+		 * @brief Check whether every key of this set is in the other
+		 * @param other The candidate superset
+		 * @return true if this set is a subset of other
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool isSubsetOf( const HashSet& other ) const noexcept;
+
+		//----------------------------------------------
+		// State inspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of keys in the set
+		 * @return Number of keys currently stored
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t size() const noexcept;
+
+		/**
+		 * @brief Get the current bucket capacity
+		 * @return Number of buckets allocated
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t capacity() const noexcept;
+
+		/**
+		 * @brief Check if the set is empty
+		 * @return true if the set contains no keys, false otherwise
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Get a copy of the allocator used by this set
+		 * @return The allocator the set was constructed with
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE allocator_type allocator() const noexcept;
+
+		//----------------------------------------------
+		// Iteration
+		//----------------------------------------------
+
+		/**
+		 * @brief Get iterator to first key
+		 * @return Const iterator over the keys
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE const_iterator begin() const noexcept;
+
+		/**
+		 * @brief Get iterator to end
+		 * @return Const iterator past the last key
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE const_iterator end() const noexcept;
+
+		//----------------------------------------------
+		// Comparison
+		//----------------------------------------------
+
+		/**
+		 * @brief Compare two HashSets for equality
+		 * @param other The other HashSet to compare with
+		 * @return true if both sets contain the same keys
+		 */
+		[[nodiscard]] NFX_META_INLINE bool operator==( const HashSet& other ) const noexcept;
+
+		//----------------------------------------------
+		// Iterator class definition
+		//----------------------------------------------
+
+		/**
+		 * @brief Forward iterator yielding the stored keys
+		 */
+		class const_iterator
+		{
+		public:
+			/** @brief STL iterator category (forward iterator) */
+			using iterator_category = std::forward_iterator_tag;
+
+			/** @brief STL iterator value type (key) */
+			using value_type = TKey;
+
+			/** @brief STL iterator difference type */
+			using difference_type = std::ptrdiff_t;
+
+			/** @brief STL iterator pointer type */
+			using pointer = const TKey*;
+
+			/** @brief STL iterator reference type */
+			using reference = const TKey&;
+
+			/**
+			 * @brief Default constructor creates an invalid iterator
+			 */
+			const_iterator() = default;
+
+			/**
+			 * @brief Wrap a bucket map iterator
+			 * @param it Iterator over (key, presence) pairs
+			 */
+			explicit const_iterator( map_const_iterator it ) : m_it( it ) {}
+
+			/**
+			 * @brief Dereference operator to access the key
+			 * @return Const reference to current key
+			 */
+			reference operator*() const { return m_it->first; }
+
+			/**
+			 * @brief Arrow operator to access key members
+			 * @return Const pointer to current key
+			 */
+			pointer operator->() const { return &m_it->first; }
+
+			/**
+			 * @brief Pre-increment operator to advance to next key
+			 * @return Reference to this iterator after advancement
+			 */
+			const_iterator& operator++()
+			{
+				++m_it;
+				return *this;
+			}
+
+			/**
+			 * @brief Post-increment operator to advance to next key
+			 * @return Copy of iterator before advancement
+			 */
+			const_iterator operator++( int )
+			{
+				const_iterator tmp = *this;
+				++( *this );
+				return tmp;
+			}
+
+			/**
+			 * @brief Equality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to the same bucket
+			 */
+			bool operator==( const const_iterator& other ) const { return m_it == other.m_it; }
+
+			/**
+			 * @brief Inequality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to different buckets
+			 */
+			bool operator!=( const const_iterator& other ) const { return m_it != other.m_it; }
+
+		private:
+			map_const_iterator m_it{};
+		};
+
+	private:
+		//----------------------------------------------
+		// Private member variables
+		//----------------------------------------------
+
+		map_type m_map; ///< Buckets holding the keys
+	};
+
+	//=====================================================================
+	// Polymorphic allocator aliases
+	//=====================================================================
+
+	namespace pmr
+	{
+		/**
+		 * @brief HashSet drawing its buckets (and std::pmr::string keys) from a std::pmr::memory_resource
+		 */
+		template <typename TKey,
+			uint32_t FnvOffsetBasis = core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS,
+			uint32_t FnvPrime = core::hashing::constants::DEFAULT_FNV_PRIME,
+			typename Hasher = HashMapHash<FnvOffsetBasis, FnvPrime>>
+		using HashSet = containers::HashSet<TKey, FnvOffsetBasis, FnvPrime, std::pmr::polymorphic_allocator<TKey>, Hasher>;
+	} // namespace pmr
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/HashSet.inl"
@@ -0,0 +1,185 @@
+/**
+ * @file HugePageAllocator.h
+ * @brief Allocator backing large container storage with 2 MiB transparent huge pages
+ * @details Random probes into a multi-gigabyte bucket array miss the TLB on almost every
+ *          access with 4 KiB pages. Backing the array with 2 MiB pages cuts the number of
+ *          page-table entries by 512, so most probes hit the TLB again.
+ *
+ * ## Allocation Strategy:
+ *
+ * ```
+ * allocate( n ):
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  bytes < MIN_HUGE_PAGE_ALLOCATION  →  std::allocator<T>     │ ← Small vectors, keys
+ * │                                                             │
+ * │  bytes ≥ MIN_HUGE_PAGE_ALLOCATION (Linux):                  │
+ * │  1. mmap( round2M( bytes ) + 2 MiB ) anonymous, private     │
+ * │  2. munmap the unaligned head and tail                      │
+ * │ ┌──────┬──────────────────────────────────────────┬───────┐ │
+ * │ │ head │ 2 MiB aligned, round2M( bytes )          │ tail  │ │
+ * │ └──────┴──────────────────────────────────────────┴───────┘ │
+ * │  3. madvise( MADV_HUGEPAGE ) - ignored where THP is off     │
+ * │                                                             │
+ * │  Other platforms: always std::allocator<T>                  │
+ * └─────────────────────────────────────────────────────────────┘
+ * ```
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include "nfx/config.h"
+
+namespace nfx::containers
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Huge page mapping helpers
+		//=====================================================================
+
+		/**
+		 * @brief Map a 2 MiB aligned anonymous region and request huge pages for it
+		 * @param bytes Region size, a multiple of 2 MiB
+		 * @return Start of the region
+		 * @throws std::bad_alloc if the mapping fails
+		 */
+		NFX_META_INLINE void* mapHugePages( size_t bytes );
+
+		/**
+		 * @brief Release a region returned by mapHugePages()
+		 * @param address Start of the region
+		 * @param bytes Size passed to mapHugePages()
+		 */
+		NFX_META_INLINE void unmapHugePages( void* address, size_t bytes ) noexcept;
+	} // namespace detail
+
+	//=====================================================================
+	// HugePageAllocator class
+	//=====================================================================
+
+	/**
+	 * @brief Stateless allocator placing large allocations on 2 MiB transparent huge pages
+	 * @details Meant for the bucket and table arrays of large containers, e.g.
+	 *          HashMap<K, V, ..., HugePageAllocator<std::pair<const K, V>>> or
+	 *          ChdHashMap<V, ..., HugePageAllocator<std::pair<std::string, V>>>.
+	 *          Allocations of at least MIN_HUGE_PAGE_ALLOCATION bytes are mapped directly on
+	 *          Linux, 2 MiB aligned and advised with MADV_HUGEPAGE; smaller ones, and all of
+	 *          them elsewhere, come from std::allocator. When transparent huge pages are
+	 *          disabled the advice is ignored and the mapping uses regular pages.
+	 * @tparam T Element type
+	 */
+	template <typename T>
+	class HugePageAllocator
+	{
+	public:
+		//----------------------------------------------
+		// Type aliases
+		//----------------------------------------------
+
+		/** @brief Element type */
+		using value_type = T;
+
+		/** @brief Size type */
+		using size_type = size_t;
+
+		/** @brief Difference type */
+		using difference_type = std::ptrdiff_t;
+
+		/** @brief Stateless: any two instances can free each other's memory */
+		using is_always_equal = std::true_type;
+
+		/** @brief Move assignment of containers can take over the storage */
+		using propagate_on_container_move_assignment = std::true_type;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Size of a transparent huge page on x86-64 and AArch64 (4 KiB granule) */
+		static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+		/**
+		 * @brief Smallest allocation mapped on huge pages
+		 * @details Anything smaller would waste most of its page, and gains little: a table
+		 *          covered by a handful of regular TLB entries does not miss the TLB anyway
+		 */
+		static constexpr size_t MIN_HUGE_PAGE_ALLOCATION = HUGE_PAGE_SIZE;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Default constructor */
+		HugePageAllocator() noexcept = default;
+
+		/**
+		 * @brief Converting constructor used when containers rebind the allocator
+		 * @tparam U Element type of the other allocator
+		 */
+		template <typename U>
+		constexpr HugePageAllocator( const HugePageAllocator<U>& ) noexcept
+		{
+		}
+
+		//----------------------------------------------
+		// Allocation
+		//----------------------------------------------
+
+		/**
+		 * @brief Allocate storage for count elements
+		 * @param count Number of elements
+		 * @return Pointer to uninitialized storage
+		 * @throws std::bad_array_new_length if count * sizeof(T), rounded to a huge page, overflows
+		 * @throws std::bad_alloc if the memory cannot be obtained
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE T* allocate( size_t count );
+
+		/**
+		 * @brief Release storage returned by allocate()
+		 * @param pointer Storage to release
+		 * @param count Element count passed to allocate()
+		 */
+		NFX_META_INLINE void deallocate( T* pointer, size_t count ) noexcept;
+
+		//----------------------------------------------
+		// State inspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Check whether an allocation of count elements is mapped on huge pages
+		 * @param count Number of elements
+		 * @return true on Linux for allocations of at least MIN_HUGE_PAGE_ALLOCATION bytes
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static NFX_META_INLINE bool usesHugePages( size_t count ) noexcept;
+
+		//----------------------------------------------
+		// Comparison
+		//----------------------------------------------
+
+		/**
+		 * @brief Compare allocators; all instances are interchangeable
+		 * @return Always true
+		 */
+		template <typename U>
+		friend constexpr bool operator==( const HugePageAllocator&, const HugePageAllocator<U>& ) noexcept
+		{
+			return true;
+		}
+
+	private:
+		/**
+		 * @brief Size of the mapping backing count elements
+		 * @param count Number of elements
+		 * @return count * sizeof(T) rounded up to HUGE_PAGE_SIZE
+		 */
+		static NFX_META_INLINE size_t mappedBytes( size_t count ) noexcept;
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/HugePageAllocator.inl"
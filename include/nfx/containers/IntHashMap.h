@@ -0,0 +1,636 @@
+/**
+ * @file IntHashMap.h
+ * @brief Integer-keyed Robin Hood map with sentinel-encoded empty slots
+ * @details Open-addressing hash map for integral keys. A slot is just the key and the value:
+ *          empty slots hold a reserved sentinel key, the home slot comes from Fibonacci
+ *          hashing of the key, and the probe distance is recomputed from the key instead of
+ *          being cached, so no per-slot hash, distance or occupied flag is stored.
+ *
+ * ## Memory Layout:
+ *
+ * ```
+ * IntHashMap Internal Structure:
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │                  IntHashMap<TKey, TValue>                   │
+ * ├─────────────────────────────────────────────────────────────┤
+ * │ ┌─────────────────────────────────────────────────────────┐ │
+ * │ │                       m_slots                           │ │
+ * │ │ ┌─────────────────────────────────────────────────────┐ │ │
+ * │ │ │  [0] │ 1042       │ value │                         │ │ │
+ * │ │ │  [1] │ EMPTY_KEY  │ {}    │                         │ │ │ ← Sentinel: slot unused
+ * │ │ │  [2] │ 77         │ value │                         │ │ │
+ * │ │ │  ... │ ...        │ ...   │                         │ │ │
+ * │ │ └─────────────────────────────────────────────────────┘ │ │
+ * │ └─────────────────────────────────────────────────────────┘ │
+ * │  m_size: 3     m_capacity: 32     m_shift: 59               │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * Home slot:  (uint64(key) * 0x9E3779B97F4A7C15) >> (64 - log2(capacity))
+ * Distance:   (slot - home(slot.key)) & (capacity - 1)
+ * ```
+ *
+ * Per slot (uint64_t keys):
+ *   HashMap<uint64_t, uint64_t>    : 24 bytes (key, value, hash, distance, occupied)
+ *   IntHashMap<uint64_t, uint64_t> : 16 bytes (key, value)
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "nfx/config.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// IntHashMap class
+	//=====================================================================
+
+	/**
+	 * @brief Hash map specialized for integral keys
+	 * @details Robin Hood linear probing with backward-shift deletion, so erasing never
+	 *          leaves tombstones. The sentinel key EmptyKey marks unused slots and therefore
+	 *          cannot be stored; inserting it throws std::invalid_argument and looking it up
+	 *          always misses. Pick a sentinel outside the key domain (the default, the
+	 *          type's maximum, suits most ID spaces).
+	 *
+	 * @tparam TKey Integral key type
+	 * @tparam TValue Value type (must be default constructible, empty slots hold TValue{})
+	 * @tparam EmptyKey Reserved key value marking empty slots (default: max of TKey)
+	 * @tparam Allocator Allocator for key-value pairs, rebound for slot storage (default: std::allocator)
+	 *
+	 * Features:
+	 * - Slot is key + value only: no cached hash, distance or occupied flag
+	 * - Multiplicative (Fibonacci) hashing instead of a byte-wise hash
+	 * - Sequential and strided IDs spread evenly across the table
+	 * - 75% maximum load factor
+	 */
+	template <std::integral TKey, typename TValue,
+		TKey EmptyKey = std::numeric_limits<TKey>::max(),
+		typename Allocator = std::allocator<std::pair<const TKey, TValue>>>
+	class IntHashMap final
+	{
+		//----------------------------------------------
+		// Forward declarations for iterator support
+		//----------------------------------------------
+
+		class iterator;
+		class const_iterator;
+
+	public:
+		//----------------------------------------------
+		// STL-compatible type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type */
+		using key_type = TKey;
+
+		/** @brief Type alias for mapped value type */
+		using mapped_type = TValue;
+
+		/** @brief Type alias for key-value pair type */
+		using value_type = std::pair<const TKey, TValue>;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		/** @brief Type alias for difference type */
+		using difference_type = std::ptrdiff_t;
+
+		/** @brief Type alias for allocator type */
+		using allocator_type = Allocator;
+
+		/** @brief Key value reserved for empty slots */
+		static constexpr TKey EMPTY_KEY = EmptyKey;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor with initial capacity of 32 slots
+		 */
+		NFX_META_INLINE IntHashMap();
+
+		/**
+		 * @brief Constructor with specified initial capacity
+		 * @param initialCapacity Minimum initial capacity (rounded up to power of 2)
+		 */
+		NFX_META_INLINE explicit IntHashMap( size_t initialCapacity );
+
+		/**
+		 * @brief Constructor with initial capacity of 32 slots and a specific allocator
+		 * @param allocator Allocator used for slot storage
+		 */
+		NFX_META_INLINE explicit IntHashMap( const Allocator& allocator );
+
+		/**
+		 * @brief Constructor with specified initial capacity and allocator
+		 * @param initialCapacity Minimum initial capacity (rounded up to power of 2)
+		 * @param allocator Allocator used for slot storage
+		 */
+		NFX_META_INLINE IntHashMap( size_t initialCapacity, const Allocator& allocator );
+
+		//----------------------------------------------
+		// Core operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Fast lookup
+		 * @param key The key to search for
+		 * @param outValue Reference to pointer that will be set to the found value (or nullptr if not found)
+		 * @return true if the key was found, false otherwise
+		 */
+		NFX_META_INLINE bool tryGetValue( TKey key, TValue*& outValue ) noexcept;
+
+		/**
+		 * @brief Fast const lookup
+		 * @param key The key to search for
+		 * @param outValue Reference to pointer that will be set to the found value (or nullptr if not found)
+		 * @return true if the key was found, false otherwise
+		 */
+		NFX_META_INLINE bool tryGetValue( TKey key, const TValue*& outValue ) const noexcept;
+
+		/**
+		 * @brief Check whether a key is present
+		 * @param key The key to search for
+		 * @return true if the key was found, false otherwise
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool contains( TKey key ) const noexcept;
+
+		//----------------------------------------------
+		// Insertion
+		//----------------------------------------------
+
+		/**
+		 * @brief Insert or update a key-value pair
+		 * @tparam ValueType Deduced value type supporting move/copy semantics
+		 * @param key The key to insert or update
+		 * @param value The value to associate with the key
+		 * @throws std::invalid_argument if key equals EMPTY_KEY
+		 */
+		template <typename ValueType>
+			requires std::is_assignable_v<TValue&, ValueType&&> && std::is_constructible_v<TValue, ValueType&&>
+		NFX_META_INLINE void insertOrAssign( TKey key, ValueType&& value );
+
+		/**
+		 * @brief Insert a value constructed in place if the key is absent
+		 * @param key The key to look up or insert
+		 * @param args Arguments forwarded to the TValue constructor on insertion only
+		 * @return Pointer to the value and true if a new element was inserted
+		 * @throws std::invalid_argument if key equals EMPTY_KEY
+		 */
+		template <typename... Args>
+		NFX_META_INLINE std::pair<TValue*, bool> tryEmplace( TKey key, Args&&... args );
+
+		//----------------------------------------------
+		// Capacity and memory management
+		//----------------------------------------------
+
+		/**
+		 * @brief Reserve capacity for at least the specified number of elements
+		 * @param minCapacity Minimum number of elements to hold without triggering a rehash
+		 * @details Accounts for the 75% maximum load factor when sizing the slot array
+		 */
+		NFX_META_INLINE void reserve( size_t minCapacity );
+
+		/**
+		 * @brief Remove a key-value pair from the map
+		 * @param key The key to remove
+		 * @return true if the key was found and removed, false otherwise
+		 * @details Shifts the following cluster back by one slot instead of leaving a tombstone
+		 */
+		NFX_META_INLINE bool erase( TKey key ) noexcept;
+
+		/**
+		 * @brief Remove every element, keeping the current capacity
+		 */
+		NFX_META_INLINE void clear() noexcept;
+
+		//----------------------------------------------
+		// State inspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of elements in the map
+		 * @return Current number of key-value pairs stored
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t size() const noexcept;
+
+		/**
+		 * @brief Get the current capacity of the hash table
+		 * @return Number of slots (always power of 2)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t capacity() const noexcept;
+
+		/**
+		 * @brief Check if the map contains no elements
+		 * @return true if size() == 0, false otherwise
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Get a copy of the allocator used by this map
+		 * @return The allocator the map was constructed with
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE allocator_type allocator() const noexcept;
+
+		//----------------------------------------------
+		// STL-compatible iteration support
+		//----------------------------------------------
+
+		/**
+		 * @brief Get iterator to beginning of occupied slots
+		 * @return Iterator pointing to first key-value pair
+		 */
+		[[nodiscard]] iterator begin() noexcept;
+
+		/**
+		 * @brief Get const iterator to beginning of occupied slots
+		 * @return Const iterator pointing to first key-value pair
+		 */
+		[[nodiscard]] const_iterator begin() const noexcept;
+
+		/**
+		 * @brief Get iterator to end (past last occupied slot)
+		 * @return Iterator pointing past the last key-value pair
+		 */
+		[[nodiscard]] iterator end() noexcept;
+
+		/**
+		 * @brief Get const iterator to end (past last occupied slot)
+		 * @return Const iterator pointing past the last key-value pair
+		 */
+		[[nodiscard]] const_iterator end() const noexcept;
+
+		/**
+		 * @brief Compare two IntHashMaps for equality
+		 * @param other The other IntHashMap to compare with
+		 * @return true if both maps contain the same key-value pairs
+		 */
+		[[nodiscard]] bool operator==( const IntHashMap& other ) const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Slot structure
+		//----------------------------------------------
+
+		/**
+		 * @brief Slot holding the key-value payload
+		 * @details Layout-compatible with std::pair<const TKey, TValue> for iterator access.
+		 *          key == EMPTY_KEY marks an unused slot.
+		 */
+		struct Slot
+		{
+			TKey key{ EmptyKey }; ///< The stored key, or EMPTY_KEY
+			TValue value{};		  ///< The associated value
+		};
+
+		/** @brief Allocator rebound to the slot type */
+		using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+
+		//----------------------------------------------
+		// Configuration constants
+		//----------------------------------------------
+
+		/** @brief Initial hash table capacity (power of 2) */
+		static constexpr size_t INITIAL_CAPACITY = 32;
+
+		/**
+		 * @brief Load factor threshold as a percentage
+		 * @details Same as HashMap, so both grow at the same sizes and differ only in slot size
+		 */
+		static constexpr size_t MAX_LOAD_FACTOR_PERCENT = 75;
+
+		/** @brief 2^64 divided by the golden ratio, the Fibonacci hashing multiplier */
+		static constexpr std::uint64_t FIBONACCI_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+		/** @brief Whether placing and displacing slots can throw (it moves and swaps values) */
+		static constexpr bool NOTHROW_SLOT_MOVE = std::is_nothrow_move_constructible_v<TValue> && std::is_nothrow_move_assignable_v<TValue>;
+
+		//----------------------------------------------
+		// Private member variables
+		//----------------------------------------------
+
+		std::vector<Slot, SlotAllocator> m_slots; ///< Slot storage, EMPTY_KEY marks unused slots
+
+		size_t m_size{};					   ///< Current number of elements
+		size_t m_capacity{ INITIAL_CAPACITY }; ///< Current number of slots
+		size_t m_mask{ INITIAL_CAPACITY - 1 }; ///< Bitwise mask for slot wrap-around
+		unsigned m_shift{ 64 - 5 };			   ///< 64 - log2(m_capacity), selects the top hash bits
+
+		//----------------------------------------------
+		// Internal implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Home slot of a key
+		 * @param key The key to hash
+		 * @return Slot index given by the top log2(capacity) bits of key * FIBONACCI_MULTIPLIER
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t homeSlot( TKey key ) const noexcept;
+
+		/**
+		 * @brief Distance of an occupied slot from its key's home slot
+		 * @param pos Slot index
+		 * @return Number of probe steps between home slot and pos
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t distanceAt( size_t pos ) const noexcept;
+
+		/**
+		 * @brief Locate the slot holding a key
+		 * @param key The key to search for (never EMPTY_KEY)
+		 * @return Slot index, or m_capacity if the key is absent
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t findIndex( TKey key ) const noexcept;
+
+		/**
+		 * @brief Place a new key known to be absent, displacing richer slots
+		 * @param slot Slot to insert (key must not be present)
+		 * @return Index where the new key ended up
+		 * @throws Whatever moving TValue throws; the carried slot is lost in that case
+		 */
+		inline size_t placeNew( Slot&& slot ) noexcept( NOTHROW_SLOT_MOVE );
+
+		/**
+		 * @brief Rebuild the table with the given slot count
+		 * @param newCapacity New slot count (power of 2)
+		 */
+		inline void rehash( size_t newCapacity );
+
+		/**
+		 * @brief Set capacity, mask and shift for a slot count
+		 * @param capacity Slot count (power of 2)
+		 */
+		NFX_META_INLINE void setCapacity( size_t capacity ) noexcept;
+
+		/**
+		 * @brief Grow before an insertion would exceed the load factor
+		 */
+		NFX_META_INLINE void growIfNeeded();
+
+		/**
+		 * @brief Reject the sentinel key on insertion
+		 * @param key The key being inserted
+		 * @throws std::invalid_argument if key equals EMPTY_KEY
+		 */
+		static NFX_META_INLINE void checkKey( TKey key );
+
+	private:
+		//----------------------------------------------
+		// Iterator class definitions
+		//----------------------------------------------
+
+		/**
+		 * @brief Iterator for IntHashMap that skips empty slots
+		 */
+		class iterator
+		{
+		public:
+			/** @brief STL iterator category (forward iterator) */
+			using iterator_category = std::forward_iterator_tag;
+
+			/** @brief STL iterator value type (key-value pair) */
+			using value_type = std::pair<const TKey, TValue>;
+
+			/** @brief STL iterator difference type */
+			using difference_type = std::ptrdiff_t;
+
+			/** @brief STL iterator pointer type */
+			using pointer = value_type*;
+
+			/** @brief STL iterator reference type */
+			using reference = value_type&;
+
+			/**
+			 * @brief Default constructor creates an invalid iterator
+			 */
+			iterator() = default;
+
+			/**
+			 * @brief Construct iterator from slot range
+			 * @param slot Starting slot pointer
+			 * @param end Slot pointer one past the last slot
+			 */
+			iterator( Slot* slot, Slot* end )
+				: m_slot( slot ), m_end( end )
+			{
+				skipToOccupied();
+			}
+
+			/**
+			 * @brief Dereference operator to access key-value pair
+			 * @return Reference to current key-value pair
+			 */
+			reference operator*() const
+			{
+				return reinterpret_cast<reference>( *m_slot );
+			}
+
+			/**
+			 * @brief Arrow operator to access key-value pair members
+			 * @return Pointer to current key-value pair
+			 */
+			pointer operator->() const
+			{
+				return reinterpret_cast<pointer>( m_slot );
+			}
+
+			/**
+			 * @brief Pre-increment operator to advance to next occupied slot
+			 * @return Reference to this iterator after advancement
+			 */
+			iterator& operator++()
+			{
+				++m_slot;
+				skipToOccupied();
+				return *this;
+			}
+
+			/**
+			 * @brief Post-increment operator to advance to next occupied slot
+			 * @return Copy of iterator before advancement
+			 */
+			iterator operator++( int )
+			{
+				iterator tmp = *this;
+				++( *this );
+				return tmp;
+			}
+
+			/**
+			 * @brief Equality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to the same slot
+			 */
+			bool operator==( const iterator& other ) const { return m_slot == other.m_slot; }
+
+			/**
+			 * @brief Inequality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to different slots
+			 */
+			bool operator!=( const iterator& other ) const { return m_slot != other.m_slot; }
+
+		private:
+			/**
+			 * @brief Skip to next slot whose key is not the sentinel
+			 */
+			void skipToOccupied()
+			{
+				while ( m_slot != m_end && m_slot->key == EmptyKey )
+				{
+					++m_slot;
+				}
+			}
+
+			Slot* m_slot = nullptr;
+			Slot* m_end = nullptr;
+			friend class IntHashMap;
+			friend class const_iterator;
+		};
+
+		/**
+		 * @brief Const iterator for IntHashMap that skips empty slots
+		 */
+		class const_iterator
+		{
+		public:
+			/** @brief STL iterator category (forward iterator) */
+			using iterator_category = std::forward_iterator_tag;
+
+			/** @brief STL iterator value type (const key-value pair) */
+			using value_type = std::pair<const TKey, TValue>;
+
+			/** @brief STL iterator difference type */
+			using difference_type = std::ptrdiff_t;
+
+			/** @brief STL iterator pointer type */
+			using pointer = const value_type*;
+
+			/** @brief STL iterator reference type */
+			using reference = const value_type&;
+
+			/**
+			 * @brief Default constructor creates an invalid iterator
+			 */
+			const_iterator() = default;
+
+			/**
+			 * @brief Construct const iterator from slot range
+			 * @param slot Starting slot pointer
+			 * @param end Slot pointer one past the last slot
+			 */
+			const_iterator( const Slot* slot, const Slot* end )
+				: m_slot( slot ), m_end( end )
+			{
+				skipToOccupied();
+			}
+
+			/**
+			 * @brief Convert from non-const iterator
+			 * @param it Non-const iterator to convert from
+			 */
+			const_iterator( const iterator& it ) : m_slot( it.m_slot ), m_end( it.m_end ) {}
+
+			/**
+			 * @brief Dereference operator to access key-value pair
+			 * @return Const reference to current key-value pair
+			 */
+			reference operator*() const
+			{
+				return reinterpret_cast<reference>( *m_slot );
+			}
+
+			/**
+			 * @brief Arrow operator to access key-value pair members
+			 * @return Const pointer to current key-value pair
+			 */
+			pointer operator->() const
+			{
+				return reinterpret_cast<pointer>( m_slot );
+			}
+
+			/**
+			 * @brief Pre-increment operator to advance to next occupied slot
+			 * @return Reference to this iterator after advancement
+			 */
+			const_iterator& operator++()
+			{
+				++m_slot;
+				skipToOccupied();
+				return *this;
+			}
+
+			/**
+			 * @brief Post-increment operator to advance to next occupied slot
+			 * @return Copy of iterator before advancement
+			 */
+			const_iterator operator++( int )
+			{
+				const_iterator tmp = *this;
+				++( *this );
+				return tmp;
+			}
+
+			/**
+			 * @brief Equality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to the same slot
+			 */
+			bool operator==( const const_iterator& other ) const { return m_slot == other.m_slot; }
+
+			/**
+			 * @brief Inequality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to different slots
+			 */
+			bool operator!=( const const_iterator& other ) const { return m_slot != other.m_slot; }
+
+		private:
+			/**
+			 * @brief Skip to next slot whose key is not the sentinel
+			 */
+			void skipToOccupied()
+			{
+				while ( m_slot != m_end && m_slot->key == EmptyKey )
+				{
+					++m_slot;
+				}
+			}
+
+			const Slot* m_slot = nullptr;
+			const Slot* m_end = nullptr;
+			friend class IntHashMap;
+		};
+	};
+
+	//=====================================================================
+	// Polymorphic allocator aliases
+	//=====================================================================
+
+	namespace pmr
+	{
+		/**
+		 * @brief IntHashMap drawing its slot storage from a std::pmr::memory_resource
+		 */
+		template <std::integral TKey, typename TValue, TKey EmptyKey = std::numeric_limits<TKey>::max()>
+		using IntHashMap = containers::IntHashMap<TKey, TValue, EmptyKey,
+			std::pmr::polymorphic_allocator<std::pair<const TKey, TValue>>>;
+	} // namespace pmr
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/IntHashMap.inl"
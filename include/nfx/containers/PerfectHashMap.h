@@ -0,0 +1,341 @@
+/**
+ * @file PerfectHashMap.h
+ * @brief Read-only string dictionary over a minimal perfect hash function, for very large key sets
+ * @details PerfectHashMap offers ChdHashMap's read API on top of a pluggable minimal perfect
+ *          hash engine (see PerfectHashEngines.h). Keys are hashed to 64 bits, the engine maps
+ *          each hash to a distinct index in [0, n), and entries are stored at their index, so a
+ *          lookup is one engine evaluation, one fingerprint read and one key comparison.
+ *
+ *          ChdHashMap's 32-bit hashes and 16-bit seeds suit up to a few million keys; its seed
+ *          search fails on larger or adversarial sets. The engines here take 64-bit hashes and
+ *          have no such limit, which makes this the container for static dictionaries of tens of
+ *          millions to billions of keys.
+ *
+ * ## Memory Layout:
+ *
+ * ```
+ * PerfectHashMap<TValue, Engine> (n entries):
+ * ┌─────────────────────────────────────────────────────────────────┐
+ * │ m_table         pair<string, TValue>[n]   │ ← Engine order      │
+ * ├─────────────────────────────────────────────────────────────────┤
+ * │ m_fingerprints  uint16_t[n]               │ ← Hash bits 48..63  │
+ * ├─────────────────────────────────────────────────────────────────┤
+ * │ m_engine        ~4 bits per key           │ ← MPHF index        │
+ * └─────────────────────────────────────────────────────────────────┘
+ * ```
+ *
+ * ## Example:
+ *
+ * ```cpp
+ * PerfectHashMap<uint32_t>::container_type items{ ... }; // 100M words
+ * PerfectHashMap<uint32_t> ptHash{ std::move( items ) }; // PtHashEngine
+ * PerfectHashMap<uint32_t, BbHashEngine> bbHash{ std::move( other ), BbHashEngine{ 3.0 } };
+ *
+ * const uint32_t* id{ nullptr };
+ * if ( ptHash.tryGetValue( word, id ) ) { ... }
+ * ```
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "nfx/config.h"
+#include "nfx/containers/functors/HashPolicies.h"
+#include "nfx/containers/functors/PerfectHashEngines.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// PerfectHashKeyHasher concept
+	//=====================================================================
+
+	/**
+	 * @brief Requirements on a PerfectHashMap hash policy
+	 * @details Keys are hashed to a full 64-bit unsigned value: the engines consume all of it and
+	 *          the fingerprint is bits 48..63, so a 32-bit result would zero every fingerprint.
+	 *          Any width-64 unsigned type is accepted, since size_t and std::uint64_t are distinct
+	 *          types on some platforms.
+	 */
+	template <typename THasher>
+	concept PerfectHashKeyHasher = requires( const THasher& hasher, std::string_view key ) {
+		{ hasher( key ) } -> std::unsigned_integral;
+	} && std::numeric_limits<std::invoke_result_t<const THasher&, std::string_view>>::digits == 64;
+
+	//=====================================================================
+	// PerfectHashMap class
+	//=====================================================================
+
+	/**
+	 * @class PerfectHashMap
+	 * @brief A read-only dictionary backed by a selectable minimal perfect hash engine
+	 * @details Built once from a table of unique keys. Every index in [0, n) holds exactly one
+	 *          entry, so an absent key still lands on some entry; a 16-bit fingerprint of the key's
+	 *          hash rejects all but 1 in 65536 such misses before the key comparison.
+	 *
+	 *          Entries are reordered into engine order during construction: iteration visits
+	 *          every entry once, in no meaningful order. Construction is single-threaded; the
+	 *          engine's build dominates its cost (see PtHashEngine and BbHashEngine).
+	 *
+	 * @tparam TValue The type of values stored in the dictionary
+	 * @tparam Engine Minimal perfect hash engine (default: PtHashEngine)
+	 * @tparam Hasher 64-bit string hash policy (default: Xxh3Hash, see PerfectHashKeyHasher);
+	 *         stateful policies such as SipHash13 are kept per map
+	 * @tparam Allocator Allocator for the entries and fingerprints (default: std::allocator)
+	 */
+	template <typename TValue,
+		PerfectHashEngine Engine = PtHashEngine,
+		PerfectHashKeyHasher Hasher = Xxh3Hash,
+		typename Allocator = std::allocator<std::pair<std::string, TValue>>>
+	class PerfectHashMap final
+	{
+		/** @brief Allocator rebound to an internal storage element type */
+		template <typename T>
+		using RebindAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+	public:
+		//----------------------------------------------
+		// Type aliases
+		//----------------------------------------------
+
+		/** @brief Allocator type */
+		using allocator_type = Allocator;
+
+		/** @brief Key string type, allocated with the map's allocator (std::string by default) */
+		using key_type = std::basic_string<char, std::char_traits<char>, RebindAllocator<char>>;
+
+		/** @brief Stored key-value pair type */
+		using value_type = std::pair<key_type, TValue>;
+
+		/** @brief Key-value table type, also accepted by the constructor */
+		using container_type = std::vector<value_type, RebindAllocator<value_type>>;
+
+		/** @brief Iterator over the entries, in engine order */
+		using const_iterator = typename container_type::const_iterator;
+
+		/** @brief Engine type */
+		using engine_type = Engine;
+
+		/** @brief Hash policy type */
+		using hasher = Hasher;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Builds the dictionary from a table of key-value pairs
+		 * @param[in] items Key-value pairs with unique keys; moved into the map and reordered
+		 * @param[in] engine Unbuilt engine carrying its tuning parameters (default: Engine{})
+		 * @param[in] hash Hash policy instance (default: Hasher{})
+		 * @throws std::invalid_argument if two keys are equal or share a 64-bit hash
+		 */
+		inline explicit PerfectHashMap( container_type&& items, Engine engine = Engine{}, Hasher hash = Hasher{} );
+
+		/** @brief Default constructor, creates an empty dictionary */
+		PerfectHashMap() = default;
+
+		/** @brief Copy constructor */
+		PerfectHashMap( const PerfectHashMap& other ) = default;
+
+		/** @brief Move constructor */
+		PerfectHashMap( PerfectHashMap&& other ) noexcept = default;
+
+		/** @brief Destructor */
+		~PerfectHashMap() = default;
+
+		//----------------------------------------------
+		// Assignment
+		//----------------------------------------------
+
+		/**
+		 * @brief Copy assignment operator
+		 * @return Reference to this dictionary
+		 */
+		PerfectHashMap& operator=( const PerfectHashMap& other ) = default;
+
+		/**
+		 * @brief Move assignment operator
+		 * @return Reference to this dictionary
+		 */
+		PerfectHashMap& operator=( PerfectHashMap&& other ) noexcept = default;
+
+		//----------------------------------------------
+		// Lookup methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Accesses the value associated with the specified key
+		 * @param[in] key The key whose associated value is to be retrieved
+		 * @return A reference to the value
+		 * @throws KeyNotFoundException if the key is not in the dictionary
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE TValue& operator[]( std::string_view key );
+
+		/**
+		 * @brief Accesses the value associated with the specified key
+		 * @param[in] key The key whose associated value is to be retrieved
+		 * @return A constant reference to the value
+		 * @throws KeyNotFoundException if the key is not in the dictionary
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline const TValue& at( std::string_view key ) const;
+
+		/**
+		 * @brief Attempts to retrieve the value associated with the specified key without throwing
+		 * @param[in] key The key whose associated value is to be retrieved
+		 * @param[out] outValue Set to the stored value on success, `nullptr` otherwise
+		 * @return `true` if the key was found
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool tryGetValue( std::string_view key, TValue*& outValue ) noexcept;
+
+		/**
+		 * @brief Attempts to retrieve the value associated with the specified key without throwing
+		 * @param[in] key The key whose associated value is to be retrieved
+		 * @param[out] outValue Set to the stored value on success, `nullptr` otherwise
+		 * @return `true` if the key was found
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool tryGetValue( std::string_view key, const TValue*& outValue ) const noexcept;
+
+		/**
+		 * @brief Checks whether the dictionary contains a key
+		 * @param[in] key The key to look for
+		 * @return `true` if the key was found
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool contains( std::string_view key ) const noexcept;
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the number of key-value pairs
+		 * @return The number of entries
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline size_t size() const noexcept;
+
+		/**
+		 * @brief Checks if the dictionary holds no entries
+		 * @return `true` if the dictionary is empty
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Gets the built engine
+		 * @return The engine, e.g. for engine().sizeInBytes()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline const Engine& engine() const noexcept;
+
+		/**
+		 * @brief Gets the memory held by the lookup structures
+		 * @return Bytes of engine and fingerprints, excluding the entries themselves
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline size_t indexSizeInBytes() const noexcept;
+
+		/**
+		 * @brief Gets the allocator
+		 * @return A copy of the allocator
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline allocator_type allocator() const noexcept;
+
+		//----------------------------------------------
+		// Iteration
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets an iterator to the first entry
+		 * @return An iterator at the first entry, in engine order
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline const_iterator begin() const noexcept;
+
+		/**
+		 * @brief Gets an iterator past the last entry
+		 * @return An iterator that must not be dereferenced
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline const_iterator end() const noexcept;
+
+		//----------------------------------------------
+		// Exception classes
+		//----------------------------------------------
+
+		//----------------------------
+		// PerfectHashMap::KeyNotFoundException
+		//----------------------------
+
+		/** @brief Exception thrown by operator[] and at() when the key is not in the dictionary */
+		class KeyNotFoundException : public std::runtime_error
+		{
+		public:
+			/**
+			 * @brief Constructs a key not found exception
+			 * @param[in] key The key that was not found
+			 */
+			inline explicit KeyNotFoundException( std::string_view key );
+		};
+
+	private:
+		//----------------------------------------------
+		// Private constants
+		//----------------------------------------------
+
+		/** @brief entryIndex() result for an absent key */
+		static constexpr size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+
+		//----------------------------------------------
+		// Private lookup helpers
+		//----------------------------------------------
+
+		/**
+		 * @brief 16-bit fingerprint of a key hash
+		 * @param[in] hash Key hash
+		 * @return Top 16 bits of the hash
+		 */
+		[[nodiscard]] static NFX_META_INLINE std::uint16_t fingerprint( std::uint64_t hash ) noexcept;
+
+		/**
+		 * @brief Resolve a key to its entry
+		 * @param[in] key Key to look up
+		 * @return Index into `m_table`, or NOT_FOUND if the key is absent
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t entryIndex( std::string_view key ) const noexcept;
+
+		//----------------------------------------------
+		// Private member variables
+		//----------------------------------------------
+
+		/** @brief Minimal perfect hash function over the key hashes */
+		Engine m_engine{};
+
+		/** @brief Key hash policy */
+		Hasher m_hasher{};
+
+		/** @brief Key-value pairs, entry i at engine position i */
+		container_type m_table;
+
+		/** @brief Hash fingerprint per entry, same order as m_table */
+		std::vector<std::uint16_t, RebindAllocator<std::uint16_t>> m_fingerprints;
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/PerfectHashMap.inl"
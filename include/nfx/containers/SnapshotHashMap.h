@@ -0,0 +1,373 @@
+/**
+ * @file SnapshotHashMap.h
+ * @brief Read-mostly map with lock-free readers and epoch-based reclamation
+ * @details Readers pin the currently published HashMap and probe it without taking any
+ *          lock. Writers copy the published table, apply their changes and publish the
+ *          copy with a single atomic exchange. Replaced tables are retired and freed once
+ *          no reader can still be looking at them.
+ *
+ * ## Publication & Reclamation:
+ *
+ * ```
+ * SnapshotHashMap Internal Structure:
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │                 SnapshotHashMap<TKey, TValue>               │
+ * ├─────────────────────────────────────────────────────────────┤
+ * │  m_current ──────────→ HashMap v3 (immutable once published)│ ← Readers
+ * │  m_retired: [ v1 @ epoch 2 ] [ v2 @ epoch 3 ]               │ ← Awaiting readers
+ * │  m_globalEpoch: 3                                           │
+ * │  m_slots: [ 0 ] [ 3 ] [ 2 ] [ 0 ] ...  (cache-line padded)  │ ← Reader epochs
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * Reader (snapshot)                 Writer (update, serialized)
+ * ┌───────────────────────────┐     ┌─────────────────────────────────┐
+ * │ 1. slot = globalEpoch     │     │ 1. next = copy of current       │
+ * │ 2. table = m_current      │     │ 2. fn( next )                   │
+ * │ 3. probe table (no lock)  │     │ 3. old = m_current.exchange     │
+ * │ 4. slot = 0               │     │ 4. R = ++globalEpoch            │
+ * └───────────────────────────┘     │ 5. retire old @ R               │
+ *                                   │ 6. free retired with R <= every │
+ *                                   │    active reader slot           │
+ *                                   └─────────────────────────────────┘
+ * A reader announcing epoch >= R loaded m_current after step 3,
+ * so it can only hold the new table.
+ * ```
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "nfx/core/Hashing.h"
+#include "HashMap.h"
+
+#include "nfx/config.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// SnapshotHashMap class
+	//=====================================================================
+
+	/**
+	 * @brief Copy-on-write HashMap with lock-free snapshot reads
+	 * @details Intended for maps that are read far more often than they are written. Every
+	 *          write copies the published table, so writes cost O(n); batch related changes
+	 *          into one update() call. Acquiring a snapshot is lock-free and lookups on a
+	 *          snapshot are wait-free. Writers are serialized by a mutex that readers never touch.
+	 *
+	 * @tparam TKey Key type (automatically optimized for std::string/string_view)
+	 * @tparam TValue Value type (must be copy-constructible)
+	 * @tparam FnvOffsetBasis FNV-1a offset basis constant (default: 0x811C9DC5)
+	 * @tparam FnvPrime FNV-1a prime constant (default: 0x01000193)
+	 * @tparam Layout Bucket storage layout of the published tables (default: HashMapLayout::Interleaved)
+	 *
+	 * Features:
+	 * - No lock, no reference count and no shared cache-line write on the table for readers
+	 * - Consistent point-in-time view for the lifetime of a Snapshot
+	 * - Epoch-based reclamation of replaced tables
+	 * - Zero-copy string_view lookups for string keys
+	 */
+	template <typename TKey, typename TValue,
+		uint32_t FnvOffsetBasis = core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS,
+		uint32_t FnvPrime = core::hashing::constants::DEFAULT_FNV_PRIME,
+		HashMapLayout Layout = HashMapLayout::Interleaved>
+	class SnapshotHashMap final
+	{
+	public:
+		//----------------------------------------------
+		// STL-compatible type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type */
+		using key_type = TKey;
+
+		/** @brief Type alias for mapped value type */
+		using mapped_type = TValue;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		/** @brief Type alias for the published table type */
+		using table_type = HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>;
+
+		class Snapshot;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor with an empty table and DEFAULT_READER_SLOTS reader slots
+		 */
+		NFX_META_INLINE SnapshotHashMap();
+
+		/**
+		 * @brief Constructor with specified number of reader slots
+		 * @param readerSlots Maximum number of simultaneously held snapshots (rounded up to power of 2, at least 1)
+		 * @details A snapshot request finding every slot taken spins until one is released
+		 */
+		NFX_META_INLINE explicit SnapshotHashMap( size_t readerSlots );
+
+		/** @brief Copy constructor (deleted, readers hold pointers into this map) */
+		SnapshotHashMap( const SnapshotHashMap& ) = delete;
+
+		/** @brief Move constructor (deleted, readers hold pointers into this map) */
+		SnapshotHashMap( SnapshotHashMap&& ) = delete;
+
+		/** @brief Copy assignment (deleted, readers hold pointers into this map) */
+		SnapshotHashMap& operator=( const SnapshotHashMap& ) = delete;
+
+		/** @brief Move assignment (deleted, readers hold pointers into this map) */
+		SnapshotHashMap& operator=( SnapshotHashMap&& ) = delete;
+
+		/**
+		 * @brief Destructor, frees the published and all retired tables
+		 * @details No Snapshot of this map may outlive it
+		 */
+		NFX_META_INLINE ~SnapshotHashMap();
+
+		//----------------------------------------------
+		// Read access
+		//----------------------------------------------
+
+		/**
+		 * @brief Pin the currently published table
+		 * @return RAII snapshot; the table it refers to is not freed before the snapshot is destroyed
+		 * @details Lock-free: one CAS on a reader slot, normally the calling thread's preferred one
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE Snapshot snapshot() const;
+
+		/**
+		 * @brief Lookup copying the value out of a short-lived snapshot
+		 * @param key The key to search for (supports heterogeneous lookup)
+		 * @param outValue Receives a copy of the value if found, left untouched otherwise
+		 * @return true if the key was found, false otherwise
+		 */
+		template <typename KeyType = TKey>
+		NFX_META_INLINE bool tryGetValue( const KeyType& key, TValue& outValue ) const;
+
+		/**
+		 * @brief Get the number of elements in the published table
+		 * @return Current number of key-value pairs
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t size() const;
+
+		/**
+		 * @brief Check if the published table contains no elements
+		 * @return true if size() == 0, false otherwise
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE bool isEmpty() const;
+
+		//----------------------------------------------
+		// Write access
+		//----------------------------------------------
+
+		/**
+		 * @brief Apply a batch of modifications and publish the result atomically
+		 * @param fn Callable invoked as fn( table_type& ) on a private copy of the published table
+		 * @details Readers see either none or all of the modifications made by fn.
+		 *          Retired tables no longer visible to any reader are freed afterwards.
+		 */
+		template <typename Fn>
+		NFX_META_INLINE void update( Fn&& fn );
+
+		/**
+		 * @brief Replace the whole content with a prebuilt table
+		 * @param table Table to publish (moved)
+		 */
+		NFX_META_INLINE void assign( table_type&& table );
+
+		/**
+		 * @brief Insert or update a single key-value pair (copy semantics)
+		 * @param key The key to insert or update
+		 * @param value The value to associate with the key
+		 * @details Copies the whole table; prefer update() for more than one change
+		 */
+		NFX_META_INLINE void insertOrAssign( const TKey& key, const TValue& value );
+
+		/**
+		 * @brief Remove a single key-value pair
+		 * @param key The key to remove (supports heterogeneous lookup)
+		 * @return true if the key was found and removed, false otherwise
+		 * @details Copies the whole table when the key is present; prefer update() for more than one change
+		 */
+		template <typename KeyType = TKey>
+		NFX_META_INLINE bool erase( const KeyType& key );
+
+		//----------------------------------------------
+		// Reclamation
+		//----------------------------------------------
+
+		/**
+		 * @brief Free retired tables that no reader can still observe
+		 * @return Number of tables freed
+		 * @details Called automatically after each publication; useful after long-lived
+		 *          snapshots have been released while no writes occur
+		 */
+		NFX_META_INLINE size_t reclaim();
+
+		/**
+		 * @brief Get the number of retired tables not yet freed
+		 * @return Tables waiting for readers pinned on older epochs
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t retiredCount() const;
+
+		/**
+		 * @brief Default number of reader slots
+		 * @details Upper bound on snapshots held at the same time, not on reader threads
+		 */
+		static constexpr size_t DEFAULT_READER_SLOTS = 128;
+
+	private:
+		//----------------------------------------------
+		// Reader slot and retired table structures
+		//----------------------------------------------
+
+		/** @brief Reader slot value meaning "not pinned" */
+		static constexpr std::uint64_t INACTIVE_EPOCH = 0;
+
+		/**
+		 * @brief Epoch announced by one active reader
+		 * @details Cache-line aligned so readers on different slots never share a line
+		 */
+		struct alignas( 64 ) ReaderSlot
+		{
+			std::atomic<std::uint64_t> epoch{ INACTIVE_EPOCH }; ///< Epoch at pin time, INACTIVE_EPOCH when free
+		};
+
+		/**
+		 * @brief Replaced table waiting for older readers to finish
+		 */
+		struct Retired
+		{
+			std::unique_ptr<table_type> table; ///< Replaced table
+			std::uint64_t epoch;			   ///< Readers announcing this epoch or later cannot hold table
+		};
+
+		std::atomic<table_type*> m_current;				  ///< Published table read by snapshots
+		std::atomic<std::uint64_t> m_globalEpoch{ 1 };	  ///< Incremented after every publication
+		std::unique_ptr<ReaderSlot[]> m_slots;			  ///< Reader epoch announcements
+		size_t m_slotMask{};							  ///< Bitwise mask for slot selection
+		mutable std::mutex m_writeMutex;				  ///< Serializes writers (never taken by readers)
+		std::unique_ptr<table_type> m_published;		  ///< Owner of the table m_current points to
+		std::vector<Retired> m_retired;					  ///< Tables awaiting reclamation
+
+		//----------------------------------------------
+		// Internal implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Publish a table and retire the previous one
+		 * @param next Fully built table (ownership transferred)
+		 * @details Caller must hold m_writeMutex
+		 */
+		NFX_META_INLINE void publish( std::unique_ptr<table_type> next );
+
+		/**
+		 * @brief Free retired tables no reader can observe
+		 * @return Number of tables freed
+		 * @details Caller must hold m_writeMutex
+		 */
+		NFX_META_INLINE size_t reclaimLocked();
+
+	public:
+		//----------------------------------------------
+		// Snapshot class definition
+		//----------------------------------------------
+
+		/**
+		 * @brief Pinned, immutable view of the table published at acquisition time
+		 * @details Move-only. Lookups never block and never observe later writes.
+		 *          Must not outlive the SnapshotHashMap it was taken from.
+		 */
+		class Snapshot
+		{
+		public:
+			/** @brief Move constructor, the source no longer pins anything */
+			Snapshot( Snapshot&& other ) noexcept
+				: m_slot( std::exchange( other.m_slot, nullptr ) ), m_table( std::exchange( other.m_table, nullptr ) )
+			{
+			}
+
+			/** @brief Move assignment, releases the currently pinned table first */
+			Snapshot& operator=( Snapshot&& other ) noexcept
+			{
+				if ( this != &other )
+				{
+					release();
+					m_slot = std::exchange( other.m_slot, nullptr );
+					m_table = std::exchange( other.m_table, nullptr );
+				}
+				return *this;
+			}
+
+			Snapshot( const Snapshot& ) = delete;
+			Snapshot& operator=( const Snapshot& ) = delete;
+
+			/** @brief Destructor, unpins the table */
+			~Snapshot() { release(); }
+
+			/**
+			 * @brief Wait-free lookup in the pinned table
+			 * @param key The key to search for (supports heterogeneous lookup)
+			 * @param outValue Set to the value (valid while this snapshot lives) or nullptr if not found
+			 * @return true if the key was found, false otherwise
+			 */
+			template <typename KeyType = TKey>
+			bool tryGetValue( const KeyType& key, const TValue*& outValue ) const noexcept
+			{
+				// Published tables are never modified, HashMap lookups do not write
+				TValue* value{ nullptr };
+				const bool found{ m_table->tryGetValue( key, value ) };
+				outValue = value;
+				return found;
+			}
+
+			/**
+			 * @brief Get the pinned table for iteration
+			 * @return Const reference to the pinned table
+			 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+			 */
+			[[nodiscard]] const table_type& table() const noexcept { return *m_table; }
+
+			/**
+			 * @brief Get the number of elements in the pinned table
+			 * @return Number of key-value pairs
+			 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+			 */
+			[[nodiscard]] size_t size() const noexcept { return m_table->size(); }
+
+		private:
+			friend class SnapshotHashMap;
+
+			Snapshot( std::atomic<std::uint64_t>* slot, table_type* table ) noexcept
+				: m_slot( slot ), m_table( table )
+			{
+			}
+
+			void release() noexcept
+			{
+				if ( m_slot != nullptr )
+				{
+					m_slot->store( INACTIVE_EPOCH, std::memory_order_release );
+					m_slot = nullptr;
+				}
+			}
+
+			std::atomic<std::uint64_t>* m_slot = nullptr; ///< Reader slot holding our epoch
+			table_type* m_table = nullptr;				  ///< Pinned table
+		};
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/SnapshotHashMap.inl"
@@ -0,0 +1,283 @@
+/**
+ * @file StaticChdHashMap.h
+ * @brief Perfect hash map over a key set known at compile time, built by the compiler
+ * @details StaticChdHashMap runs ChdHashMap's CHD construction in a consteval constructor:
+ *          hashing, bucketing, bucket ordering and seed search all happen during compilation.
+ *          A map declared `constexpr` (or `static constexpr`) is a plain aggregate of arrays in
+ *          read-only data, with no construction at startup and no heap allocation.
+ *
+ * ## Memory Layout:
+ *
+ * ```
+ * StaticChdHashMap<TValue, N> (constant-initialized, .rodata):
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │ m_entries   pair<string_view, TValue>[N]  │ ← Input order   │
+ * ├─────────────────────────────────────────────────────────────┤
+ * │ m_slots     uint32_t[SLOT_COUNT]          │ ← Slot → entry  │
+ * ├─────────────────────────────────────────────────────────────┤
+ * │ m_seeds     uint16_t[SLOT_COUNT]          │ ← CHD seeds     │
+ * └─────────────────────────────────────────────────────────────┘
+ *   SLOT_COUNT = 2 × N rounded up to a power of 2, as in ChdHashMap
+ * ```
+ *
+ * Keys are std::string_view and must refer to storage with static duration (string
+ * literals, `constexpr` character arrays).
+ *
+ * ## Example:
+ *
+ * ```cpp
+ * static constexpr auto units{ nfx::containers::makeStaticChdHashMap<int>( {
+ *     { "m", 1 }, { "kg", 2 }, { "s", 3 }, { "A", 4 }, { "K", 5 } } ) };
+ *
+ * static_assert( units.at( "kg" ) == 2 );
+ * const int* unit{ nullptr };
+ * if ( units.tryGetValue( token, unit ) ) { ... }
+ * ```
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "nfx/config.h"
+#include "nfx/core/Hashing.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// StaticChdHashMap class
+	//=====================================================================
+
+	/**
+	 * @class StaticChdHashMap
+	 * @brief Read-only CHD perfect hash map constructed entirely at compile time
+	 * @details Construction mirrors a single-threaded ChdHashMap build: keys are grouped into
+	 *          SLOT_COUNT buckets by hash, buckets are placed largest first, and each gets the
+	 *          smallest 16-bit seed for which `core::hashing::seedMix` sends all of its keys to free
+	 *          slots. Duplicate keys and a failed seed search are compile errors.
+	 *
+	 *          Keys are hashed with FNV-1a in both the compiler and at run time. ChdHashMap::hash()
+	 *          switches to the SSE4.2 CRC32 instruction where available, which cannot run in a
+	 *          constant expression; a fixed hash keeps compile-time seeds valid on every machine.
+	 *
+	 *          Compilers bound constant evaluation: with default limits, GCC builds tables up to
+	 *          tens of thousands of keys and Clang (`-fconstexpr-steps`) a few thousand.
+	 *
+	 * @tparam TValue Value type; must be a copyable literal type
+	 * @tparam N Number of keys
+	 * @tparam FnvOffsetBasis FNV-1a offset basis constant for hash calculation (default: 0x811C9DC5)
+	 */
+	template <typename TValue,
+		size_t N,
+		uint32_t FnvOffsetBasis = core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS>
+	class StaticChdHashMap final
+	{
+		static_assert( N > 0, "StaticChdHashMap needs at least one key" );
+		static_assert( N < std::numeric_limits<uint32_t>::max(), "StaticChdHashMap entries are indexed with 32 bits" );
+
+	public:
+		//----------------------------------------------
+		// Type aliases
+		//----------------------------------------------
+
+		/** @brief Key type */
+		using key_type = std::string_view;
+
+		/** @brief Stored key-value pair type */
+		using value_type = std::pair<std::string_view, TValue>;
+
+		/** @brief Iterator over the entries, in input order */
+		using const_iterator = typename std::array<value_type, N>::const_iterator;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Number of slots and seeds: 2 × N rounded up to a power of 2, as in ChdHashMap */
+		static constexpr size_t SLOT_COUNT = 2 * std::bit_ceil( N );
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Builds the perfect hash table at compile time
+		 * @param[in] items Key-value pairs; keys must be unique and outlive the map
+		 * @param[in] maxSeedSearchMultiplier Maximum multiplier for seed search iterations (default: 100),
+		 *            capped so every seed fits 16 bits, as in ChdHashMap
+		 * @details Being consteval, a duplicate key or a failed seed search stops compilation at the
+		 *          throw expression naming the problem.
+		 */
+		consteval explicit StaticChdHashMap( const value_type ( &items )[N], uint32_t maxSeedSearchMultiplier = 100 );
+
+		/**
+		 * @brief Builds the perfect hash table at compile time from a generated table
+		 * @param[in] items Key-value pairs, e.g. produced by a constexpr function; keys must be unique and outlive the map
+		 * @param[in] maxSeedSearchMultiplier Maximum multiplier for seed search iterations (default: 100)
+		 */
+		consteval explicit StaticChdHashMap( const std::array<value_type, N>& items, uint32_t maxSeedSearchMultiplier = 100 );
+
+		//----------------------------------------------
+		// Lookup methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Accesses the value associated with the specified key
+		 * @param[in] key The key whose associated value is to be retrieved
+		 * @return A constant reference to the value
+		 * @throws KeyNotFoundException if the key is not in the map (a compile error in a constant expression)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] constexpr const TValue& at( std::string_view key ) const;
+
+		/**
+		 * @brief Attempts to retrieve the value associated with the specified key without throwing
+		 * @param[in] key The key whose associated value is to be retrieved
+		 * @param[out] outValue Set to the stored value on success, `nullptr` otherwise
+		 * @return `true` if the key was found
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE constexpr bool tryGetValue( std::string_view key, const TValue*& outValue ) const noexcept;
+
+		/**
+		 * @brief Checks whether the map contains a key
+		 * @param[in] key The key to look for
+		 * @return `true` if the key was found
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE constexpr bool contains( std::string_view key ) const noexcept;
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Returns the number of key-value pairs
+		 * @return N
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] constexpr size_t size() const noexcept;
+
+		/**
+		 * @brief Checks if the map holds no entries
+		 * @return Always `false`; provided for parity with ChdHashMap
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] constexpr bool isEmpty() const noexcept;
+
+		//----------------------------------------------
+		// Iteration
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets an iterator to the first entry
+		 * @return An iterator at the first entry, in input order
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] constexpr const_iterator begin() const noexcept;
+
+		/**
+		 * @brief Gets an iterator past the last entry
+		 * @return An iterator that must not be dereferenced
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] constexpr const_iterator end() const noexcept;
+
+		//---------------------------
+		// Hashing
+		//---------------------------
+
+		/**
+		 * @brief FNV-1a hash of a key, identical in constant evaluation and at run time
+		 * @param[in] key Key to hash
+		 * @return 32-bit hash value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static NFX_META_INLINE constexpr uint32_t hash( std::string_view key ) noexcept;
+
+		//----------------------------------------------
+		// Exception classes
+		//----------------------------------------------
+
+		//----------------------------
+		// StaticChdHashMap::KeyNotFoundException
+		//----------------------------
+
+		/** @brief Exception thrown by at() when the key is not in the map */
+		class KeyNotFoundException : public std::runtime_error
+		{
+		public:
+			/**
+			 * @brief Constructs a key not found exception
+			 * @param[in] key The key that was not found
+			 */
+			inline explicit KeyNotFoundException( std::string_view key );
+		};
+
+	private:
+		//----------------------------------------------
+		// Private constants
+		//----------------------------------------------
+
+		/** @brief `m_slots` value of a slot without an entry, as in ChdHashMap */
+		static constexpr uint32_t EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+
+		/** @brief Largest seed a bucket can be assigned, as in ChdHashMap */
+		static constexpr uint64_t MAX_SEED = std::numeric_limits<uint16_t>::max();
+
+		//----------------------------------------------
+		// Private lookup helpers
+		//----------------------------------------------
+
+		/**
+		 * @brief Resolve a key to its entry
+		 * @param[in] key Key to look up
+		 * @return Index into `m_entries`, or EMPTY_SLOT if the key is absent
+		 */
+		[[nodiscard]] NFX_META_INLINE constexpr uint32_t entryIndex( std::string_view key ) const noexcept;
+
+		//----------------------------------------------
+		// Private member variables
+		//----------------------------------------------
+
+		/** @brief Key-value pairs in input order */
+		std::array<value_type, N> m_entries;
+
+		/** @brief Entry index per slot, EMPTY_SLOT for a free slot */
+		std::array<uint32_t, SLOT_COUNT> m_slots{};
+
+		/** @brief CHD seed per bucket; 0 marks a bucket without keys */
+		std::array<uint16_t, SLOT_COUNT> m_seeds{};
+	};
+
+	/** @brief Deduces TValue and N from a std::array of key-value pairs */
+	template <typename TValue, size_t N>
+	StaticChdHashMap( const std::array<std::pair<std::string_view, TValue>, N>&, uint32_t = 100 ) -> StaticChdHashMap<TValue, N>;
+
+	//=====================================================================
+	// Factory
+	//=====================================================================
+
+	/**
+	 * @brief Builds a StaticChdHashMap at compile time, deducing the key count
+	 * @tparam TValue Value type
+	 * @tparam FnvOffsetBasis FNV-1a offset basis constant for hash calculation
+	 * @tparam N Number of keys, deduced from the braced list
+	 * @param[in] items Key-value pairs; keys must be unique and outlive the map
+	 * @param[in] maxSeedSearchMultiplier Maximum multiplier for seed search iterations (default: 100)
+	 * @return The constructed map
+	 */
+	template <typename TValue, uint32_t FnvOffsetBasis = core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, size_t N>
+	[[nodiscard]] consteval StaticChdHashMap<TValue, N, FnvOffsetBasis> makeStaticChdHashMap(
+		const std::pair<std::string_view, TValue> ( &items )[N], uint32_t maxSeedSearchMultiplier = 100 );
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/StaticChdHashMap.inl"
@@ -0,0 +1,151 @@
+/**
+ * @file StringArena.h
+ * @brief Append-only storage for string bytes with stable addresses
+ * @details Copies strings back to back into large blocks and hands out std::string_view
+ *          references to the copies. Blocks are never reallocated, so every view stays
+ *          valid until the arena is cleared or destroyed.
+ *
+ * ## Memory Layout:
+ *
+ * ```
+ * StringArena Internal Structure:
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  m_blocks[0]  (m_blockSize bytes)                           │
+ * │ ┌─────────────────────────────────────────────────────────┐ │
+ * │ │ /usr/lib/libfoo.so│/usr/lib/libbar.so│/etc/hosts│...    │ │ ← Full block
+ * │ └─────────────────────────────────────────────────────────┘ │
+ * │  m_blocks[1]                                                │
+ * │ ┌─────────────────────────────────────────────────────────┐ │
+ * │ │ /var/log/syslog│/tmp/x│░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░ │ │ ← m_cursor, m_remaining
+ * │ └─────────────────────────────────────────────────────────┘ │
+ * │  m_blocks[2]  (dedicated block for one oversized string)    │
+ * └─────────────────────────────────────────────────────────────┘
+ *  No terminators, no per-string headers: one allocation per block.
+ * ```
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "nfx/config.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// StringArena class
+	//=====================================================================
+
+	/**
+	 * @brief Append-only string byte storage handing out stable string_views
+	 * @details Individual strings cannot be freed; clear() or destruction releases all
+	 *          of them at once. Strings larger than a quarter of the block size get a
+	 *          dedicated block so they never waste the tail of the current one.
+	 */
+	class StringArena final
+	{
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Default size of each storage block in bytes */
+		static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor using DEFAULT_BLOCK_SIZE blocks
+		 * @details No memory is allocated until the first non-empty string is stored
+		 */
+		NFX_META_INLINE StringArena();
+
+		/**
+		 * @brief Constructor with specified block size
+		 * @param blockSize Size of each storage block in bytes (at least 1)
+		 */
+		NFX_META_INLINE explicit StringArena( size_t blockSize );
+
+		/** @brief Copy constructor (deleted, views would point into the source) */
+		StringArena( const StringArena& ) = delete;
+
+		/**
+		 * @brief Move constructor
+		 * @details Views handed out by other stay valid and now refer to this arena
+		 */
+		NFX_META_INLINE StringArena( StringArena&& other ) noexcept;
+
+		/** @brief Copy assignment (deleted, views would point into the source) */
+		StringArena& operator=( const StringArena& ) = delete;
+
+		/**
+		 * @brief Move assignment
+		 * @details Releases this arena's blocks; views handed out by other stay valid
+		 */
+		NFX_META_INLINE StringArena& operator=( StringArena&& other ) noexcept;
+
+		/** @brief Destructor, releases every block */
+		~StringArena() = default;
+
+		//----------------------------------------------
+		// Storage
+		//----------------------------------------------
+
+		/**
+		 * @brief Copy a string into the arena
+		 * @param str Bytes to copy
+		 * @return View of the stored copy (empty view for an empty string)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE std::string_view store( std::string_view str );
+
+		/**
+		 * @brief Release every block, invalidating all views handed out so far
+		 */
+		NFX_META_INLINE void clear() noexcept;
+
+		//----------------------------------------------
+		// State inspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of string bytes stored
+		 * @return Sum of the sizes of every stored string
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t bytesUsed() const noexcept;
+
+		/**
+		 * @brief Get the number of bytes allocated for blocks
+		 * @return Total size of every block, including unused tails
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t bytesReserved() const noexcept;
+
+		/**
+		 * @brief Get the configured block size
+		 * @return Size of each regular storage block in bytes
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t blockSize() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Private member variables
+		//----------------------------------------------
+
+		std::vector<std::unique_ptr<char[]>> m_blocks; ///< Every allocated block, in allocation order
+		char* m_cursor{};							   ///< Next free byte of the current block
+		size_t m_remaining{};						   ///< Free bytes left in the current block
+		size_t m_blockSize{ DEFAULT_BLOCK_SIZE };	   ///< Size of each regular block
+		size_t m_bytesUsed{};						   ///< Bytes of stored strings
+		size_t m_bytesReserved{};					   ///< Bytes of allocated blocks
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/StringArena.inl"
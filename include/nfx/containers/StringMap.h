@@ -52,6 +52,8 @@
 
 #pragma once
 
+#include <memory>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -70,11 +72,19 @@ namespace nfx::containers
 	/**
 	 * @brief Enhanced unordered map with full heterogeneous support
 	 * @tparam T Value type
+	 * @tparam Allocator Node allocator; keys are std::basic_string rebound to the same allocator,
+	 *         so std::pmr::polymorphic_allocator yields std::pmr::string keys (see pmr::StringMap)
+	 * @tparam Hash Transparent string hash functor (default: StringViewHash). Pass SipHash13
+	 *         (HashPolicies.h) for maps keyed by untrusted input: each map draws its own key,
+	 *         so colliding keys cannot be precomputed to degrade its bucket chains
 	 */
-	template <typename T>
-	class StringMap final : public std::unordered_map<std::string, T, StringViewHash, StringViewEqual>
+	template <typename T, typename Allocator = std::allocator<std::pair<const std::string, T>>, typename Hash = StringViewHash>
+	class StringMap final : public std::unordered_map<detail::RebindString<Allocator>, T, Hash, StringViewEqual,
+								typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const detail::RebindString<Allocator>, T>>>
 	{
-		using Base = std::unordered_map<std::string, T, StringViewHash, StringViewEqual>;
+		using KeyString = detail::RebindString<Allocator>;
+		using Base = std::unordered_map<KeyString, T, Hash, StringViewEqual,
+			typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const KeyString, T>>>;
 
 	public:
 		//----------------------------------------------
@@ -92,6 +102,7 @@ namespace nfx::containers
 		 * - Move:              StringMap<int> map2(std::move(map1));
 		 * - Bucket count:      StringMap<int> map(100);  // Pre-allocate buckets
 		 * - Custom allocator:  StringMap<int> map(alloc);
+		 * - Memory resource:   pmr::StringMap<int> map(&arena);
 		 *
 		 * @note All constructors support automatic conversion from string-like types to std::string keys
 		 */
@@ -254,6 +265,21 @@ namespace nfx::containers
 		NFX_META_INLINE std::pair<typename Base::iterator, bool> insert_or_assign( std::string_view key, M&& obj ) noexcept(
 			std::is_nothrow_assignable_v<T&, M> && std::is_nothrow_constructible_v<T, M> );
 	};
+
+	//=====================================================================
+	// Polymorphic allocator aliases
+	//=====================================================================
+
+	namespace pmr
+	{
+		/**
+		 * @brief StringMap whose nodes, buckets and std::pmr::string keys share one memory resource
+		 * @tparam T Value type
+		 * @tparam Hash Transparent string hash functor (default: StringViewHash)
+		 */
+		template <typename T, typename Hash = StringViewHash>
+		using StringMap = containers::StringMap<T, std::pmr::polymorphic_allocator<std::pair<const std::pmr::string, T>>, Hash>;
+	} // namespace pmr
 } // namespace nfx::containers
 
 #include "nfx/detail/containers/StringMap.inl"
@@ -81,6 +81,8 @@
 
 #pragma once
 
+#include <memory>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -98,10 +100,17 @@ namespace nfx::containers
 
 	/**
 	 * @brief Enhanced unordered set with full heterogeneous support for string types
+	 * @tparam Allocator Node allocator; elements are std::basic_string rebound to the same allocator,
+	 *         so std::pmr::polymorphic_allocator yields std::pmr::string elements (see pmr::StringSet)
+	 * @note Use the StringSet alias for the default std::allocator / std::string instantiation
 	 */
-	class StringSet final : public std::unordered_set<std::string, StringViewHash, StringViewEqual>
+	template <typename Allocator = std::allocator<std::string>>
+	class BasicStringSet final : public std::unordered_set<detail::RebindString<Allocator>, StringViewHash, StringViewEqual,
+									 typename std::allocator_traits<Allocator>::template rebind_alloc<detail::RebindString<Allocator>>>
 	{
-		using Base = std::unordered_set<std::string, StringViewHash, StringViewEqual>;
+		using KeyString = detail::RebindString<Allocator>;
+		using Base = std::unordered_set<KeyString, StringViewHash, StringViewEqual,
+			typename std::allocator_traits<Allocator>::template rebind_alloc<KeyString>>;
 
 	public:
 		//----------------------------------------------
@@ -210,6 +219,19 @@ namespace nfx::containers
 		 */
 		NFX_META_INLINE bool contains( std::string_view key ) const noexcept;
 	};
+
+	/** @brief Heterogeneous string set with std::string elements */
+	using StringSet = BasicStringSet<>;
+
+	//=====================================================================
+	// Polymorphic allocator aliases
+	//=====================================================================
+
+	namespace pmr
+	{
+		/** @brief StringSet whose nodes, buckets and std::pmr::string elements share one memory resource */
+		using StringSet = BasicStringSet<std::pmr::polymorphic_allocator<std::pmr::string>>;
+	} // namespace pmr
 } // namespace nfx::containers
 
 #include "nfx/detail/containers/StringSet.inl"
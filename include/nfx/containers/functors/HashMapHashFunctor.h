@@ -12,6 +12,8 @@
 #include <string_view>
 #include <type_traits>
 
+#include "nfx/core/Hashing.h"
+
 #include "nfx/config.h"
 
 namespace nfx::containers
@@ -31,8 +33,11 @@ namespace nfx::containers
 	 * - Integer hashing: Multiplicative hashing with proper avalanche properties
 	 * - Heterogeneous lookup: Supports string/string_view/const char*
 	 * - Zero allocation: No temporary string creation during lookups
+	 *
+	 * @tparam FnvOffsetBasis FNV-1a offset basis constant
+	 * @tparam FnvPrime FNV-1a prime constant used by the non-SSE4.2 string path
 	 */
-	template <uint32_t FnvOffsetBasis>
+	template <uint32_t FnvOffsetBasis, uint32_t FnvPrime = core::hashing::constants::DEFAULT_FNV_PRIME>
 	struct HashMapHash final
 	{
 		/**
@@ -89,6 +94,8 @@ namespace nfx::containers
 
 		/**
 		 * @brief Fallback to std::hash for non-optimized types
+		 * @details Types convertible to std::string_view (e.g. std::pmr::string) are excluded
+		 *          so they hash the same as their string_view for heterogeneous lookup
 		 * @tparam T Type to hash
 		 * @param value Value to hash
 		 * @return Standard library hash
@@ -97,9 +104,7 @@ namespace nfx::containers
 		template <typename T>
 		[[nodiscard]] NFX_META_INLINE std::enable_if_t<
 			!std::is_integral_v<T> &&
-				!std::is_same_v<T, std::string> &&
-				!std::is_same_v<T, std::string_view> &&
-				!std::is_same_v<T, const char*>,
+				!std::is_convertible_v<const T&, std::string_view>,
 			size_t>
 		operator()( const T& value ) const noexcept;
 	};
@@ -0,0 +1,383 @@
+/**
+ * @file HashPolicies.h
+ * @brief Alternative string hash policies for HashMap
+ * @details Drop-in replacements for HashMapHash selected through HashMap's Hasher template
+ *          parameter. Each policy hashes strings with a 64-bit algorithm that consumes
+ *          8 bytes per step, which dominates the cost of long keys (paths, URLs), and keeps
+ *          HashMapHash's integer mixing and std::hash fallback for every other key type.
+ *
+ * ## Policy selection:
+ *
+ * ```
+ * ┌──────────────┬──────────────────────────────────────────────┐
+ * │ Policy       │ String algorithm                             │
+ * ├──────────────┼──────────────────────────────────────────────┤
+ * │ HashMapHash  │ core::hashing (CRC32 byte-wise / FNV-1a)     │ ← Default
+ * │ Crc32Hash    │ CRC32-C, 3 x 8 bytes per step (SSE4.2/ARMv8) │
+ * │ WyHash       │ wyhash, 48 bytes per step, 64x64→128 mixing  │
+ * │ Xxh3Hash     │ XXH3-64 (seed 0, default secret)             │
+ * │ SipHash13    │ SipHash-1-3, random 128-bit key per instance │ ← Untrusted keys
+ * └──────────────┴──────────────────────────────────────────────┘
+ *
+ * HashMap<std::string, int, Basis, Prime, Layout, Alloc, Xxh3Hash>
+ * ```
+ *
+ * The unkeyed policies are deterministic: anyone who knows the algorithm can precompute
+ * keys that share a bucket. SipHash13 is keyed with a secret drawn per instance, and
+ * HashMap rebuilds under a fresh key when a probe sequence grows suspiciously long.
+ *
+ * @note Hash values are not stable across policies, and Crc32Hash falls back to wyhash
+ *       when the target has no CRC32 instructions. Do not persist them.
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "nfx/core/Hashing.h"
+
+#include "nfx/config.h"
+
+/** @brief Hardware CRC32-C available to Crc32Hash (x86-64 SSE4.2 or AArch64 CRC extension) */
+#if ( defined( __SSE4_2__ ) && defined( __x86_64__ ) ) || ( defined( _MSC_VER ) && defined( _M_X64 ) && defined( __AVX__ ) )
+#	define NFX_META_HAS_HW_CRC32 1
+#elif defined( __ARM_FEATURE_CRC32 ) && defined( __aarch64__ )
+#	define NFX_META_HAS_HW_CRC32 1
+#else
+#	define NFX_META_HAS_HW_CRC32 0
+#endif
+
+namespace nfx::containers
+{
+	namespace detail
+	{
+		//=====================================================================
+		// String hash algorithms
+		//=====================================================================
+
+		/**
+		 * @brief wyhash (final4 mixing, default secret)
+		 * @details Reads 16 bytes per 64x64→128 multiply, three independent lanes for
+		 *          inputs of 48 bytes and more. Fast everywhere a 128-bit product is cheap.
+		 */
+		struct WyHashAlgorithm final
+		{
+			/**
+			 * @brief Hash a byte range
+			 * @param data First byte
+			 * @param size Number of bytes
+			 * @return 64-bit hash
+			 */
+			[[nodiscard]] static NFX_META_INLINE std::uint64_t hash( const char* data, size_t size ) noexcept;
+		};
+
+		/**
+		 * @brief XXH3-64 with seed 0 and the default 192-byte secret
+		 * @details Bit-compatible with XXH3_64bits(). Short inputs use dedicated 1-3, 4-8,
+		 *          9-16, 17-128 and 129-240 byte paths; longer inputs run the 8-lane stripe
+		 *          accumulator (AVX2 or SSE2 on x86-64, scalar elsewhere).
+		 */
+		struct Xxh3Algorithm final
+		{
+			/**
+			 * @brief Hash a byte range
+			 * @param data First byte
+			 * @param size Number of bytes
+			 * @return 64-bit hash, equal to XXH3_64bits( data, size )
+			 */
+			[[nodiscard]] static NFX_META_INLINE std::uint64_t hash( const char* data, size_t size ) noexcept;
+		};
+
+		/**
+		 * @brief Hardware CRC32-C consuming 8 bytes per instruction
+		 * @details Keys of 24 bytes and more are split over three independent CRC lanes to
+		 *          hide the instruction's 3-cycle latency; the lanes are folded back into one
+		 *          CRC before the tail. Falls back to WyHashAlgorithm without CRC32 support.
+		 */
+		struct Crc32Algorithm final
+		{
+			/** @brief Whether hash() uses CRC32 instructions on this target */
+			static constexpr bool HARDWARE_ACCELERATED = NFX_META_HAS_HW_CRC32 != 0;
+
+			/**
+			 * @brief Hash a byte range
+			 * @param data First byte
+			 * @param size Number of bytes
+			 * @return 64-bit hash whose low 32 bits are the folded CRC
+			 */
+			[[nodiscard]] static NFX_META_INLINE std::uint64_t hash( const char* data, size_t size ) noexcept;
+		};
+
+		/**
+		 * @brief SipHash-1-3 keyed pseudo-random function
+		 * @details One compression and three finalization rounds, the variant used by the
+		 *          Rust and CPython hash tables. Without the key an attacker cannot tell which
+		 *          inputs collide, which is what hash flooding relies on.
+		 */
+		struct SipHash13Algorithm final
+		{
+			/**
+			 * @brief Hash a byte range under a 128-bit key
+			 * @param data First byte
+			 * @param size Number of bytes
+			 * @param k0 Low half of the key
+			 * @param k1 High half of the key
+			 * @return 64-bit SipHash-1-3 tag
+			 */
+			[[nodiscard]] static NFX_META_INLINE std::uint64_t hash( const char* data, size_t size, std::uint64_t k0, std::uint64_t k1 ) noexcept;
+
+			/**
+			 * @brief Draw a fresh, unpredictable key half
+			 * @return 64 random bits
+			 * @details std::random_device is read once per process; later draws mix an atomic
+			 *          counter with that secret, so constructing a map costs no system call
+			 */
+			[[nodiscard]] static NFX_META_INLINE std::uint64_t randomKey();
+		};
+	} // namespace detail
+
+	//=====================================================================
+	// HashPolicy functor
+	//=====================================================================
+
+	/**
+	 * @brief HashMap hash functor using a pluggable string algorithm
+	 * @details Same interface as HashMapHash, so it can be passed as HashMap's Hasher:
+	 *          transparent string_view/std::string/const char* hashing through Algorithm,
+	 *          integer mixing through core::hashing::hashInteger and std::hash for the rest.
+	 * @tparam Algorithm Type providing static std::uint64_t hash( const char*, size_t ) noexcept
+	 */
+	template <typename Algorithm>
+	struct HashPolicy final
+	{
+		/**
+		 * @brief Enables heterogeneous lookup in HashMap
+		 * @details Allows different but compatible key types without conversion
+		 */
+		using is_transparent = void;
+
+		//----------------------------------------------
+		// String type hashing
+		//----------------------------------------------
+
+		/**
+		 * @brief Hash string_view with the policy's algorithm
+		 * @param sv String view to hash
+		 * @return Hash value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t operator()( std::string_view sv ) const noexcept;
+
+		/**
+		 * @brief Hash std::string with the policy's algorithm
+		 * @param s String to hash
+		 * @return Hash value, equal to the hash of its string_view
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t operator()( const std::string& s ) const noexcept;
+
+		/**
+		 * @brief Hash C-string with the policy's algorithm
+		 * @param s C-string to hash
+		 * @return Hash value, equal to the hash of its string_view
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t operator()( const char* s ) const noexcept;
+
+		//----------------------------------------------
+		// Integer type hashing (proper mixing)
+		//----------------------------------------------
+
+		/**
+		 * @brief Hash integer with proper avalanche properties
+		 * @tparam T Integer type
+		 * @param value Integer value to hash
+		 * @return Well-distributed hash value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <typename T>
+		[[nodiscard]] NFX_META_INLINE std::enable_if_t<std::is_integral_v<T>, size_t> operator()( T value ) const noexcept;
+
+		//----------------------------------------------
+		// Fallback for other types (delegate to std::hash)
+		//----------------------------------------------
+
+		/**
+		 * @brief Fallback to std::hash for non-string, non-integer types
+		 * @tparam T Type to hash
+		 * @param value Value to hash
+		 * @return Standard library hash
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <typename T>
+		[[nodiscard]] NFX_META_INLINE std::enable_if_t<
+			!std::is_integral_v<T> &&
+				!std::is_convertible_v<const T&, std::string_view>,
+			size_t>
+		operator()( const T& value ) const noexcept;
+	};
+
+	//----------------------------------------------
+	// Built-in policies
+	//----------------------------------------------
+
+	/** @brief Hardware CRC32-C, 8 bytes per instruction over three lanes */
+	using Crc32Hash = HashPolicy<detail::Crc32Algorithm>;
+
+	/** @brief wyhash, portable and fast on every 64-bit target */
+	using WyHash = HashPolicy<detail::WyHashAlgorithm>;
+
+	/** @brief XXH3-64, strongest distribution for long keys */
+	using Xxh3Hash = HashPolicy<detail::Xxh3Algorithm>;
+
+	//=====================================================================
+	// Seeded hashing
+	//=====================================================================
+
+	/**
+	 * @brief Hash functor that can switch to a new secret key
+	 * @details HashMap detects this capability: when an insertion probes MAX_PROBE_DISTANCE
+	 *          buckets or more it calls reseed() and rebuilds every stored hash
+	 */
+	template <typename THasher>
+	concept ReseedableHasher = requires( THasher& hasher ) {
+		{ hasher.reseed() } -> std::same_as<void>;
+	};
+
+	/**
+	 * @brief Flooding-resistant hash functor keyed per instance
+	 * @details SipHash-1-3 under a random 128-bit key drawn at construction. Strings, integers
+	 *          and std::hash results all go through the keyed function, so no key type has a
+	 *          seed-independent collision. Hashing costs 3-6x WyHash, lookups about 2x; use
+	 *          it for maps filled from untrusted input (JSON object keys, HTTP headers, IDs).
+	 *
+	 * Features:
+	 * - Copies share the key, so a copied HashMap keeps its stored hashes valid
+	 * - reseed() draws a new key; HashMap calls it when it detects a collision attack
+	 * - Deterministic keys can be supplied for reproducible tests
+	 */
+	struct SipHash13 final
+	{
+		/**
+		 * @brief Enables heterogeneous lookup in HashMap
+		 * @details Allows different but compatible key types without conversion
+		 */
+		using is_transparent = void;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor drawing a random key
+		 */
+		NFX_META_INLINE SipHash13();
+
+		/**
+		 * @brief Constructor with an explicit key
+		 * @param k0 Low half of the key
+		 * @param k1 High half of the key
+		 */
+		NFX_META_INLINE SipHash13( std::uint64_t k0, std::uint64_t k1 ) noexcept;
+
+		//----------------------------------------------
+		// Key management
+		//----------------------------------------------
+
+		/**
+		 * @brief Replace the key with a freshly drawn random one
+		 * @details Every hash computed under the previous key becomes meaningless
+		 */
+		NFX_META_INLINE void reseed();
+
+		/**
+		 * @brief Get the low half of the current key
+		 * @return First 64 key bits
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE std::uint64_t key0() const noexcept;
+
+		/**
+		 * @brief Get the high half of the current key
+		 * @return Last 64 key bits
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE std::uint64_t key1() const noexcept;
+
+		/**
+		 * @brief Compare the keys of two functors
+		 * @return true if both hash every value identically
+		 * @details Lets HashMap reuse hashes cached by another map drawn from the same key
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] friend bool operator==( const SipHash13&, const SipHash13& ) noexcept = default;
+
+		//----------------------------------------------
+		// String type hashing
+		//----------------------------------------------
+
+		/**
+		 * @brief Hash string_view under the current key
+		 * @param sv String view to hash
+		 * @return Hash value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t operator()( std::string_view sv ) const noexcept;
+
+		/**
+		 * @brief Hash std::string under the current key
+		 * @param s String to hash
+		 * @return Hash value, equal to the hash of its string_view
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t operator()( const std::string& s ) const noexcept;
+
+		/**
+		 * @brief Hash C-string under the current key
+		 * @param s C-string to hash
+		 * @return Hash value, equal to the hash of its string_view
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t operator()( const char* s ) const noexcept;
+
+		//----------------------------------------------
+		// Integer and fallback hashing
+		//----------------------------------------------
+
+		/**
+		 * @brief Hash integer under the current key
+		 * @tparam T Integer type
+		 * @param value Integer value to hash (as 8 bytes)
+		 * @return Hash value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <typename T>
+		[[nodiscard]] NFX_META_INLINE std::enable_if_t<std::is_integral_v<T>, size_t> operator()( T value ) const noexcept;
+
+		/**
+		 * @brief Hash the std::hash value of any other type under the current key
+		 * @tparam T Type to hash
+		 * @param value Value to hash
+		 * @return Hash value
+		 * @note Keyed mixing only helps if std::hash<T> itself is injective enough for T
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <typename T>
+		[[nodiscard]] NFX_META_INLINE std::enable_if_t<
+			!std::is_integral_v<T> &&
+				!std::is_convertible_v<const T&, std::string_view>,
+			size_t>
+		operator()( const T& value ) const noexcept;
+
+	private:
+		std::uint64_t m_k0; ///< Low half of the SipHash key
+		std::uint64_t m_k1; ///< High half of the SipHash key
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/functors/HashPolicies.inl"
@@ -0,0 +1,347 @@
+/**
+ * @file PerfectHashEngines.h
+ * @brief Minimal perfect hash function engines for PerfectHashMap
+ * @details An engine maps each of n distinct 64-bit key hashes to a distinct position in
+ *          [0, n). It is built once from the full hash set and then only evaluated. Engines
+ *          are selected through PerfectHashMap's Engine template parameter and trade index
+ *          space, lookup cost and build time differently:
+ *
+ * ## Engine selection:
+ *
+ * ```
+ * ┌──────────────┬─────────────────────────────────────────────┬───────────┬────────────┐
+ * │ Engine       │ Structure                                   │ Bits/key  │ Build/key  │
+ * ├──────────────┼─────────────────────────────────────────────┼───────────┼────────────┤
+ * │ PtHashEngine │ Skewed buckets, one 16-bit pilot per bucket │ 4.1 - 4.7 │ 0.2-0.5 µs │ ← Default
+ * │ BbHashEngine │ Cascade of bit arrays with rank directory   │ 3.7       │ 30-50 ns   │
+ * └──────────────┴─────────────────────────────────────────────┴───────────┴────────────┘
+ *   Default parameters, 1M-10M keys, single thread
+ * ```
+ *
+ * PtHashEngine answers a lookup with one pilot read and, for the ~2% of keys placed past
+ * n, one remap read. BbHashEngine needs one bit probe per level a key descends plus a rank,
+ * about twice the lookup cost, but builds an order of magnitude faster and never searches.
+ * Neither has CHD's seed limit: pilot search has no practical bound, and BbHashEngine
+ * sends what no level can place to a small sorted fallback.
+ *
+ * Engines only see hashes, never keys. Two keys with equal 64-bit hashes cannot be told
+ * apart, so build() rejects them with std::invalid_argument.
+ *
+ * @see Pibiri, Trani: "PTHash: Revisiting FCH Minimal Perfect Hashing", SIGIR 2021
+ * @see Limasset et al.: "Fast and scalable minimal perfect hashing for massive key sets", SEA 2017
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "nfx/config.h"
+#include "nfx/containers/functors/HashPolicies.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// PerfectHashEngine concept
+	//=====================================================================
+
+	/**
+	 * @brief Requirements on a PerfectHashMap engine
+	 * @details `build(hashes)` constructs the function over distinct hashes and throws
+	 *          std::invalid_argument on equal ones. `position(hash)` returns the hash's index
+	 *          in [0, n) for a hash of the build set, and an arbitrary index in [0, n) for any
+	 *          other when n > 0; an empty engine, built or default-constructed, returns 0.
+	 *          `sizeInBytes()` reports the index footprint.
+	 */
+	template <typename TEngine>
+	concept PerfectHashEngine = std::default_initializable<TEngine> &&
+								requires( TEngine& engine, const TEngine& built, std::span<const std::uint64_t> hashes, std::uint64_t hash ) {
+									{ engine.build( hashes ) } -> std::same_as<void>;
+									{ built.position( hash ) } noexcept -> std::same_as<size_t>;
+									{ built.sizeInBytes() } noexcept -> std::same_as<size_t>;
+								};
+
+	//=====================================================================
+	// PtHashEngine
+	//=====================================================================
+
+	/**
+	 * @brief PTHash-style minimal perfect hash: one displacement pilot per bucket
+	 * @details Keys are split into about c·n/log2(n) buckets, skewed so that 60% of the keys
+	 *          fall into 30% of the buckets. Buckets are placed largest first into a table of
+	 *          n/alpha positions; each gets the smallest pilot k for which every key's
+	 *          `reduce((hash ^ mix(k)) × φ, tableSize)` lands on a free position. Positions at or
+	 *          past n are remapped to the holes left below n.
+	 *
+	 *          Pilots are stored as uint16_t; the rare pilot that does not fit is kept in a
+	 *          sorted overflow list behind an escape value. Build is single-threaded and costs
+	 *          0.2-0.5 µs per key at the defaults, dominated by the last, sparsely free
+	 *          positions; lower alpha or higher c trade index size for build speed.
+	 */
+	class PtHashEngine final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs an unbuilt engine
+		 * @param[in] bucketDensity Buckets per key times log2(n), PTHash's c (default: 5.0)
+		 * @param[in] loadFactor Keys per table position, PTHash's alpha, in (0, 1] (default: 0.98)
+		 */
+		inline explicit PtHashEngine( double bucketDensity = 5.0, double loadFactor = 0.98 ) noexcept;
+
+		//----------------------------------------------
+		// Build
+		//----------------------------------------------
+
+		/**
+		 * @brief Builds the function over a set of distinct hashes
+		 * @param[in] hashes Key hashes; at most 2^32 - 1
+		 * @throws std::invalid_argument if two hashes are equal
+		 * @throws std::length_error if there are too many hashes
+		 */
+		inline void build( std::span<const std::uint64_t> hashes );
+
+		//----------------------------------------------
+		// Evaluation
+		//----------------------------------------------
+
+		/**
+		 * @brief Evaluates the function
+		 * @param[in] hash Key hash
+		 * @return Index in [0, size()); unique per hash of the build set. 0 if the engine is empty
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t position( std::uint64_t hash ) const noexcept;
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the number of keys the function was built over
+		 * @return n
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline size_t size() const noexcept;
+
+		/**
+		 * @brief Gets the memory held by the function
+		 * @return Bytes of pilots, overflow pilots and remap table
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline size_t sizeInBytes() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Private constants
+		//----------------------------------------------
+
+		/** @brief Stored pilot meaning "look the pilot up in m_overflowPilots" */
+		static constexpr std::uint16_t OVERFLOW_PILOT = 0xFFFF;
+
+		//----------------------------------------------
+		// Private helpers
+		//----------------------------------------------
+
+		/**
+		 * @brief Bucket of a hash
+		 * @param[in] hash Key hash
+		 * @return Bucket index in [0, m_bucketCount)
+		 */
+		[[nodiscard]] NFX_META_INLINE std::uint64_t bucket( std::uint64_t hash ) const noexcept;
+
+		/**
+		 * @brief Table position of a hash under a pilot
+		 * @param[in] hash Key hash
+		 * @param[in] pilot Displacement pilot
+		 * @return Position in [0, m_tableSize)
+		 */
+		[[nodiscard]] NFX_META_INLINE std::uint64_t slot( std::uint64_t hash, std::uint64_t pilot ) const noexcept;
+
+		//----------------------------------------------
+		// Private member variables
+		//----------------------------------------------
+
+		/** @brief PTHash c parameter */
+		double m_bucketDensity;
+
+		/** @brief PTHash alpha parameter */
+		double m_loadFactor;
+
+		/** @brief Number of keys */
+		std::uint64_t m_size{ 0 };
+
+		/** @brief Number of table positions, n/alpha */
+		std::uint64_t m_tableSize{ 0 };
+
+		/** @brief Total number of buckets */
+		std::uint64_t m_bucketCount{ 0 };
+
+		/** @brief Number of dense buckets receiving 60% of the keys */
+		std::uint64_t m_denseBuckets{ 0 };
+
+		/** @brief Pilot per bucket, OVERFLOW_PILOT for pilots of 0xFFFF and above */
+		std::vector<std::uint16_t> m_pilots;
+
+		/** @brief (bucket, pilot) for escaped pilots, sorted by bucket */
+		std::vector<std::pair<std::uint32_t, std::uint64_t>> m_overflowPilots;
+
+		/** @brief Position below n for each taken position at or past n, indexed by position - n */
+		std::vector<std::uint32_t> m_remap;
+	};
+
+	//=====================================================================
+	// BbHashEngine
+	//=====================================================================
+
+	/**
+	 * @brief BBHash-style minimal perfect hash: cascade of collision-free bit arrays
+	 * @details Level l hashes the keys still unplaced into gamma·n_l bits. Keys alone in their
+	 *          bit set it and are placed; colliding keys move on to level l + 1. A key's index
+	 *          is the rank of its bit across all levels, answered from a directory of 64-bit
+	 *          cumulative counts every 512 bits. Keys left after maxLevels levels are kept in
+	 *          a sorted fallback list and numbered after the leveled keys.
+	 *
+	 *          Build is a few linear passes over the hashes (no search), 30-50 ns per key, with
+	 *          two temporary bit arrays per level. Higher gamma descends fewer levels per lookup
+	 *          and builds faster at the cost of more bits per key.
+	 */
+	class BbHashEngine final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs an unbuilt engine
+		 * @param[in] gamma Bits per remaining key at each level, at least 1 (default: 2.0)
+		 * @param[in] maxLevels Levels before the fallback list (default: 24)
+		 */
+		inline explicit BbHashEngine( double gamma = 2.0, std::uint32_t maxLevels = 24 ) noexcept;
+
+		//----------------------------------------------
+		// Build
+		//----------------------------------------------
+
+		/**
+		 * @brief Builds the function over a set of distinct hashes
+		 * @param[in] hashes Key hashes
+		 * @throws std::invalid_argument if two hashes are equal
+		 */
+		inline void build( std::span<const std::uint64_t> hashes );
+
+		//----------------------------------------------
+		// Evaluation
+		//----------------------------------------------
+
+		/**
+		 * @brief Evaluates the function
+		 * @param[in] hash Key hash
+		 * @return Index in [0, size()); unique per hash of the build set. 0 if the engine is empty
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] NFX_META_INLINE size_t position( std::uint64_t hash ) const noexcept;
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the number of keys the function was built over
+		 * @return n
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline size_t size() const noexcept;
+
+		/**
+		 * @brief Gets the memory held by the function
+		 * @return Bytes of level bits, rank directory, level table and fallback list
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline size_t sizeInBytes() const noexcept;
+
+		/**
+		 * @brief Gets the number of levels built
+		 * @return Levels holding at least one key
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline size_t levelCount() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Private types
+		//----------------------------------------------
+
+		/** @brief Placement of one level within m_bits */
+		struct Level
+		{
+			/** @brief First bit of the level */
+			std::uint64_t offset;
+
+			/** @brief Number of bits, a multiple of 64 */
+			std::uint64_t bits;
+		};
+
+		//----------------------------------------------
+		// Private constants
+		//----------------------------------------------
+
+		/** @brief Bits covered by one m_ranks entry */
+		static constexpr std::uint64_t RANK_BLOCK_BITS = 512;
+
+		//----------------------------------------------
+		// Private helpers
+		//----------------------------------------------
+
+		/**
+		 * @brief Bit of a hash within a level
+		 * @param[in] hash Key hash
+		 * @param[in] level Level index
+		 * @param[in] bits Bits in the level
+		 * @return Bit index in [0, bits)
+		 */
+		[[nodiscard]] static NFX_META_INLINE std::uint64_t levelBit( std::uint64_t hash, std::uint64_t level, std::uint64_t bits ) noexcept;
+
+		/**
+		 * @brief Number of set bits before a bit of m_bits
+		 * @param[in] bit Bit index
+		 * @return Rank of bit
+		 */
+		[[nodiscard]] NFX_META_INLINE std::uint64_t rank( std::uint64_t bit ) const noexcept;
+
+		//----------------------------------------------
+		// Private member variables
+		//----------------------------------------------
+
+		/** @brief Bits per remaining key per level */
+		double m_gamma;
+
+		/** @brief Level limit */
+		std::uint32_t m_maxLevels;
+
+		/** @brief Number of keys */
+		std::uint64_t m_size{ 0 };
+
+		/** @brief Placed keys of all levels, concatenated */
+		std::vector<std::uint64_t> m_bits;
+
+		/** @brief Set bits before each RANK_BLOCK_BITS block of m_bits */
+		std::vector<std::uint64_t> m_ranks;
+
+		/** @brief Level placements */
+		std::vector<Level> m_levels;
+
+		/** @brief Hashes no level placed, sorted */
+		std::vector<std::uint64_t> m_fallback;
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/functors/PerfectHashEngines.inl"
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <string_view>
 
@@ -163,6 +164,21 @@ namespace nfx::containers
 		 */
 		[[nodiscard]] inline NFX_META_CONDITIONAL_CONSTEXPR bool operator()( std::string_view lhs, const std::string& rhs ) const noexcept;
 	};
+
+	//=====================================================================
+	// Allocator-aware string key type
+	//=====================================================================
+
+	namespace detail
+	{
+		/**
+		 * @brief std::basic_string<char> using Allocator rebound to char
+		 * @details std::string for std::allocator, std::pmr::string for std::pmr::polymorphic_allocator.
+		 *          Both functors above accept it through its std::string_view conversion.
+		 */
+		template <typename Allocator>
+		using RebindString = std::basic_string<char, std::char_traits<char>, typename std::allocator_traits<Allocator>::template rebind_alloc<char>>;
+	} // namespace detail
 } // namespace nfx::containers
 
 #include "nfx/detail/containers/functors/StringFunctors.inl"
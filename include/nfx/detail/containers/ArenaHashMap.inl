@@ -0,0 +1,218 @@
+/**
+ * @file ArenaHashMap.inl
+ * @brief Template implementation file for ArenaHashMap arena-keyed container
+ * @details Contains template method implementations for arena-backed insertion,
+ *          compacting copies and forwarding lookups to the underlying HashMap
+ */
+
+#include <utility>
+
+#include "nfx/config.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// ArenaHashMap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::ArenaHashMap() = default;
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::ArenaHashMap( size_t initialCapacity, size_t arenaBlockSize )
+		: m_keys{ arenaBlockSize },
+		  m_map{ initialCapacity }
+	{
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::ArenaHashMap( const ArenaHashMap& other )
+		: m_keys{ other.m_keys.blockSize() },
+		  m_map{ other.m_map.capacity() }
+	{
+		// Re-store every live key: the copy never points into other's arena
+		for ( const auto& [key, value] : other.m_map )
+		{
+			m_map.emplaceInternal( m_keys.store( key ), static_cast<std::uint32_t>( m_hasher( key ) ), value );
+		}
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>& ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::operator=( const ArenaHashMap& other )
+	{
+		if ( this != &other )
+		{
+			ArenaHashMap copy{ other };
+			*this = std::move( copy );
+		}
+
+		return *this;
+	}
+
+	//----------------------------------------------
+	// Core operations
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE bool ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::tryGetValue( std::string_view key, TValue*& outValue ) noexcept
+	{
+		return m_map.tryGetValue( key, outValue );
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE bool ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::tryGetValue( std::string_view key, const TValue*& outValue ) const noexcept
+	{
+		// const_cast is safe because lookup only reads the buckets
+		TValue* value{ nullptr };
+		const bool found{ const_cast<map_type&>( m_map ).tryGetValue( key, value ) };
+		outValue = value;
+
+		return found;
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE size_t ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::tryGetValues( std::span<const std::string_view> keys, std::span<TValue*> outValues ) noexcept
+	{
+		return m_map.tryGetValues( keys, outValues );
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE bool ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::contains( std::string_view key ) const noexcept
+	{
+		const TValue* value{ nullptr };
+
+		return tryGetValue( key, value );
+	}
+
+	//----------------------------------------------
+	// Insertion
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	template <typename ValueType>
+		requires std::is_assignable_v<TValue&, ValueType&&> && std::is_constructible_v<TValue, ValueType&&>
+	NFX_META_INLINE void ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::insertOrAssign( std::string_view key, ValueType&& value )
+	{
+		// value is only consumed when a new element is created
+		auto [existing, inserted] = tryEmplace( key, std::forward<ValueType>( value ) );
+		if ( !inserted )
+		{
+			*existing = std::forward<ValueType>( value );
+		}
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	template <typename... Args>
+	NFX_META_INLINE std::pair<TValue*, bool> ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::tryEmplace( std::string_view key, Args&&... args )
+	{
+		const std::uint32_t hash{ static_cast<std::uint32_t>( m_hasher( key ) ) };
+
+		if ( TValue* existing{ m_map.lookup( key, hash ) } )
+		{
+			return { existing, false };
+		}
+
+		return m_map.emplaceInternal( m_keys.store( key ), hash, std::forward<Args>( args )... );
+	}
+
+	//----------------------------------------------
+	// Capacity and memory management
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE void ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::reserve( size_t minCapacity )
+	{
+		m_map.reserve( minCapacity );
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE bool ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::erase( std::string_view key ) noexcept
+	{
+		return m_map.erase( key );
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE void ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::clear()
+	{
+		// Drop the views before the bytes they refer to
+		m_map = map_type{};
+		m_keys.clear();
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE void ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::compact()
+	{
+		ArenaHashMap compacted{ *this };
+		*this = std::move( compacted );
+	}
+
+	//----------------------------------------------
+	// State inspection
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE size_t ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::size() const noexcept
+	{
+		return m_map.size();
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE size_t ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::capacity() const noexcept
+	{
+		return m_map.capacity();
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE bool ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::isEmpty() const noexcept
+	{
+		return m_map.isEmpty();
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE const StringArena& ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::keyArena() const noexcept
+	{
+		return m_keys;
+	}
+
+	//----------------------------------------------
+	// Iteration
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE typename ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::iterator ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::begin() noexcept
+	{
+		return m_map.begin();
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE typename ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::const_iterator ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::begin() const noexcept
+	{
+		return m_map.begin();
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE typename ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::iterator ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::end() noexcept
+	{
+		return m_map.end();
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE typename ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::const_iterator ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::end() const noexcept
+	{
+		return m_map.end();
+	}
+
+	//----------------------------------------------
+	// Comparison
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE bool ArenaHashMap<TValue, FnvOffsetBasis, FnvPrime, Layout>::operator==( const ArenaHashMap& other ) const noexcept
+	{
+		return m_map == other.m_map;
+	}
+} // namespace nfx::containers
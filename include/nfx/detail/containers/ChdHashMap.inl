@@ -22,10 +22,13 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <limits>
 #include <sstream>
+#include <stdexcept>
 #include <string>
-#include <unordered_map>
+#include <system_error>
+#include <thread>
 
 namespace nfx::containers
 {
@@ -37,17 +40,24 @@ namespace nfx::containers
 	// Construction
 	//----------------------------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline ChdHashMap<TValue, FnvOffsetBasis>::ChdHashMap( std::vector<std::pair<std::string, TValue>>&& items, uint32_t maxSeedSearchMultiplier )
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline ChdHashMap<TValue, FnvOffsetBasis, Allocator>::ChdHashMap( container_type&& items, uint32_t maxSeedSearchMultiplier, size_t buildThreads )
 		: m_maxSeedSearchMultiplier{ maxSeedSearchMultiplier },
-		  m_table{},
-		  m_seeds{}
+		  m_table{ items.get_allocator() },
+		  m_slots{ items.get_allocator() },
+		  m_seeds{ items.get_allocator() }
 	{
 		if ( items.empty() )
 		{
 			return;
 		}
 
+		// Slots index entries with 32 bits and reserve the all-ones value for empty slots
+		if ( items.size() >= EMPTY_SLOT )
+		{
+			throw std::length_error{ "ChdHashMap: at most 4294967294 entries are supported" };
+		}
+
 		uint64_t size{ 1 };
 		// Ensure table size is a power of 2 and at least 2x item count for efficient modulo operations (using '&')
 		while ( size < items.size() )
@@ -56,117 +66,183 @@ namespace nfx::containers
 		}
 		size *= 2;
 
-		m_table.reserve( size );
-		m_seeds.reserve( size );
+		const size_t itemCount{ items.size() };
+		const uint64_t mask{ size - 1 };
+		// Every tried seed must fit seed_type, so the bound stays one below its maximum
+		const uint64_t seedLimit{ std::min<uint64_t>( size * m_maxSeedSearchMultiplier, MAX_SEED - 1 ) };
 
-		auto hashBuckets{ std::vector<std::vector<std::pair<unsigned, uint32_t>>>( size ) };
-		for ( auto& bucket : hashBuckets )
+		size_t threadCount{ buildThreads };
+		if ( threadCount == 0 )
 		{
-			bucket.reserve( 4 );
+			threadCount = itemCount >= PARALLEL_BUILD_THRESHOLD ? std::max( 1u, std::thread::hardware_concurrency() ) : 1;
 		}
 
-		for ( size_t i{ 0 }; i < items.size(); ++i )
+		// Hash every key once; each thread writes its own contiguous chunk
+		std::vector<uint32_t> hashes( itemCount );
+		runOnThreads( threadCount, [&]( size_t thread ) {
+			const size_t first{ itemCount * thread / threadCount };
+			const size_t last{ itemCount * ( thread + 1 ) / threadCount };
+			for ( size_t i{ first }; i < last; ++i )
+			{
+				hashes[i] = hash( items[i].first );
+			}
+		} );
+
+		// Flat bucket layout: counting sort of item indices by bucket, ascending within each bucket.
+		// Counts become end offsets, then filling backwards turns them into start offsets.
+		std::vector<uint32_t> bucketStart( size + 1, 0 );
+		for ( size_t i{ 0 }; i < itemCount; ++i )
 		{
-			const auto& key{ items[i].first };
-			uint32_t hashValue{ hash( key ) };
-			auto bucketForItemIdx{ hashValue & ( size - 1 ) };
-			hashBuckets[bucketForItemIdx].emplace_back( static_cast<unsigned int>( i + 1 ), hashValue );
+			++bucketStart[hashes[i] & mask];
 		}
 
-		std::sort( hashBuckets.begin(), hashBuckets.end(), []( const auto& a, const auto& b ) { return a.size() > b.size(); } );
+		size_t largestBucket{ 0 };
+		for ( uint64_t bucket{ 0 }, end{ 0 }; bucket < size; ++bucket )
+		{
+			largestBucket = std::max<size_t>( largestBucket, bucketStart[bucket] );
+			end += bucketStart[bucket];
+			bucketStart[bucket] = static_cast<uint32_t>( end );
+		}
+		bucketStart[size] = static_cast<uint32_t>( itemCount );
 
-		auto indices{ std::vector<unsigned int>( size, 0 ) };
-		auto seeds{ std::vector<int>( size, 0 ) };
+		std::vector<uint32_t> bucketItems( itemCount );
+		for ( size_t i{ itemCount }; i-- > 0; )
+		{
+			bucketItems[--bucketStart[hashes[i] & mask]] = static_cast<uint32_t>( i );
+		}
 
-		size_t currentBucketIdx{ 0 };
-		for ( ; currentBucketIdx < hashBuckets.size() && hashBuckets[currentBucketIdx].size() > 1; ++currentBucketIdx )
+		// Non-empty buckets ordered largest first, ascending bucket index within a size
+		std::vector<uint32_t> sizeOffsets( largestBucket + 2, 0 );
+		for ( uint64_t bucket{ 0 }; bucket < size; ++bucket )
 		{
-			const auto& subKeys{ hashBuckets[currentBucketIdx] };
-			auto entries{ std::unordered_map<size_t, unsigned>() };
-			entries.reserve( subKeys.size() );
-			uint32_t currentSeedValue{ 0 };
+			++sizeOffsets[largestBucket + 1 - ( bucketStart[bucket + 1] - bucketStart[bucket] )];
+		}
+		for ( size_t i{ 0 }, start{ 0 }; i < sizeOffsets.size(); ++i )
+		{
+			const size_t count{ sizeOffsets[i] };
+			sizeOffsets[i] = static_cast<uint32_t>( start );
+			start += count;
+		}
 
-			// CHD ALGORITHM: Find perfect seed value for this collision bucket
-			while ( true )
+		const size_t nonEmptyBuckets{ sizeOffsets[largestBucket + 1] };
+		std::vector<uint32_t> bucketOrder( nonEmptyBuckets );
+		for ( uint64_t bucket{ 0 }; bucket < size; ++bucket )
+		{
+			const size_t bucketSize{ bucketStart[bucket + 1] - bucketStart[bucket] };
+			if ( bucketSize != 0 )
 			{
-				++currentSeedValue;
-				entries.clear();
-				bool seedValid{ true };
+				bucketOrder[sizeOffsets[largestBucket + 1 - bucketSize]++] = static_cast<uint32_t>( bucket );
+			}
+		}
 
-				for ( const auto& k : subKeys )
-				{
-					// Calculate final position using secondary hash with current seed
-					auto finalHash{ core::hashing::seedMix( currentSeedValue, k.second, size ) };
-					bool slotOccupied = indices[finalHash] != 0;
-					bool entryClaimedThisTry = entries.count( finalHash ) != 0;
+		// Occupied table slots, one bit each
+		std::vector<uint64_t> occupied( ( size + 63 ) / 64, 0 );
+		auto slotEntries{ std::vector<detail::ChdSlot, RebindAllocator<detail::ChdSlot>>( size, detail::ChdSlot{ EMPTY_SLOT, 0 }, m_slots.get_allocator() ) };
+		auto seeds{ std::vector<seed_type, RebindAllocator<seed_type>>( size, 0, m_seeds.get_allocator() ) };
 
-					if ( !slotOccupied && !entryClaimedThisTry )
-					{
-						entries[finalHash] = k.first;
-					}
-					else
+		// Final slots of a bucket's items under seed, or false if one is occupied or two coincide
+		auto placeBucket{ [&]( uint32_t bucket, uint64_t seed, uint32_t* slots ) noexcept {
+			const uint32_t first{ bucketStart[bucket] };
+			const uint32_t count{ bucketStart[bucket + 1] - first };
+			for ( uint32_t k{ 0 }; k < count; ++k )
+			{
+				// CHD ALGORITHM: final position from the secondary hash with the current seed
+				const uint32_t slot{ static_cast<uint32_t>(
+					core::hashing::seedMix( static_cast<uint32_t>( seed ), hashes[bucketItems[first + k]], size ) ) };
+				if ( ( occupied[slot >> 6] >> ( slot & 63 ) ) & 1 )
+				{
+					return false;
+				}
+				for ( uint32_t j{ 0 }; j < k; ++j )
+				{
+					if ( slots[j] == slot )
 					{
-						seedValid = false;
-						break;
+						return false;
 					}
 				}
+				slots[k] = slot;
+			}
 
-				if ( seedValid )
+			return true;
+		} };
+
+		// Smallest seed from firstSeed on that places the bucket, or 0 once the threshold is exceeded
+		auto findSeed{ [&]( uint32_t bucket, uint64_t firstSeed, uint32_t* slots ) noexcept -> uint64_t {
+			for ( uint64_t seed{ firstSeed };; ++seed )
+			{
+				if ( placeBucket( bucket, seed, slots ) )
 				{
-					break;
+					return seed;
 				}
-
-				if ( currentSeedValue > size * m_maxSeedSearchMultiplier )
+				if ( seed > seedLimit )
 				{
-					std::ostringstream oss;
-					oss << "Bucket " << currentBucketIdx << ": Seed search exceeded threshold (" << currentSeedValue << "), aborting construction!";
-					throw std::runtime_error{ oss.str() };
+					return 0;
 				}
 			}
+		} };
 
-			for ( const auto& [finalHash, itemIdx] : entries )
+		std::vector<uint32_t> slots( std::max<size_t>( largestBucket, 1 ) );
+		auto commitBucket{ [&]( size_t orderIndex, uint64_t seed ) {
+			const uint32_t bucket{ bucketOrder[orderIndex] };
+			if ( seed != 0 && !placeBucket( bucket, seed, slots.data() ) )
 			{
-				indices[finalHash] = itemIdx;
+				// An earlier bucket of the batch took one of the slots: keep searching past it
+				seed = seed > seedLimit ? 0 : findSeed( bucket, seed + 1, slots.data() );
+			}
+			if ( seed == 0 )
+			{
+				std::ostringstream oss;
+				oss << "Bucket " << orderIndex << ": Seed search exceeded threshold (" << seedLimit + 1 << "), aborting construction!";
+				throw std::runtime_error{ oss.str() };
 			}
-			seeds[subKeys[0].second & ( size - 1 )] = static_cast<int>( currentSeedValue );
-		}
-
-		m_table.resize( size );
-		m_seeds.resize( size, 0 );
-
-		std::vector<size_t> freeSlots;
-		freeSlots.reserve( size );
 
-		for ( size_t i{ 0 }; i < size; ++i )
-		{
-			if ( i < indices.size() && indices[i] != 0 )
+			const uint32_t first{ bucketStart[bucket] };
+			for ( uint32_t k{ 0 }; k < bucketStart[bucket + 1] - first; ++k )
 			{
-				auto itemIndex = indices[i] - 1;
-				m_table[i] = std::move( items[itemIndex] );
+				occupied[slots[k] >> 6] |= uint64_t{ 1 } << ( slots[k] & 63 );
+				const uint32_t item{ bucketItems[first + k] };
+				slotEntries[slots[k]] = detail::ChdSlot{ item, hashes[item] };
 			}
-			else
+			seeds[bucket] = static_cast<seed_type>( seed );
+		} };
+
+		if ( threadCount == 1 )
+		{
+			for ( size_t i{ 0 }; i < nonEmptyBuckets; ++i )
 			{
-				m_table[i] = { std::string{}, TValue{} };
-				if ( i < indices.size() )
-				{
-					freeSlots.push_back( i );
-				}
+				commitBucket( i, findSeed( bucketOrder[i], 1, slots.data() ) );
 			}
 		}
-
-		size_t freeSlotsIndex{ 0 };
-		for ( ; currentBucketIdx < hashBuckets.size() && !hashBuckets[currentBucketIdx].empty(); ++currentBucketIdx )
+		else
 		{
-			const auto& k{ hashBuckets[currentBucketIdx][0] };
-			auto slotIndexInMTable{ freeSlots[freeSlotsIndex++] };
-			auto itemIndex = k.first - 1;
+			// Workers only read the occupancy, so a seed rejected against it is rejected at commit too
+			const size_t batchSize{ threadCount * SEED_SEARCH_BATCH_PER_THREAD };
+			std::vector<uint64_t> speculativeSeeds( std::min( batchSize, nonEmptyBuckets ) );
+			std::vector<uint32_t> workerSlots( threadCount * largestBucket );
 
-			m_table[slotIndexInMTable] = std::move( items[itemIndex] );
+			for ( size_t batchStart{ 0 }; batchStart < nonEmptyBuckets; batchStart += batchSize )
+			{
+				const size_t batchEnd{ std::min( batchStart + batchSize, nonEmptyBuckets ) };
+
+				// Interleaved so the largest, slowest buckets at the front are spread over all threads
+				runOnThreads( threadCount, [&]( size_t thread ) {
+					uint32_t* threadSlots{ workerSlots.data() + thread * largestBucket };
+					for ( size_t i{ batchStart + thread }; i < batchEnd; i += threadCount )
+					{
+						speculativeSeeds[i - batchStart] = findSeed( bucketOrder[i], 1, threadSlots );
+					}
+				} );
 
-			// Use negative seed to directly encode the final table index for single-item buckets
-			seeds[k.second & ( size - 1 )] = -static_cast<int>( slotIndexInMTable + 1 );
+				for ( size_t i{ batchStart }; i < batchEnd; ++i )
+				{
+					commitBucket( i, speculativeSeeds[i - batchStart] );
+				}
+			}
 		}
 
+		// Entries stay dense and in input order; slots only refer to them
+		m_table = std::move( items );
+		m_slots = std::move( slotEntries );
 		m_seeds = std::move( seeds );
 	}
 
@@ -174,45 +250,29 @@ namespace nfx::containers
 	// Lookup operators
 	//----------------------------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	NFX_META_INLINE TValue& ChdHashMap<TValue, FnvOffsetBasis>::operator[]( std::string_view key )
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	NFX_META_INLINE TValue& ChdHashMap<TValue, FnvOffsetBasis, Allocator>::operator[]( std::string_view key )
 	{
 		if ( isEmpty() )
 		{
 			ThrowHelper::throwKeyNotFoundException( key );
 		}
 
-		uint32_t hashValue = hash( key );
-		const size_t tableSize = m_table.size();
-		const uint32_t index = hashValue & ( tableSize - 1 );
-		const int seed = m_seeds[index];
-
-		size_t finalIndex;
-		if ( seed < 0 )
+		const uint32_t entry{ entryIndex( key ) };
+		if ( entry == EMPTY_SLOT )
 		{
-			finalIndex = static_cast<size_t>( -seed - 1 );
-		}
-		else
-		{
-			finalIndex = core::hashing::seedMix( static_cast<uint32_t>( seed ), hashValue, tableSize );
-		}
-
-		const auto& kvp = m_table[finalIndex];
-
-		if ( key == kvp.first )
-		{
-			return const_cast<TValue&>( kvp.second );
+			ThrowHelper::throwKeyNotFoundException( key );
 		}
 
-		ThrowHelper::throwKeyNotFoundException( key );
+		return m_table[entry].second;
 	}
 
 	//----------------------------------------------
 	// Lookup methods
 	//----------------------------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline const TValue& ChdHashMap<TValue, FnvOffsetBasis>::at( std::string_view key )
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline const TValue& ChdHashMap<TValue, FnvOffsetBasis, Allocator>::at( std::string_view key )
 	{
 		if ( isEmpty() )
 		{
@@ -232,24 +292,30 @@ namespace nfx::containers
 	// Accessors
 	//----------------------------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline size_t ChdHashMap<TValue, FnvOffsetBasis>::size() const noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline size_t ChdHashMap<TValue, FnvOffsetBasis, Allocator>::size() const noexcept
 	{
 		return m_table.size();
 	}
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline uint32_t ChdHashMap<TValue, FnvOffsetBasis>::maxSeedSearchMultiplier() const noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline uint32_t ChdHashMap<TValue, FnvOffsetBasis, Allocator>::maxSeedSearchMultiplier() const noexcept
 	{
 		return m_maxSeedSearchMultiplier;
 	}
 
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline typename ChdHashMap<TValue, FnvOffsetBasis, Allocator>::allocator_type ChdHashMap<TValue, FnvOffsetBasis, Allocator>::allocator() const noexcept
+	{
+		return allocator_type( m_table.get_allocator() );
+	}
+
 	//----------------------------------------------
 	// State inspection methods
 	//----------------------------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline bool ChdHashMap<TValue, FnvOffsetBasis>::isEmpty() const noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline bool ChdHashMap<TValue, FnvOffsetBasis, Allocator>::isEmpty() const noexcept
 	{
 		return m_table.empty();
 	}
@@ -258,8 +324,8 @@ namespace nfx::containers
 	// Comparison operators
 	//----------------------------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline bool ChdHashMap<TValue, FnvOffsetBasis>::operator==( const ChdHashMap& other ) const noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline bool ChdHashMap<TValue, FnvOffsetBasis, Allocator>::operator==( const ChdHashMap& other ) const noexcept
 	{
 		if ( size() != other.size() )
 		{
@@ -289,8 +355,8 @@ namespace nfx::containers
 		return true;
 	}
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline bool ChdHashMap<TValue, FnvOffsetBasis>::operator!=( const ChdHashMap& other ) const noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline bool ChdHashMap<TValue, FnvOffsetBasis, Allocator>::operator!=( const ChdHashMap& other ) const noexcept
 	{
 		return !( *this == other );
 	}
@@ -299,8 +365,8 @@ namespace nfx::containers
 	// Static query methods
 	//----------------------------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	NFX_META_INLINE bool ChdHashMap<TValue, FnvOffsetBasis>::tryGetValue( std::string_view key, TValue*& outValue ) noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	NFX_META_INLINE bool ChdHashMap<TValue, FnvOffsetBasis, Allocator>::tryGetValue( std::string_view key, TValue*& outValue ) noexcept
 	{
 		if ( isEmpty() )
 		{
@@ -308,50 +374,98 @@ namespace nfx::containers
 			return false;
 		}
 
-		const uint32_t hashValue = hash( key );
-		const size_t tableSize = m_table.size();
-		const uint32_t index = hashValue & ( tableSize - 1 );
-		const int seed = m_seeds[index];
+		const uint32_t entry{ entryIndex( key ) };
+		if ( entry == EMPTY_SLOT )
+		{
+			outValue = nullptr;
+			return false;
+		}
 
-		const size_t finalIndex = ( seed < 0 ) ? static_cast<size_t>( -seed - 1 )
-											   : core::hashing::seedMix( static_cast<uint32_t>( seed ), hashValue, tableSize );
+		outValue = &m_table[entry].second;
 
-		auto& kvp = m_table[finalIndex];
-		const size_t keyLen = key.size();
-		const size_t storedLen = kvp.first.size();
+		return true;
+	}
 
-		if ( keyLen == storedLen && !kvp.first.empty() && key == kvp.first )
-		{
-			outValue = &kvp.second;
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	template <typename KeyType>
+	NFX_META_INLINE size_t ChdHashMap<TValue, FnvOffsetBasis, Allocator>::tryGetValues( std::span<const std::type_identity_t<KeyType>> keys, std::span<TValue*> outValues ) noexcept
+	{
+		const size_t count{ std::min( keys.size(), outValues.size() ) };
 
-			return true;
+		if ( isEmpty() )
+		{
+			std::fill_n( outValues.begin(), count, nullptr );
+			return 0;
 		}
 
-		outValue = nullptr;
+		const size_t slotCount{ m_slots.size() };
+		std::array<uint32_t, BATCH_LOOKUP_SIZE> hashes;
+		std::array<uint32_t, BATCH_LOOKUP_SIZE> slots;
+		std::array<uint32_t, BATCH_LOOKUP_SIZE> entries;
+		size_t found{ 0 };
+
+		for ( size_t base{ 0 }; base < count; base += BATCH_LOOKUP_SIZE )
+		{
+			const size_t batch{ std::min( BATCH_LOOKUP_SIZE, count - base ) };
+
+			// Pass 1: hash the whole block and start loading every seed
+			for ( size_t i{ 0 }; i < batch; ++i )
+			{
+				const uint32_t hashValue = hash( std::string_view{ keys[base + i] } );
+				hashes[i] = hashValue;
+				NFX_META_PREFETCH( &m_seeds[hashValue & ( slotCount - 1 )] );
+			}
 
-		return false;
+			// Pass 2: resolve slots and start loading every slot's entry index
+			for ( size_t i{ 0 }; i < batch; ++i )
+			{
+				const seed_type seed{ m_seeds[hashes[i] & ( slotCount - 1 )] };
+				slots[i] = static_cast<uint32_t>( core::hashing::seedMix( seed, hashes[i], slotCount ) );
+				NFX_META_PREFETCH( &m_slots[slots[i]] );
+			}
+
+			// Pass 3: start loading every candidate entry whose key hash matches
+			for ( size_t i{ 0 }; i < batch; ++i )
+			{
+				const detail::ChdSlot slot{ m_slots[slots[i]] };
+				entries[i] = slot.fingerprint == hashes[i] ? slot.entry : EMPTY_SLOT;
+				if ( entries[i] != EMPTY_SLOT )
+				{
+					NFX_META_PREFETCH( &m_table[entries[i]] );
+				}
+			}
+
+			// Pass 4: compare keys
+			for ( size_t i{ 0 }; i < batch; ++i )
+			{
+				const std::string_view key{ keys[base + i] };
+				if ( entries[i] != EMPTY_SLOT && m_table[entries[i]].first == key )
+				{
+					outValues[base + i] = &m_table[entries[i]].second;
+					++found;
+				}
+				else
+				{
+					outValues[base + i] = nullptr;
+				}
+			}
+		}
+
+		return found;
 	}
 
 	//----------------------------------------------
 	// Iteration
 	//----------------------------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline typename ChdHashMap<TValue, FnvOffsetBasis>::Iterator ChdHashMap<TValue, FnvOffsetBasis>::begin() const noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline typename ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Iterator ChdHashMap<TValue, FnvOffsetBasis, Allocator>::begin() const noexcept
 	{
-		for ( size_t i{ 0 }; i < m_table.size(); ++i )
-		{
-			if ( !m_table[i].first.empty() )
-			{
-				return Iterator{ &m_table, i };
-			}
-		}
-
-		return end();
+		return Iterator{ &m_table, 0 };
 	}
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline typename ChdHashMap<TValue, FnvOffsetBasis>::Iterator ChdHashMap<TValue, FnvOffsetBasis>::end() const noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline typename ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Iterator ChdHashMap<TValue, FnvOffsetBasis, Allocator>::end() const noexcept
 	{
 		return Iterator{ &m_table, m_table.size() };
 	}
@@ -360,18 +474,80 @@ namespace nfx::containers
 	// Enumeration
 	//----------------------------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline typename ChdHashMap<TValue, FnvOffsetBasis>::Enumerator ChdHashMap<TValue, FnvOffsetBasis>::enumerator() const noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline typename ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Enumerator ChdHashMap<TValue, FnvOffsetBasis, Allocator>::enumerator() const noexcept
 	{
 		return Enumerator{ &m_table };
 	}
 
+	//----------------------------------------------
+	// Persistence
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline void ChdHashMap<TValue, FnvOffsetBasis, Allocator>::saveImage( const std::filesystem::path& path ) const
+		requires std::is_trivially_copyable_v<TValue>
+	{
+		static_assert( alignof( TValue ) <= detail::CHD_IMAGE_SECTION_ALIGNMENT, "ChdHashMap images cannot hold over-aligned values" );
+
+		uint64_t keyBytes{ 0 };
+		for ( const auto& entry : m_table )
+		{
+			keyBytes += entry.first.size();
+		}
+
+		const uint64_t entryCount{ m_table.size() };
+		const uint64_t slotCount{ m_slots.size() };
+		const auto layout{ detail::chdImageLayout( entryCount, slotCount, keyBytes, sizeof( TValue ) ) };
+
+		// Zero-filled, so padding between sections is deterministic
+		std::vector<std::byte> image( layout.fileSize );
+		if ( !isEmpty() )
+		{
+			std::memcpy( image.data() + layout.seedsOffset, m_seeds.data(), slotCount * sizeof( seed_type ) );
+			std::memcpy( image.data() + layout.slotsOffset, m_slots.data(), slotCount * sizeof( detail::ChdSlot ) );
+		}
+
+		uint64_t keyOffset{ 0 };
+		for ( size_t i{ 0 }; i < m_table.size(); ++i )
+		{
+			const auto& [key, value]{ m_table[i] };
+			std::memcpy( image.data() + layout.keyOffsetsOffset + i * sizeof( uint64_t ), &keyOffset, sizeof( uint64_t ) );
+			std::memcpy( image.data() + layout.valuesOffset + i * sizeof( TValue ), &value, sizeof( TValue ) );
+			if ( !key.empty() )
+			{
+				std::memcpy( image.data() + layout.keysOffset + keyOffset, key.data(), key.size() );
+			}
+			keyOffset += key.size();
+		}
+		std::memcpy( image.data() + layout.keyOffsetsOffset + entryCount * sizeof( uint64_t ), &keyOffset, sizeof( uint64_t ) );
+
+		const auto [hashProbe, seedMixProbe]{ detail::chdImageHashProbes<FnvOffsetBasis>() };
+		const std::span<const std::byte> body{ image.data() + layout.seedsOffset, image.size() - layout.seedsOffset };
+		const detail::ChdImageHeader header{
+			detail::CHD_IMAGE_MAGIC,
+			detail::CHD_IMAGE_VERSION,
+			detail::CHD_IMAGE_BYTE_ORDER,
+			hashProbe,
+			seedMixProbe,
+			static_cast<uint32_t>( sizeof( TValue ) ),
+			static_cast<uint32_t>( alignof( TValue ) ),
+			entryCount,
+			slotCount,
+			keyBytes,
+			layout.fileSize,
+			detail::chdImageChecksum( body ) };
+		std::memcpy( image.data(), &header, sizeof( header ) );
+
+		detail::writeChdImageFile( path, image );
+	}
+
 	//---------------------------
 	// Hashing
 	//---------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	NFX_META_INLINE uint32_t ChdHashMap<TValue, FnvOffsetBasis>::hash( std::string_view key ) noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	NFX_META_INLINE uint32_t ChdHashMap<TValue, FnvOffsetBasis, Allocator>::hash( std::string_view key ) noexcept
 	{
 		return core::hashing::hashStringView<FnvOffsetBasis>( key );
 	}
@@ -384,8 +560,8 @@ namespace nfx::containers
 	// ChdHashMap::KeyNotFoundException
 	//----------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline ChdHashMap<TValue, FnvOffsetBasis>::KeyNotFoundException::KeyNotFoundException( std::string_view key )
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline ChdHashMap<TValue, FnvOffsetBasis, Allocator>::KeyNotFoundException::KeyNotFoundException( std::string_view key )
 		: std::runtime_error{ std::string{ "No value associated to key: " } + std::string{ key } }
 	{
 	}
@@ -394,14 +570,14 @@ namespace nfx::containers
 	// ChdHashMap::InvalidOperationException
 	//----------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline ChdHashMap<TValue, FnvOffsetBasis>::InvalidOperationException::InvalidOperationException()
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline ChdHashMap<TValue, FnvOffsetBasis, Allocator>::InvalidOperationException::InvalidOperationException()
 		: std::runtime_error{ "Operation is not valid due to the current state of the object." }
 	{
 	}
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline ChdHashMap<TValue, FnvOffsetBasis>::InvalidOperationException::InvalidOperationException( std::string_view message )
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline ChdHashMap<TValue, FnvOffsetBasis, Allocator>::InvalidOperationException::InvalidOperationException( std::string_view message )
 		: std::runtime_error{ std::string{ message } }
 	{
 	}
@@ -414,8 +590,8 @@ namespace nfx::containers
 	// Construction
 	//---------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline ChdHashMap<TValue, FnvOffsetBasis>::Iterator::Iterator( const std::vector<std::pair<std::string, TValue>>* table, size_t index ) noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Iterator::Iterator( const container_type* table, size_t index ) noexcept
 		: m_table{ table },
 		  m_index{ index }
 	{
@@ -425,8 +601,8 @@ namespace nfx::containers
 	// Operations
 	//---------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline const std::pair<std::string, TValue>& ChdHashMap<TValue, FnvOffsetBasis>::Iterator::operator*() const
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline const typename ChdHashMap<TValue, FnvOffsetBasis, Allocator>::value_type& ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Iterator::operator*() const
 	{
 		if ( m_index >= m_table->size() )
 		{
@@ -438,8 +614,8 @@ namespace nfx::containers
 		return ( *m_table )[m_index];
 	}
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline const std::pair<std::string, TValue>* ChdHashMap<TValue, FnvOffsetBasis>::Iterator::operator->() const
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline const typename ChdHashMap<TValue, FnvOffsetBasis, Allocator>::value_type* ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Iterator::operator->() const
 	{
 		if ( m_index >= m_table->size() )
 		{
@@ -451,30 +627,24 @@ namespace nfx::containers
 		return &( ( *m_table )[m_index] );
 	}
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline typename ChdHashMap<TValue, FnvOffsetBasis>::Iterator& ChdHashMap<TValue, FnvOffsetBasis>::Iterator::operator++() noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline typename ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Iterator& ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Iterator::operator++() noexcept
 	{
 		if ( m_table == nullptr )
 		{
 			return *this;
 		}
 
-		while ( ++m_index < m_table->size() )
+		if ( m_index < m_table->size() )
 		{
-			const auto& entry{ ( *m_table )[m_index] };
-			if ( !entry.first.empty() )
-			{
-				return *this;
-			}
+			++m_index;
 		}
 
-		m_index = m_table->size();
-
 		return *this;
 	}
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline typename ChdHashMap<TValue, FnvOffsetBasis>::Iterator ChdHashMap<TValue, FnvOffsetBasis>::Iterator::operator++( int ) noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline typename ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Iterator ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Iterator::operator++( int ) noexcept
 	{
 		auto tmp{ Iterator{ *this } };
 		++( *this );
@@ -486,14 +656,14 @@ namespace nfx::containers
 	// Comparison
 	//---------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline bool ChdHashMap<TValue, FnvOffsetBasis>::Iterator::operator==( const Iterator& other ) const noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline bool ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Iterator::operator==( const Iterator& other ) const noexcept
 	{
 		return m_table == other.m_table && m_index == other.m_index;
 	}
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline bool ChdHashMap<TValue, FnvOffsetBasis>::Iterator::operator!=( const Iterator& other ) const noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline bool ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Iterator::operator!=( const Iterator& other ) const noexcept
 	{
 		return !( *this == other );
 	}
@@ -506,8 +676,8 @@ namespace nfx::containers
 	// Construction
 	//----------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline ChdHashMap<TValue, FnvOffsetBasis>::Enumerator::Enumerator( const std::vector<std::pair<std::string, TValue>>* table ) noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Enumerator::Enumerator( const container_type* table ) noexcept
 		: m_table{ table },
 		  m_index{ std::numeric_limits<size_t>::max() }
 	{
@@ -517,19 +687,20 @@ namespace nfx::containers
 	// Enumeration
 	//----------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline bool ChdHashMap<TValue, FnvOffsetBasis>::Enumerator::next() noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline bool ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Enumerator::next() noexcept
 	{
-		do
+		// Entries are dense: starting from SIZE_MAX, the first increment wraps to 0
+		if ( m_index == SIZE_MAX || m_index < m_table->size() )
 		{
 			++m_index;
-		} while ( m_index < m_table->size() && ( *m_table )[m_index].first.empty() );
+		}
 
 		return m_index < m_table->size();
 	}
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline const std::pair<std::string, TValue>& ChdHashMap<TValue, FnvOffsetBasis>::Enumerator::current() const
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline const typename ChdHashMap<TValue, FnvOffsetBasis, Allocator>::value_type& ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Enumerator::current() const
 	{
 		if ( !m_table || m_index == SIZE_MAX || m_index >= m_table->size() )
 		{
@@ -539,8 +710,8 @@ namespace nfx::containers
 		return ( *m_table )[m_index];
 	}
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline void ChdHashMap<TValue, FnvOffsetBasis>::Enumerator::reset() noexcept
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline void ChdHashMap<TValue, FnvOffsetBasis, Allocator>::Enumerator::reset() noexcept
 	{
 		m_index = std::numeric_limits<size_t>::max();
 	}
@@ -553,15 +724,72 @@ namespace nfx::containers
 	// Static exception methods
 	//----------------------------
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline void ChdHashMap<TValue, FnvOffsetBasis>::ThrowHelper::throwKeyNotFoundException( std::string_view key )
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline void ChdHashMap<TValue, FnvOffsetBasis, Allocator>::ThrowHelper::throwKeyNotFoundException( std::string_view key )
 	{
 		throw KeyNotFoundException{ key };
 	}
 
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	inline void ChdHashMap<TValue, FnvOffsetBasis>::ThrowHelper::throwInvalidOperationException()
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	inline void ChdHashMap<TValue, FnvOffsetBasis, Allocator>::ThrowHelper::throwInvalidOperationException()
 	{
 		throw InvalidOperationException{};
 	}
+
+	//----------------------------------------------
+	// Private lookup helpers
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	NFX_META_INLINE uint32_t ChdHashMap<TValue, FnvOffsetBasis, Allocator>::entryIndex( std::string_view key ) const noexcept
+	{
+		const uint32_t hashValue{ hash( key ) };
+		const size_t slotCount{ m_slots.size() };
+		const seed_type seed{ m_seeds[hashValue & ( slotCount - 1 )] };
+		const detail::ChdSlot slot{ m_slots[core::hashing::seedMix( seed, hashValue, slotCount )] };
+
+		// A different key hash rejects the slot without touching the entry or its key bytes
+		if ( slot.entry != EMPTY_SLOT && slot.fingerprint == hashValue && m_table[slot.entry].first == key )
+		{
+			return slot.entry;
+		}
+
+		return EMPTY_SLOT;
+	}
+
+	//----------------------------------------------
+	// Private construction helpers
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	template <typename Function>
+	inline void ChdHashMap<TValue, FnvOffsetBasis, Allocator>::runOnThreads( size_t threadCount, const Function& function )
+	{
+		std::vector<std::thread> workers;
+		workers.reserve( threadCount > 0 ? threadCount - 1 : 0 );
+
+		size_t started{ 1 };
+		try
+		{
+			for ( ; started < threadCount; ++started )
+			{
+				workers.emplace_back( [&function, started]() { function( started ); } );
+			}
+		}
+		catch ( const std::system_error& )
+		{
+			// Out of threads: the calling thread takes over the indices that were not started
+		}
+
+		function( 0 );
+		for ( size_t thread{ started }; thread < threadCount; ++thread )
+		{
+			function( thread );
+		}
+
+		for ( auto& worker : workers )
+		{
+			worker.join();
+		}
+	}
 } // namespace nfx::containers
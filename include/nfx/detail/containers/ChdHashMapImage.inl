@@ -0,0 +1,547 @@
+/**
+ * @file ChdHashMapImage.inl
+ * @brief Implementation file for ChdHashMapImage
+ * @details Image layout, checksum and file mapping helpers, and the read-only mapped view
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <random>
+#include <string>
+#include <system_error>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace nfx::containers
+{
+	namespace detail
+	{
+		//=====================================================================
+		// ChdHashMap image format
+		//=====================================================================
+
+		NFX_META_INLINE constexpr ChdImageLayout chdImageLayout(
+			uint64_t entryCount, uint64_t slotCount, uint64_t keyBytes, uint64_t valueSize ) noexcept
+		{
+			constexpr auto alignUp{ []( uint64_t offset ) noexcept {
+				return ( offset + CHD_IMAGE_SECTION_ALIGNMENT - 1 ) & ~( CHD_IMAGE_SECTION_ALIGNMENT - 1 );
+			} };
+
+			ChdImageLayout layout{};
+			layout.seedsOffset = alignUp( sizeof( ChdImageHeader ) );
+			layout.slotsOffset = alignUp( layout.seedsOffset + slotCount * sizeof( uint16_t ) );
+			layout.keyOffsetsOffset = alignUp( layout.slotsOffset + slotCount * sizeof( ChdSlot ) );
+			layout.valuesOffset = alignUp( layout.keyOffsetsOffset + ( entryCount + 1 ) * sizeof( uint64_t ) );
+			layout.keysOffset = alignUp( layout.valuesOffset + entryCount * valueSize );
+			layout.fileSize = alignUp( layout.keysOffset + keyBytes );
+
+			return layout;
+		}
+
+		template <uint32_t FnvOffsetBasis>
+		NFX_META_INLINE std::pair<uint32_t, uint32_t> chdImageHashProbes() noexcept
+		{
+			const uint32_t hashProbe{ core::hashing::hashStringView<FnvOffsetBasis>( CHD_IMAGE_HASH_PROBE_KEY ) };
+			const uint32_t seedMixProbe{ static_cast<uint32_t>( core::hashing::seedMix( 0x9E37u, hashProbe, size_t{ 1 } << 31 ) ) };
+
+			return { hashProbe, seedMixProbe };
+		}
+
+		NFX_META_INLINE uint64_t chdImageChecksum( std::span<const std::byte> bytes ) noexcept
+		{
+			constexpr uint64_t prime{ 0x9E3779B97F4A7C15ULL };
+			constexpr auto mix{ []( uint64_t lane, uint64_t word ) noexcept {
+				lane = ( lane ^ word ) * prime;
+				return lane ^ ( lane >> 32 );
+			} };
+
+			std::array<uint64_t, 4> lanes{ 0x243F6A8885A308D3ULL, 0x13198A2E03707344ULL, 0xA4093822299F31D0ULL, 0x082EFA98EC4E6C89ULL };
+			const std::byte* data{ bytes.data() };
+			size_t remaining{ bytes.size() };
+
+			for ( ; remaining >= 4 * sizeof( uint64_t ); data += 4 * sizeof( uint64_t ), remaining -= 4 * sizeof( uint64_t ) )
+			{
+				for ( size_t lane{ 0 }; lane < lanes.size(); ++lane )
+				{
+					uint64_t word;
+					std::memcpy( &word, data + lane * sizeof( uint64_t ), sizeof( word ) );
+					lanes[lane] = mix( lanes[lane], word );
+				}
+			}
+
+			for ( ; remaining >= sizeof( uint64_t ); data += sizeof( uint64_t ), remaining -= sizeof( uint64_t ) )
+			{
+				uint64_t word;
+				std::memcpy( &word, data, sizeof( word ) );
+				lanes[0] = mix( lanes[0], word );
+			}
+
+			if ( remaining != 0 )
+			{
+				uint64_t word{ 0 };
+				std::memcpy( &word, data, remaining );
+				lanes[1] = mix( lanes[1], word );
+			}
+
+			uint64_t checksum{ bytes.size() };
+			for ( const uint64_t lane : lanes )
+			{
+				checksum = mix( checksum, lane );
+			}
+
+			return checksum;
+		}
+
+		inline std::filesystem::path chdImageTemporaryPath( const std::filesystem::path& path )
+		{
+			// Random per call, plus a process-wide counter in case random_device is deterministic
+			static std::atomic<uint64_t> counter{ 0 };
+			std::random_device device;
+			const uint64_t suffix{ ( ( uint64_t{ device() } << 32 ) ^ device() ) + counter.fetch_add( 1, std::memory_order_relaxed ) * 0x9E3779B97F4A7C15ULL };
+
+			std::array<char, 16> digits{};
+			const auto result{ std::to_chars( digits.data(), digits.data() + digits.size(), suffix, 16 ) };
+
+			std::filesystem::path temporary{ path };
+			temporary += ".";
+			temporary += std::string_view{ digits.data(), static_cast<size_t>( result.ptr - digits.data() ) };
+			temporary += ".tmp";
+
+			return temporary;
+		}
+
+		inline void writeChdImageFile( const std::filesystem::path& path, std::span<const std::byte> image )
+		{
+			// Concurrent writers of the same path each fill their own file; the last rename wins
+			const std::filesystem::path temporary{ chdImageTemporaryPath( path ) };
+
+			{
+				std::ofstream file{ temporary, std::ios::binary | std::ios::trunc };
+				file.write( reinterpret_cast<const char*>( image.data() ), static_cast<std::streamsize>( image.size() ) );
+				file.close();
+				if ( !file )
+				{
+					std::error_code ignored;
+					std::filesystem::remove( temporary, ignored );
+					throw std::runtime_error{ "Cannot write ChdHashMap image: " + temporary.string() };
+				}
+			}
+
+			// Replaces the directory entry only: existing mappings of the old file stay valid
+			std::filesystem::rename( temporary, path );
+		}
+
+		inline const std::byte* mapChdImageFile( const std::filesystem::path& path, size_t& bytes )
+		{
+#if defined( __unix__ ) || defined( __APPLE__ )
+			const int descriptor{ ::open( path.c_str(), O_RDONLY | O_CLOEXEC ) };
+			if ( descriptor < 0 )
+			{
+				throw std::system_error{ errno, std::generic_category(), "Cannot open ChdHashMap image " + path.string() };
+			}
+
+			struct stat status{};
+			if ( ::fstat( descriptor, &status ) != 0 )
+			{
+				const int error{ errno };
+				::close( descriptor );
+				throw std::system_error{ error, std::generic_category(), "Cannot stat ChdHashMap image " + path.string() };
+			}
+
+			bytes = static_cast<size_t>( status.st_size );
+			if ( bytes == 0 )
+			{
+				::close( descriptor );
+				return nullptr;
+			}
+
+			// Shared and read-only: every process mapping the file uses the same page cache pages
+			void* address{ ::mmap( nullptr, bytes, PROT_READ, MAP_SHARED, descriptor, 0 ) };
+			const int error{ errno };
+			::close( descriptor );
+			if ( address == MAP_FAILED )
+			{
+				throw std::system_error{ error, std::generic_category(), "Cannot map ChdHashMap image " + path.string() };
+			}
+
+			return static_cast<const std::byte*>( address );
+#else
+			std::ifstream file{ path, std::ios::binary | std::ios::ate };
+			if ( !file )
+			{
+				throw std::system_error{ std::make_error_code( std::errc::no_such_file_or_directory ), "Cannot open ChdHashMap image " + path.string() };
+			}
+
+			bytes = static_cast<size_t>( file.tellg() );
+			if ( bytes == 0 )
+			{
+				return nullptr;
+			}
+
+			auto* buffer{ static_cast<std::byte*>( ::operator new( bytes, std::align_val_t{ CHD_IMAGE_SECTION_ALIGNMENT } ) ) };
+			file.seekg( 0 );
+			if ( !file.read( reinterpret_cast<char*>( buffer ), static_cast<std::streamsize>( bytes ) ) )
+			{
+				::operator delete( buffer, std::align_val_t{ CHD_IMAGE_SECTION_ALIGNMENT } );
+				throw std::system_error{ std::make_error_code( std::errc::io_error ), "Cannot read ChdHashMap image " + path.string() };
+			}
+
+			return buffer;
+#endif
+		}
+
+		inline void unmapChdImageFile( const std::byte* address, size_t bytes ) noexcept
+		{
+#if defined( __unix__ ) || defined( __APPLE__ )
+			::munmap( const_cast<std::byte*>( address ), bytes );
+#else
+			(void)bytes;
+			::operator delete( const_cast<std::byte*>( address ), std::align_val_t{ CHD_IMAGE_SECTION_ALIGNMENT } );
+#endif
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// ChdHashMapImage class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline ChdHashMapImage<TValue, FnvOffsetBasis>::ChdHashMapImage( const std::filesystem::path& path, bool verify )
+	{
+		m_mapping = detail::mapChdImageFile( path, m_mappedBytes );
+
+		try
+		{
+			attach( path, verify );
+		}
+		catch ( ... )
+		{
+			release();
+			throw;
+		}
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline ChdHashMapImage<TValue, FnvOffsetBasis>::ChdHashMapImage( ChdHashMapImage&& other ) noexcept
+		: m_mapping{ std::exchange( other.m_mapping, nullptr ) },
+		  m_mappedBytes{ std::exchange( other.m_mappedBytes, 0 ) },
+		  m_size{ std::exchange( other.m_size, 0 ) },
+		  m_slotCount{ std::exchange( other.m_slotCount, 0 ) },
+		  m_seeds{ std::exchange( other.m_seeds, nullptr ) },
+		  m_slots{ std::exchange( other.m_slots, nullptr ) },
+		  m_keyOffsets{ std::exchange( other.m_keyOffsets, nullptr ) },
+		  m_values{ std::exchange( other.m_values, nullptr ) },
+		  m_keys{ std::exchange( other.m_keys, nullptr ) }
+	{
+	}
+
+	//----------------------------------------------
+	// Destruction
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline ChdHashMapImage<TValue, FnvOffsetBasis>::~ChdHashMapImage()
+	{
+		release();
+	}
+
+	//----------------------------------------------
+	// Assignment
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline ChdHashMapImage<TValue, FnvOffsetBasis>& ChdHashMapImage<TValue, FnvOffsetBasis>::operator=( ChdHashMapImage&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			release();
+			m_mapping = std::exchange( other.m_mapping, nullptr );
+			m_mappedBytes = std::exchange( other.m_mappedBytes, 0 );
+			m_size = std::exchange( other.m_size, 0 );
+			m_slotCount = std::exchange( other.m_slotCount, 0 );
+			m_seeds = std::exchange( other.m_seeds, nullptr );
+			m_slots = std::exchange( other.m_slots, nullptr );
+			m_keyOffsets = std::exchange( other.m_keyOffsets, nullptr );
+			m_values = std::exchange( other.m_values, nullptr );
+			m_keys = std::exchange( other.m_keys, nullptr );
+		}
+
+		return *this;
+	}
+
+	//----------------------------------------------
+	// Lookup methods
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline const TValue& ChdHashMapImage<TValue, FnvOffsetBasis>::at( std::string_view key ) const
+	{
+		const TValue* value{ nullptr };
+		if ( !tryGetValue( key, value ) )
+		{
+			throw KeyNotFoundException{ key };
+		}
+
+		return *value;
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	NFX_META_INLINE bool ChdHashMapImage<TValue, FnvOffsetBasis>::tryGetValue( std::string_view key, const TValue*& outValue ) const noexcept
+	{
+		const uint32_t entry{ isEmpty() ? EMPTY_SLOT : entryIndex( key ) };
+		if ( entry == EMPTY_SLOT )
+		{
+			outValue = nullptr;
+			return false;
+		}
+
+		outValue = &m_values[entry];
+
+		return true;
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	NFX_META_INLINE bool ChdHashMapImage<TValue, FnvOffsetBasis>::contains( std::string_view key ) const noexcept
+	{
+		return !isEmpty() && entryIndex( key ) != EMPTY_SLOT;
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline size_t ChdHashMapImage<TValue, FnvOffsetBasis>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline bool ChdHashMapImage<TValue, FnvOffsetBasis>::isEmpty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline size_t ChdHashMapImage<TValue, FnvOffsetBasis>::mappedBytes() const noexcept
+	{
+		return m_mappedBytes;
+	}
+
+	//----------------------------------------------
+	// Iteration
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline typename ChdHashMapImage<TValue, FnvOffsetBasis>::Iterator ChdHashMapImage<TValue, FnvOffsetBasis>::begin() const noexcept
+	{
+		return Iterator{ this, 0 };
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline typename ChdHashMapImage<TValue, FnvOffsetBasis>::Iterator ChdHashMapImage<TValue, FnvOffsetBasis>::end() const noexcept
+	{
+		return Iterator{ this, m_size };
+	}
+
+	//----------------------------------------------
+	// Exception classes
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline ChdHashMapImage<TValue, FnvOffsetBasis>::KeyNotFoundException::KeyNotFoundException( std::string_view key )
+		: std::runtime_error{ std::string{ "No value associated to key: " } + std::string{ key } }
+	{
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline ChdHashMapImage<TValue, FnvOffsetBasis>::InvalidImageException::InvalidImageException( const std::filesystem::path& path, std::string_view reason )
+		: std::runtime_error{ "Invalid ChdHashMap image " + path.string() + ": " + std::string{ reason } }
+	{
+	}
+
+	//----------------------------------------------
+	// ChdHashMapImage::Iterator class
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline ChdHashMapImage<TValue, FnvOffsetBasis>::Iterator::Iterator( const ChdHashMapImage* image, size_t index ) noexcept
+		: m_image{ image },
+		  m_index{ index }
+	{
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline typename ChdHashMapImage<TValue, FnvOffsetBasis>::value_type ChdHashMapImage<TValue, FnvOffsetBasis>::Iterator::operator*() const noexcept
+	{
+		return value_type{ m_image->keyAt( m_index ), m_image->m_values[m_index] };
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline typename ChdHashMapImage<TValue, FnvOffsetBasis>::Iterator& ChdHashMapImage<TValue, FnvOffsetBasis>::Iterator::operator++() noexcept
+	{
+		++m_index;
+
+		return *this;
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline typename ChdHashMapImage<TValue, FnvOffsetBasis>::Iterator ChdHashMapImage<TValue, FnvOffsetBasis>::Iterator::operator++( int ) noexcept
+	{
+		auto tmp{ Iterator{ *this } };
+		++m_index;
+
+		return tmp;
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline bool ChdHashMapImage<TValue, FnvOffsetBasis>::Iterator::operator==( const Iterator& other ) const noexcept
+	{
+		return m_image == other.m_image && m_index == other.m_index;
+	}
+
+	//----------------------------------------------
+	// Private helpers
+	//----------------------------------------------
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	NFX_META_INLINE std::string_view ChdHashMapImage<TValue, FnvOffsetBasis>::keyAt( size_t entry ) const noexcept
+	{
+		const uint64_t first{ m_keyOffsets[entry] };
+
+		return std::string_view{ m_keys + first, static_cast<size_t>( m_keyOffsets[entry + 1] - first ) };
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	NFX_META_INLINE uint32_t ChdHashMapImage<TValue, FnvOffsetBasis>::entryIndex( std::string_view key ) const noexcept
+	{
+		// Same resolution as ChdHashMap::entryIndex()
+		const uint32_t hashValue{ core::hashing::hashStringView<FnvOffsetBasis>( key ) };
+		const uint16_t seed{ m_seeds[hashValue & ( m_slotCount - 1 )] };
+		const detail::ChdSlot slot{ m_slots[core::hashing::seedMix( seed, hashValue, m_slotCount )] };
+
+		if ( slot.entry != EMPTY_SLOT && slot.fingerprint == hashValue && keyAt( slot.entry ) == key )
+		{
+			return slot.entry;
+		}
+
+		return EMPTY_SLOT;
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline void ChdHashMapImage<TValue, FnvOffsetBasis>::attach( const std::filesystem::path& path, bool verify )
+	{
+		if ( m_mappedBytes < sizeof( detail::ChdImageHeader ) )
+		{
+			throw InvalidImageException{ path, "file is smaller than the image header" };
+		}
+
+		detail::ChdImageHeader header;
+		std::memcpy( &header, m_mapping, sizeof( header ) );
+
+		if ( header.magic != detail::CHD_IMAGE_MAGIC )
+		{
+			throw InvalidImageException{ path, "not a ChdHashMap image" };
+		}
+		if ( header.byteOrder != detail::CHD_IMAGE_BYTE_ORDER )
+		{
+			throw InvalidImageException{ path, "written on a machine of the other byte order" };
+		}
+		if ( header.version != detail::CHD_IMAGE_VERSION )
+		{
+			throw InvalidImageException{ path, "unsupported format version " + std::to_string( header.version ) };
+		}
+
+		const auto [hashProbe, seedMixProbe]{ detail::chdImageHashProbes<FnvOffsetBasis>() };
+		if ( header.hashProbe != hashProbe || header.seedMixProbe != seedMixProbe )
+		{
+			throw InvalidImageException{ path, "built with a different hash function or FNV offset basis" };
+		}
+		if ( header.valueSize != sizeof( TValue ) || header.valueAlignment != alignof( TValue ) )
+		{
+			throw InvalidImageException{ path, "value type size or alignment differs" };
+		}
+		if ( header.fileSize != m_mappedBytes )
+		{
+			throw InvalidImageException{ path, "file size does not match the header" };
+		}
+
+		// Bounded before computing the layout, so the offsets below cannot overflow
+		const bool slotCountValid{ header.slotCount == 0
+									   ? header.entryCount == 0
+									   : header.slotCount <= ( uint64_t{ 1 } << 32 ) && ( header.slotCount & ( header.slotCount - 1 ) ) == 0 };
+		if ( !slotCountValid || header.entryCount > header.slotCount || header.keyBytes > header.fileSize )
+		{
+			throw InvalidImageException{ path, "inconsistent entry, slot or key counts" };
+		}
+
+		const auto layout{ detail::chdImageLayout( header.entryCount, header.slotCount, header.keyBytes, sizeof( TValue ) ) };
+		if ( layout.fileSize != header.fileSize )
+		{
+			throw InvalidImageException{ path, "section sizes do not add up to the file size" };
+		}
+
+		m_size = static_cast<size_t>( header.entryCount );
+		m_slotCount = static_cast<size_t>( header.slotCount );
+		m_seeds = reinterpret_cast<const uint16_t*>( m_mapping + layout.seedsOffset );
+		m_slots = reinterpret_cast<const detail::ChdSlot*>( m_mapping + layout.slotsOffset );
+		m_keyOffsets = reinterpret_cast<const uint64_t*>( m_mapping + layout.keyOffsetsOffset );
+		m_values = reinterpret_cast<const TValue*>( m_mapping + layout.valuesOffset );
+		m_keys = reinterpret_cast<const char*>( m_mapping + layout.keysOffset );
+
+		if ( !verify )
+		{
+			return;
+		}
+
+		const std::span<const std::byte> body{ m_mapping + layout.seedsOffset, m_mappedBytes - layout.seedsOffset };
+		if ( detail::chdImageChecksum( body ) != header.checksum )
+		{
+			throw InvalidImageException{ path, "checksum mismatch" };
+		}
+
+		// A well-formed checksum does not prove a well-formed image: keep every lookup in bounds
+		const bool slotsValid{ std::all_of( m_slots, m_slots + m_slotCount,
+			[this]( const detail::ChdSlot& slot ) noexcept { return slot.entry == EMPTY_SLOT || slot.entry < m_size; } ) };
+		const bool keyOffsetsValid{ m_keyOffsets[0] == 0 && m_keyOffsets[m_size] == header.keyBytes &&
+									std::is_sorted( m_keyOffsets, m_keyOffsets + m_size + 1 ) };
+		if ( !slotsValid || !keyOffsetsValid )
+		{
+			throw InvalidImageException{ path, "slot index or key offsets out of range" };
+		}
+	}
+
+	template <typename TValue, uint32_t FnvOffsetBasis>
+	inline void ChdHashMapImage<TValue, FnvOffsetBasis>::release() noexcept
+	{
+		if ( m_mapping != nullptr )
+		{
+			detail::unmapChdImageFile( m_mapping, m_mappedBytes );
+		}
+
+		m_mapping = nullptr;
+		m_mappedBytes = 0;
+		m_size = 0;
+		m_slotCount = 0;
+		m_seeds = nullptr;
+		m_slots = nullptr;
+		m_keyOffsets = nullptr;
+		m_values = nullptr;
+		m_keys = nullptr;
+	}
+} // namespace nfx::containers
@@ -0,0 +1,215 @@
+/**
+ * @file ConcurrentHashMap.inl
+ * @brief Template implementation file for ConcurrentHashMap sharded container
+ * @details Contains template method implementations for shard selection, per-shard
+ *          reader/writer locking and cross-shard aggregation
+ */
+
+#include <bit>
+#include <utility>
+
+#include "nfx/config.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// ConcurrentHashMap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::ConcurrentHashMap()
+		: ConcurrentHashMap( DEFAULT_SHARD_COUNT )
+	{
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::ConcurrentHashMap( size_t shardCount )
+	{
+		size_t count{ 1 };
+		while ( count < shardCount && count < ( size_t{ 1 } << 16 ) )
+		{
+			count <<= 1;
+		}
+
+		m_shardCount = count;
+		m_shardShift = 32u - static_cast<unsigned>( std::countr_zero( count ) );
+		m_shards = std::make_unique<Shard[]>( count );
+	}
+
+	//----------------------------------------------
+	// Core operations
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	template <typename KeyType>
+	NFX_META_INLINE bool ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::tryGetValue( const KeyType& key, TValue& outValue ) const
+	{
+		return visit( key, [&outValue]( const TValue& value ) { outValue = value; } );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	template <typename KeyType>
+	NFX_META_INLINE bool ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::contains( const KeyType& key ) const
+	{
+		return visit( key, []( const TValue& ) {} );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	template <typename KeyType, typename Fn>
+	NFX_META_INLINE bool ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::visit( const KeyType& key, Fn&& fn ) const
+	{
+		const std::uint32_t hash{ static_cast<std::uint32_t>( m_hasher( key ) ) };
+		Shard& shard{ shardFor( hash ) };
+		std::shared_lock lock{ shard.mutex };
+
+		// HashMap lookups never modify the table, so concurrent readers are safe
+		TValue* value{ shard.map.lookup( key, hash ) };
+		if ( value == nullptr )
+		{
+			return false;
+		}
+
+		std::forward<Fn>( fn )( std::as_const( *value ) );
+		return true;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	template <typename KeyType, typename Fn>
+	NFX_META_INLINE bool ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::update( const KeyType& key, Fn&& fn )
+	{
+		const std::uint32_t hash{ static_cast<std::uint32_t>( m_hasher( key ) ) };
+		Shard& shard{ shardFor( hash ) };
+		std::unique_lock lock{ shard.mutex };
+
+		TValue* value{ shard.map.lookup( key, hash ) };
+		if ( value == nullptr )
+		{
+			return false;
+		}
+
+		std::forward<Fn>( fn )( *value );
+		return true;
+	}
+
+	//----------------------------------------------
+	// Insertion
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE void ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::insertOrAssign( const TKey& key, TValue&& value )
+	{
+		const std::uint32_t hash{ static_cast<std::uint32_t>( m_hasher( key ) ) };
+		Shard& shard{ shardFor( hash ) };
+		std::unique_lock lock{ shard.mutex };
+
+		shard.map.insertOrAssignInternal( key, hash, std::move( value ) );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE void ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::insertOrAssign( const TKey& key, const TValue& value )
+	{
+		const std::uint32_t hash{ static_cast<std::uint32_t>( m_hasher( key ) ) };
+		Shard& shard{ shardFor( hash ) };
+		std::unique_lock lock{ shard.mutex };
+
+		shard.map.insertOrAssignInternal( key, hash, value );
+	}
+
+	//----------------------------------------------
+	// Capacity and memory management
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE void ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::reserve( size_t minCapacity )
+	{
+		const size_t perShard{ ( minCapacity + m_shardCount - 1 ) / m_shardCount };
+
+		for ( size_t i = 0; i < m_shardCount; ++i )
+		{
+			std::unique_lock lock{ m_shards[i].mutex };
+			m_shards[i].map.reserve( perShard );
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	template <typename KeyType>
+	NFX_META_INLINE bool ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::erase( const KeyType& key )
+	{
+		const std::uint32_t hash{ static_cast<std::uint32_t>( m_hasher( key ) ) };
+		Shard& shard{ shardFor( hash ) };
+		std::unique_lock lock{ shard.mutex };
+
+		return shard.map.eraseInternal( key, hash );
+	}
+
+	//----------------------------------------------
+	// Aggregation across shards
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	template <typename Fn>
+	NFX_META_INLINE void ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::forEach( Fn&& fn ) const
+	{
+		for ( size_t i = 0; i < m_shardCount; ++i )
+		{
+			const Shard& shard{ m_shards[i] };
+			std::shared_lock lock{ shard.mutex };
+
+			for ( const auto& [key, value] : shard.map )
+			{
+				fn( key, value );
+			}
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE size_t ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::size() const
+	{
+		size_t total{ 0 };
+
+		for ( size_t i = 0; i < m_shardCount; ++i )
+		{
+			std::shared_lock lock{ m_shards[i].mutex };
+			total += m_shards[i].map.size();
+		}
+
+		return total;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE bool ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::isEmpty() const
+	{
+		for ( size_t i = 0; i < m_shardCount; ++i )
+		{
+			std::shared_lock lock{ m_shards[i].mutex };
+			if ( !m_shards[i].map.isEmpty() )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE size_t ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::shardCount() const noexcept
+	{
+		return m_shardCount;
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE typename ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::Shard&
+	ConcurrentHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::shardFor( std::uint32_t hash ) const noexcept
+	{
+		// 64-bit shift so that a single shard (shift of 32) yields index 0 without UB
+		return m_shards[static_cast<size_t>( static_cast<std::uint64_t>( hash ) >> m_shardShift )];
+	}
+} // namespace nfx::containers
@@ -0,0 +1,453 @@
+/**
+ * @file FlatHashMap.inl
+ * @brief Template implementation file for FlatHashMap control-byte hashing container
+ * @details Contains template method implementations for the SIMD group probing engine,
+ *          heterogeneous string lookup and tombstone-aware erase
+ */
+
+#include <bit>
+
+#include "nfx/config.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// FlatHashMap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::FlatHashMap()
+		: FlatHashMap( INITIAL_CAPACITY )
+	{
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::FlatHashMap( size_t initialCapacity )
+	{
+		size_t capacity{ GROUP_WIDTH };
+		while ( capacity < initialCapacity )
+		{
+			capacity <<= 1;
+		}
+		m_capacity = capacity;
+		m_mask = capacity - 1;
+		m_ctrl.assign( capacity + GROUP_WIDTH, CTRL_EMPTY );
+		m_slots.resize( capacity );
+		m_growthLeft = ( capacity * MAX_LOAD_FACTOR_EIGHTHS ) / 8;
+	}
+
+	//----------------------------------------------
+	// Core operations
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	template <typename KeyType>
+	NFX_META_INLINE bool FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::tryGetValue( const KeyType& key, TValue*& outValue ) noexcept
+	{
+		const std::uint32_t hash{ static_cast<std::uint32_t>( m_hasher( key ) ) };
+		const size_t index{ findIndex( key, hash ) };
+
+		if ( index == m_capacity )
+		{
+			outValue = nullptr;
+			return false;
+		}
+
+		outValue = &m_slots[index].value;
+		return true;
+	}
+
+	//----------------------------------------------
+	// Insertion
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE void FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::insertOrAssign( const TKey& key, TValue&& value )
+	{
+		insertOrAssignInternal( key, std::forward<TValue>( value ) );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE void FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::insertOrAssign( const TKey& key, const TValue& value )
+	{
+		insertOrAssignInternal( key, value );
+	}
+
+	//----------------------------------------------
+	// Capacity and memory management
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE void FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::reserve( size_t minCapacity )
+	{
+		const size_t requiredSlots{ ( minCapacity * 8 + MAX_LOAD_FACTOR_EIGHTHS - 1 ) / MAX_LOAD_FACTOR_EIGHTHS };
+
+		if ( requiredSlots > m_capacity )
+		{
+			size_t newCapacity{ m_capacity };
+			while ( newCapacity < requiredSlots )
+			{
+				newCapacity <<= 1;
+			}
+			rehash( newCapacity );
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	template <typename KeyType>
+	NFX_META_INLINE bool FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::erase( const KeyType& key ) noexcept
+	{
+		const std::uint32_t hash{ static_cast<std::uint32_t>( m_hasher( key ) ) };
+		const size_t index{ findIndex( key, hash ) };
+
+		if ( index == m_capacity )
+		{
+			return false;
+		}
+
+		m_slots[index] = Slot{};
+		--m_size;
+
+		// The slot may go back to EMPTY only if every group window covering it still
+		// contains an EMPTY byte, i.e. no probe sequence ever had to continue past it
+		const size_t indexBefore{ ( index - GROUP_WIDTH ) & m_mask };
+		const std::uint32_t emptyAfter{ Group{ m_ctrl.data() + index }.maskEmpty() };
+		const std::uint32_t emptyBefore{ Group{ m_ctrl.data() + indexBefore }.maskEmpty() };
+
+		const bool wasNeverFull{ emptyBefore != 0 && emptyAfter != 0 &&
+								 static_cast<size_t>( std::countr_zero( emptyAfter ) ) +
+										 static_cast<size_t>( std::countl_zero( emptyBefore ) ) - ( 32 - GROUP_WIDTH ) <
+									 GROUP_WIDTH };
+
+		if ( wasNeverFull )
+		{
+			setCtrl( index, CTRL_EMPTY );
+			++m_growthLeft;
+		}
+		else
+		{
+			setCtrl( index, CTRL_DELETED );
+		}
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// State inspection
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE size_t FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE size_t FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE bool FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::isEmpty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	//----------------------------------------------
+	// Group implementation
+	//----------------------------------------------
+
+#if defined( __AVX2__ )
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::Group::Group( const std::int8_t* pos ) noexcept
+		: ctrl{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pos ) ) }
+	{
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE std::uint32_t FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::Group::match( std::int8_t h2 ) const noexcept
+	{
+		return static_cast<std::uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( _mm256_set1_epi8( h2 ), ctrl ) ) );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE std::uint32_t FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::Group::maskEmpty() const noexcept
+	{
+		return match( CTRL_EMPTY );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE std::uint32_t FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::Group::maskEmptyOrDeleted() const noexcept
+	{
+		// EMPTY (-128) and DELETED (-2) are the only control bytes below -1
+		return static_cast<std::uint32_t>( _mm256_movemask_epi8( _mm256_cmpgt_epi8( _mm256_set1_epi8( -1 ), ctrl ) ) );
+	}
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::Group::Group( const std::int8_t* pos ) noexcept
+		: ctrl{ _mm_loadu_si128( reinterpret_cast<const __m128i*>( pos ) ) }
+	{
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE std::uint32_t FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::Group::match( std::int8_t h2 ) const noexcept
+	{
+		return static_cast<std::uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_set1_epi8( h2 ), ctrl ) ) );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE std::uint32_t FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::Group::maskEmpty() const noexcept
+	{
+		return match( CTRL_EMPTY );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE std::uint32_t FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::Group::maskEmptyOrDeleted() const noexcept
+	{
+		// EMPTY (-128) and DELETED (-2) are the only control bytes below -1
+		return static_cast<std::uint32_t>( _mm_movemask_epi8( _mm_cmpgt_epi8( _mm_set1_epi8( -1 ), ctrl ) ) );
+	}
+#else
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::Group::Group( const std::int8_t* pos ) noexcept
+		: ctrl{ pos }
+	{
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE std::uint32_t FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::Group::match( std::int8_t h2 ) const noexcept
+	{
+		std::uint32_t mask{ 0 };
+		for ( size_t i = 0; i < WIDTH; ++i )
+		{
+			mask |= static_cast<std::uint32_t>( ctrl[i] == h2 ) << i;
+		}
+		return mask;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE std::uint32_t FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::Group::maskEmpty() const noexcept
+	{
+		return match( CTRL_EMPTY );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE std::uint32_t FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::Group::maskEmptyOrDeleted() const noexcept
+	{
+		std::uint32_t mask{ 0 };
+		for ( size_t i = 0; i < WIDTH; ++i )
+		{
+			mask |= static_cast<std::uint32_t>( ctrl[i] < -1 ) << i;
+		}
+		return mask;
+	}
+#endif
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE std::int8_t FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::h2( std::uint32_t hash ) noexcept
+	{
+		// Top 7 bits: independent from the low bits used for the group start
+		return static_cast<std::int8_t>( hash >> 25 );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	template <typename KeyType>
+	NFX_META_INLINE size_t FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::findIndex( const KeyType& key, std::uint32_t hash ) const noexcept
+	{
+		const std::int8_t tag{ h2( hash ) };
+		size_t pos{ hash & m_mask };
+		size_t step{ 0 };
+
+		while ( true )
+		{
+			const Group group{ m_ctrl.data() + pos };
+
+			for ( std::uint32_t candidates = group.match( tag ); candidates != 0; candidates &= candidates - 1 )
+			{
+				const size_t index{ ( pos + static_cast<size_t>( std::countr_zero( candidates ) ) ) & m_mask };
+				if ( keysEqual( m_slots[index].key, key ) )
+				{
+					return index;
+				}
+			}
+
+			// An EMPTY byte in the group proves the key was never pushed further along
+			if ( group.maskEmpty() != 0 )
+			{
+				return m_capacity;
+			}
+
+			// Triangular probing over groups visits every group of a power-of-2 table
+			step += GROUP_WIDTH;
+			pos = ( pos + step ) & m_mask;
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE size_t FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::findFirstNonFull( std::uint32_t hash ) const noexcept
+	{
+		size_t pos{ hash & m_mask };
+		size_t step{ 0 };
+
+		while ( true )
+		{
+			const std::uint32_t available{ Group{ m_ctrl.data() + pos }.maskEmptyOrDeleted() };
+			if ( available != 0 )
+			{
+				return ( pos + static_cast<size_t>( std::countr_zero( available ) ) ) & m_mask;
+			}
+
+			step += GROUP_WIDTH;
+			pos = ( pos + step ) & m_mask;
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE void FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::setCtrl( size_t pos, std::int8_t ctrl ) noexcept
+	{
+		m_ctrl[pos] = ctrl;
+		if ( pos < GROUP_WIDTH )
+		{
+			m_ctrl[m_capacity + pos] = ctrl;
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	template <typename ValueType>
+	inline void FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::insertOrAssignInternal( const TKey& key, ValueType&& value )
+	{
+		const std::uint32_t hash{ static_cast<std::uint32_t>( m_hasher( key ) ) };
+
+		const size_t existing{ findIndex( key, hash ) };
+		if ( existing != m_capacity )
+		{
+			m_slots[existing].value = std::forward<ValueType>( value );
+			return;
+		}
+
+		if ( m_growthLeft == 0 )
+		{
+			// Mostly tombstones: rebuild in place, otherwise double
+			const size_t maxLoad{ ( m_capacity * MAX_LOAD_FACTOR_EIGHTHS ) / 8 };
+			rehash( m_size * 2 <= maxLoad ? m_capacity : m_capacity << 1 );
+		}
+
+		const size_t pos{ findFirstNonFull( hash ) };
+		if ( m_ctrl[pos] == CTRL_EMPTY )
+		{
+			--m_growthLeft;
+		}
+
+		setCtrl( pos, h2( hash ) );
+		m_slots[pos] = Slot{ key, std::forward<ValueType>( value ) };
+		++m_size;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	inline void FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::rehash( size_t newCapacity )
+	{
+		std::vector<std::int8_t> oldCtrl{ std::move( m_ctrl ) };
+		std::vector<Slot> oldSlots{ std::move( m_slots ) };
+		const size_t oldCapacity{ m_capacity };
+
+		m_capacity = newCapacity;
+		m_mask = newCapacity - 1;
+		m_ctrl.assign( newCapacity + GROUP_WIDTH, CTRL_EMPTY );
+		m_slots.clear();
+		m_slots.resize( newCapacity );
+
+		for ( size_t i = 0; i < oldCapacity; ++i )
+		{
+			if ( oldCtrl[i] >= 0 )
+			{
+				const std::uint32_t hash{ static_cast<std::uint32_t>( m_hasher( oldSlots[i].key ) ) };
+				const size_t pos{ findFirstNonFull( hash ) };
+				setCtrl( pos, h2( hash ) );
+				m_slots[pos] = std::move( oldSlots[i] );
+			}
+		}
+
+		m_growthLeft = ( newCapacity * MAX_LOAD_FACTOR_EIGHTHS ) / 8 - m_size;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	template <typename KeyType1, typename KeyType2>
+	NFX_META_INLINE bool FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::keysEqual( const KeyType1& k1, const KeyType2& k2 ) const noexcept
+	{
+		if constexpr ( std::is_same_v<KeyType1, std::string> && std::is_same_v<KeyType2, std::string_view> )
+		{
+			return StringViewEqual{}( k1, k2 );
+		}
+		else if constexpr ( std::is_same_v<KeyType1, std::string_view> && std::is_same_v<KeyType2, std::string> )
+		{
+			return StringViewEqual{}( k1, k2 );
+		}
+		else
+		{
+			return k1 == k2;
+		}
+	}
+
+	//----------------------------------------------
+	// STL-compatible iteration support
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	typename FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::iterator
+	FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::begin() noexcept
+	{
+		return iterator( m_slots.data(), m_ctrl.data(), m_ctrl.data() + m_capacity );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	typename FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::const_iterator
+	FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::begin() const noexcept
+	{
+		return const_iterator( m_slots.data(), m_ctrl.data(), m_ctrl.data() + m_capacity );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	typename FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::iterator
+	FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::end() noexcept
+	{
+		return iterator( m_slots.data() + m_capacity, m_ctrl.data() + m_capacity, m_ctrl.data() + m_capacity );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	typename FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::const_iterator
+	FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::end() const noexcept
+	{
+		return const_iterator( m_slots.data() + m_capacity, m_ctrl.data() + m_capacity, m_ctrl.data() + m_capacity );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	bool FlatHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::operator==( const FlatHashMap& other ) const noexcept
+	{
+		if ( m_size != other.m_size )
+		{
+			return false;
+		}
+
+		for ( const auto& pair : *this )
+		{
+			const std::uint32_t hash{ static_cast<std::uint32_t>( other.m_hasher( pair.first ) ) };
+			const size_t index{ other.findIndex( pair.first, hash ) };
+
+			if ( index == other.m_capacity || other.m_slots[index].value != pair.second )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+} // namespace nfx::containers
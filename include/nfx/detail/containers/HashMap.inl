@@ -18,14 +18,29 @@ namespace nfx::containers
 	// Construction
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	NFX_META_INLINE HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::HashMap()
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::HashMap()
+		: HashMap( INITIAL_CAPACITY, Allocator{} )
 	{
-		m_buckets.resize( INITIAL_CAPACITY );
 	}
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	NFX_META_INLINE HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::HashMap( size_t initialCapacity )
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::HashMap( size_t initialCapacity )
+		: HashMap( initialCapacity, Allocator{} )
+	{
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::HashMap( const Allocator& allocator )
+		: HashMap( INITIAL_CAPACITY, allocator )
+	{
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::HashMap( size_t initialCapacity, const Allocator& allocator )
+		: m_table{ allocator },
+		  m_oldTable{ allocator },
+		  m_nextTable{ allocator }
 	{
 		size_t capacity{ 1 };
 		while ( capacity < initialCapacity )
@@ -34,244 +49,1120 @@ namespace nfx::containers
 		}
 		m_capacity = capacity;
 		m_mask = capacity - 1;
-		m_buckets.resize( capacity );
+		m_table.resize( capacity );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::HashMap( const HashMap& other, const Allocator& allocator )
+		: m_table{ other.m_table, allocator },
+		  m_size{ other.m_size },
+		  m_capacity{ other.m_capacity },
+		  m_mask{ other.m_mask },
+		  m_oldTable{ other.m_oldTable, allocator },
+		  m_nextTable{ allocator },
+		  m_oldCapacity{ other.m_oldCapacity },
+		  m_oldMask{ other.m_oldMask },
+		  m_migratePos{ other.m_migratePos },
+		  m_migrateRemaining{ other.m_migrateRemaining },
+		  m_rehashStep{ other.m_rehashStep },
+		  m_growth{ other.m_growth },
+		  m_hasher{ other.m_hasher }
+	{
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::HashMap( HashMap&& other, const Allocator& allocator )
+		: m_table{ std::move( other.m_table ), allocator },
+		  m_size{ other.m_size },
+		  m_capacity{ other.m_capacity },
+		  m_mask{ other.m_mask },
+		  m_oldTable{ std::move( other.m_oldTable ), allocator },
+		  m_nextTable{ std::move( other.m_nextTable ), allocator },
+		  m_oldCapacity{ other.m_oldCapacity },
+		  m_oldMask{ other.m_oldMask },
+		  m_migratePos{ other.m_migratePos },
+		  m_migrateRemaining{ other.m_migrateRemaining },
+		  m_rehashStep{ other.m_rehashStep },
+		  m_growth{ other.m_growth },
+		  m_hasher{ other.m_hasher }
+	{
 	}
 
 	//----------------------------------------------
 	// Core operations
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
 	template <typename KeyType>
-	NFX_META_INLINE bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::tryGetValue( const KeyType& key, TValue*& outValue ) noexcept
+	NFX_META_INLINE bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::tryGetValue( const KeyType& key, TValue*& outValue ) noexcept
 	{
-		const std::uint32_t hash{ static_cast<std::uint32_t>( m_hasher( key ) ) };
+		outValue = lookup( key, static_cast<CachedHash>( m_hasher( key ) ) );
+
+		return outValue != nullptr;
+	}
 
-		size_t pos{ hash & m_mask };
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	template <typename KeyType>
+	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::tryGetValues( std::span<const std::type_identity_t<KeyType>> keys, std::span<TValue*> outValues ) noexcept
+	{
+		const size_t count{ std::min( keys.size(), outValues.size() ) };
+		std::array<CachedHash, BATCH_LOOKUP_SIZE> hashes;
+		size_t found{ 0 };
 
-		for ( std::uint16_t distance = 0;; ++distance, pos = ( pos + 1 ) & m_mask )
+		for ( size_t base = 0; base < count; base += BATCH_LOOKUP_SIZE )
 		{
-			Bucket& bucket{ m_buckets[pos] };
+			const size_t batch{ std::min( BATCH_LOOKUP_SIZE, count - base ) };
 
-			// Check Robin Hood invariant and occupancy in single condition
-			if ( !bucket.occupied || distance > bucket.distance )
+			// Pass 1: hash the whole block and start loading every home bucket
+			for ( size_t i = 0; i < batch; ++i )
 			{
-				outValue = nullptr;
-				return false;
+				const CachedHash hash{ static_cast<CachedHash>( m_hasher( keys[base + i] ) ) };
+				const size_t home{ homeBucket( hash, m_capacity, m_mask ) };
+
+				hashes[i] = hash;
+				NFX_META_PREFETCH( &m_table.meta( home ) );
+				NFX_META_PREFETCH( &m_table.slot( home ) );
 			}
 
-			// Hot path: hash comparison first, then key equality
-			if ( bucket.hash == hash && keysEqual( bucket.key, key ) )
+			// Pass 2: probe, by now the home buckets are (mostly) in cache
+			for ( size_t i = 0; i < batch; ++i )
 			{
-				outValue = &bucket.value;
-				return true;
+				TValue* value{ lookup( keys[base + i], hashes[i] ) };
+				outValues[base + i] = value;
+				found += value != nullptr ? 1 : 0;
 			}
 		}
+
+		return found;
 	}
 
 	//----------------------------------------------
 	// Insertion
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::insertOrAssign( const TKey& key, TValue&& value )
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::insertOrAssign( const TKey& key, TValue&& value )
+	{
+		insertOrAssignInternal( key, static_cast<CachedHash>( m_hasher( key ) ), std::forward<TValue>( value ) );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::insertOrAssign( const TKey& key, const TValue& value )
+	{
+		insertOrAssignInternal( key, static_cast<CachedHash>( m_hasher( key ) ), value );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	template <typename KeyType, typename ValueType>
+		requires( !std::is_same_v<KeyType, TKey> && std::is_constructible_v<TKey, const KeyType&> )
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::insertOrAssign( const KeyType& key, ValueType&& value )
 	{
-		insertOrAssignInternal( key, std::forward<TValue>( value ) );
+		if constexpr ( IS_TRANSPARENT_KEY<KeyType> )
+		{
+			insertOrAssignInternal( key, static_cast<CachedHash>( m_hasher( key ) ), std::forward<ValueType>( value ) );
+		}
+		else
+		{
+			const TKey converted( key );
+			insertOrAssignInternal( converted, static_cast<CachedHash>( m_hasher( converted ) ), std::forward<ValueType>( value ) );
+		}
 	}
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::insertOrAssign( const TKey& key, const TValue& value )
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	template <typename KeyType, typename... Args>
+		requires std::is_constructible_v<TKey, const KeyType&>
+	NFX_META_INLINE std::pair<TValue*, bool> HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::tryEmplace( const KeyType& key, Args&&... args )
 	{
-		insertOrAssignInternal( key, value );
+		if constexpr ( IS_TRANSPARENT_KEY<KeyType> )
+		{
+			return emplaceInternal( key, static_cast<CachedHash>( m_hasher( key ) ), std::forward<Args>( args )... );
+		}
+		else
+		{
+			const TKey converted( key );
+			return emplaceInternal( converted, static_cast<CachedHash>( m_hasher( converted ) ), std::forward<Args>( args )... );
+		}
 	}
 
 	//----------------------------------------------
 	// Capacity and memory management
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::reserve( size_t minCapacity )
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::reserve( size_t minCapacity )
 	{
 		if ( minCapacity > m_capacity )
 		{
-			size_t newCapacity{ 1 };
-			while ( newCapacity < minCapacity )
+			const size_t newCapacity{ capacityFor( minCapacity ) };
+			if ( newCapacity > m_capacity )
 			{
-				newCapacity <<= 1;
+				// Explicit reservation pays the full cost up front, in either mode
+				completeRehash();
+				m_nextTable = Table{ allocator() };
+				rehashAll( newCapacity );
+				recordResize();
 			}
+		}
+	}
 
-			if ( newCapacity > m_capacity )
-			{
-				std::vector<Bucket> oldBuckets{ std::move( m_buckets ) };
-				const size_t oldCapacity{ m_capacity };
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::shrinkToFit()
+	{
+		// Smallest capacity at which the current size stays below the maximum load
+		const size_t newCapacity{ capacityFor( ( m_size * 100 ) / m_growth.maxLoadFactorPercent + 1 ) };
 
-				m_capacity = newCapacity;
-				m_mask = newCapacity - 1;
-				m_buckets.clear();
-				m_buckets.resize( newCapacity );
-				m_size = 0;
+		completeRehash();
+		m_nextTable = Table{ allocator() };
+		if ( newCapacity < m_capacity )
+		{
+			rehashAll( newCapacity );
+		}
+	}
 
-				for ( size_t i = 0; i < oldCapacity; ++i )
-				{
-					if ( oldBuckets[i].occupied )
-					{
-						insertOrAssignInternal( std::move( oldBuckets[i].key ), std::move( oldBuckets[i].value ) );
-					}
-				}
-			}
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::setGrowthPolicy( const HashMapGrowthPolicy& policy )
+	{
+		m_growth.maxLoadFactorPercent = std::clamp( policy.maxLoadFactorPercent, HashMapGrowthPolicy::MIN_LOAD_FACTOR_PERCENT, HashMapGrowthPolicy::MAX_LOAD_FACTOR_PERCENT );
+		m_growth.growthPercent = std::clamp( policy.growthPercent, HashMapGrowthPolicy::MIN_GROWTH_PERCENT, HashMapGrowthPolicy::MAX_GROWTH_PERCENT );
+
+		// A prebuilt next table may no longer have the size the policy asks for
+		m_nextTable = Table{ allocator() };
+
+		if ( shouldResize() )
+		{
+			completeRehash();
+			rehashAll( capacityFor( ( m_size * 100 ) / m_growth.maxLoadFactorPercent + 1 ) );
+			recordResize();
 		}
 	}
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE const HashMapGrowthPolicy& HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::growthPolicy() const noexcept
+	{
+		return m_growth;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
 	template <typename KeyType>
-	NFX_META_INLINE bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::erase( const KeyType& key ) noexcept
+	NFX_META_INLINE bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::erase( const KeyType& key ) noexcept
 	{
-		const std::uint32_t hash{ static_cast<std::uint32_t>( m_hasher( key ) ) };
+		return eraseInternal( key, static_cast<CachedHash>( m_hasher( key ) ) );
+	}
 
-		size_t pos{ hash & m_mask };
-		std::uint16_t distance{ 0 };
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	template <typename Predicate>
+	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::eraseIf( Predicate&& predicate )
+	{
+		return eraseWhere( [&predicate]( const Slot& slot, CachedHash ) { return predicate( slot.key, slot.value ); } );
+	}
 
-		while ( distance <= m_buckets[pos].distance && m_buckets[pos].occupied )
-		{
-			if ( m_buckets[pos].hash == hash && keysEqual( m_buckets[pos].key, key ) )
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	template <typename Predicate>
+	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::retain( Predicate&& predicate )
+	{
+		return eraseIf( [&predicate]( const TKey& key, const TValue& value ) { return !predicate( key, value ); } );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::clear() noexcept
+	{
+		const auto resetOccupied{ []( Table& table ) noexcept {
+			auto& words{ table.occupancy.words };
+			for ( size_t index = 0; index < words.size(); ++index )
 			{
-				eraseAtPosition( pos );
-				--m_size;
-				return true;
+				for ( std::uint64_t word{ words[index] }; word != 0; word &= word - 1 )
+				{
+					const size_t pos{ ( index << 6 ) + static_cast<size_t>( std::countr_zero( word ) ) };
+					table.slot( pos ) = Slot{};
+					table.meta( pos ) = Metadata{};
+				}
+				words[index] = 0;
 			}
-			pos = ( pos + 1 ) & m_mask;
-			++distance;
+		} };
+		resetOccupied( m_table );
+
+		// Elements not yet migrated go with the old table; a prebuilt next table is still empty
+		m_oldTable = Table{ allocator() };
+		m_oldCapacity = 0;
+		m_oldMask = 0;
+		m_migratePos = 0;
+		m_migrateRemaining = 0;
+		m_size = 0;
+	}
+
+	//----------------------------------------------
+	// Incremental rehashing
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::setIncrementalRehash( size_t bucketsPerStep )
+	{
+		if ( bucketsPerStep == 0 )
+		{
+			completeRehash();
+			m_nextTable = Table{ allocator() };
+			m_rehashStep = 0;
+			return;
 		}
 
-		return false;
+		m_rehashStep = std::max( bucketsPerStep, MIN_REHASH_STEP );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::completeRehash()
+	{
+		if ( m_oldCapacity != 0 )
+		{
+			migrateBuckets( std::numeric_limits<size_t>::max() );
+		}
+
+		m_oldTable = Table{ allocator() };
 	}
 
 	//----------------------------------------------
 	// State insspection
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::size() const noexcept
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::size() const noexcept
 	{
 		return m_size;
 	}
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::capacity() const noexcept
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::capacity() const noexcept
 	{
 		return m_capacity;
 	}
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	NFX_META_INLINE bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::isEmpty() const noexcept
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::isEmpty() const noexcept
 	{
 		return m_size == 0;
 	}
 
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::isRehashing() const noexcept
+	{
+		return m_oldCapacity != 0;
+	}
+
+	//----------------------------------------------
+	// Set algebra
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::mergeFrom( const HashMap& other )
+	{
+		if ( &other == this )
+		{
+			return;
+		}
+
+		other.forEachOccupied( [this, &other]( const Slot& slot, CachedHash hash ) {
+			// Re-evaluated per element: an insertion may reseed this map's hash functor
+			insertOrAssignInternal( slot.key, hashFrom( other, slot.key, hash ), slot.value );
+			return true;
+		} );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::intersectWith( const HashMap& other )
+	{
+		if ( &other == this )
+		{
+			return 0;
+		}
+
+		return eraseWhere( [this, &other]( const Slot& slot, CachedHash hash ) {
+			return other.findSlot( slot.key, other.hashFrom( *this, slot.key, hash ) ) == nullptr;
+		} );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>
+	HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::difference( const HashMap& other ) const
+	{
+		HashMap result{ allocator() };
+		result.m_hasher = m_hasher;
+
+		forEachOccupied( [this, &other, &result]( const Slot& slot, CachedHash hash ) {
+			if ( other.findSlot( slot.key, other.hashFrom( *this, slot.key, hash ) ) == nullptr )
+			{
+				result.insertOrAssignInternal( slot.key, result.hashFrom( *this, slot.key, hash ), slot.value );
+			}
+			return true;
+		} );
+
+		return result;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE HashMapDiff<TKey> HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::diff( const HashMap& other ) const
+	{
+		HashMapDiff<TKey> result;
+
+		forEachOccupied( [this, &other, &result]( const Slot& slot, CachedHash hash ) {
+			const Slot* match{ other.findSlot( slot.key, other.hashFrom( *this, slot.key, hash ) ) };
+			if ( match == nullptr )
+			{
+				result.removed.push_back( slot.key );
+			}
+			else if ( !( match->value == slot.value ) )
+			{
+				result.changed.push_back( slot.key );
+			}
+			return true;
+		} );
+
+		other.forEachOccupied( [this, &other, &result]( const Slot& slot, CachedHash hash ) {
+			if ( findSlot( slot.key, hashFrom( other, slot.key, hash ) ) == nullptr )
+			{
+				result.added.push_back( slot.key );
+			}
+			return true;
+		} );
+
+		return result;
+	}
+
+	//----------------------------------------------
+	// Statistics
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	inline HashMapStats HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::stats() const
+	{
+		HashMapStats result;
+		result.size = m_size;
+		result.capacity = m_capacity;
+		result.loadFactor = static_cast<double>( m_size ) / static_cast<double>( m_capacity );
+
+		size_t distanceSum{ 0 };
+		size_t currentCount{ 0 };
+		const auto collect{ [&]( const Table& table, size_t capacity, bool current ) {
+			for ( size_t i = table.occupancy.next( 0, capacity ); i != capacity; i = table.occupancy.next( i + 1, capacity ) )
+			{
+				const Metadata& meta{ table.meta( i ) };
+				if ( meta.distance >= result.distanceHistogram.size() )
+				{
+					result.distanceHistogram.resize( meta.distance + 1u, 0 );
+				}
+				++result.distanceHistogram[meta.distance];
+				distanceSum += meta.distance;
+				currentCount += current ? 1 : 0;
+			}
+		} };
+		collect( m_table, m_capacity, true );
+		collect( m_oldTable, m_oldCapacity, false );
+
+		result.emptyBuckets = m_capacity - currentCount;
+		result.maxDistance = result.distanceHistogram.empty() ? 0 : result.distanceHistogram.size() - 1;
+		result.meanDistance = m_size == 0 ? 0.0 : static_cast<double>( distanceSum ) / static_cast<double>( m_size );
+		result.expectedSuccessfulProbes = m_size == 0 ? 0.0 : result.meanDistance + 1.0;
+
+		// A miss from home h stops at the first bucket h + d that is empty or holds an
+		// element with distance < d: walk each home once
+		size_t missProbes{ 0 };
+		for ( size_t home = 0; home < m_capacity; ++home )
+		{
+			size_t distance{ 0 };
+			size_t pos{ home };
+			while ( m_table.meta( pos ).occupied && distance <= m_table.meta( pos ).distance )
+			{
+				++distance;
+				pos = nextBucket( pos, m_capacity );
+			}
+			missProbes += distance + 1u;
+		}
+		result.expectedUnsuccessfulProbes = static_cast<double>( missProbes ) / static_cast<double>( m_capacity );
+
+#if NFX_META_HASHMAP_STATS
+		const std::uint64_t lookups{ m_stats.lookups.load( std::memory_order_relaxed ) };
+		const std::uint64_t hits{ m_stats.hits.load( std::memory_order_relaxed ) };
+		const std::uint64_t misses{ lookups - std::min( hits, lookups ) };
+
+		result.recorded = true;
+		result.lookups = lookups;
+		result.hits = hits;
+		result.meanSuccessfulProbes = hits == 0 ? 0.0 : static_cast<double>( m_stats.hitProbes.load( std::memory_order_relaxed ) ) / static_cast<double>( hits );
+		result.meanUnsuccessfulProbes = misses == 0 ? 0.0 : static_cast<double>( m_stats.missProbes.load( std::memory_order_relaxed ) ) / static_cast<double>( misses );
+		result.resizes = m_stats.resizes.load( std::memory_order_relaxed );
+		result.reseeds = m_stats.reseeds.load( std::memory_order_relaxed );
+		result.rehashTime = std::chrono::nanoseconds{ static_cast<std::int64_t>( m_stats.rehashNanoseconds.load( std::memory_order_relaxed ) ) };
+#endif
+
+		return result;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::resetStats() noexcept
+	{
+#if NFX_META_HASHMAP_STATS
+		m_stats = StatsCounters{};
+#endif
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::recordLookup( [[maybe_unused]] bool hit, [[maybe_unused]] size_t probes ) const noexcept
+	{
+#if NFX_META_HASHMAP_STATS
+		m_stats.lookups.fetch_add( 1, std::memory_order_relaxed );
+		if ( hit )
+		{
+			m_stats.hits.fetch_add( 1, std::memory_order_relaxed );
+			m_stats.hitProbes.fetch_add( probes, std::memory_order_relaxed );
+		}
+		else
+		{
+			m_stats.missProbes.fetch_add( probes, std::memory_order_relaxed );
+		}
+#endif
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::recordResize() noexcept
+	{
+#if NFX_META_HASHMAP_STATS
+		m_stats.resizes.fetch_add( 1, std::memory_order_relaxed );
+#endif
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::recordReseed() noexcept
+	{
+#if NFX_META_HASHMAP_STATS
+		m_stats.reseeds.fetch_add( 1, std::memory_order_relaxed );
+#endif
+	}
+
+	//----------------------------------------------
+	// Allocator support
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE typename HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::allocator_type HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::allocator() const noexcept
+	{
+		return m_table.allocator();
+	}
+
+	//----------------------------------------------
+	// Hashing
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE const typename HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::hasher& HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::hashFunction() const noexcept
+	{
+		return m_hasher;
+	}
+
 	//----------------------------------------------
 	// Internal implementation
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	template <typename ValueType>
-	inline void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::insertOrAssignInternal( const TKey& key, ValueType&& value )
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	template <typename KeyType, typename ValueType>
+	inline void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::insertOrAssignInternal( const KeyType& key, CachedHash hash, ValueType&& value )
+	{
+		// value is only consumed when a new element is created
+		auto [existing, inserted] = emplaceInternal( key, hash, std::forward<ValueType>( value ) );
+		if ( !inserted )
+		{
+			*existing = std::forward<ValueType>( value );
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	template <typename KeyType, typename... Args>
+	inline std::pair<TValue*, bool> HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::emplaceInternal( const KeyType& key, CachedHash hash, Args&&... args )
 	{
 		if ( shouldResize() )
 		{
 			resize();
 		}
 
-		const std::uint32_t hash{ static_cast<std::uint32_t>( m_hasher( key ) ) };
+		if ( m_rehashStep != 0 )
+		{
+			advanceRehash();
+		}
 
-		size_t pos{ hash & m_mask };
+		if ( m_oldCapacity != 0 )
+		{
+			// Existing keys not yet migrated are found in place
+			const size_t oldPos{ findPosition( m_oldTable, m_oldCapacity, m_oldMask, key, hash ) };
+			if ( oldPos != NPOS )
+			{
+				return { &m_oldTable.slot( oldPos ).value, false };
+			}
+		}
+
+		size_t pos{ homeBucket( hash, m_capacity, m_mask ) };
 		std::uint16_t distance{ 0 };
 
 		// First pass: check for existing key or find insertion point
-		while ( m_buckets[pos].occupied )
+		while ( m_table.meta( pos ).occupied )
 		{
-			if ( m_buckets[pos].hash == hash && keysEqual( m_buckets[pos].key, key ) )
+			const Metadata& meta{ m_table.meta( pos ) };
+
+			if ( meta.hash == hash && keysEqual( m_table.slot( pos ).key, key ) )
 			{
-				// Update existing key
-				m_buckets[pos].value = std::forward<ValueType>( value );
-				return;
+				return { &m_table.slot( pos ).value, false };
 			}
 
-			if ( distance > m_buckets[pos].distance )
+			if ( distance > meta.distance )
 			{
 				// Robin Hood: we need to displace this bucket
 				break;
 			}
 
-			pos = ( pos + 1 ) & m_mask;
+			pos = nextBucket( pos, m_capacity );
 			++distance;
 		}
 
-		// If we're here, we need to insert a new bucket
-		Bucket newBucket{ key, std::forward<ValueType>( value ), hash, distance, true };
+		// If we're here, we need to insert a new bucket; placeNew() leaves it at pos
+		// Keys and values that use the map's allocator (e.g. std::pmr::string) are built in it
+		const std::uint16_t longest{ placeNew( pos, Slot{ std::allocator_arg, allocator(), key, std::forward<Args>( args )... }, Metadata{ hash, distance, true } ) };
+		++m_size;
+
+		if constexpr ( ReseedableHasher<Hasher> )
+		{
+			if ( longest >= MAX_PROBE_DISTANCE )
+			{
+				// Keys chosen to collide under the current key will not under the next one
+				reseedAndRebuild();
+				return { lookup( key, static_cast<CachedHash>( m_hasher( key ) ) ), true };
+			}
+		}
+
+		return { &m_table.slot( pos ).value, true };
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	template <typename KeyType>
+	NFX_META_INLINE bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::eraseInternal( const KeyType& key, CachedHash hash ) noexcept
+	{
+		if ( m_oldCapacity != 0 )
+		{
+			migrateBuckets( m_rehashStep );
+		}
+
+		size_t pos{ findPosition( m_table, m_capacity, m_mask, key, hash ) };
+		if ( pos != NPOS )
+		{
+			eraseAtPosition( m_table, m_capacity, pos );
+			--m_size;
+			return true;
+		}
+
+		if ( m_oldCapacity != 0 )
+		{
+			pos = findPosition( m_oldTable, m_oldCapacity, m_oldMask, key, hash );
+			if ( pos != NPOS )
+			{
+				eraseAtPosition( m_oldTable, m_oldCapacity, pos );
+				--m_size;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	template <typename KeyType>
+	NFX_META_INLINE TValue* HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::lookup( const KeyType& key, CachedHash hash ) noexcept
+	{
+		size_t probes{ 0 };
+		size_t pos{ findPosition( m_table, m_capacity, m_mask, key, hash, probes ) };
+		if ( pos != NPOS )
+		{
+			recordLookup( true, probes );
+			return &m_table.slot( pos ).value;
+		}
+
+		// Incremental resize in progress: the key may not have been migrated yet
+		if ( m_oldCapacity != 0 )
+		{
+			size_t oldProbes{ 0 };
+			pos = findPosition( m_oldTable, m_oldCapacity, m_oldMask, key, hash, oldProbes );
+			probes += oldProbes;
+			if ( pos != NPOS )
+			{
+				recordLookup( true, probes );
+				return &m_oldTable.slot( pos ).value;
+			}
+		}
+
+		recordLookup( false, probes );
+		return nullptr;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	template <typename KeyType>
+	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::findPosition( const Table& table, size_t capacity, size_t mask, const KeyType& key, CachedHash hash ) const noexcept
+	{
+		size_t probes{ 0 };
+
+		return findPosition( table, capacity, mask, key, hash, probes );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	template <typename KeyType>
+	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::findPosition( const Table& table, size_t capacity, size_t mask, const KeyType& key, CachedHash hash, size_t& probes ) const noexcept
+	{
+		size_t pos{ homeBucket( hash, capacity, mask ) };
+
+		for ( std::uint16_t distance = 0;; ++distance, pos = nextBucket( pos, capacity ) )
+		{
+			const Metadata& meta{ table.meta( pos ) };
+
+			// Check Robin Hood invariant and occupancy in single condition
+			if ( !meta.occupied || distance > meta.distance )
+			{
+				probes = distance + 1u;
+				return NPOS;
+			}
+
+			// Hot path: hash comparison first, then key equality
+			if ( meta.hash == hash && keysEqual( table.slot( pos ).key, key ) )
+			{
+				probes = distance + 1u;
+				return pos;
+			}
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE const typename HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::Slot*
+	HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::findSlot( const TKey& key, CachedHash hash ) const noexcept
+	{
+		size_t pos{ findPosition( m_table, m_capacity, m_mask, key, hash ) };
+		if ( pos != NPOS )
+		{
+			return &m_table.slot( pos );
+		}
+
+		if ( m_oldCapacity != 0 )
+		{
+			pos = findPosition( m_oldTable, m_oldCapacity, m_oldMask, key, hash );
+			if ( pos != NPOS )
+			{
+				return &m_oldTable.slot( pos );
+			}
+		}
+
+		return nullptr;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::sharesHashWith( const HashMap& other ) const noexcept
+	{
+		if constexpr ( std::is_empty_v<Hasher> )
+		{
+			return true;
+		}
+		else if constexpr ( std::equality_comparable<Hasher> )
+		{
+			return m_hasher == other.m_hasher;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE CachedHash HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::hashFrom( const HashMap& source, const TKey& key, CachedHash sourceHash ) const noexcept
+	{
+		return sharesHashWith( source ) ? sourceHash : static_cast<CachedHash>( m_hasher( key ) );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	template <typename Fn>
+	NFX_META_INLINE bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::forEachOccupied( Fn&& fn ) const
+	{
+		const auto walk{ [&fn]( const Table& table, size_t capacity ) {
+			for ( size_t i = table.occupancy.next( 0, capacity ); i != capacity; i = table.occupancy.next( i + 1, capacity ) )
+			{
+				if ( !fn( table.slot( i ), table.meta( i ).hash ) )
+				{
+					return false;
+				}
+			}
+			return true;
+		} };
+
+		return walk( m_oldTable, m_oldCapacity ) && walk( m_table, m_capacity );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE std::uint16_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::placeNew( size_t pos, Slot&& slot, Metadata meta )
+	{
+		Slot newSlot{ std::move( slot ) };
+		std::uint16_t longest{ 0 };
 
 		// Robin Hood displacement loop
-		while ( m_buckets[pos].occupied )
+		while ( m_table.meta( pos ).occupied )
 		{
-			if ( newBucket.distance > m_buckets[pos].distance )
+			if ( meta.distance > m_table.meta( pos ).distance )
 			{
-				std::swap( newBucket, m_buckets[pos] );
+				longest = std::max( longest, meta.distance );
+				std::swap( newSlot, m_table.slot( pos ) );
+				std::swap( meta, m_table.meta( pos ) );
 			}
 
-			pos = ( pos + 1 ) & m_mask;
-			++newBucket.distance;
+			pos = nextBucket( pos, m_capacity );
+			++meta.distance;
 		}
 
 		// Insert the final bucket
-		m_buckets[pos] = std::move( newBucket );
-		++m_size;
+		m_table.slot( pos ) = std::move( newSlot );
+		m_table.meta( pos ) = meta;
+		m_table.occupancy.set( pos );
+
+		return std::max( longest, meta.distance );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::migrateBuckets( size_t budget )
+	{
+		[[maybe_unused]] const RehashTimer timer{ *this };
+
+		while ( budget > 0 && m_migrateRemaining > 0 )
+		{
+			if ( !m_oldTable.meta( m_migratePos ).occupied )
+			{
+				m_migratePos = nextBucket( m_migratePos, m_oldCapacity );
+				--m_migrateRemaining;
+				--budget;
+				continue;
+			}
+
+			// The bucket before m_migratePos is always empty, so clearing a whole cluster
+			// never breaks the probe chain of an element that is still in the old table
+			size_t moved{ 0 };
+			while ( m_oldTable.meta( m_migratePos ).occupied )
+			{
+				Metadata& meta{ m_oldTable.meta( m_migratePos ) };
+				Slot& slot{ m_oldTable.slot( m_migratePos ) };
+
+				placeNew( homeBucket( meta.hash, m_capacity, m_mask ), std::move( slot ), Metadata{ meta.hash, 0, true } );
+				slot = Slot{};
+				meta = Metadata{};
+				m_oldTable.occupancy.reset( m_migratePos );
+
+				m_migratePos = nextBucket( m_migratePos, m_oldCapacity );
+				--m_migrateRemaining;
+				++moved;
+			}
+
+			budget -= std::min( budget, moved );
+		}
+
+		if ( m_migrateRemaining == 0 )
+		{
+			// Drained: stop probing it; advanceRehash() destroys its buckets in chunks
+			m_oldCapacity = 0;
+			m_oldMask = 0;
+			m_migratePos = 0;
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::advanceRehash()
+	{
+		const size_t buildBudget{ m_rehashStep * BUILD_BUCKETS_PER_STEP };
+
+		if ( m_oldCapacity != 0 )
+		{
+			migrateBuckets( m_rehashStep );
+		}
+		else if ( m_oldTable.size() != 0 )
+		{
+			[[maybe_unused]] const RehashTimer timer{ *this };
+			const size_t remaining{ m_oldTable.size() > buildBudget ? m_oldTable.size() - buildBudget : 0 };
+			if ( remaining == 0 )
+			{
+				m_oldTable = Table{ allocator() };
+			}
+			else
+			{
+				m_oldTable.resize( remaining );
+			}
+		}
+
+		// Build the next table from two thirds of the maximum load on (50% of 75% by default)
+		const size_t nextCapacity{ grownCapacity() };
+		if ( m_nextTable.size() < nextCapacity && ( m_size * 300 ) >= ( m_capacity * m_growth.maxLoadFactorPercent * 2 ) )
+		{
+			[[maybe_unused]] const RehashTimer timer{ *this };
+			if ( m_nextTable.size() == 0 )
+			{
+				m_nextTable.reserve( nextCapacity );
+			}
+			m_nextTable.resize( std::min( nextCapacity, m_nextTable.size() + buildBudget ) );
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::shouldResize() const noexcept
+	{
+		// Tiny tables at a high load factor would otherwise fill up: one bucket always stays empty
+		return ( m_size * 100 ) >= ( m_capacity * m_growth.maxLoadFactorPercent ) || m_size + 1 >= m_capacity;
 	}
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	NFX_META_INLINE bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::shouldResize() const noexcept
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	inline void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::resize()
 	{
-		return ( m_size * 100 ) >= ( m_capacity * MAX_LOAD_FACTOR_PERCENT );
+		recordResize();
+
+		if ( m_rehashStep == 0 )
+		{
+			rehashAll( grownCapacity() );
+			return;
+		}
+
+		// Only one migration at a time: drain the previous one before starting the next
+		completeRehash();
+
+		[[maybe_unused]] const RehashTimer timer{ *this };
+		const size_t newCapacity{ grownCapacity() };
+		if ( m_nextTable.size() != newCapacity )
+		{
+			// Not fully prebuilt (e.g. erase-heavy workload or mode enabled late)
+			m_nextTable.reserve( newCapacity );
+			m_nextTable.resize( newCapacity );
+		}
+
+		m_oldTable = std::move( m_table );
+		m_oldCapacity = m_capacity;
+		m_oldMask = m_mask;
+		m_migrateRemaining = m_capacity;
+
+		// Migration starts right after an empty bucket (one always exists below 100% load)
+		m_migratePos = 0;
+		while ( m_oldTable.meta( m_migratePos ).occupied )
+		{
+			++m_migratePos;
+		}
+		m_migratePos = nextBucket( m_migratePos, m_oldCapacity );
+
+		m_table = std::move( m_nextTable );
+		m_nextTable = Table{ allocator() };
+		m_capacity = newCapacity;
+		m_mask = maskFor( newCapacity );
 	}
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	inline void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::resize()
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::rehashAll( size_t newCapacity )
 	{
+		[[maybe_unused]] const RehashTimer timer{ *this };
 		const size_t oldCapacity{ m_capacity };
-		m_capacity <<= 1;
-		m_mask = m_capacity - 1;
+		Table oldTable{ std::move( m_table ) };
 
-		std::vector<Bucket> oldBuckets{ std::move( m_buckets ) };
-		m_buckets.clear();
-		m_buckets.resize( m_capacity );
-		m_size = 0;
+		m_capacity = newCapacity;
+		m_mask = maskFor( newCapacity );
+		m_table = Table{ allocator() };
+		m_table.resize( newCapacity );
+
+		for ( size_t i = oldTable.occupancy.next( 0, oldCapacity ); i != oldCapacity; i = oldTable.occupancy.next( i + 1, oldCapacity ) )
+		{
+			const CachedHash hash{ oldTable.meta( i ).hash };
+			placeNew( homeBucket( hash, m_capacity, m_mask ), std::move( oldTable.slot( i ) ), Metadata{ hash, 0, true } );
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::grownCapacity() const noexcept
+	{
+		if ( m_growth.growthPercent == 200 )
+		{
+			return m_capacity << 1;
+		}
+
+		return std::max( m_capacity + 1, ( m_capacity * m_growth.growthPercent ) / 100 );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::capacityFor( size_t minCapacity ) const noexcept
+	{
+		const size_t capacity{ std::max( minCapacity, size_t{ 1 } ) };
+
+		return m_growth.growthPercent == 200 ? std::bit_ceil( capacity ) : capacity;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::maskFor( size_t capacity ) noexcept
+	{
+		return std::has_single_bit( capacity ) ? capacity - 1 : 0;
+	}
 
-		for ( size_t i = 0; i < oldCapacity; ++i )
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::homeBucket( CachedHash hash, size_t capacity, size_t mask ) noexcept
+	{
+		if ( mask != 0 )
 		{
-			if ( oldBuckets[i].occupied )
+			return static_cast<size_t>( hash & mask );
+		}
+
+		// Multiply-shift range reduction; capacity 1 also lands here and yields 0
+		if constexpr ( sizeof( CachedHash ) == sizeof( std::uint64_t ) )
+		{
+			std::uint64_t low{ hash };
+			std::uint64_t high{ capacity };
+			detail::hashing::multiply128( low, high );
+
+			return static_cast<size_t>( high );
+		}
+		else
+		{
+			return static_cast<size_t>( ( static_cast<std::uint64_t>( hash ) * capacity ) >> 32 );
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::nextBucket( size_t pos, size_t capacity ) noexcept
+	{
+		return pos + 1 == capacity ? 0 : pos + 1;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	inline void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::reseedAndRebuild()
+	{
+		completeRehash();
+		m_hasher.reseed();
+		recordReseed();
+
+		[[maybe_unused]] const RehashTimer timer{ *this };
+
+		Table oldTable{ std::move( m_table ) };
+		m_table = Table{ allocator() };
+		m_table.resize( m_capacity );
+
+		// Stored hashes belong to the previous key: every key is hashed again
+		for ( size_t i = oldTable.occupancy.next( 0, m_capacity ); i != m_capacity; i = oldTable.occupancy.next( i + 1, m_capacity ) )
+		{
+			Slot& slot{ oldTable.slot( i ) };
+			const CachedHash hash{ static_cast<CachedHash>( m_hasher( slot.key ) ) };
+			placeNew( homeBucket( hash, m_capacity, m_mask ), std::move( slot ), Metadata{ hash, 0, true } );
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	template <typename Predicate>
+	NFX_META_INLINE size_t HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::eraseWhere( Predicate&& predicate )
+	{
+		completeRehash();
+		if ( m_size == 0 )
+		{
+			return 0;
+		}
+
+		// Start after an empty bucket (one always exists below 100% load): no cluster wraps past it
+		size_t start{ 0 };
+		while ( m_table.meta( start ).occupied )
+		{
+			++start;
+		}
+
+		// Bucket indices below are unwrapped (start + 1 .. start + capacity) so they compare in probe order.
+		// Only occupied buckets are visited; a gap in the indices means the previous cluster ended.
+		// Buckets are only written at or behind the sweep, so the bitmap ahead of it is unchanged.
+		size_t erased{ 0 };
+		size_t nextFree{ start + 1 };
+		size_t lastIndex{ start };
+		std::exception_ptr error;
+
+		const auto sweep{ [&]( size_t first, size_t last, size_t offset ) {
+			for ( size_t pos = m_table.occupancy.next( first, last ); pos != last; pos = m_table.occupancy.next( pos + 1, last ) )
 			{
-				insertOrAssignInternal( std::move( oldBuckets[i].key ), std::move( oldBuckets[i].value ) );
+				const size_t index{ pos + offset };
+				if ( index != lastIndex + 1 )
+				{
+					if ( error )
+					{
+						// The cluster interrupted by the exception is consistent again
+						return false;
+					}
+					nextFree = index;
+				}
+				lastIndex = index;
+
+				Metadata& meta{ m_table.meta( pos ) };
+				Slot& slot{ m_table.slot( pos ) };
+				if ( !error )
+				{
+					try
+					{
+						if ( predicate( std::as_const( slot ), meta.hash ) )
+						{
+							slot = Slot{};
+							meta = Metadata{};
+							m_table.occupancy.reset( pos );
+							++erased;
+							continue;
+						}
+					}
+					catch ( ... )
+					{
+						error = std::current_exception();
+					}
+				}
+
+				// Kept: move back over the buckets freed earlier in this cluster, but not before home
+				const size_t home{ index - meta.distance };
+				const size_t target{ std::max( home, nextFree ) };
+				if ( target != index )
+				{
+					const size_t targetPos{ target < m_capacity ? target : target - m_capacity };
+					m_table.slot( targetPos ) = std::move( slot );
+					m_table.meta( targetPos ) = Metadata{ meta.hash, static_cast<std::uint16_t>( target - home ), true };
+					m_table.occupancy.set( targetPos );
+					slot = Slot{};
+					meta = Metadata{};
+					m_table.occupancy.reset( pos );
+				}
+				nextFree = target + 1;
 			}
+			return true;
+		} };
+
+		if ( sweep( start + 1, m_capacity, 0 ) )
+		{
+			sweep( 0, start, m_capacity );
+		}
+
+		m_size -= erased;
+		if ( error )
+		{
+			std::rethrow_exception( error );
 		}
+
+		return erased;
 	}
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::eraseAtPosition( size_t pos ) noexcept
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	NFX_META_INLINE void HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::eraseAtPosition( Table& table, size_t capacity, size_t pos ) noexcept
 	{
-		size_t nextPos{ ( pos + 1 ) & m_mask };
+		size_t nextPos{ nextBucket( pos, capacity ) };
 
-		while ( m_buckets[nextPos].occupied && m_buckets[nextPos].distance > 0 )
+		while ( table.meta( nextPos ).occupied && table.meta( nextPos ).distance > 0 )
 		{
-			m_buckets[pos] = std::move( m_buckets[nextPos] );
-			--m_buckets[pos].distance; // Adjust distance!
+			table.slot( pos ) = std::move( table.slot( nextPos ) );
+			table.meta( pos ) = table.meta( nextPos );
+			--table.meta( pos ).distance; // Adjust distance!
 			pos = nextPos;
-			nextPos = ( nextPos + 1 ) & m_mask;
+			nextPos = nextBucket( nextPos, capacity );
 		}
 
-		m_buckets[pos] = Bucket{};
+		table.slot( pos ) = Slot{};
+		table.meta( pos ) = Metadata{};
+		table.occupancy.reset( pos );
 	}
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
 	template <typename KeyType1, typename KeyType2>
-	NFX_META_INLINE bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::keysEqual( const KeyType1& k1, const KeyType2& k2 ) const noexcept
+	NFX_META_INLINE bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::keysEqual( const KeyType1& k1, const KeyType2& k2 ) const noexcept
 	{
 		if constexpr ( std::is_same_v<KeyType1, std::string> && std::is_same_v<KeyType2, std::string_view> )
 		{
@@ -291,57 +1182,55 @@ namespace nfx::containers
 	// STL-compatible iteration support
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	typename HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::iterator
-	HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::begin() noexcept
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	typename HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::iterator
+	HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::begin() noexcept
 	{
-		return iterator( m_buckets.data(), m_buckets.data() + m_capacity );
+		if ( m_oldCapacity != 0 )
+		{
+			return iterator( &m_oldTable, 0, m_oldCapacity, &m_table, m_capacity );
+		}
+
+		return iterator( &m_table, 0, m_capacity );
 	}
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	typename HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::const_iterator
-	HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::begin() const noexcept
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	typename HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::const_iterator
+	HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::begin() const noexcept
 	{
-		return const_iterator( m_buckets.data(), m_buckets.data() + m_capacity );
+		if ( m_oldCapacity != 0 )
+		{
+			return const_iterator( &m_oldTable, 0, m_oldCapacity, &m_table, m_capacity );
+		}
+
+		return const_iterator( &m_table, 0, m_capacity );
 	}
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	typename HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::iterator
-	HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::end() noexcept
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	typename HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::iterator
+	HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::end() noexcept
 	{
-		return iterator( m_buckets.data() + m_capacity, m_buckets.data() + m_capacity );
+		return iterator( &m_table, m_capacity, m_capacity );
 	}
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	typename HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::const_iterator
-	HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::end() const noexcept
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	typename HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::const_iterator
+	HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::end() const noexcept
 	{
-		return const_iterator( m_buckets.data() + m_capacity, m_buckets.data() + m_capacity );
+		return const_iterator( &m_table, m_capacity, m_capacity );
 	}
 
-	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-	bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>::operator==( const HashMap& other ) const noexcept
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout, typename Allocator, typename Hasher, CachedHashType CachedHash>
+	bool HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>::operator==( const HashMap& other ) const noexcept
 	{
 		if ( m_size != other.m_size )
 		{
 			return false;
 		}
 
-		// Compare all key-value pairs
-		for ( const auto& pair : *this )
-		{
-			// Find key in other HashMap and compare values
-			auto it = std::find_if( other.begin(), other.end(),
-				[&pair]( const auto& otherPair ) {
-					return pair.first == otherPair.first;
-				} );
-
-			if ( it == other.end() || it->second != pair.second )
-			{
-				return false;
-			}
-		}
-
-		return true;
+		return forEachOccupied( [this, &other]( const Slot& slot, CachedHash hash ) {
+			const Slot* match{ other.findSlot( slot.key, other.hashFrom( *this, slot.key, hash ) ) };
+			return match != nullptr && match->value == slot.value;
+		} );
 	}
 } // namespace nfx::containers
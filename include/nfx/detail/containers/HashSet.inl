@@ -0,0 +1,255 @@
+/**
+ * @file HashSet.inl
+ * @brief Template implementation file for HashSet Robin Hood set
+ * @details Forwards to the underlying HashMap and implements bulk insertion and set algebra
+ */
+
+#include <algorithm>
+
+#include "nfx/config.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// HashSet class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::HashSet()
+		: m_map{}
+	{
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::HashSet( size_t initialCapacity )
+		: m_map{ initialCapacity }
+	{
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::HashSet( const Allocator& allocator )
+		: m_map{ typename map_type::allocator_type( allocator ) }
+	{
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::HashSet( size_t initialCapacity, const Allocator& allocator )
+		: m_map{ initialCapacity, typename map_type::allocator_type( allocator ) }
+	{
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::HashSet( std::initializer_list<TKey> keys )
+		: m_map{}
+	{
+		insertRange( keys.begin(), keys.end() );
+	}
+
+	//----------------------------------------------
+	// Core operations
+	//----------------------------------------------
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	template <typename KeyType>
+	NFX_META_INLINE bool HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::contains( const KeyType& key ) const noexcept
+	{
+		// const_cast is safe because lookup only reads the buckets
+		detail::SetPresence* presence{ nullptr };
+
+		return const_cast<map_type&>( m_map ).tryGetValue( key, presence );
+	}
+
+	//----------------------------------------------
+	// Insertion
+	//----------------------------------------------
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	template <typename KeyType>
+	NFX_META_INLINE bool HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::insert( const KeyType& key )
+	{
+		return m_map.tryEmplace( key ).second;
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+	NFX_META_INLINE size_t HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::insertRange( InputIt first, Sentinel last )
+	{
+		if constexpr ( std::sized_sentinel_for<Sentinel, InputIt> )
+		{
+			// Size for every key being new so the loop below never rehashes
+			const size_t incoming{ static_cast<size_t>( last - first ) };
+			reserve( ( ( m_map.size() + incoming ) * 100 ) / map_type::MAX_LOAD_FACTOR_PERCENT + 1 );
+		}
+
+		size_t inserted{ 0 };
+		for ( ; first != last; ++first )
+		{
+			inserted += insert( *first ) ? 1 : 0;
+		}
+
+		return inserted;
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	template <std::ranges::input_range Range>
+	NFX_META_INLINE size_t HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::insertRange( Range&& keys )
+	{
+		if constexpr ( std::ranges::sized_range<Range> )
+		{
+			reserve( ( ( m_map.size() + std::ranges::size( keys ) ) * 100 ) / map_type::MAX_LOAD_FACTOR_PERCENT + 1 );
+		}
+
+		size_t inserted{ 0 };
+		for ( const auto& key : keys )
+		{
+			inserted += insert( key ) ? 1 : 0;
+		}
+
+		return inserted;
+	}
+
+	//----------------------------------------------
+	// Capacity and memory management
+	//----------------------------------------------
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE void HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::reserve( size_t minCapacity )
+	{
+		m_map.reserve( minCapacity );
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	template <typename KeyType>
+	NFX_META_INLINE bool HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::erase( const KeyType& key ) noexcept
+	{
+		return m_map.erase( key );
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE void HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::clear() noexcept
+	{
+		m_map.clear();
+	}
+
+	//----------------------------------------------
+	// Set algebra
+	//----------------------------------------------
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>
+	HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::unionWith( const HashSet& other ) const
+	{
+		HashSet result{ *this };
+		result.insertRange( other.begin(), other.end() );
+
+		return result;
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>
+	HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::intersectionWith( const HashSet& other ) const
+	{
+		const HashSet& smaller{ size() <= other.size() ? *this : other };
+		const HashSet& larger{ size() <= other.size() ? other : *this };
+
+		HashSet result{ allocator() };
+		for ( const TKey& key : smaller )
+		{
+			if ( larger.contains( key ) )
+			{
+				result.insert( key );
+			}
+		}
+
+		return result;
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>
+	HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::differenceWith( const HashSet& other ) const
+	{
+		HashSet result{ allocator() };
+		for ( const TKey& key : *this )
+		{
+			if ( !other.contains( key ) )
+			{
+				result.insert( key );
+			}
+		}
+
+		return result;
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE bool HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::isSubsetOf( const HashSet& other ) const noexcept
+	{
+		if ( size() > other.size() )
+		{
+			return false;
+		}
+
+		return std::all_of( begin(), end(), [&other]( const TKey& key ) { return other.contains( key ); } );
+	}
+
+	//----------------------------------------------
+	// State inspection
+	//----------------------------------------------
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE size_t HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::size() const noexcept
+	{
+		return m_map.size();
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE size_t HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::capacity() const noexcept
+	{
+		return m_map.capacity();
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE bool HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::isEmpty() const noexcept
+	{
+		return m_map.isEmpty();
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE typename HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::allocator_type
+	HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::allocator() const noexcept
+	{
+		return Allocator( m_map.allocator() );
+	}
+
+	//----------------------------------------------
+	// Iteration
+	//----------------------------------------------
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE typename HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::const_iterator
+	HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::begin() const noexcept
+	{
+		return const_iterator{ m_map.begin() };
+	}
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE typename HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::const_iterator
+	HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::end() const noexcept
+	{
+		return const_iterator{ m_map.end() };
+	}
+
+	//----------------------------------------------
+	// Comparison
+	//----------------------------------------------
+
+	template <typename TKey, uint32_t FnvOffsetBasis, uint32_t FnvPrime, typename Allocator, typename Hasher>
+	NFX_META_INLINE bool HashSet<TKey, FnvOffsetBasis, FnvPrime, Allocator, Hasher>::operator==( const HashSet& other ) const noexcept
+	{
+		// The map compares with cached hashes instead of hashing every key again
+		return m_map == other.m_map;
+	}
+} // namespace nfx::containers
@@ -0,0 +1,132 @@
+/**
+ * @file HugePageAllocator.inl
+ * @brief Implementation file for HugePageAllocator
+ * @details Aligned anonymous mappings with MADV_HUGEPAGE on Linux, std::allocator elsewhere
+ */
+
+#include <cstdint>
+#include <limits>
+#include <new>
+
+#if defined( __linux__ )
+#	include <sys/mman.h>
+#endif
+
+namespace nfx::containers
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Huge page mapping helpers
+		//=====================================================================
+
+		NFX_META_INLINE void* mapHugePages( size_t bytes )
+		{
+#if defined( __linux__ )
+			constexpr size_t pageSize{ HugePageAllocator<std::byte>::HUGE_PAGE_SIZE };
+
+			// Over-map by one huge page so a 2 MiB aligned start always fits, then trim
+			const size_t reserved{ bytes + pageSize };
+			void* raw{ ::mmap( nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 ) };
+			if ( raw == MAP_FAILED )
+			{
+				throw std::bad_alloc{};
+			}
+
+			const std::uintptr_t start{ reinterpret_cast<std::uintptr_t>( raw ) };
+			const std::uintptr_t aligned{ ( start + pageSize - 1 ) & ~static_cast<std::uintptr_t>( pageSize - 1 ) };
+			const size_t head{ static_cast<size_t>( aligned - start ) };
+			const size_t tail{ reserved - head - bytes };
+			if ( head != 0 )
+			{
+				::munmap( raw, head );
+			}
+			if ( tail != 0 )
+			{
+				::munmap( reinterpret_cast<void*>( aligned + bytes ), tail );
+			}
+
+			// Only advice: with THP disabled the kernel keeps using regular pages
+			void* address{ reinterpret_cast<void*>( aligned ) };
+			::madvise( address, bytes, MADV_HUGEPAGE );
+
+			return address;
+#else
+			(void)bytes;
+			throw std::bad_alloc{};
+#endif
+		}
+
+		NFX_META_INLINE void unmapHugePages( void* address, size_t bytes ) noexcept
+		{
+#if defined( __linux__ )
+			::munmap( address, bytes );
+#else
+			(void)address;
+			(void)bytes;
+#endif
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// HugePageAllocator class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Allocation
+	//----------------------------------------------
+
+	template <typename T>
+	NFX_META_INLINE T* HugePageAllocator<T>::allocate( size_t count )
+	{
+		// Leaves room for rounding the mapping up to a whole huge page
+		if ( count > ( std::numeric_limits<size_t>::max() - HUGE_PAGE_SIZE ) / sizeof( T ) )
+		{
+			throw std::bad_array_new_length{};
+		}
+
+		if ( usesHugePages( count ) )
+		{
+			return static_cast<T*>( detail::mapHugePages( mappedBytes( count ) ) );
+		}
+
+		return std::allocator<T>{}.allocate( count );
+	}
+
+	template <typename T>
+	NFX_META_INLINE void HugePageAllocator<T>::deallocate( T* pointer, size_t count ) noexcept
+	{
+		if ( usesHugePages( count ) )
+		{
+			detail::unmapHugePages( pointer, mappedBytes( count ) );
+			return;
+		}
+
+		std::allocator<T>{}.deallocate( pointer, count );
+	}
+
+	//----------------------------------------------
+	// State inspection
+	//----------------------------------------------
+
+	template <typename T>
+	NFX_META_INLINE bool HugePageAllocator<T>::usesHugePages( size_t count ) noexcept
+	{
+#if defined( __linux__ )
+		return alignof( T ) <= HUGE_PAGE_SIZE && count >= ( MIN_HUGE_PAGE_ALLOCATION + sizeof( T ) - 1 ) / sizeof( T );
+#else
+		(void)count;
+		return false;
+#endif
+	}
+
+	//----------------------------------------------
+	// Private helpers
+	//----------------------------------------------
+
+	template <typename T>
+	NFX_META_INLINE size_t HugePageAllocator<T>::mappedBytes( size_t count ) noexcept
+	{
+		return ( count * sizeof( T ) + HUGE_PAGE_SIZE - 1 ) & ~( HUGE_PAGE_SIZE - 1 );
+	}
+} // namespace nfx::containers
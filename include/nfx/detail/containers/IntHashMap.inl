@@ -0,0 +1,384 @@
+/**
+ * @file IntHashMap.inl
+ * @brief Template implementation file for IntHashMap integer-keyed container
+ * @details Contains template method implementations for Fibonacci hashing, Robin Hood
+ *          insertion with recomputed probe distances and backward-shift deletion
+ */
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <type_traits>
+
+#include "nfx/config.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// IntHashMap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE IntHashMap<TKey, TValue, EmptyKey, Allocator>::IntHashMap()
+		: IntHashMap( INITIAL_CAPACITY, Allocator{} )
+	{
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE IntHashMap<TKey, TValue, EmptyKey, Allocator>::IntHashMap( size_t initialCapacity )
+		: IntHashMap( initialCapacity, Allocator{} )
+	{
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE IntHashMap<TKey, TValue, EmptyKey, Allocator>::IntHashMap( const Allocator& allocator )
+		: IntHashMap( INITIAL_CAPACITY, allocator )
+	{
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE IntHashMap<TKey, TValue, EmptyKey, Allocator>::IntHashMap( size_t initialCapacity, const Allocator& allocator )
+		: m_slots( SlotAllocator( allocator ) )
+	{
+		// At least two slots so the shift stays below 64
+		setCapacity( std::bit_ceil( std::max<size_t>( initialCapacity, 2 ) ) );
+		m_slots.resize( m_capacity );
+	}
+
+	//----------------------------------------------
+	// Core operations
+	//----------------------------------------------
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE bool IntHashMap<TKey, TValue, EmptyKey, Allocator>::tryGetValue( TKey key, TValue*& outValue ) noexcept
+	{
+		const TValue* found{ nullptr };
+		const bool result{ std::as_const( *this ).tryGetValue( key, found ) };
+		outValue = const_cast<TValue*>( found );
+		return result;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE bool IntHashMap<TKey, TValue, EmptyKey, Allocator>::tryGetValue( TKey key, const TValue*& outValue ) const noexcept
+	{
+		const size_t index{ key == EmptyKey ? m_capacity : findIndex( key ) };
+
+		if ( index == m_capacity )
+		{
+			outValue = nullptr;
+			return false;
+		}
+
+		outValue = &m_slots[index].value;
+		return true;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE bool IntHashMap<TKey, TValue, EmptyKey, Allocator>::contains( TKey key ) const noexcept
+	{
+		return key != EmptyKey && findIndex( key ) != m_capacity;
+	}
+
+	//----------------------------------------------
+	// Insertion
+	//----------------------------------------------
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	template <typename ValueType>
+		requires std::is_assignable_v<TValue&, ValueType&&> && std::is_constructible_v<TValue, ValueType&&>
+	NFX_META_INLINE void IntHashMap<TKey, TValue, EmptyKey, Allocator>::insertOrAssign( TKey key, ValueType&& value )
+	{
+		checkKey( key );
+
+		const size_t existing{ findIndex( key ) };
+		if ( existing != m_capacity )
+		{
+			m_slots[existing].value = std::forward<ValueType>( value );
+			return;
+		}
+
+		growIfNeeded();
+		placeNew( Slot{ key, TValue( std::forward<ValueType>( value ) ) } );
+		++m_size;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	template <typename... Args>
+	NFX_META_INLINE std::pair<TValue*, bool> IntHashMap<TKey, TValue, EmptyKey, Allocator>::tryEmplace( TKey key, Args&&... args )
+	{
+		checkKey( key );
+
+		const size_t existing{ findIndex( key ) };
+		if ( existing != m_capacity )
+		{
+			return { &m_slots[existing].value, false };
+		}
+
+		growIfNeeded();
+		const size_t pos{ placeNew( Slot{ key, TValue( std::forward<Args>( args )... ) } ) };
+		++m_size;
+
+		return { &m_slots[pos].value, true };
+	}
+
+	//----------------------------------------------
+	// Capacity and memory management
+	//----------------------------------------------
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE void IntHashMap<TKey, TValue, EmptyKey, Allocator>::reserve( size_t minCapacity )
+	{
+		const size_t requiredSlots{ ( minCapacity * 100 + MAX_LOAD_FACTOR_PERCENT - 1 ) / MAX_LOAD_FACTOR_PERCENT };
+
+		if ( requiredSlots > m_capacity )
+		{
+			rehash( std::bit_ceil( requiredSlots ) );
+		}
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE bool IntHashMap<TKey, TValue, EmptyKey, Allocator>::erase( TKey key ) noexcept
+	{
+		if ( key == EmptyKey )
+		{
+			return false;
+		}
+
+		size_t pos{ findIndex( key ) };
+		if ( pos == m_capacity )
+		{
+			return false;
+		}
+
+		// Backward shift: pull every displaced successor one slot closer to home
+		while ( true )
+		{
+			const size_t next{ ( pos + 1 ) & m_mask };
+			if ( m_slots[next].key == EmptyKey || distanceAt( next ) == 0 )
+			{
+				break;
+			}
+			m_slots[pos] = std::move( m_slots[next] );
+			pos = next;
+		}
+
+		m_slots[pos] = Slot{};
+		--m_size;
+
+		return true;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE void IntHashMap<TKey, TValue, EmptyKey, Allocator>::clear() noexcept
+	{
+		for ( Slot& slot : m_slots )
+		{
+			slot = Slot{};
+		}
+		m_size = 0;
+	}
+
+	//----------------------------------------------
+	// State inspection
+	//----------------------------------------------
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE size_t IntHashMap<TKey, TValue, EmptyKey, Allocator>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE size_t IntHashMap<TKey, TValue, EmptyKey, Allocator>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE bool IntHashMap<TKey, TValue, EmptyKey, Allocator>::isEmpty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE typename IntHashMap<TKey, TValue, EmptyKey, Allocator>::allocator_type
+	IntHashMap<TKey, TValue, EmptyKey, Allocator>::allocator() const noexcept
+	{
+		return Allocator( m_slots.get_allocator() );
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE size_t IntHashMap<TKey, TValue, EmptyKey, Allocator>::homeSlot( TKey key ) const noexcept
+	{
+		// Multiplication carries every key bit into the top bits, which index the table
+		const std::uint64_t bits{ static_cast<std::uint64_t>( static_cast<std::make_unsigned_t<TKey>>( key ) ) };
+		return static_cast<size_t>( ( bits * FIBONACCI_MULTIPLIER ) >> m_shift );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE size_t IntHashMap<TKey, TValue, EmptyKey, Allocator>::distanceAt( size_t pos ) const noexcept
+	{
+		return ( pos - homeSlot( m_slots[pos].key ) ) & m_mask;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE size_t IntHashMap<TKey, TValue, EmptyKey, Allocator>::findIndex( TKey key ) const noexcept
+	{
+		size_t pos{ homeSlot( key ) };
+
+		for ( size_t distance = 0;; ++distance )
+		{
+			const TKey slotKey{ m_slots[pos].key };
+			if ( slotKey == key )
+			{
+				return pos;
+			}
+
+			// Robin Hood invariant: the key would have displaced any slot closer to its home
+			if ( slotKey == EmptyKey || distanceAt( pos ) < distance )
+			{
+				return m_capacity;
+			}
+
+			pos = ( pos + 1 ) & m_mask;
+		}
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	inline size_t IntHashMap<TKey, TValue, EmptyKey, Allocator>::placeNew( Slot&& slot ) noexcept( NOTHROW_SLOT_MOVE )
+	{
+		size_t pos{ homeSlot( slot.key ) };
+		size_t distance{ 0 };
+		size_t placed{ m_capacity };
+
+		while ( true )
+		{
+			Slot& current{ m_slots[pos] };
+			if ( current.key == EmptyKey )
+			{
+				current = std::move( slot );
+				return placed == m_capacity ? pos : placed;
+			}
+
+			// Take the slot from a richer resident and carry it forward instead
+			const size_t currentDistance{ distanceAt( pos ) };
+			if ( currentDistance < distance )
+			{
+				std::swap( current, slot );
+				if ( placed == m_capacity )
+				{
+					placed = pos;
+				}
+				distance = currentDistance;
+			}
+
+			pos = ( pos + 1 ) & m_mask;
+			++distance;
+		}
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	inline void IntHashMap<TKey, TValue, EmptyKey, Allocator>::rehash( size_t newCapacity )
+	{
+		// Fill a separate table and commit only once every element is placed: if a value copy
+		// throws, this map is left untouched (values whose move can throw are copied)
+		IntHashMap grown( newCapacity, allocator() );
+		for ( Slot& slot : m_slots )
+		{
+			if ( slot.key != EmptyKey )
+			{
+				grown.placeNew( Slot{ slot.key, std::move_if_noexcept( slot.value ) } );
+			}
+		}
+
+		m_slots.swap( grown.m_slots );
+		setCapacity( grown.m_capacity );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE void IntHashMap<TKey, TValue, EmptyKey, Allocator>::setCapacity( size_t capacity ) noexcept
+	{
+		m_capacity = capacity;
+		m_mask = capacity - 1;
+		m_shift = 64u - static_cast<unsigned>( std::countr_zero( capacity ) );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE void IntHashMap<TKey, TValue, EmptyKey, Allocator>::growIfNeeded()
+	{
+		if ( ( m_size + 1 ) * 100 > m_capacity * MAX_LOAD_FACTOR_PERCENT )
+		{
+			rehash( m_capacity << 1 );
+		}
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	NFX_META_INLINE void IntHashMap<TKey, TValue, EmptyKey, Allocator>::checkKey( TKey key )
+	{
+		if ( key == EmptyKey )
+		{
+			throw std::invalid_argument{ "IntHashMap: key equals the reserved empty-slot sentinel" };
+		}
+	}
+
+	//----------------------------------------------
+	// STL-compatible iteration support
+	//----------------------------------------------
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	typename IntHashMap<TKey, TValue, EmptyKey, Allocator>::iterator
+	IntHashMap<TKey, TValue, EmptyKey, Allocator>::begin() noexcept
+	{
+		return iterator( m_slots.data(), m_slots.data() + m_capacity );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	typename IntHashMap<TKey, TValue, EmptyKey, Allocator>::const_iterator
+	IntHashMap<TKey, TValue, EmptyKey, Allocator>::begin() const noexcept
+	{
+		return const_iterator( m_slots.data(), m_slots.data() + m_capacity );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	typename IntHashMap<TKey, TValue, EmptyKey, Allocator>::iterator
+	IntHashMap<TKey, TValue, EmptyKey, Allocator>::end() noexcept
+	{
+		return iterator( m_slots.data() + m_capacity, m_slots.data() + m_capacity );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	typename IntHashMap<TKey, TValue, EmptyKey, Allocator>::const_iterator
+	IntHashMap<TKey, TValue, EmptyKey, Allocator>::end() const noexcept
+	{
+		return const_iterator( m_slots.data() + m_capacity, m_slots.data() + m_capacity );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename Allocator>
+	bool IntHashMap<TKey, TValue, EmptyKey, Allocator>::operator==( const IntHashMap& other ) const noexcept
+	{
+		if ( m_size != other.m_size )
+		{
+			return false;
+		}
+
+		for ( const auto& pair : *this )
+		{
+			const size_t index{ other.findIndex( pair.first ) };
+
+			if ( index == other.m_capacity || other.m_slots[index].value != pair.second )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+} // namespace nfx::containers
@@ -0,0 +1,208 @@
+/**
+ * @file PerfectHashMap.inl
+ * @brief Implementation file for PerfectHashMap
+ * @details Construction (hashing, engine build, in-place reorder into engine order) and
+ *          fingerprint-checked lookups
+ */
+
+#include <utility>
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// PerfectHashMap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	inline PerfectHashMap<TValue, Engine, Hasher, Allocator>::PerfectHashMap( container_type&& items, Engine engine, Hasher hash )
+		: m_engine{ std::move( engine ) },
+		  m_hasher{ std::move( hash ) },
+		  m_table{ std::move( items ) },
+		  m_fingerprints( m_table.size(), 0, RebindAllocator<std::uint16_t>{ m_table.get_allocator() } )
+	{
+		const size_t count{ m_table.size() };
+
+		std::vector<std::uint64_t> hashes( count );
+		for ( size_t i{ 0 }; i < count; ++i )
+		{
+			hashes[i] = m_hasher( std::string_view{ m_table[i].first } );
+		}
+
+		m_engine.build( hashes );
+
+		// Reuse the hash array as each entry's target index, then move every entry home along its cycle
+		for ( size_t i{ 0 }; i < count; ++i )
+		{
+			m_fingerprints[i] = fingerprint( hashes[i] );
+			hashes[i] = m_engine.position( hashes[i] );
+		}
+
+		for ( size_t i{ 0 }; i < count; ++i )
+		{
+			while ( hashes[i] != i )
+			{
+				const size_t target{ static_cast<size_t>( hashes[i] ) };
+				std::swap( m_table[i], m_table[target] );
+				std::swap( m_fingerprints[i], m_fingerprints[target] );
+				std::swap( hashes[i], hashes[target] );
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Lookup methods
+	//----------------------------------------------
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	NFX_META_INLINE TValue& PerfectHashMap<TValue, Engine, Hasher, Allocator>::operator[]( std::string_view key )
+	{
+		const size_t entry{ entryIndex( key ) };
+		if ( entry == NOT_FOUND )
+		{
+			throw KeyNotFoundException{ key };
+		}
+
+		return m_table[entry].second;
+	}
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	inline const TValue& PerfectHashMap<TValue, Engine, Hasher, Allocator>::at( std::string_view key ) const
+	{
+		const size_t entry{ entryIndex( key ) };
+		if ( entry == NOT_FOUND )
+		{
+			throw KeyNotFoundException{ key };
+		}
+
+		return m_table[entry].second;
+	}
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	NFX_META_INLINE bool PerfectHashMap<TValue, Engine, Hasher, Allocator>::tryGetValue( std::string_view key, TValue*& outValue ) noexcept
+	{
+		const size_t entry{ entryIndex( key ) };
+		if ( entry == NOT_FOUND )
+		{
+			outValue = nullptr;
+			return false;
+		}
+
+		outValue = &m_table[entry].second;
+
+		return true;
+	}
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	NFX_META_INLINE bool PerfectHashMap<TValue, Engine, Hasher, Allocator>::tryGetValue( std::string_view key, const TValue*& outValue ) const noexcept
+	{
+		const size_t entry{ entryIndex( key ) };
+		if ( entry == NOT_FOUND )
+		{
+			outValue = nullptr;
+			return false;
+		}
+
+		outValue = &m_table[entry].second;
+
+		return true;
+	}
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	NFX_META_INLINE bool PerfectHashMap<TValue, Engine, Hasher, Allocator>::contains( std::string_view key ) const noexcept
+	{
+		return entryIndex( key ) != NOT_FOUND;
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	inline size_t PerfectHashMap<TValue, Engine, Hasher, Allocator>::size() const noexcept
+	{
+		return m_table.size();
+	}
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	inline bool PerfectHashMap<TValue, Engine, Hasher, Allocator>::isEmpty() const noexcept
+	{
+		return m_table.empty();
+	}
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	inline const Engine& PerfectHashMap<TValue, Engine, Hasher, Allocator>::engine() const noexcept
+	{
+		return m_engine;
+	}
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	inline size_t PerfectHashMap<TValue, Engine, Hasher, Allocator>::indexSizeInBytes() const noexcept
+	{
+		return m_engine.sizeInBytes() + m_fingerprints.capacity() * sizeof( std::uint16_t );
+	}
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	inline typename PerfectHashMap<TValue, Engine, Hasher, Allocator>::allocator_type PerfectHashMap<TValue, Engine, Hasher, Allocator>::allocator() const noexcept
+	{
+		return allocator_type{ m_table.get_allocator() };
+	}
+
+	//----------------------------------------------
+	// Iteration
+	//----------------------------------------------
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	inline typename PerfectHashMap<TValue, Engine, Hasher, Allocator>::const_iterator PerfectHashMap<TValue, Engine, Hasher, Allocator>::begin() const noexcept
+	{
+		return m_table.begin();
+	}
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	inline typename PerfectHashMap<TValue, Engine, Hasher, Allocator>::const_iterator PerfectHashMap<TValue, Engine, Hasher, Allocator>::end() const noexcept
+	{
+		return m_table.end();
+	}
+
+	//----------------------------------------------
+	// Exception classes
+	//----------------------------------------------
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	inline PerfectHashMap<TValue, Engine, Hasher, Allocator>::KeyNotFoundException::KeyNotFoundException( std::string_view key )
+		: std::runtime_error{ std::string{ "No value associated to key: " } + std::string{ key } }
+	{
+	}
+
+	//----------------------------------------------
+	// Private lookup helpers
+	//----------------------------------------------
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	NFX_META_INLINE std::uint16_t PerfectHashMap<TValue, Engine, Hasher, Allocator>::fingerprint( std::uint64_t hash ) noexcept
+	{
+		return static_cast<std::uint16_t>( hash >> 48 );
+	}
+
+	template <typename TValue, PerfectHashEngine Engine, PerfectHashKeyHasher Hasher, typename Allocator>
+	NFX_META_INLINE size_t PerfectHashMap<TValue, Engine, Hasher, Allocator>::entryIndex( std::string_view key ) const noexcept
+	{
+		if ( m_table.empty() )
+		{
+			return NOT_FOUND;
+		}
+
+		const std::uint64_t hashValue{ m_hasher( key ) };
+		const size_t entry{ m_engine.position( hashValue ) };
+
+		if ( m_fingerprints[entry] == fingerprint( hashValue ) && m_table[entry].first == key )
+		{
+			return entry;
+		}
+
+		return NOT_FOUND;
+	}
+} // namespace nfx::containers
@@ -0,0 +1,225 @@
+/**
+ * @file SnapshotHashMap.inl
+ * @brief Template implementation file for SnapshotHashMap read-mostly container
+ * @details Contains template method implementations for snapshot pinning, copy-on-write
+ *          publication and epoch-based reclamation of retired tables
+ */
+
+#include <functional>
+#include <limits>
+#include <thread>
+
+#include "nfx/config.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// SnapshotHashMap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::SnapshotHashMap()
+		: SnapshotHashMap( DEFAULT_READER_SLOTS )
+	{
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::SnapshotHashMap( size_t readerSlots )
+		: m_published( std::make_unique<table_type>() )
+	{
+		size_t count{ 1 };
+		while ( count < readerSlots )
+		{
+			count <<= 1;
+		}
+
+		m_slots = std::make_unique<ReaderSlot[]>( count );
+		m_slotMask = count - 1;
+		m_current.store( m_published.get(), std::memory_order_release );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::~SnapshotHashMap() = default;
+
+	//----------------------------------------------
+	// Read access
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE typename SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::Snapshot
+	SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::snapshot() const
+	{
+		// Start at a per-thread slot so a thread normally finds its own slot free on first try
+		size_t index{ std::hash<std::thread::id>{}( std::this_thread::get_id() ) & m_slotMask };
+
+		for ( size_t attempt = 0;; ++attempt )
+		{
+			std::atomic<std::uint64_t>& slot{ m_slots[index].epoch };
+			std::uint64_t expected{ INACTIVE_EPOCH };
+
+			// seq_cst: the announcement must be visible before m_current is read
+			if ( slot.load( std::memory_order_relaxed ) == INACTIVE_EPOCH &&
+				 slot.compare_exchange_strong( expected, m_globalEpoch.load( std::memory_order_seq_cst ), std::memory_order_seq_cst ) )
+			{
+				return Snapshot{ &slot, m_current.load( std::memory_order_seq_cst ) };
+			}
+
+			index = ( index + 1 ) & m_slotMask;
+			if ( attempt >= m_slotMask )
+			{
+				// Every slot pinned: wait for a reader to finish
+				std::this_thread::yield();
+				attempt = 0;
+			}
+		}
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	template <typename KeyType>
+	NFX_META_INLINE bool SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::tryGetValue( const KeyType& key, TValue& outValue ) const
+	{
+		const Snapshot pinned{ snapshot() };
+
+		const TValue* value{ nullptr };
+		if ( !pinned.tryGetValue( key, value ) )
+		{
+			return false;
+		}
+
+		outValue = *value;
+		return true;
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE size_t SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::size() const
+	{
+		return snapshot().size();
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE bool SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::isEmpty() const
+	{
+		return size() == 0;
+	}
+
+	//----------------------------------------------
+	// Write access
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	template <typename Fn>
+	NFX_META_INLINE void SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::update( Fn&& fn )
+	{
+		std::lock_guard lock{ m_writeMutex };
+
+		auto next{ std::make_unique<table_type>( *m_published ) };
+		std::forward<Fn>( fn )( *next );
+		publish( std::move( next ) );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE void SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::assign( table_type&& table )
+	{
+		auto next{ std::make_unique<table_type>( std::move( table ) ) };
+
+		std::lock_guard lock{ m_writeMutex };
+		publish( std::move( next ) );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE void SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::insertOrAssign( const TKey& key, const TValue& value )
+	{
+		update( [&key, &value]( table_type& table ) { table.insertOrAssign( key, value ); } );
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	template <typename KeyType>
+	NFX_META_INLINE bool SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::erase( const KeyType& key )
+	{
+		std::lock_guard lock{ m_writeMutex };
+
+		// Absent key: nothing to copy or publish
+		TValue* existing{ nullptr };
+		if ( !m_published->tryGetValue( key, existing ) )
+		{
+			return false;
+		}
+
+		auto next{ std::make_unique<table_type>( *m_published ) };
+		next->erase( key );
+		publish( std::move( next ) );
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Reclamation
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE size_t SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::reclaim()
+	{
+		std::lock_guard lock{ m_writeMutex };
+
+		return reclaimLocked();
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE size_t SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::retiredCount() const
+	{
+		std::lock_guard lock{ m_writeMutex };
+
+		return m_retired.size();
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE void SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::publish( std::unique_ptr<table_type> next )
+	{
+		m_current.exchange( next.get(), std::memory_order_seq_cst );
+
+		// Readers announcing this epoch or later read m_current after the exchange above
+		const std::uint64_t retireEpoch{ m_globalEpoch.fetch_add( 1, std::memory_order_seq_cst ) + 1 };
+
+		m_retired.push_back( Retired{ std::move( m_published ), retireEpoch } );
+		m_published = std::move( next );
+
+		reclaimLocked();
+	}
+
+	template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, HashMapLayout Layout>
+	NFX_META_INLINE size_t SnapshotHashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout>::reclaimLocked()
+	{
+		if ( m_retired.empty() )
+		{
+			return 0;
+		}
+
+		std::uint64_t oldestActive{ std::numeric_limits<std::uint64_t>::max() };
+		for ( size_t i = 0; i <= m_slotMask; ++i )
+		{
+			const std::uint64_t epoch{ m_slots[i].epoch.load( std::memory_order_seq_cst ) };
+			if ( epoch != INACTIVE_EPOCH && epoch < oldestActive )
+			{
+				oldestActive = epoch;
+			}
+		}
+
+		// Retired in epoch order: free the prefix no active reader can still hold
+		size_t freed{ 0 };
+		while ( freed < m_retired.size() && m_retired[freed].epoch <= oldestActive )
+		{
+			++freed;
+		}
+		m_retired.erase( m_retired.begin(), m_retired.begin() + static_cast<std::ptrdiff_t>( freed ) );
+
+		return freed;
+	}
+} // namespace nfx::containers
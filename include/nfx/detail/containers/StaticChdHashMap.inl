@@ -0,0 +1,278 @@
+/**
+ * @file StaticChdHashMap.inl
+ * @brief Implementation file for StaticChdHashMap
+ * @details Compile-time CHD construction and constexpr lookups. The construction follows
+ *          ChdHashMap's single-threaded build step by step (see ChdHashMap.inl).
+ */
+
+#include <algorithm>
+#include <string>
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// StaticChdHashMap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TValue, size_t N, uint32_t FnvOffsetBasis>
+	consteval StaticChdHashMap<TValue, N, FnvOffsetBasis>::StaticChdHashMap( const value_type ( &items )[N], uint32_t maxSeedSearchMultiplier )
+		: StaticChdHashMap{ std::to_array( items ), maxSeedSearchMultiplier }
+	{
+	}
+
+	template <typename TValue, size_t N, uint32_t FnvOffsetBasis>
+	consteval StaticChdHashMap<TValue, N, FnvOffsetBasis>::StaticChdHashMap( const std::array<value_type, N>& items, uint32_t maxSeedSearchMultiplier )
+		: m_entries{ items }
+	{
+		constexpr uint64_t mask{ SLOT_COUNT - 1 };
+		const uint64_t seedLimit{ std::min<uint64_t>( SLOT_COUNT * maxSeedSearchMultiplier, MAX_SEED - 1 ) };
+
+		std::array<uint32_t, N> hashes{};
+		for ( size_t i{ 0 }; i < N; ++i )
+		{
+			hashes[i] = hash( m_entries[i].first );
+		}
+
+		// Flat bucket layout: counting sort of item indices by bucket, ascending within each bucket
+		std::array<uint32_t, SLOT_COUNT + 1> bucketStart{};
+		for ( size_t i{ 0 }; i < N; ++i )
+		{
+			++bucketStart[hashes[i] & mask];
+		}
+
+		size_t largestBucket{ 0 };
+		for ( uint64_t bucket{ 0 }, end{ 0 }; bucket < SLOT_COUNT; ++bucket )
+		{
+			largestBucket = std::max<size_t>( largestBucket, bucketStart[bucket] );
+			end += bucketStart[bucket];
+			bucketStart[bucket] = static_cast<uint32_t>( end );
+		}
+		bucketStart[SLOT_COUNT] = static_cast<uint32_t>( N );
+
+		std::array<uint32_t, N> bucketItems{};
+		for ( size_t i{ N }; i-- > 0; )
+		{
+			bucketItems[--bucketStart[hashes[i] & mask]] = static_cast<uint32_t>( i );
+		}
+
+		// Equal keys hash alike, so duplicates can only meet within a bucket
+		for ( uint64_t bucket{ 0 }; bucket < SLOT_COUNT; ++bucket )
+		{
+			for ( uint32_t i{ bucketStart[bucket] }; i < bucketStart[bucket + 1]; ++i )
+			{
+				for ( uint32_t j{ bucketStart[bucket] }; j < i; ++j )
+				{
+					if ( m_entries[bucketItems[i]].first == m_entries[bucketItems[j]].first )
+					{
+						throw std::invalid_argument{ "StaticChdHashMap: duplicate key" };
+					}
+				}
+			}
+		}
+
+		// Non-empty buckets ordered largest first, ascending bucket index within a size
+		std::array<uint32_t, N + 2> sizeOffsets{};
+		for ( uint64_t bucket{ 0 }; bucket < SLOT_COUNT; ++bucket )
+		{
+			++sizeOffsets[largestBucket + 1 - ( bucketStart[bucket + 1] - bucketStart[bucket] )];
+		}
+		for ( size_t i{ 0 }, start{ 0 }; i <= largestBucket + 1; ++i )
+		{
+			const size_t count{ sizeOffsets[i] };
+			sizeOffsets[i] = static_cast<uint32_t>( start );
+			start += count;
+		}
+
+		const size_t nonEmptyBuckets{ sizeOffsets[largestBucket + 1] };
+		std::array<uint32_t, N> bucketOrder{};
+		for ( uint64_t bucket{ 0 }; bucket < SLOT_COUNT; ++bucket )
+		{
+			const size_t bucketSize{ bucketStart[bucket + 1] - bucketStart[bucket] };
+			if ( bucketSize != 0 )
+			{
+				bucketOrder[sizeOffsets[largestBucket + 1 - bucketSize]++] = static_cast<uint32_t>( bucket );
+			}
+		}
+
+		m_slots.fill( EMPTY_SLOT );
+		std::array<uint32_t, N> slots{};
+
+		// Final slots of a bucket's items under seed, or false if one is occupied or two coincide
+		auto placeBucket{ [&]( uint32_t bucket, uint64_t seed ) {
+			const uint32_t first{ bucketStart[bucket] };
+			const uint32_t count{ bucketStart[bucket + 1] - first };
+			for ( uint32_t k{ 0 }; k < count; ++k )
+			{
+				// CHD ALGORITHM: final position from the secondary hash with the current seed
+				const uint32_t slot{ static_cast<uint32_t>(
+					core::hashing::seedMix( static_cast<uint32_t>( seed ), hashes[bucketItems[first + k]], SLOT_COUNT ) ) };
+				if ( m_slots[slot] != EMPTY_SLOT )
+				{
+					return false;
+				}
+				for ( uint32_t j{ 0 }; j < k; ++j )
+				{
+					if ( slots[j] == slot )
+					{
+						return false;
+					}
+				}
+				slots[k] = slot;
+			}
+
+			return true;
+		} };
+
+		for ( size_t i{ 0 }; i < nonEmptyBuckets; ++i )
+		{
+			const uint32_t bucket{ bucketOrder[i] };
+			uint64_t seed{ 1 };
+			while ( !placeBucket( bucket, seed ) )
+			{
+				if ( seed > seedLimit )
+				{
+					throw std::runtime_error{ "StaticChdHashMap: seed search exceeded threshold, raise maxSeedSearchMultiplier" };
+				}
+				++seed;
+			}
+
+			const uint32_t first{ bucketStart[bucket] };
+			for ( uint32_t k{ 0 }; k < bucketStart[bucket + 1] - first; ++k )
+			{
+				m_slots[slots[k]] = bucketItems[first + k];
+			}
+			m_seeds[bucket] = static_cast<uint16_t>( seed );
+		}
+	}
+
+	//----------------------------------------------
+	// Lookup methods
+	//----------------------------------------------
+
+	template <typename TValue, size_t N, uint32_t FnvOffsetBasis>
+	constexpr const TValue& StaticChdHashMap<TValue, N, FnvOffsetBasis>::at( std::string_view key ) const
+	{
+		const uint32_t entry{ entryIndex( key ) };
+		if ( entry == EMPTY_SLOT )
+		{
+			throw KeyNotFoundException{ key };
+		}
+
+		return m_entries[entry].second;
+	}
+
+	template <typename TValue, size_t N, uint32_t FnvOffsetBasis>
+	NFX_META_INLINE constexpr bool StaticChdHashMap<TValue, N, FnvOffsetBasis>::tryGetValue( std::string_view key, const TValue*& outValue ) const noexcept
+	{
+		const uint32_t entry{ entryIndex( key ) };
+		if ( entry == EMPTY_SLOT )
+		{
+			outValue = nullptr;
+			return false;
+		}
+
+		outValue = &m_entries[entry].second;
+
+		return true;
+	}
+
+	template <typename TValue, size_t N, uint32_t FnvOffsetBasis>
+	NFX_META_INLINE constexpr bool StaticChdHashMap<TValue, N, FnvOffsetBasis>::contains( std::string_view key ) const noexcept
+	{
+		return entryIndex( key ) != EMPTY_SLOT;
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	template <typename TValue, size_t N, uint32_t FnvOffsetBasis>
+	constexpr size_t StaticChdHashMap<TValue, N, FnvOffsetBasis>::size() const noexcept
+	{
+		return N;
+	}
+
+	template <typename TValue, size_t N, uint32_t FnvOffsetBasis>
+	constexpr bool StaticChdHashMap<TValue, N, FnvOffsetBasis>::isEmpty() const noexcept
+	{
+		return false;
+	}
+
+	//----------------------------------------------
+	// Iteration
+	//----------------------------------------------
+
+	template <typename TValue, size_t N, uint32_t FnvOffsetBasis>
+	constexpr typename StaticChdHashMap<TValue, N, FnvOffsetBasis>::const_iterator StaticChdHashMap<TValue, N, FnvOffsetBasis>::begin() const noexcept
+	{
+		return m_entries.begin();
+	}
+
+	template <typename TValue, size_t N, uint32_t FnvOffsetBasis>
+	constexpr typename StaticChdHashMap<TValue, N, FnvOffsetBasis>::const_iterator StaticChdHashMap<TValue, N, FnvOffsetBasis>::end() const noexcept
+	{
+		return m_entries.end();
+	}
+
+	//---------------------------
+	// Hashing
+	//---------------------------
+
+	template <typename TValue, size_t N, uint32_t FnvOffsetBasis>
+	NFX_META_INLINE constexpr uint32_t StaticChdHashMap<TValue, N, FnvOffsetBasis>::hash( std::string_view key ) noexcept
+	{
+		uint32_t hashValue{ FnvOffsetBasis };
+		for ( const char c : key )
+		{
+			hashValue ^= static_cast<uint8_t>( c );
+			hashValue *= core::hashing::constants::DEFAULT_FNV_PRIME;
+		}
+
+		return hashValue;
+	}
+
+	//----------------------------------------------
+	// Exception classes
+	//----------------------------------------------
+
+	template <typename TValue, size_t N, uint32_t FnvOffsetBasis>
+	inline StaticChdHashMap<TValue, N, FnvOffsetBasis>::KeyNotFoundException::KeyNotFoundException( std::string_view key )
+		: std::runtime_error{ std::string{ "No value associated to key: " } + std::string{ key } }
+	{
+	}
+
+	//----------------------------------------------
+	// Private lookup helpers
+	//----------------------------------------------
+
+	template <typename TValue, size_t N, uint32_t FnvOffsetBasis>
+	NFX_META_INLINE constexpr uint32_t StaticChdHashMap<TValue, N, FnvOffsetBasis>::entryIndex( std::string_view key ) const noexcept
+	{
+		// Same resolution as ChdHashMap::entryIndex(); SLOT_COUNT is a constant, so masks fold away
+		const uint32_t hashValue{ hash( key ) };
+		const uint16_t seed{ m_seeds[hashValue & ( SLOT_COUNT - 1 )] };
+		const uint32_t entry{ m_slots[core::hashing::seedMix( seed, hashValue, SLOT_COUNT )] };
+
+		if ( entry != EMPTY_SLOT && m_entries[entry].first == key )
+		{
+			return entry;
+		}
+
+		return EMPTY_SLOT;
+	}
+
+	//=====================================================================
+	// Factory
+	//=====================================================================
+
+	template <typename TValue, uint32_t FnvOffsetBasis, size_t N>
+	consteval StaticChdHashMap<TValue, N, FnvOffsetBasis> makeStaticChdHashMap(
+		const std::pair<std::string_view, TValue> ( &items )[N], uint32_t maxSeedSearchMultiplier )
+	{
+		return StaticChdHashMap<TValue, N, FnvOffsetBasis>{ items, maxSeedSearchMultiplier };
+	}
+} // namespace nfx::containers
@@ -0,0 +1,124 @@
+/**
+ * @file StringArena.inl
+ * @brief Implementation file for StringArena append-only string storage
+ * @details Contains the inline function implementations for block allocation,
+ *          string copying and arena release
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// StringArena class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	NFX_META_INLINE StringArena::StringArena() = default;
+
+	NFX_META_INLINE StringArena::StringArena( size_t blockSize )
+		: m_blockSize{ std::max( blockSize, size_t{ 1 } ) }
+	{
+	}
+
+	NFX_META_INLINE StringArena::StringArena( StringArena&& other ) noexcept
+		: m_blocks{ std::move( other.m_blocks ) },
+		  m_cursor{ std::exchange( other.m_cursor, nullptr ) },
+		  m_remaining{ std::exchange( other.m_remaining, 0 ) },
+		  m_blockSize{ other.m_blockSize },
+		  m_bytesUsed{ std::exchange( other.m_bytesUsed, 0 ) },
+		  m_bytesReserved{ std::exchange( other.m_bytesReserved, 0 ) }
+	{
+		other.m_blocks.clear();
+	}
+
+	NFX_META_INLINE StringArena& StringArena::operator=( StringArena&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			m_blocks = std::move( other.m_blocks );
+			other.m_blocks.clear();
+			m_cursor = std::exchange( other.m_cursor, nullptr );
+			m_remaining = std::exchange( other.m_remaining, 0 );
+			m_blockSize = other.m_blockSize;
+			m_bytesUsed = std::exchange( other.m_bytesUsed, 0 );
+			m_bytesReserved = std::exchange( other.m_bytesReserved, 0 );
+		}
+
+		return *this;
+	}
+
+	//----------------------------------------------
+	// Storage
+	//----------------------------------------------
+
+	NFX_META_INLINE std::string_view StringArena::store( std::string_view str )
+	{
+		const size_t size{ str.size() };
+		if ( size == 0 )
+		{
+			return {};
+		}
+
+		if ( size > m_remaining )
+		{
+			if ( size > m_blockSize / 4 )
+			{
+				// Oversized: a dedicated block keeps the tail of the current block usable
+				m_blocks.push_back( std::make_unique_for_overwrite<char[]>( size ) );
+				char* dedicated{ m_blocks.back().get() };
+				std::memcpy( dedicated, str.data(), size );
+
+				m_bytesReserved += size;
+				m_bytesUsed += size;
+				return { dedicated, size };
+			}
+
+			m_blocks.push_back( std::make_unique_for_overwrite<char[]>( m_blockSize ) );
+			m_cursor = m_blocks.back().get();
+			m_remaining = m_blockSize;
+			m_bytesReserved += m_blockSize;
+		}
+
+		char* stored{ m_cursor };
+		std::memcpy( stored, str.data(), size );
+		m_cursor += size;
+		m_remaining -= size;
+		m_bytesUsed += size;
+
+		return { stored, size };
+	}
+
+	NFX_META_INLINE void StringArena::clear() noexcept
+	{
+		m_blocks.clear();
+		m_cursor = nullptr;
+		m_remaining = 0;
+		m_bytesUsed = 0;
+		m_bytesReserved = 0;
+	}
+
+	//----------------------------------------------
+	// State inspection
+	//----------------------------------------------
+
+	NFX_META_INLINE size_t StringArena::bytesUsed() const noexcept
+	{
+		return m_bytesUsed;
+	}
+
+	NFX_META_INLINE size_t StringArena::bytesReserved() const noexcept
+	{
+		return m_bytesReserved;
+	}
+
+	NFX_META_INLINE size_t StringArena::blockSize() const noexcept
+	{
+		return m_blockSize;
+	}
+} // namespace nfx::containers
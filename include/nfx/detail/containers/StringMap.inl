@@ -17,20 +17,20 @@ namespace nfx::containers
 	// Heterogeneous operator[] overloads
 	//----------------------------------------------
 
-	template <typename T>
-	NFX_META_INLINE T& StringMap<T>::operator[]( const char* key ) noexcept
+	template <typename T, typename Allocator, typename Hash>
+	NFX_META_INLINE T& StringMap<T, Allocator, Hash>::operator[]( const char* key ) noexcept
 	{
 		return ( *this )[std::string_view{ key }];
 	}
 
-	template <typename T>
-	NFX_META_INLINE T& StringMap<T>::operator[]( char* key ) noexcept
+	template <typename T, typename Allocator, typename Hash>
+	NFX_META_INLINE T& StringMap<T, Allocator, Hash>::operator[]( char* key ) noexcept
 	{
 		return ( *this )[std::string_view{ key }];
 	}
 
-	template <typename T>
-	NFX_META_INLINE T& StringMap<T>::operator[]( std::string_view key ) noexcept
+	template <typename T, typename Allocator, typename Hash>
+	NFX_META_INLINE T& StringMap<T, Allocator, Hash>::operator[]( std::string_view key ) noexcept
 	{
 		auto it = this->find( key );
 		if ( it != this->end() )
@@ -38,39 +38,39 @@ namespace nfx::containers
 			return it->second;
 		}
 
-		return this->emplace( std::string{ key }, T{} ).first->second;
+		return this->emplace( KeyString( key, this->get_allocator() ), T{} ).first->second;
 	}
 
 	//----------------------------------------------
 	// Heterogeneous at() overloads
 	//----------------------------------------------
 
-	template <typename T>
-	NFX_META_INLINE const T& StringMap<T>::at( const char* key ) const
+	template <typename T, typename Allocator, typename Hash>
+	NFX_META_INLINE const T& StringMap<T, Allocator, Hash>::at( const char* key ) const
 	{
 		return this->at( std::string_view{ key } );
 	}
 
-	template <typename T>
-	NFX_META_INLINE T& StringMap<T>::at( const char* key )
+	template <typename T, typename Allocator, typename Hash>
+	NFX_META_INLINE T& StringMap<T, Allocator, Hash>::at( const char* key )
 	{
 		return this->at( std::string_view{ key } );
 	}
 
-	template <typename T>
-	NFX_META_INLINE const T& StringMap<T>::at( char* key ) const
+	template <typename T, typename Allocator, typename Hash>
+	NFX_META_INLINE const T& StringMap<T, Allocator, Hash>::at( char* key ) const
 	{
 		return this->at( std::string_view{ key } );
 	}
 
-	template <typename T>
-	NFX_META_INLINE T& StringMap<T>::at( char* key )
+	template <typename T, typename Allocator, typename Hash>
+	NFX_META_INLINE T& StringMap<T, Allocator, Hash>::at( char* key )
 	{
 		return this->at( std::string_view{ key } );
 	}
 
-	template <typename T>
-	NFX_META_INLINE const T& StringMap<T>::at( std::string_view key ) const
+	template <typename T, typename Allocator, typename Hash>
+	NFX_META_INLINE const T& StringMap<T, Allocator, Hash>::at( std::string_view key ) const
 	{
 		auto it = this->find( key );
 		if ( it == this->end() )
@@ -80,8 +80,8 @@ namespace nfx::containers
 		return it->second;
 	}
 
-	template <typename T>
-	NFX_META_INLINE T& StringMap<T>::at( std::string_view key )
+	template <typename T, typename Allocator, typename Hash>
+	NFX_META_INLINE T& StringMap<T, Allocator, Hash>::at( std::string_view key )
 	{
 		auto it = this->find( key );
 		if ( it == this->end() )
@@ -95,55 +95,55 @@ namespace nfx::containers
 	// Heterogeneous try_emplace overloads
 	//----------------------------------------------
 
-	template <typename T>
+	template <typename T, typename Allocator, typename Hash>
 	template <typename... Args>
-	NFX_META_INLINE std::pair<typename StringMap<T>::Base::iterator, bool> StringMap<T>::try_emplace( const char* key, Args&&... args ) noexcept(
+	NFX_META_INLINE std::pair<typename StringMap<T, Allocator, Hash>::Base::iterator, bool> StringMap<T, Allocator, Hash>::try_emplace( const char* key, Args&&... args ) noexcept(
 		std::is_nothrow_constructible_v<T, Args...> )
 	{
-		return Base::try_emplace( std::string{ key }, std::forward<Args>( args )... );
+		return Base::try_emplace( KeyString( key, this->get_allocator() ), std::forward<Args>( args )... );
 	}
 
-	template <typename T>
+	template <typename T, typename Allocator, typename Hash>
 	template <typename... Args>
-	NFX_META_INLINE std::pair<typename StringMap<T>::Base::iterator, bool> StringMap<T>::try_emplace( char* key, Args&&... args ) noexcept(
+	NFX_META_INLINE std::pair<typename StringMap<T, Allocator, Hash>::Base::iterator, bool> StringMap<T, Allocator, Hash>::try_emplace( char* key, Args&&... args ) noexcept(
 		std::is_nothrow_constructible_v<T, Args...> )
 	{
-		return Base::try_emplace( std::string{ key }, std::forward<Args>( args )... );
+		return Base::try_emplace( KeyString( key, this->get_allocator() ), std::forward<Args>( args )... );
 	}
 
-	template <typename T>
+	template <typename T, typename Allocator, typename Hash>
 	template <typename... Args>
-	NFX_META_INLINE std::pair<typename StringMap<T>::Base::iterator, bool> StringMap<T>::try_emplace( std::string_view key, Args&&... args ) noexcept(
+	NFX_META_INLINE std::pair<typename StringMap<T, Allocator, Hash>::Base::iterator, bool> StringMap<T, Allocator, Hash>::try_emplace( std::string_view key, Args&&... args ) noexcept(
 		std::is_nothrow_constructible_v<T, Args...> )
 	{
-		return Base::try_emplace( std::string{ key }, std::forward<Args>( args )... );
+		return Base::try_emplace( KeyString( key, this->get_allocator() ), std::forward<Args>( args )... );
 	}
 
 	//----------------------------------------------
 	// Heterogeneous insert_or_assign overloads
 	//----------------------------------------------
 
-	template <typename T>
+	template <typename T, typename Allocator, typename Hash>
 	template <typename M>
-	NFX_META_INLINE std::pair<typename StringMap<T>::Base::iterator, bool> StringMap<T>::insert_or_assign( const char* key, M&& obj ) noexcept(
+	NFX_META_INLINE std::pair<typename StringMap<T, Allocator, Hash>::Base::iterator, bool> StringMap<T, Allocator, Hash>::insert_or_assign( const char* key, M&& obj ) noexcept(
 		std::is_nothrow_assignable_v<T&, M> && std::is_nothrow_constructible_v<T, M> )
 	{
-		return Base::insert_or_assign( std::string{ key }, std::forward<M>( obj ) );
+		return Base::insert_or_assign( KeyString( key, this->get_allocator() ), std::forward<M>( obj ) );
 	}
 
-	template <typename T>
+	template <typename T, typename Allocator, typename Hash>
 	template <typename M>
-	NFX_META_INLINE std::pair<typename StringMap<T>::Base::iterator, bool> StringMap<T>::insert_or_assign( char* key, M&& obj ) noexcept(
+	NFX_META_INLINE std::pair<typename StringMap<T, Allocator, Hash>::Base::iterator, bool> StringMap<T, Allocator, Hash>::insert_or_assign( char* key, M&& obj ) noexcept(
 		std::is_nothrow_assignable_v<T&, M> && std::is_nothrow_constructible_v<T, M> )
 	{
-		return Base::insert_or_assign( std::string{ key }, std::forward<M>( obj ) );
+		return Base::insert_or_assign( KeyString( key, this->get_allocator() ), std::forward<M>( obj ) );
 	}
 
-	template <typename T>
+	template <typename T, typename Allocator, typename Hash>
 	template <typename M>
-	NFX_META_INLINE std::pair<typename StringMap<T>::Base::iterator, bool> StringMap<T>::insert_or_assign( std::string_view key, M&& obj ) noexcept(
+	NFX_META_INLINE std::pair<typename StringMap<T, Allocator, Hash>::Base::iterator, bool> StringMap<T, Allocator, Hash>::insert_or_assign( std::string_view key, M&& obj ) noexcept(
 		std::is_nothrow_assignable_v<T&, M> && std::is_nothrow_constructible_v<T, M> )
 	{
-		return Base::insert_or_assign( std::string{ key }, std::forward<M>( obj ) );
+		return Base::insert_or_assign( KeyString( key, this->get_allocator() ), std::forward<M>( obj ) );
 	}
 } // namespace nfx::containers
@@ -1,7 +1,7 @@
 /**
  * @file StringSet.inl
  * @brief Template implementations for StringSet heterogeneous lookup container
- * @details Contains the inline function implementations for zero-copy string operations
+ * @details Contains the template function implementations for zero-copy string operations
  *          and heterogeneous key support in StringSet
  */
 
@@ -15,60 +15,70 @@ namespace nfx::containers
 	// Heterogeneous insert overloads
 	//----------------------------------------------
 
-	NFX_META_INLINE std::pair<typename StringSet::Base::iterator, bool> StringSet::insert( const char* key )
+	template <typename Allocator>
+	NFX_META_INLINE std::pair<typename BasicStringSet<Allocator>::Base::iterator, bool> BasicStringSet<Allocator>::insert( const char* key )
 	{
 		return this->insert( std::string_view{ key } );
 	}
 
-	NFX_META_INLINE std::pair<typename StringSet::Base::iterator, bool> StringSet::insert( char* key )
+	template <typename Allocator>
+	NFX_META_INLINE std::pair<typename BasicStringSet<Allocator>::Base::iterator, bool> BasicStringSet<Allocator>::insert( char* key )
 	{
 		return this->insert( std::string_view{ key } );
 	}
 
-	NFX_META_INLINE std::pair<typename StringSet::Base::iterator, bool> StringSet::insert( std::string_view key )
+	template <typename Allocator>
+	NFX_META_INLINE std::pair<typename BasicStringSet<Allocator>::Base::iterator, bool> BasicStringSet<Allocator>::insert( std::string_view key )
 	{
-		return Base::insert( std::string{ key } );
+		return Base::insert( KeyString( key, this->get_allocator() ) );
 	}
 
 	//----------------------------------------------
 	// Heterogeneous emplace overloads
 	//----------------------------------------------
 
-	NFX_META_INLINE std::pair<typename StringSet::Base::iterator, bool> StringSet::emplace( const char* key )
+	template <typename Allocator>
+	NFX_META_INLINE std::pair<typename BasicStringSet<Allocator>::Base::iterator, bool> BasicStringSet<Allocator>::emplace( const char* key )
 	{
 		return this->emplace( std::string_view{ key } );
 	}
 
-	NFX_META_INLINE std::pair<typename StringSet::Base::iterator, bool> StringSet::emplace( char* key )
+	template <typename Allocator>
+	NFX_META_INLINE std::pair<typename BasicStringSet<Allocator>::Base::iterator, bool> BasicStringSet<Allocator>::emplace( char* key )
 	{
 		return this->emplace( std::string_view{ key } );
 	}
 
-	NFX_META_INLINE std::pair<typename StringSet::Base::iterator, bool> StringSet::emplace( std::string_view key )
+	template <typename Allocator>
+	NFX_META_INLINE std::pair<typename BasicStringSet<Allocator>::Base::iterator, bool> BasicStringSet<Allocator>::emplace( std::string_view key )
 	{
-		return Base::emplace( std::string{ key } );
+		return Base::emplace( KeyString( key, this->get_allocator() ) );
 	}
 
 	//----------------------------------------------
 	// C++20-style contains() method
 	//----------------------------------------------
 
-	NFX_META_INLINE bool StringSet::contains( const char* key ) const noexcept
+	template <typename Allocator>
+	NFX_META_INLINE bool BasicStringSet<Allocator>::contains( const char* key ) const noexcept
 	{
 		return this->contains( std::string_view{ key } );
 	}
 
-	NFX_META_INLINE bool StringSet::contains( char* key ) const noexcept
+	template <typename Allocator>
+	NFX_META_INLINE bool BasicStringSet<Allocator>::contains( char* key ) const noexcept
 	{
 		return this->contains( std::string_view{ key } );
 	}
 
-	NFX_META_INLINE bool StringSet::contains( const std::string& key ) const noexcept
+	template <typename Allocator>
+	NFX_META_INLINE bool BasicStringSet<Allocator>::contains( const std::string& key ) const noexcept
 	{
 		return this->contains( std::string_view{ key } );
 	}
 
-	NFX_META_INLINE bool StringSet::contains( std::string_view key ) const noexcept
+	template <typename Allocator>
+	NFX_META_INLINE bool BasicStringSet<Allocator>::contains( std::string_view key ) const noexcept
 	{
 		return this->find( key ) != this->end();
 	}
@@ -25,31 +25,31 @@ namespace nfx::containers
 	// String hashing
 	//----------------------------------------------
 
-	template <uint32_t FnvOffsetBasis>
-	NFX_META_INLINE size_t HashMapHash<FnvOffsetBasis>::operator()( const char* s ) const noexcept
+	template <uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE size_t HashMapHash<FnvOffsetBasis, FnvPrime>::operator()( const char* s ) const noexcept
 	{
-		return static_cast<size_t>( core::hashing::hashStringView<FnvOffsetBasis>( std::string_view{ s } ) );
+		return static_cast<size_t>( core::hashing::hashStringView<FnvOffsetBasis, FnvPrime>( std::string_view{ s } ) );
 	}
 
-	template <uint32_t FnvOffsetBasis>
-	NFX_META_INLINE size_t HashMapHash<FnvOffsetBasis>::operator()( const std::string& s ) const noexcept
+	template <uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE size_t HashMapHash<FnvOffsetBasis, FnvPrime>::operator()( const std::string& s ) const noexcept
 	{
-		return static_cast<size_t>( core::hashing::hashStringView<FnvOffsetBasis>( std::string_view{ s.data(), s.size() } ) );
+		return static_cast<size_t>( core::hashing::hashStringView<FnvOffsetBasis, FnvPrime>( std::string_view{ s.data(), s.size() } ) );
 	}
 
-	template <uint32_t FnvOffsetBasis>
-	NFX_META_INLINE size_t HashMapHash<FnvOffsetBasis>::operator()( std::string_view sv ) const noexcept
+	template <uint32_t FnvOffsetBasis, uint32_t FnvPrime>
+	NFX_META_INLINE size_t HashMapHash<FnvOffsetBasis, FnvPrime>::operator()( std::string_view sv ) const noexcept
 	{
-		return static_cast<size_t>( core::hashing::hashStringView<FnvOffsetBasis>( sv ) );
+		return static_cast<size_t>( core::hashing::hashStringView<FnvOffsetBasis, FnvPrime>( sv ) );
 	}
 
 	//----------------------------------------------
 	// Integer hashing (proper mixing)
 	//----------------------------------------------
 
-	template <uint32_t FnvOffsetBasis>
+	template <uint32_t FnvOffsetBasis, uint32_t FnvPrime>
 	template <typename T>
-	NFX_META_INLINE std::enable_if_t<std::is_integral_v<T>, size_t> HashMapHash<FnvOffsetBasis>::operator()( T value ) const noexcept
+	NFX_META_INLINE std::enable_if_t<std::is_integral_v<T>, size_t> HashMapHash<FnvOffsetBasis, FnvPrime>::operator()( T value ) const noexcept
 	{
 		return core::hashing::hashInteger( value );
 	}
@@ -58,15 +58,13 @@ namespace nfx::containers
 	// Fallback to std::hash for other types
 	//----------------------------------------------
 
-	template <uint32_t FnvOffsetBasis>
+	template <uint32_t FnvOffsetBasis, uint32_t FnvPrime>
 	template <typename T>
 	NFX_META_INLINE std::enable_if_t<
 		!std::is_integral_v<T> &&
-			!std::is_same_v<T, std::string> &&
-			!std::is_same_v<T, std::string_view> &&
-			!std::is_same_v<T, const char*>,
+			!std::is_convertible_v<const T&, std::string_view>,
 		size_t>
-	HashMapHash<FnvOffsetBasis>::operator()( const T& value ) const noexcept
+	HashMapHash<FnvOffsetBasis, FnvPrime>::operator()( const T& value ) const noexcept
 	{
 		// Delegate to standard library for types we don't optimize
 		return std::hash<T>{}( value );
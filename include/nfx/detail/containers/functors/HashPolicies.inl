@@ -0,0 +1,729 @@
+/**
+ * @file HashPolicies.inl
+ * @brief Implementation of the alternative string hash policies for HashMap
+ * @details Contains the wyhash, XXH3-64, hardware CRC32-C and keyed SipHash-1-3 string
+ *          algorithms, the HashPolicy functor forwarding to them and the seeded SipHash13 functor
+ */
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string_view>
+#include <type_traits>
+
+#if NFX_META_HAS_HW_CRC32
+#	if defined( __aarch64__ )
+#		include <arm_acle.h>
+#	elif defined( _MSC_VER )
+#		include <intrin.h>
+#	else
+#		include <nmmintrin.h>
+#	endif
+#endif
+
+namespace nfx::containers
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Shared primitives
+		//=====================================================================
+
+		namespace hashing
+		{
+			/** @brief Reverse the bytes of a 64-bit word */
+			NFX_META_INLINE constexpr std::uint64_t byteSwap64( std::uint64_t v ) noexcept
+			{
+				v = ( ( v & 0x00FF00FF00FF00FFull ) << 8 ) | ( ( v >> 8 ) & 0x00FF00FF00FF00FFull );
+				v = ( ( v & 0x0000FFFF0000FFFFull ) << 16 ) | ( ( v >> 16 ) & 0x0000FFFF0000FFFFull );
+				return ( v << 32 ) | ( v >> 32 );
+			}
+
+			/** @brief Reverse the bytes of a 32-bit word */
+			NFX_META_INLINE constexpr std::uint32_t byteSwap32( std::uint32_t v ) noexcept
+			{
+				return ( ( v & 0x000000FFu ) << 24 ) | ( ( v & 0x0000FF00u ) << 8 ) | ( ( v >> 8 ) & 0x0000FF00u ) | ( v >> 24 );
+			}
+
+			/** @brief Unaligned little-endian 64-bit read */
+			NFX_META_INLINE std::uint64_t read64( const char* p ) noexcept
+			{
+				std::uint64_t v;
+				std::memcpy( &v, p, sizeof( v ) );
+				if constexpr ( std::endian::native == std::endian::big )
+				{
+					v = byteSwap64( v );
+				}
+				return v;
+			}
+
+			/** @brief Unaligned little-endian 32-bit read */
+			NFX_META_INLINE std::uint32_t read32( const char* p ) noexcept
+			{
+				std::uint32_t v;
+				std::memcpy( &v, p, sizeof( v ) );
+				if constexpr ( std::endian::native == std::endian::big )
+				{
+					v = byteSwap32( v );
+				}
+				return v;
+			}
+
+			/** @brief Full 64x64→128 multiply, returning the low and high halves in place */
+			NFX_META_INLINE void multiply128( std::uint64_t& lo, std::uint64_t& hi ) noexcept
+			{
+#if NFX_META_HAS_INT128
+				const NFX_META_UINT128 product{ static_cast<NFX_META_UINT128>( lo ) * hi };
+				lo = static_cast<std::uint64_t>( product );
+				hi = static_cast<std::uint64_t>( product >> 64 );
+#elif defined( _MSC_VER ) && defined( _M_X64 )
+				lo = _umul128( lo, hi, &hi );
+#else
+				const std::uint64_t aLo{ lo & 0xFFFFFFFFull };
+				const std::uint64_t aHi{ lo >> 32 };
+				const std::uint64_t bLo{ hi & 0xFFFFFFFFull };
+				const std::uint64_t bHi{ hi >> 32 };
+				const std::uint64_t loLo{ aLo * bLo };
+				const std::uint64_t hiLo{ aHi * bLo };
+				const std::uint64_t loHi{ aLo * bHi };
+				const std::uint64_t cross{ ( loLo >> 32 ) + ( hiLo & 0xFFFFFFFFull ) + loHi };
+				hi = aHi * bHi + ( hiLo >> 32 ) + ( cross >> 32 );
+				lo = ( cross << 32 ) | ( loLo & 0xFFFFFFFFull );
+#endif
+			}
+
+			/** @brief 128-bit product folded to 64 bits by xoring its halves */
+			NFX_META_INLINE std::uint64_t multiplyFold64( std::uint64_t a, std::uint64_t b ) noexcept
+			{
+				multiply128( a, b );
+				return a ^ b;
+			}
+		} // namespace hashing
+
+		//=====================================================================
+		// WyHashAlgorithm
+		//=====================================================================
+
+		namespace wyhash
+		{
+			inline constexpr std::uint64_t SECRET[4]{
+				0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+			/** @brief Read 1-3 bytes as first, middle and last byte */
+			NFX_META_INLINE std::uint64_t read3( const char* p, size_t k ) noexcept
+			{
+				return ( static_cast<std::uint64_t>( static_cast<unsigned char>( p[0] ) ) << 16 ) |
+					   ( static_cast<std::uint64_t>( static_cast<unsigned char>( p[k >> 1] ) ) << 8 ) |
+					   static_cast<unsigned char>( p[k - 1] );
+			}
+		} // namespace wyhash
+
+		NFX_META_INLINE std::uint64_t WyHashAlgorithm::hash( const char* data, size_t size ) noexcept
+		{
+			using namespace hashing;
+			const std::uint64_t* secret{ wyhash::SECRET };
+
+			const char* p{ data };
+			std::uint64_t seed{ multiplyFold64( secret[0], secret[1] ) };
+			std::uint64_t a;
+			std::uint64_t b;
+
+			if ( size <= 16 )
+			{
+				if ( size >= 4 )
+				{
+					const size_t mid{ ( size >> 3 ) << 2 };
+					a = ( static_cast<std::uint64_t>( read32( p ) ) << 32 ) | read32( p + mid );
+					b = ( static_cast<std::uint64_t>( read32( p + size - 4 ) ) << 32 ) | read32( p + size - 4 - mid );
+				}
+				else if ( size > 0 )
+				{
+					a = wyhash::read3( p, size );
+					b = 0;
+				}
+				else
+				{
+					a = b = 0;
+				}
+			}
+			else
+			{
+				size_t i{ size };
+				if ( i >= 48 )
+				{
+					std::uint64_t see1{ seed };
+					std::uint64_t see2{ seed };
+					do
+					{
+						seed = multiplyFold64( read64( p ) ^ secret[1], read64( p + 8 ) ^ seed );
+						see1 = multiplyFold64( read64( p + 16 ) ^ secret[2], read64( p + 24 ) ^ see1 );
+						see2 = multiplyFold64( read64( p + 32 ) ^ secret[3], read64( p + 40 ) ^ see2 );
+						p += 48;
+						i -= 48;
+					} while ( i >= 48 );
+					seed ^= see1 ^ see2;
+				}
+				while ( i > 16 )
+				{
+					seed = multiplyFold64( read64( p ) ^ secret[1], read64( p + 8 ) ^ seed );
+					i -= 16;
+					p += 16;
+				}
+				a = read64( p + i - 16 );
+				b = read64( p + i - 8 );
+			}
+
+			a ^= secret[1];
+			b ^= seed;
+			multiply128( a, b );
+
+			return multiplyFold64( a ^ secret[0] ^ size, b ^ secret[1] );
+		}
+
+		//=====================================================================
+		// Xxh3Algorithm
+		//=====================================================================
+
+		namespace xxh3
+		{
+			inline constexpr std::uint64_t PRIME32_1{ 0x9E3779B1u };
+			inline constexpr std::uint64_t PRIME32_2{ 0x85EBCA77u };
+			inline constexpr std::uint64_t PRIME32_3{ 0xC2B2AE3Du };
+			inline constexpr std::uint64_t PRIME64_1{ 0x9E3779B185EBCA87ull };
+			inline constexpr std::uint64_t PRIME64_2{ 0xC2B2AE3D27D4EB4Full };
+			inline constexpr std::uint64_t PRIME64_3{ 0x165667B19E3779F9ull };
+			inline constexpr std::uint64_t PRIME64_4{ 0x85EBCA77C2B2AE63ull };
+			inline constexpr std::uint64_t PRIME64_5{ 0x27D4EB2F165667C5ull };
+
+			inline constexpr size_t SECRET_SIZE{ 192 };
+			inline constexpr size_t STRIPE_SIZE{ 64 };
+			inline constexpr size_t STRIPES_PER_BLOCK{ ( SECRET_SIZE - STRIPE_SIZE ) / 8 };
+			inline constexpr size_t BLOCK_SIZE{ STRIPE_SIZE * STRIPES_PER_BLOCK };
+
+			alignas( 64 ) inline constexpr unsigned char SECRET[SECRET_SIZE]{
+				0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+				0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+				0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+				0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+				0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+				0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+				0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+				0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+				0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+				0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+				0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+				0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e };
+
+			/** @brief Secret bytes as the const char* every reader takes */
+			NFX_META_INLINE const char* secret( size_t offset ) noexcept
+			{
+				return reinterpret_cast<const char*>( SECRET ) + offset;
+			}
+
+			NFX_META_INLINE std::uint64_t avalanche( std::uint64_t h ) noexcept
+			{
+				h ^= h >> 37;
+				h *= 0x165667919E3779F9ull;
+				return h ^ ( h >> 32 );
+			}
+
+			NFX_META_INLINE std::uint64_t avalancheXxh64( std::uint64_t h ) noexcept
+			{
+				h ^= h >> 33;
+				h *= PRIME64_2;
+				h ^= h >> 29;
+				h *= PRIME64_3;
+				return h ^ ( h >> 32 );
+			}
+
+			NFX_META_INLINE std::uint64_t rrmxmx( std::uint64_t h, size_t size ) noexcept
+			{
+				h ^= std::rotl( h, 49 ) ^ std::rotl( h, 24 );
+				h *= 0x9FB21C651E98DF25ull;
+				h ^= ( h >> 35 ) + size;
+				h *= 0x9FB21C651E98DF25ull;
+				return h ^ ( h >> 28 );
+			}
+
+			NFX_META_INLINE std::uint64_t mix16( const char* p, size_t secretOffset ) noexcept
+			{
+				using namespace hashing;
+				return multiplyFold64( read64( p ) ^ read64( secret( secretOffset ) ), read64( p + 8 ) ^ read64( secret( secretOffset + 8 ) ) );
+			}
+
+			NFX_META_INLINE void accumulateStripe( std::uint64_t* acc, const char* p, const char* key ) noexcept
+			{
+#if defined( __AVX2__ )
+				// Same lane arithmetic as the scalar loop, four lanes per instruction
+				for ( size_t i = 0; i < 2; ++i )
+				{
+					const __m256i data{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( p + 32 * i ) ) };
+					const __m256i keyed{ _mm256_xor_si256( data, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( key + 32 * i ) ) ) };
+					const __m256i product{ _mm256_mul_epu32( keyed, _mm256_shuffle_epi32( keyed, _MM_SHUFFLE( 0, 3, 0, 1 ) ) ) };
+					const __m256i swapped{ _mm256_shuffle_epi32( data, _MM_SHUFFLE( 1, 0, 3, 2 ) ) };
+					__m256i* lanes{ reinterpret_cast<__m256i*>( acc + 4 * i ) };
+					_mm256_store_si256( lanes, _mm256_add_epi64( product, _mm256_add_epi64( _mm256_load_si256( lanes ), swapped ) ) );
+				}
+#elif defined( __SSE2__ ) || defined( _M_X64 )
+				// Same lane arithmetic as the scalar loop, two lanes per instruction
+				for ( size_t i = 0; i < 4; ++i )
+				{
+					const __m128i data{ _mm_loadu_si128( reinterpret_cast<const __m128i*>( p + 16 * i ) ) };
+					const __m128i keyed{ _mm_xor_si128( data, _mm_loadu_si128( reinterpret_cast<const __m128i*>( key + 16 * i ) ) ) };
+					const __m128i product{ _mm_mul_epu32( keyed, _mm_shuffle_epi32( keyed, _MM_SHUFFLE( 0, 3, 0, 1 ) ) ) };
+					const __m128i swapped{ _mm_shuffle_epi32( data, _MM_SHUFFLE( 1, 0, 3, 2 ) ) };
+					__m128i* lanes{ reinterpret_cast<__m128i*>( acc + 2 * i ) };
+					_mm_store_si128( lanes, _mm_add_epi64( product, _mm_add_epi64( _mm_load_si128( lanes ), swapped ) ) );
+				}
+#else
+				using namespace hashing;
+				for ( size_t i = 0; i < 8; ++i )
+				{
+					const std::uint64_t value{ read64( p + 8 * i ) };
+					const std::uint64_t keyed{ value ^ read64( key + 8 * i ) };
+					acc[i ^ 1] += value;
+					acc[i] += ( keyed & 0xFFFFFFFFull ) * ( keyed >> 32 );
+				}
+#endif
+			}
+
+			NFX_META_INLINE void scramble( std::uint64_t* acc ) noexcept
+			{
+#if defined( __SSE2__ ) || defined( _M_X64 )
+				const __m128i prime{ _mm_set1_epi32( static_cast<int>( PRIME32_1 ) ) };
+				for ( size_t i = 0; i < 4; ++i )
+				{
+					__m128i* lanes{ reinterpret_cast<__m128i*>( acc + 2 * i ) };
+					__m128i a{ _mm_load_si128( lanes ) };
+					a = _mm_xor_si128( a, _mm_srli_epi64( a, 47 ) );
+					a = _mm_xor_si128( a, _mm_loadu_si128( reinterpret_cast<const __m128i*>( secret( SECRET_SIZE - STRIPE_SIZE + 16 * i ) ) ) );
+					const __m128i productLo{ _mm_mul_epu32( a, prime ) };
+					const __m128i productHi{ _mm_mul_epu32( _mm_shuffle_epi32( a, _MM_SHUFFLE( 0, 3, 0, 1 ) ), prime ) };
+					_mm_store_si128( lanes, _mm_add_epi64( productLo, _mm_slli_epi64( productHi, 32 ) ) );
+				}
+#else
+				using namespace hashing;
+				for ( size_t i = 0; i < 8; ++i )
+				{
+					std::uint64_t a{ acc[i] };
+					a ^= a >> 47;
+					a ^= read64( secret( SECRET_SIZE - STRIPE_SIZE + 8 * i ) );
+					acc[i] = a * PRIME32_1;
+				}
+#endif
+			}
+
+			/** @brief Inputs longer than 240 bytes: 8-lane stripe accumulation with per-block scrambling */
+			inline std::uint64_t hashLong( const char* p, size_t size ) noexcept
+			{
+				alignas( 32 ) std::uint64_t acc[8]{ PRIME32_3, PRIME64_1, PRIME64_2, PRIME64_3, PRIME64_4, PRIME32_2, PRIME64_5, PRIME32_1 };
+
+				const size_t blocks{ ( size - 1 ) / BLOCK_SIZE };
+				for ( size_t n = 0; n < blocks; ++n )
+				{
+					for ( size_t s = 0; s < STRIPES_PER_BLOCK; ++s )
+					{
+						accumulateStripe( acc, p + n * BLOCK_SIZE + s * STRIPE_SIZE, secret( s * 8 ) );
+					}
+					scramble( acc );
+				}
+
+				const size_t stripes{ ( ( size - 1 ) - BLOCK_SIZE * blocks ) / STRIPE_SIZE };
+				for ( size_t s = 0; s < stripes; ++s )
+				{
+					accumulateStripe( acc, p + blocks * BLOCK_SIZE + s * STRIPE_SIZE, secret( s * 8 ) );
+				}
+				accumulateStripe( acc, p + size - STRIPE_SIZE, secret( SECRET_SIZE - STRIPE_SIZE - 7 ) );
+
+				using namespace hashing;
+				std::uint64_t result{ size * PRIME64_1 };
+				for ( size_t i = 0; i < 4; ++i )
+				{
+					result += multiplyFold64( acc[2 * i] ^ read64( secret( 11 + 16 * i ) ), acc[2 * i + 1] ^ read64( secret( 11 + 16 * i + 8 ) ) );
+				}
+
+				return avalanche( result );
+			}
+		} // namespace xxh3
+
+		NFX_META_INLINE std::uint64_t Xxh3Algorithm::hash( const char* data, size_t size ) noexcept
+		{
+			using namespace hashing;
+			using namespace xxh3;
+
+			if ( size <= 16 )
+			{
+				if ( size > 8 )
+				{
+					const std::uint64_t lo{ read64( data ) ^ ( read64( secret( 24 ) ) ^ read64( secret( 32 ) ) ) };
+					const std::uint64_t hi{ read64( data + size - 8 ) ^ ( read64( secret( 40 ) ) ^ read64( secret( 48 ) ) ) };
+					return avalanche( size + byteSwap64( lo ) + hi + multiplyFold64( lo, hi ) );
+				}
+				if ( size >= 4 )
+				{
+					const std::uint64_t combined{ read32( data + size - 4 ) + ( static_cast<std::uint64_t>( read32( data ) ) << 32 ) };
+					return rrmxmx( combined ^ ( read64( secret( 8 ) ) ^ read64( secret( 16 ) ) ), size );
+				}
+				if ( size > 0 )
+				{
+					const std::uint32_t combined{ ( static_cast<std::uint32_t>( static_cast<unsigned char>( data[0] ) ) << 16 ) |
+												  ( static_cast<std::uint32_t>( static_cast<unsigned char>( data[size >> 1] ) ) << 24 ) |
+												  static_cast<unsigned char>( data[size - 1] ) |
+												  ( static_cast<std::uint32_t>( size ) << 8 ) };
+					const std::uint64_t flip{ static_cast<std::uint64_t>( read32( secret( 0 ) ) ^ read32( secret( 4 ) ) ) };
+					return avalancheXxh64( combined ^ flip );
+				}
+				return avalancheXxh64( read64( secret( 56 ) ) ^ read64( secret( 64 ) ) );
+			}
+
+			if ( size <= 128 )
+			{
+				std::uint64_t acc{ size * PRIME64_1 };
+				if ( size > 32 )
+				{
+					if ( size > 64 )
+					{
+						if ( size > 96 )
+						{
+							acc += mix16( data + 48, 96 );
+							acc += mix16( data + size - 64, 112 );
+						}
+						acc += mix16( data + 32, 64 );
+						acc += mix16( data + size - 48, 80 );
+					}
+					acc += mix16( data + 16, 32 );
+					acc += mix16( data + size - 32, 48 );
+				}
+				acc += mix16( data, 0 );
+				acc += mix16( data + size - 16, 16 );
+				return avalanche( acc );
+			}
+
+			if ( size <= 240 )
+			{
+				std::uint64_t acc{ size * PRIME64_1 };
+				for ( size_t i = 0; i < 8; ++i )
+				{
+					acc += mix16( data + 16 * i, 16 * i );
+				}
+				acc = avalanche( acc );
+
+				const size_t rounds{ size / 16 };
+				for ( size_t i = 8; i < rounds; ++i )
+				{
+					acc += mix16( data + 16 * i, 16 * ( i - 8 ) + 3 );
+				}
+				acc += mix16( data + size - 16, 136 - 17 );
+				return avalanche( acc );
+			}
+
+			return hashLong( data, size );
+		}
+
+		//=====================================================================
+		// Crc32Algorithm
+		//=====================================================================
+
+#if NFX_META_HAS_HW_CRC32
+		namespace crc32
+		{
+			NFX_META_INLINE std::uint32_t step( std::uint32_t crc, std::uint64_t value ) noexcept
+			{
+#	if defined( __aarch64__ )
+				return __crc32cd( crc, value );
+#	else
+				return static_cast<std::uint32_t>( _mm_crc32_u64( crc, value ) );
+#	endif
+			}
+		} // namespace crc32
+#endif
+
+		NFX_META_INLINE std::uint64_t Crc32Algorithm::hash( const char* data, size_t size ) noexcept
+		{
+#if NFX_META_HAS_HW_CRC32
+			using namespace hashing;
+
+			const char* p{ data };
+			size_t remaining{ size };
+			std::uint32_t crc{ 0xFFFFFFFFu };
+
+			if ( remaining >= 24 )
+			{
+				// Three independent dependency chains keep the CRC unit busy
+				std::uint32_t crc1{ 0x9E3779B9u };
+				std::uint32_t crc2{ 0x85EBCA6Bu };
+				do
+				{
+					crc = crc32::step( crc, read64( p ) );
+					crc1 = crc32::step( crc1, read64( p + 8 ) );
+					crc2 = crc32::step( crc2, read64( p + 16 ) );
+					p += 24;
+					remaining -= 24;
+				} while ( remaining >= 24 );
+
+				crc = crc32::step( crc, ( static_cast<std::uint64_t>( crc1 ) << 32 ) | crc2 );
+			}
+
+			while ( remaining >= 8 )
+			{
+				crc = crc32::step( crc, read64( p ) );
+				p += 8;
+				remaining -= 8;
+			}
+
+			if ( remaining > 0 )
+			{
+				std::uint64_t tail;
+				if ( size >= 8 )
+				{
+					// Overlapping read of the last 8 bytes
+					tail = read64( data + size - 8 );
+				}
+				else if ( remaining >= 4 )
+				{
+					tail = ( static_cast<std::uint64_t>( read32( p ) ) << 32 ) | read32( p + remaining - 4 );
+				}
+				else
+				{
+					tail = wyhash::read3( p, remaining );
+				}
+				crc = crc32::step( crc, tail ^ ( static_cast<std::uint64_t>( remaining ) << 56 ) );
+			}
+
+			// Length in the high half; the multiply spreads the CRC into it while keeping the low half bijective
+			return ( crc ^ ( static_cast<std::uint64_t>( size ) << 32 ) ) * 0x9E3779B97F4A7C15ull;
+#else
+			return WyHashAlgorithm::hash( data, size );
+#endif
+		}
+
+		//=====================================================================
+		// SipHash13Algorithm
+		//=====================================================================
+
+		namespace siphash
+		{
+			/** @brief One SipRound over the four state words */
+			NFX_META_INLINE void round( std::uint64_t& v0, std::uint64_t& v1, std::uint64_t& v2, std::uint64_t& v3 ) noexcept
+			{
+				v0 += v1;
+				v1 = std::rotl( v1, 13 );
+				v1 ^= v0;
+				v0 = std::rotl( v0, 32 );
+				v2 += v3;
+				v3 = std::rotl( v3, 16 );
+				v3 ^= v2;
+				v0 += v3;
+				v3 = std::rotl( v3, 21 );
+				v3 ^= v0;
+				v2 += v1;
+				v1 = std::rotl( v1, 17 );
+				v1 ^= v2;
+				v2 = std::rotl( v2, 32 );
+			}
+		} // namespace siphash
+
+		NFX_META_INLINE std::uint64_t SipHash13Algorithm::hash( const char* data, size_t size, std::uint64_t k0, std::uint64_t k1 ) noexcept
+		{
+			using namespace hashing;
+
+			std::uint64_t v0{ k0 ^ 0x736F6D6570736575ull };
+			std::uint64_t v1{ k1 ^ 0x646F72616E646F6Dull };
+			std::uint64_t v2{ k0 ^ 0x6C7967656E657261ull };
+			std::uint64_t v3{ k1 ^ 0x7465646279746573ull };
+
+			const char* p{ data };
+			const char* const end{ data + ( size & ~size_t{ 7 } ) };
+			for ( ; p != end; p += 8 )
+			{
+				const std::uint64_t m{ read64( p ) };
+				v3 ^= m;
+				siphash::round( v0, v1, v2, v3 );
+				v0 ^= m;
+			}
+
+			// Last block: remaining 0-7 bytes, little-endian, with the length in the top byte
+			std::uint64_t last{ static_cast<std::uint64_t>( size ) << 56 };
+			for ( size_t i = 0; i < ( size & 7 ); ++i )
+			{
+				last |= static_cast<std::uint64_t>( static_cast<unsigned char>( p[i] ) ) << ( 8 * i );
+			}
+			v3 ^= last;
+			siphash::round( v0, v1, v2, v3 );
+			v0 ^= last;
+
+			v2 ^= 0xFF;
+			siphash::round( v0, v1, v2, v3 );
+			siphash::round( v0, v1, v2, v3 );
+			siphash::round( v0, v1, v2, v3 );
+
+			return v0 ^ v1 ^ v2 ^ v3;
+		}
+
+		NFX_META_INLINE std::uint64_t SipHash13Algorithm::randomKey()
+		{
+			// One system call per process; later keys are SipHash of a counter under that secret,
+			// so learning one map's key reveals nothing about any other
+			struct Secret
+			{
+				std::uint64_t k0;
+				std::uint64_t k1;
+			};
+			static const Secret secret{ [] {
+				std::random_device device;
+				const auto draw{ [&device] { return ( static_cast<std::uint64_t>( device() ) << 32 ) | device(); } };
+				const std::uint64_t k0{ draw() };
+				return Secret{ k0, draw() };
+			}() };
+			static std::atomic<std::uint64_t> counter{ 0 };
+
+			const std::uint64_t n{ counter.fetch_add( 1, std::memory_order_relaxed ) };
+			char bytes[sizeof( n )];
+			std::memcpy( bytes, &n, sizeof( n ) );
+
+			return hash( bytes, sizeof( bytes ), secret.k0, secret.k1 );
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// HashPolicy implementation
+	//=====================================================================
+
+	//----------------------------------------------
+	// String hashing
+	//----------------------------------------------
+
+	template <typename Algorithm>
+	NFX_META_INLINE size_t HashPolicy<Algorithm>::operator()( std::string_view sv ) const noexcept
+	{
+		return static_cast<size_t>( Algorithm::hash( sv.data(), sv.size() ) );
+	}
+
+	template <typename Algorithm>
+	NFX_META_INLINE size_t HashPolicy<Algorithm>::operator()( const std::string& s ) const noexcept
+	{
+		return static_cast<size_t>( Algorithm::hash( s.data(), s.size() ) );
+	}
+
+	template <typename Algorithm>
+	NFX_META_INLINE size_t HashPolicy<Algorithm>::operator()( const char* s ) const noexcept
+	{
+		const std::string_view sv{ s };
+
+		return static_cast<size_t>( Algorithm::hash( sv.data(), sv.size() ) );
+	}
+
+	//----------------------------------------------
+	// Integer hashing (proper mixing)
+	//----------------------------------------------
+
+	template <typename Algorithm>
+	template <typename T>
+	NFX_META_INLINE std::enable_if_t<std::is_integral_v<T>, size_t> HashPolicy<Algorithm>::operator()( T value ) const noexcept
+	{
+		return core::hashing::hashInteger( value );
+	}
+
+	//----------------------------------------------
+	// Fallback to std::hash for other types
+	//----------------------------------------------
+
+	template <typename Algorithm>
+	template <typename T>
+	NFX_META_INLINE std::enable_if_t<
+		!std::is_integral_v<T> &&
+			!std::is_convertible_v<const T&, std::string_view>,
+		size_t>
+	HashPolicy<Algorithm>::operator()( const T& value ) const noexcept
+	{
+		return std::hash<T>{}( value );
+	}
+
+	//=====================================================================
+	// SipHash13 implementation
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	NFX_META_INLINE SipHash13::SipHash13()
+		: m_k0{ detail::SipHash13Algorithm::randomKey() },
+		  m_k1{ detail::SipHash13Algorithm::randomKey() }
+	{
+	}
+
+	NFX_META_INLINE SipHash13::SipHash13( std::uint64_t k0, std::uint64_t k1 ) noexcept
+		: m_k0{ k0 },
+		  m_k1{ k1 }
+	{
+	}
+
+	//----------------------------------------------
+	// Key management
+	//----------------------------------------------
+
+	NFX_META_INLINE void SipHash13::reseed()
+	{
+		m_k0 = detail::SipHash13Algorithm::randomKey();
+		m_k1 = detail::SipHash13Algorithm::randomKey();
+	}
+
+	NFX_META_INLINE std::uint64_t SipHash13::key0() const noexcept
+	{
+		return m_k0;
+	}
+
+	NFX_META_INLINE std::uint64_t SipHash13::key1() const noexcept
+	{
+		return m_k1;
+	}
+
+	//----------------------------------------------
+	// String hashing
+	//----------------------------------------------
+
+	NFX_META_INLINE size_t SipHash13::operator()( std::string_view sv ) const noexcept
+	{
+		return static_cast<size_t>( detail::SipHash13Algorithm::hash( sv.data(), sv.size(), m_k0, m_k1 ) );
+	}
+
+	NFX_META_INLINE size_t SipHash13::operator()( const std::string& s ) const noexcept
+	{
+		return static_cast<size_t>( detail::SipHash13Algorithm::hash( s.data(), s.size(), m_k0, m_k1 ) );
+	}
+
+	NFX_META_INLINE size_t SipHash13::operator()( const char* s ) const noexcept
+	{
+		const std::string_view sv{ s };
+
+		return static_cast<size_t>( detail::SipHash13Algorithm::hash( sv.data(), sv.size(), m_k0, m_k1 ) );
+	}
+
+	//----------------------------------------------
+	// Integer and fallback hashing
+	//----------------------------------------------
+
+	template <typename T>
+	NFX_META_INLINE std::enable_if_t<std::is_integral_v<T>, size_t> SipHash13::operator()( T value ) const noexcept
+	{
+		char bytes[sizeof( std::uint64_t )];
+		const std::uint64_t word{ static_cast<std::uint64_t>( value ) };
+		std::memcpy( bytes, &word, sizeof( word ) );
+
+		return static_cast<size_t>( detail::SipHash13Algorithm::hash( bytes, sizeof( bytes ), m_k0, m_k1 ) );
+	}
+
+	template <typename T>
+	NFX_META_INLINE std::enable_if_t<
+		!std::is_integral_v<T> &&
+			!std::is_convertible_v<const T&, std::string_view>,
+		size_t>
+	SipHash13::operator()( const T& value ) const noexcept
+	{
+		return ( *this )( static_cast<std::uint64_t>( std::hash<T>{}( value ) ) );
+	}
+} // namespace nfx::containers
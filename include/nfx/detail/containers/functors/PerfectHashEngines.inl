@@ -0,0 +1,444 @@
+/**
+ * @file PerfectHashEngines.inl
+ * @brief Implementation of the minimal perfect hash engines for PerfectHashMap
+ * @details Contains the shared mixing and range reduction primitives, PtHashEngine's bucketed
+ *          pilot search with free-position remapping, and BbHashEngine's level cascade with
+ *          its rank directory
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace nfx::containers
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Shared primitives
+		//=====================================================================
+
+		namespace mphf
+		{
+			/** @brief Multiplier spreading low hash bits into the high bits read by reduce() */
+			inline constexpr std::uint64_t SPREAD{ 0x9E3779B97F4A7C15ull };
+
+			/** @brief MurmurHash3 64-bit finalizer: a bijection with full avalanche */
+			NFX_META_INLINE constexpr std::uint64_t mix( std::uint64_t v ) noexcept
+			{
+				v ^= v >> 33;
+				v *= 0xFF51AFD7ED558CCDull;
+				v ^= v >> 33;
+				v *= 0xC4CEB9FE1A85EC53ull;
+				v ^= v >> 33;
+				return v;
+			}
+
+			/** @brief Maps a uniform 64-bit value onto [0, range) with one multiply (high half of value × range) */
+			NFX_META_INLINE std::uint64_t reduce( std::uint64_t value, std::uint64_t range ) noexcept
+			{
+				hashing::multiply128( value, range );
+				return range;
+			}
+
+			/** @brief Sorts hashes and throws if two are equal */
+			inline void sortDistinct( std::uint64_t* first, std::uint64_t* last, const char* engine )
+			{
+				std::sort( first, last );
+				if ( std::adjacent_find( first, last ) != last )
+				{
+					throw std::invalid_argument{ std::string{ engine } + ": equal key hashes (duplicate keys or a 64-bit hash collision)" };
+				}
+			}
+		} // namespace mphf
+	} // namespace detail
+
+	//=====================================================================
+	// PtHashEngine
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline PtHashEngine::PtHashEngine( double bucketDensity, double loadFactor ) noexcept
+		: m_bucketDensity{ std::max( bucketDensity, 0.5 ) },
+		  m_loadFactor{ std::clamp( loadFactor, 0.5, 1.0 ) }
+	{
+	}
+
+	//----------------------------------------------
+	// Build
+	//----------------------------------------------
+
+	inline void PtHashEngine::build( std::span<const std::uint64_t> hashes )
+	{
+		const std::uint64_t n{ hashes.size() };
+		if ( n >= std::numeric_limits<std::uint32_t>::max() )
+		{
+			throw std::length_error{ "PtHashEngine: positions are stored with 32 bits" };
+		}
+
+		m_size = n;
+		m_pilots.clear();
+		m_overflowPilots.clear();
+		m_remap.clear();
+		if ( n == 0 )
+		{
+			m_tableSize = m_bucketCount = m_denseBuckets = 0;
+			return;
+		}
+
+		m_tableSize = std::max<std::uint64_t>( n, static_cast<std::uint64_t>( std::ceil( static_cast<double>( n ) / m_loadFactor ) ) );
+		const double log2n{ std::max( 1.0, std::log2( static_cast<double>( n ) ) ) };
+		m_bucketCount = std::max<std::uint64_t>( 2, static_cast<std::uint64_t>( std::ceil( m_bucketDensity * static_cast<double>( n ) / log2n ) ) );
+		m_denseBuckets = std::max<std::uint64_t>( 1, m_bucketCount * 3 / 10 );
+
+		// Flat bucket layout: counting sort of the hashes by bucket
+		std::vector<std::uint32_t> bucketStart( m_bucketCount + 1, 0 );
+		for ( const std::uint64_t hash : hashes )
+		{
+			++bucketStart[bucket( hash )];
+		}
+
+		std::uint32_t largestBucket{ 0 };
+		for ( std::uint64_t b{ 0 }, end{ 0 }; b < m_bucketCount; ++b )
+		{
+			largestBucket = std::max( largestBucket, bucketStart[b] );
+			end += bucketStart[b];
+			bucketStart[b] = static_cast<std::uint32_t>( end );
+		}
+		bucketStart[m_bucketCount] = static_cast<std::uint32_t>( n );
+
+		std::vector<std::uint64_t> bucketHashes( n );
+		for ( const std::uint64_t hash : hashes )
+		{
+			bucketHashes[--bucketStart[bucket( hash )]] = hash;
+		}
+
+		// Equal hashes share a bucket, so duplicates can only meet within one
+		for ( std::uint64_t b{ 0 }; b < m_bucketCount; ++b )
+		{
+			detail::mphf::sortDistinct( bucketHashes.data() + bucketStart[b], bucketHashes.data() + bucketStart[b + 1], "PtHashEngine" );
+		}
+
+		// Non-empty buckets ordered largest first
+		std::vector<std::uint32_t> sizeOffsets( largestBucket + 2, 0 );
+		for ( std::uint64_t b{ 0 }; b < m_bucketCount; ++b )
+		{
+			++sizeOffsets[largestBucket + 1 - ( bucketStart[b + 1] - bucketStart[b] )];
+		}
+		for ( std::uint32_t i{ 0 }, start{ 0 }; i <= largestBucket + 1; ++i )
+		{
+			const std::uint32_t count{ sizeOffsets[i] };
+			sizeOffsets[i] = start;
+			start += count;
+		}
+
+		std::vector<std::uint32_t> bucketOrder( sizeOffsets[largestBucket + 1] );
+		for ( std::uint64_t b{ 0 }; b < m_bucketCount; ++b )
+		{
+			const std::uint32_t bucketSize{ bucketStart[b + 1] - bucketStart[b] };
+			if ( bucketSize != 0 )
+			{
+				bucketOrder[sizeOffsets[largestBucket + 1 - bucketSize]++] = static_cast<std::uint32_t>( b );
+			}
+		}
+
+		// Pilot search: smallest pilot sending every key of the bucket to a distinct free position
+		std::vector<std::uint64_t> taken( ( m_tableSize + 63 ) / 64, 0 );
+		std::vector<std::uint64_t> positions( largestBucket );
+		m_pilots.assign( m_bucketCount, 0 );
+
+		for ( const std::uint32_t b : bucketOrder )
+		{
+			const std::uint64_t* bucketFirst{ bucketHashes.data() + bucketStart[b] };
+			const std::uint32_t bucketSize{ bucketStart[b + 1] - bucketStart[b] };
+
+			for ( std::uint64_t pilot{ 0 };; ++pilot )
+			{
+				if ( pilot == std::numeric_limits<std::uint32_t>::max() )
+				{
+					throw std::runtime_error{ "PtHashEngine: pilot search exceeded 32 bits" };
+				}
+
+				std::uint32_t placed{ 0 };
+				for ( ; placed < bucketSize; ++placed )
+				{
+					const std::uint64_t position{ slot( bucketFirst[placed], pilot ) };
+					if ( taken[position / 64] & ( std::uint64_t{ 1 } << ( position % 64 ) ) )
+					{
+						break;
+					}
+					if ( std::find( positions.data(), positions.data() + placed, position ) != positions.data() + placed )
+					{
+						break;
+					}
+					positions[placed] = position;
+				}
+
+				if ( placed == bucketSize )
+				{
+					for ( std::uint32_t k{ 0 }; k < bucketSize; ++k )
+					{
+						taken[positions[k] / 64] |= std::uint64_t{ 1 } << ( positions[k] % 64 );
+					}
+
+					if ( pilot < OVERFLOW_PILOT )
+					{
+						m_pilots[b] = static_cast<std::uint16_t>( pilot );
+					}
+					else
+					{
+						m_pilots[b] = OVERFLOW_PILOT;
+						m_overflowPilots.emplace_back( b, pilot );
+					}
+					break;
+				}
+			}
+		}
+		std::sort( m_overflowPilots.begin(), m_overflowPilots.end() );
+
+		// Positions at or past n move to the free positions below n, in order
+		m_remap.assign( m_tableSize - n, 0 );
+		std::uint64_t freePosition{ 0 };
+		for ( std::uint64_t position{ n }; position < m_tableSize; ++position )
+		{
+			if ( taken[position / 64] & ( std::uint64_t{ 1 } << ( position % 64 ) ) )
+			{
+				while ( taken[freePosition / 64] & ( std::uint64_t{ 1 } << ( freePosition % 64 ) ) )
+				{
+					++freePosition;
+				}
+				m_remap[position - n] = static_cast<std::uint32_t>( freePosition++ );
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Evaluation
+	//----------------------------------------------
+
+	NFX_META_INLINE size_t PtHashEngine::position( std::uint64_t hash ) const noexcept
+	{
+		// Default-constructed or built from no hashes: there is no bucket to read
+		if ( m_pilots.empty() ) [[unlikely]]
+		{
+			return 0;
+		}
+
+		const std::uint64_t b{ bucket( hash ) };
+		std::uint64_t pilot{ m_pilots[b] };
+		if ( pilot == OVERFLOW_PILOT ) [[unlikely]]
+		{
+			const auto it{ std::lower_bound( m_overflowPilots.begin(), m_overflowPilots.end(), b,
+				[]( const std::pair<std::uint32_t, std::uint64_t>& entry, std::uint64_t value ) { return entry.first < value; } ) };
+			pilot = it != m_overflowPilots.end() && it->first == b ? it->second : 0;
+		}
+
+		const std::uint64_t position{ slot( hash, pilot ) };
+		if ( position < m_size ) [[likely]]
+		{
+			return static_cast<size_t>( position );
+		}
+
+		return m_remap[position - m_size];
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	inline size_t PtHashEngine::size() const noexcept
+	{
+		return static_cast<size_t>( m_size );
+	}
+
+	inline size_t PtHashEngine::sizeInBytes() const noexcept
+	{
+		return sizeof( *this ) +
+			   m_pilots.capacity() * sizeof( std::uint16_t ) +
+			   m_overflowPilots.capacity() * sizeof( std::pair<std::uint32_t, std::uint64_t> ) +
+			   m_remap.capacity() * sizeof( std::uint32_t );
+	}
+
+	//----------------------------------------------
+	// Private helpers
+	//----------------------------------------------
+
+	NFX_META_INLINE std::uint64_t PtHashEngine::bucket( std::uint64_t hash ) const noexcept
+	{
+		// Skewed assignment: 60% of the keys into the first 30% of the buckets. The threshold
+		// reads the high bits of the mixed hash, the bucket within each part its low bits
+		constexpr std::uint64_t DENSE_THRESHOLD{ 11068046444225730969ull }; // 0.6 × 2^64
+		const std::uint64_t mixed{ detail::mphf::mix( hash ) };
+		const std::uint64_t spread{ std::rotl( mixed, 32 ) };
+
+		return mixed < DENSE_THRESHOLD
+				   ? detail::mphf::reduce( spread, m_denseBuckets )
+				   : m_denseBuckets + detail::mphf::reduce( spread, m_bucketCount - m_denseBuckets );
+	}
+
+	NFX_META_INLINE std::uint64_t PtHashEngine::slot( std::uint64_t hash, std::uint64_t pilot ) const noexcept
+	{
+		// PTHASH ALGORITHM: position = reduce(hash ^ mix(pilot)); the multiply makes keys that share
+		// their high bits land apart
+		return detail::mphf::reduce( ( hash ^ detail::mphf::mix( pilot + detail::mphf::SPREAD ) ) * detail::mphf::SPREAD, m_tableSize );
+	}
+
+	//=====================================================================
+	// BbHashEngine
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline BbHashEngine::BbHashEngine( double gamma, std::uint32_t maxLevels ) noexcept
+		: m_gamma{ std::max( gamma, 1.0 ) },
+		  m_maxLevels{ std::max<std::uint32_t>( maxLevels, 1 ) }
+	{
+	}
+
+	//----------------------------------------------
+	// Build
+	//----------------------------------------------
+
+	inline void BbHashEngine::build( std::span<const std::uint64_t> hashes )
+	{
+		m_size = hashes.size();
+		m_bits.clear();
+		m_ranks.clear();
+		m_levels.clear();
+		m_fallback.clear();
+
+		std::vector<std::uint64_t> remaining( hashes.begin(), hashes.end() );
+		std::vector<std::uint64_t> next;
+		std::vector<std::uint64_t> seen;
+		std::vector<std::uint64_t> collided;
+
+		for ( std::uint64_t level{ 0 }; level < m_maxLevels && !remaining.empty(); ++level )
+		{
+			const std::uint64_t words{ std::max<std::uint64_t>( 1,
+				static_cast<std::uint64_t>( std::ceil( m_gamma * static_cast<double>( remaining.size() ) / 64.0 ) ) ) };
+			const std::uint64_t bits{ words * 64 };
+
+			// BBHASH ALGORITHM: a bit hit by exactly one remaining key places that key
+			seen.assign( words, 0 );
+			collided.assign( words, 0 );
+			for ( const std::uint64_t hash : remaining )
+			{
+				const std::uint64_t bit{ levelBit( hash, level, bits ) };
+				const std::uint64_t mask{ std::uint64_t{ 1 } << ( bit % 64 ) };
+				collided[bit / 64] |= seen[bit / 64] & mask;
+				seen[bit / 64] |= mask;
+			}
+
+			m_levels.push_back( { m_bits.size() * 64, bits } );
+			for ( std::uint64_t w{ 0 }; w < words; ++w )
+			{
+				m_bits.push_back( seen[w] & ~collided[w] );
+			}
+
+			next.clear();
+			for ( const std::uint64_t hash : remaining )
+			{
+				const std::uint64_t bit{ levelBit( hash, level, bits ) };
+				if ( collided[bit / 64] & ( std::uint64_t{ 1 } << ( bit % 64 ) ) )
+				{
+					next.push_back( hash );
+				}
+			}
+			remaining.swap( next );
+		}
+
+		// Equal hashes collide at every level, so they all end up here
+		detail::mphf::sortDistinct( remaining.data(), remaining.data() + remaining.size(), "BbHashEngine" );
+		m_fallback = std::move( remaining );
+		m_fallback.shrink_to_fit();
+
+		m_ranks.reserve( m_bits.size() / ( RANK_BLOCK_BITS / 64 ) + 1 );
+		std::uint64_t setBits{ 0 };
+		for ( std::uint64_t w{ 0 }; w < m_bits.size(); ++w )
+		{
+			if ( w % ( RANK_BLOCK_BITS / 64 ) == 0 )
+			{
+				m_ranks.push_back( setBits );
+			}
+			setBits += static_cast<std::uint64_t>( std::popcount( m_bits[w] ) );
+		}
+		m_bits.shrink_to_fit();
+	}
+
+	//----------------------------------------------
+	// Evaluation
+	//----------------------------------------------
+
+	NFX_META_INLINE size_t BbHashEngine::position( std::uint64_t hash ) const noexcept
+	{
+		for ( std::uint64_t level{ 0 }; level < m_levels.size(); ++level )
+		{
+			const Level& placement{ m_levels[level] };
+			const std::uint64_t bit{ placement.offset + levelBit( hash, level, placement.bits ) };
+			if ( m_bits[bit / 64] & ( std::uint64_t{ 1 } << ( bit % 64 ) ) )
+			{
+				return static_cast<size_t>( rank( bit ) );
+			}
+		}
+
+		const auto it{ std::lower_bound( m_fallback.begin(), m_fallback.end(), hash ) };
+		if ( it != m_fallback.end() && *it == hash )
+		{
+			return static_cast<size_t>( m_size - m_fallback.size() + static_cast<std::uint64_t>( it - m_fallback.begin() ) );
+		}
+
+		return 0;
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	inline size_t BbHashEngine::size() const noexcept
+	{
+		return static_cast<size_t>( m_size );
+	}
+
+	inline size_t BbHashEngine::sizeInBytes() const noexcept
+	{
+		return sizeof( *this ) +
+			   m_bits.capacity() * sizeof( std::uint64_t ) +
+			   m_ranks.capacity() * sizeof( std::uint64_t ) +
+			   m_levels.capacity() * sizeof( Level ) +
+			   m_fallback.capacity() * sizeof( std::uint64_t );
+	}
+
+	inline size_t BbHashEngine::levelCount() const noexcept
+	{
+		return m_levels.size();
+	}
+
+	//----------------------------------------------
+	// Private helpers
+	//----------------------------------------------
+
+	NFX_META_INLINE std::uint64_t BbHashEngine::levelBit( std::uint64_t hash, std::uint64_t level, std::uint64_t bits ) noexcept
+	{
+		return detail::mphf::reduce( detail::mphf::mix( hash + level * detail::mphf::SPREAD ), bits );
+	}
+
+	NFX_META_INLINE std::uint64_t BbHashEngine::rank( std::uint64_t bit ) const noexcept
+	{
+		const std::uint64_t word{ bit / 64 };
+		std::uint64_t result{ m_ranks[bit / RANK_BLOCK_BITS] };
+		for ( std::uint64_t w{ word & ~( RANK_BLOCK_BITS / 64 - 1 ) }; w < word; ++w )
+		{
+			result += static_cast<std::uint64_t>( std::popcount( m_bits[w] ) );
+		}
+
+		return result + static_cast<std::uint64_t>( std::popcount( m_bits[word] & ( ( std::uint64_t{ 1 } << ( bit % 64 ) ) - 1 ) ) );
+	}
+} // namespace nfx::containers
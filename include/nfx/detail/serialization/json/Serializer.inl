@@ -195,20 +195,20 @@ namespace nfx::serialization::json
 		};
 
 		/** @brief Specialization for nfx::containers::HashMap */
-		template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime>
-		struct is_nfx_container<nfx::containers::HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime>> : std::true_type
+		template <typename TKey, typename TValue, uint32_t FnvOffsetBasis, uint32_t FnvPrime, nfx::containers::HashMapLayout Layout, typename Allocator, typename Hasher, nfx::containers::CachedHashType CachedHash>
+		struct is_nfx_container<nfx::containers::HashMap<TKey, TValue, FnvOffsetBasis, FnvPrime, Layout, Allocator, Hasher, CachedHash>> : std::true_type
 		{
 		};
 
 		/** @brief Specialization for nfx::containers::StringMap (STL-compatible) */
-		template <typename T>
-		struct is_nfx_container<nfx::containers::StringMap<T>> : std::true_type
+		template <typename T, typename Allocator, typename Hash>
+		struct is_nfx_container<nfx::containers::StringMap<T, Allocator, Hash>> : std::true_type
 		{
 		};
 
 		/** @brief Specialization for nfx::containers::StringSet (STL-compatible) */
-		template <>
-		struct is_nfx_container<nfx::containers::StringSet> : std::true_type
+		template <typename Allocator>
+		struct is_nfx_container<nfx::containers::BasicStringSet<Allocator>> : std::true_type
 		{
 		};
 
@@ -10,6 +10,7 @@
 
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "nfx/config.h"
@@ -326,15 +327,15 @@ namespace nfx::serialization::json
 	/**
 	 * @brief Specialization for nfx::containers::ChdHashMap
 	 */
-	template <typename TValue, uint32_t FnvOffsetBasis>
-	struct SerializationTraits<nfx::containers::ChdHashMap<TValue, FnvOffsetBasis>>
+	template <typename TValue, uint32_t FnvOffsetBasis, typename Allocator>
+	struct SerializationTraits<nfx::containers::ChdHashMap<TValue, FnvOffsetBasis, Allocator>>
 	{
 		/**
 		 * @brief Serialize ChdHashMap to JSON document as an object
 		 * @param obj The ChdHashMap object to serialize
 		 * @param doc The document to serialize into
 		 */
-		static void serialize( const nfx::containers::ChdHashMap<TValue, FnvOffsetBasis>& obj, Document& doc )
+		static void serialize( const nfx::containers::ChdHashMap<TValue, FnvOffsetBasis, Allocator>& obj, Document& doc )
 		{
 			// Store CHD construction parameters for proper deserialization
 			doc.set<int64_t>( "/maxSeedSearchMultiplier", static_cast<int64_t>( obj.maxSeedSearchMultiplier() ) );
@@ -346,7 +347,7 @@ namespace nfx::serialization::json
 			for ( auto it = obj.begin(); it != obj.end(); ++it )
 			{
 				const auto& pair = *it;
-				const std::string& key = pair.first;
+				const std::string_view key = pair.first;
 				const TValue& value = pair.second;
 
 				// Serialize the value using a temporary serializer
@@ -355,7 +356,7 @@ namespace nfx::serialization::json
 				valueDoc = valueSerializer.serialize( value );
 
 				// Set field in data object using JSON Pointer syntax
-				std::string fieldPath = "/" + key;
+				std::string fieldPath = "/" + std::string{ key };
 				if ( valueDoc.is<std::string>( "" ) )
 				{
 					auto str = valueDoc.get<std::string>( "" );
@@ -398,7 +399,7 @@ namespace nfx::serialization::json
 		 * @param obj The ChdHashMap object to deserialize into
 		 * @param doc The document to deserialize from
 		 */
-		static void deserialize( nfx::containers::ChdHashMap<TValue, FnvOffsetBasis>& obj, const Document& doc )
+		static void deserialize( nfx::containers::ChdHashMap<TValue, FnvOffsetBasis, Allocator>& obj, const Document& doc )
 		{
 			if ( !doc.is<Document::Object>( "" ) )
 			{
@@ -415,8 +416,9 @@ namespace nfx::serialization::json
 				}
 			}
 
-			// Collect key-value pairs for ChdHashMap construction
-			std::vector<std::pair<std::string, TValue>> items;
+			// Collect key-value pairs for ChdHashMap construction, allocated like the target map
+			using Map = nfx::containers::ChdHashMap<TValue, FnvOffsetBasis, Allocator>;
+			typename Map::container_type items{ typename Map::container_type::allocator_type{ obj.allocator() } };
 
 			// Get the data object from the structured format
 			Document dataDoc;
@@ -445,7 +447,7 @@ namespace nfx::serialization::json
 					Serializer<TValue> valueSerializer;
 					value = valueSerializer.deserialize( valueDoc );
 
-					items.emplace_back( std::move( key ), std::move( value ) );
+					items.emplace_back( std::string_view{ key }, std::move( value ) );
 
 					if ( !enumerator.next() )
 					{
@@ -454,7 +456,7 @@ namespace nfx::serialization::json
 				}
 			}
 
-			obj = nfx::containers::ChdHashMap<TValue, FnvOffsetBasis>( std::move( items ), maxSeedSearchMultiplier );
+			obj = Map( std::move( items ), maxSeedSearchMultiplier );
 		}
 	};
 } // namespace nfx::serialization::json
@@ -0,0 +1,244 @@
+/**
+ * @file TESTS_ArenaHashMap.cpp
+ * @brief Unit tests for ArenaHashMap and its StringArena key storage
+ * @details Test suite validating stable arena views, arena-backed insertion and lookup,
+ *          key lifetime across rehash, copies and moves, and compaction of erased keys
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/containers/ArenaHashMap.h>
+#include <nfx/containers/StringArena.h>
+
+namespace nfx::containers::test
+{
+	//=====================================================================
+	// StringArena Tests - Append-only key storage
+	//=====================================================================
+
+	TEST( StringArena, StoresCopiesWithStableAddresses )
+	{
+		StringArena arena{ 64 };
+
+		std::vector<std::string_view> views;
+		for ( int i = 0; i < 100; ++i )
+		{
+			std::string source{ "key_" + std::to_string( i ) };
+			views.push_back( arena.store( source ) );
+			source.assign( source.size(), 'x' ); // The arena owns a copy
+		}
+
+		// Earlier views survive the allocation of later blocks
+		for ( int i = 0; i < 100; ++i )
+		{
+			EXPECT_EQ( views[i], "key_" + std::to_string( i ) );
+		}
+
+		EXPECT_GT( arena.bytesUsed(), 0 );
+		EXPECT_GE( arena.bytesReserved(), arena.bytesUsed() );
+		EXPECT_TRUE( arena.store( "" ).empty() );
+	}
+
+	TEST( StringArena, OversizedStringsGetDedicatedBlocks )
+	{
+		StringArena arena{ 64 };
+
+		const std::string_view small{ arena.store( "abc" ) };
+		const std::string large( 1000, 'z' );
+		const std::string_view stored{ arena.store( large ) };
+
+		EXPECT_EQ( stored, large );
+		EXPECT_EQ( arena.bytesReserved(), 64 + 1000 );
+
+		// The current block keeps filling after the oversized string
+		const std::string_view next{ arena.store( "def" ) };
+		EXPECT_EQ( next.data(), small.data() + small.size() );
+	}
+
+	TEST( StringArena, MoveTransfersBlocks )
+	{
+		StringArena arena;
+		const std::string_view view{ arena.store( "/usr/lib/libfoo.so" ) };
+
+		StringArena moved{ std::move( arena ) };
+		EXPECT_EQ( view, "/usr/lib/libfoo.so" );
+		EXPECT_EQ( moved.bytesUsed(), view.size() );
+
+		// The moved-from arena starts over with fresh blocks
+		EXPECT_EQ( arena.bytesUsed(), 0 );
+		EXPECT_EQ( arena.store( "abc" ), "abc" );
+		EXPECT_EQ( view, "/usr/lib/libfoo.so" );
+
+		moved.clear();
+		EXPECT_EQ( moved.bytesUsed(), 0 );
+		EXPECT_EQ( moved.bytesReserved(), 0 );
+	}
+
+	//=====================================================================
+	// ArenaHashMap Tests - Arena-keyed string map
+	//=====================================================================
+
+	//----------------------------------------------
+	// Basic operations
+	//----------------------------------------------
+
+	TEST( ArenaHashMapBasic, InsertLookupErase )
+	{
+		ArenaHashMap<int> map;
+		EXPECT_TRUE( map.isEmpty() );
+
+		map.insertOrAssign( "alpha", 1 );
+		map.insertOrAssign( std::string{ "beta" }, 2 );
+		map.insertOrAssign( "alpha", 10 );
+
+		EXPECT_EQ( map.size(), 2 );
+
+		int* value = nullptr;
+		ASSERT_TRUE( map.tryGetValue( "alpha", value ) );
+		EXPECT_EQ( *value, 10 );
+		EXPECT_TRUE( map.contains( "beta" ) );
+		EXPECT_FALSE( map.tryGetValue( "gamma", value ) );
+		EXPECT_EQ( value, nullptr );
+
+		EXPECT_TRUE( map.erase( "alpha" ) );
+		EXPECT_FALSE( map.erase( "alpha" ) );
+		EXPECT_EQ( map.size(), 1 );
+
+		const auto& constMap = map;
+		const int* constValue = nullptr;
+		ASSERT_TRUE( constMap.tryGetValue( "beta", constValue ) );
+		EXPECT_EQ( *constValue, 2 );
+	}
+
+	TEST( ArenaHashMapBasic, ExistingKeysDoNotGrowArena )
+	{
+		ArenaHashMap<std::string> map;
+
+		auto [first, inserted] = map.tryEmplace( "config/path", 3, 'a' );
+		ASSERT_TRUE( inserted );
+		EXPECT_EQ( *first, "aaa" );
+		const size_t used{ map.keyArena().bytesUsed() };
+		EXPECT_EQ( used, std::string_view{ "config/path" }.size() );
+
+		auto [again, insertedAgain] = map.tryEmplace( "config/path", 5, 'b' );
+		EXPECT_FALSE( insertedAgain );
+		EXPECT_EQ( again, first );
+		EXPECT_EQ( *again, "aaa" );
+
+		map.insertOrAssign( "config/path", std::string{ "new" } );
+		EXPECT_EQ( map.keyArena().bytesUsed(), used );
+	}
+
+	TEST( ArenaHashMapBasic, KeysSurviveCallerBuffersAndRehash )
+	{
+		ArenaHashMap<int> map{ 4, 128 };
+
+		for ( int i = 0; i < 5000; ++i )
+		{
+			std::string key{ "/var/cache/pkg/" + std::to_string( i ) + ".deb" };
+			map.insertOrAssign( key, i );
+		} // Every caller buffer is gone: only arena copies remain
+
+		EXPECT_EQ( map.size(), 5000 );
+		EXPECT_GE( map.capacity(), 5000 );
+
+		size_t visited = 0;
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( key, "/var/cache/pkg/" + std::to_string( value ) + ".deb" );
+			++visited;
+		}
+		EXPECT_EQ( visited, 5000 );
+
+		std::vector<std::string> owned{ "/var/cache/pkg/7.deb", "/missing", "/var/cache/pkg/4999.deb" };
+		std::vector<std::string_view> keys{ owned.begin(), owned.end() };
+		std::vector<int*> out( keys.size() );
+		EXPECT_EQ( map.tryGetValues( keys, out ), 2 );
+		ASSERT_NE( out[0], nullptr );
+		EXPECT_EQ( *out[0], 7 );
+		EXPECT_EQ( out[1], nullptr );
+	}
+
+	//----------------------------------------------
+	// Copy, move and compaction
+	//----------------------------------------------
+
+	TEST( ArenaHashMapOwnership, CopyIsIndependentAndCompact )
+	{
+		ArenaHashMap<int> original;
+		for ( int i = 0; i < 100; ++i )
+		{
+			original.insertOrAssign( "entry_" + std::to_string( i ), i );
+		}
+		for ( int i = 0; i < 100; i += 2 )
+		{
+			original.erase( "entry_" + std::to_string( i ) );
+		}
+
+		ArenaHashMap<int> copy{ original };
+		EXPECT_EQ( copy, original );
+		EXPECT_LT( copy.keyArena().bytesUsed(), original.keyArena().bytesUsed() );
+
+		// Destroying the source must not invalidate the copy's keys
+		original = ArenaHashMap<int>{};
+		for ( const auto& [key, value] : copy )
+		{
+			EXPECT_EQ( key, "entry_" + std::to_string( value ) );
+		}
+
+		ArenaHashMap<int> assigned;
+		assigned.insertOrAssign( "stale", -1 );
+		assigned = copy;
+		EXPECT_EQ( assigned, copy );
+		EXPECT_FALSE( assigned.contains( "stale" ) );
+	}
+
+	TEST( ArenaHashMapOwnership, MoveKeepsViewsAndCompactReclaims )
+	{
+		ArenaHashMap<int> map;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			map.insertOrAssign( "tmp/file_" + std::to_string( i ), i );
+		}
+
+		ArenaHashMap<int> moved{ std::move( map ) };
+		int* value = nullptr;
+		ASSERT_TRUE( moved.tryGetValue( "tmp/file_999", value ) );
+		EXPECT_EQ( *value, 999 );
+
+		for ( int i = 0; i < 900; ++i )
+		{
+			moved.erase( "tmp/file_" + std::to_string( i ) );
+		}
+		const size_t before{ moved.keyArena().bytesUsed() };
+
+		moved.compact();
+		EXPECT_EQ( moved.size(), 100 );
+		EXPECT_LT( moved.keyArena().bytesUsed(), before / 5 );
+		ASSERT_TRUE( moved.tryGetValue( "tmp/file_950", value ) );
+		EXPECT_EQ( *value, 950 );
+
+		moved.clear();
+		EXPECT_TRUE( moved.isEmpty() );
+		EXPECT_EQ( moved.keyArena().bytesReserved(), 0 );
+	}
+
+	TEST( ArenaHashMapOwnership, SplitLayout )
+	{
+		ArenaHashMap<std::string, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME, HashMapLayout::Split> map;
+
+		for ( int i = 0; i < 2000; ++i )
+		{
+			map.insertOrAssign( "k" + std::to_string( i ), std::to_string( i * 3 ) );
+		}
+
+		const std::string* value = nullptr;
+		const auto& constMap = map;
+		ASSERT_TRUE( constMap.tryGetValue( "k1999", value ) );
+		EXPECT_EQ( *value, "5997" );
+	}
+} // namespace nfx::containers::test
@@ -8,7 +8,11 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <memory_resource>
 #include <memory>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 #include <nfx/containers/ChdHashMap.h>
@@ -50,7 +54,7 @@ namespace nfx::containers::test
 		ChdHashMap<int> map{ std::move( items ) };
 
 		EXPECT_FALSE( map.isEmpty() );
-		EXPECT_GT( map.size(), 0 ); // Size includes empty slots for perfect hashing
+		EXPECT_EQ( map.size(), 3 ); // Empty slots hold no entries
 	}
 
 	TEST( ChdHashMapBasic, BasicLookup )
@@ -97,6 +101,107 @@ namespace nfx::containers::test
 		EXPECT_EQ( *value2, 222 );
 	}
 
+	//----------------------------------------------
+	// Batch lookup
+	//----------------------------------------------
+
+	TEST( ChdHashMapBatch, TryGetValuesMatchesSingleLookups )
+	{
+		std::vector<std::pair<std::string, int>> items;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			items.emplace_back( "batch_" + std::to_string( i ), i );
+		}
+		ChdHashMap<int> map{ std::move( items ) };
+
+		// Mix of hits and misses spanning several internal blocks
+		std::vector<std::string> keys;
+		for ( int i = 0; i < 1100; i += 3 )
+		{
+			keys.push_back( "batch_" + std::to_string( i ) );
+		}
+		keys.push_back( "" );
+		keys.push_back( "not_there" );
+
+		std::vector<int*> values( keys.size(), nullptr );
+		const size_t found = map.tryGetValues<std::string>( keys, values );
+
+		size_t expectedFound = 0;
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			int* single = nullptr;
+			const bool hit = map.tryGetValue( keys[i], single );
+			EXPECT_EQ( values[i], single ) << keys[i];
+			expectedFound += hit ? 1 : 0;
+		}
+		EXPECT_EQ( found, expectedFound );
+		EXPECT_EQ( found, 334u );
+	}
+
+	TEST( ChdHashMapBatch, StringViewKeysAndEmptyMap )
+	{
+		std::vector<std::string_view> keys{ "alpha", "beta", "gamma" };
+		std::vector<int*> values( keys.size(), reinterpret_cast<int*>( 1 ) );
+
+		ChdHashMap<int> empty;
+		EXPECT_EQ( empty.tryGetValues( keys, values ), 0u );
+		for ( int* v : values )
+		{
+			EXPECT_EQ( v, nullptr );
+		}
+
+		std::vector<std::pair<std::string, int>> items{ { "alpha", 1 }, { "gamma", 3 } };
+		ChdHashMap<int> map{ std::move( items ) };
+
+		EXPECT_EQ( map.tryGetValues( keys, values ), 2u );
+		ASSERT_NE( values[0], nullptr );
+		EXPECT_EQ( *values[0], 1 );
+		EXPECT_EQ( values[1], nullptr );
+		ASSERT_NE( values[2], nullptr );
+		EXPECT_EQ( *values[2], 3 );
+
+		// Output span shorter than input: only the first keys are processed
+		std::vector<int*> shortValues( 1, nullptr );
+		EXPECT_EQ( map.tryGetValues( keys, shortValues ), 1u );
+		EXPECT_EQ( shortValues[0], values[0] );
+	}
+
+	TEST( ChdHashMapBatch, SameLengthMissesAreRejected )
+	{
+		// Keys of one length: a miss landing on an occupied slot can only be told apart by hash or content
+		const auto codebookKey{ []( int i ) {
+			std::string digits{ std::to_string( i ) };
+			return "tok_" + std::string( 5 - digits.size(), '0' ) + digits;
+		} };
+
+		std::vector<std::pair<std::string, int>> items;
+		for ( int i = 0; i < 2000; ++i )
+		{
+			items.emplace_back( codebookKey( i ), i );
+		}
+		ChdHashMap<int> map{ std::move( items ) };
+
+		std::vector<std::string> probes;
+		for ( int i = 0; i < 10000; ++i )
+		{
+			probes.push_back( codebookKey( i ) );
+		}
+
+		std::vector<int*> values( probes.size(), nullptr );
+		EXPECT_EQ( map.tryGetValues<std::string>( probes, values ), 2000u );
+		for ( int i = 0; i < 10000; ++i )
+		{
+			int* value = nullptr;
+			const bool hit = map.tryGetValue( probes[i], value );
+			EXPECT_EQ( hit, i < 2000 ) << probes[i];
+			EXPECT_EQ( values[i], value ) << probes[i];
+			if ( hit )
+			{
+				EXPECT_EQ( *value, i );
+			}
+		}
+	}
+
 	//----------------------------------------------
 	// Exception handling
 	//----------------------------------------------
@@ -557,4 +662,122 @@ namespace nfx::containers::test
 		// Error case
 		EXPECT_THROW( static_cast<void>( statusCodes["UNKNOWN_STATUS"] ), ChdHashMap<int>::KeyNotFoundException );
 	}
+
+	//----------------------------------------------
+	// Construction pipeline
+	//----------------------------------------------
+
+	TEST( ChdHashMapConstruction, ParallelBuildMatchesSingleThreadedLayout )
+	{
+		// Keys with an already seen 32-bit hash are skipped: no seed can separate them
+		std::vector<std::pair<std::string, int>> items;
+		std::unordered_set<uint32_t> hashes;
+		for ( int i = 0; i < 200000; ++i )
+		{
+			std::string key{ "node/" + std::to_string( i * 7919 ) };
+			if ( hashes.insert( ChdHashMap<int>::hash( key ) ).second )
+			{
+				items.emplace_back( std::move( key ), i );
+			}
+		}
+		ASSERT_GT( items.size(), 199000u );
+		auto singleItems{ items };
+		auto parallelItems{ items };
+
+		ChdHashMap<int> single{ std::move( singleItems ), 100, 1 };
+		ChdHashMap<int> parallel{ std::move( parallelItems ), 100, 3 };
+		ASSERT_EQ( single.size(), parallel.size() );
+
+		for ( size_t i = 0; i < items.size(); ++i )
+		{
+			ASSERT_EQ( single.at( items[i].first ), items[i].second );
+			ASSERT_EQ( parallel.at( items[i].first ), items[i].second );
+		}
+		EXPECT_TRUE( single == parallel );
+	}
+
+	TEST( ChdHashMapConstruction, EntriesAreDenseInInputOrder )
+	{
+		std::vector<std::pair<std::string, int>> items;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			items.emplace_back( "code_" + std::to_string( 1000 - i ), i );
+		}
+		items.emplace_back( "", -1 );
+		const auto expected{ items };
+
+		ChdHashMap<int> map{ std::move( items ) };
+		ASSERT_EQ( map.size(), expected.size() );
+
+		size_t index = 0;
+		for ( const auto& [key, value] : map )
+		{
+			ASSERT_EQ( key, expected[index].first );
+			ASSERT_EQ( value, expected[index].second );
+			++index;
+		}
+		EXPECT_EQ( index, expected.size() );
+
+		auto enumerator{ map.enumerator() };
+		index = 0;
+		while ( enumerator.next() )
+		{
+			EXPECT_EQ( enumerator.current().second, expected[index++].second );
+		}
+		EXPECT_EQ( index, expected.size() );
+		EXPECT_FALSE( enumerator.next() );
+
+		// The empty key is an ordinary entry, and empty slots never match
+		EXPECT_EQ( map[""], -1 );
+		int* value = nullptr;
+		EXPECT_FALSE( map.tryGetValue( "code_0", value ) );
+		EXPECT_EQ( value, nullptr );
+	}
+
+	TEST( ChdHashMapConstruction, DuplicateKeysExhaustSeedSearch )
+	{
+		for ( const size_t threads : { size_t{ 1 }, size_t{ 2 } } )
+		{
+			std::vector<std::pair<std::string, int>> items{ { "twin", 1 }, { "other", 2 }, { "twin", 3 } };
+			EXPECT_THROW( ( ChdHashMap<int>{ std::move( items ), 1, threads } ), std::runtime_error );
+		}
+	}
+
+	//----------------------------------------------
+	// Polymorphic allocator support
+	//----------------------------------------------
+
+	TEST( ChdHashMapPmr, TableSeedsAndKeysComeFromArena )
+	{
+		std::vector<std::byte> buffer( 1 << 20 );
+		std::pmr::monotonic_buffer_resource arena{ buffer.data(), buffer.size(), std::pmr::null_memory_resource() };
+		const auto owns = [&buffer]( const void* ptr ) {
+			const auto* byte{ static_cast<const std::byte*>( ptr ) };
+			return byte >= buffer.data() && byte < buffer.data() + buffer.size();
+		};
+
+		pmr::ChdHashMap<int>::container_type items{ &arena };
+		for ( int i = 0; i < 200; ++i )
+		{
+			items.emplace_back( "static_lookup_key_longer_than_sso_" + std::to_string( i ), i );
+		}
+
+		pmr::ChdHashMap<int> map{ std::move( items ) };
+		EXPECT_EQ( map.allocator().resource(), &arena );
+		EXPECT_EQ( map.at( "static_lookup_key_longer_than_sso_123" ), 123 );
+
+		int* value = nullptr;
+		EXPECT_FALSE( map.tryGetValue( "missing", value ) );
+
+		size_t visited = 0;
+		for ( const auto& [key, val] : map )
+		{
+			if ( !key.empty() )
+			{
+				EXPECT_TRUE( owns( key.data() ) ) << key;
+				++visited;
+			}
+		}
+		EXPECT_EQ( visited, 200 );
+	}
 } // namespace nfx::containers::test
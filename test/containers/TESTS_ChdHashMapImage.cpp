@@ -0,0 +1,264 @@
+/**
+ * @file TESTS_ChdHashMapImage.cpp
+ * @brief Unit tests for ChdHashMap binary images and the memory-mapped ChdHashMapImage view
+ * @details Test suite validating save/open round trips, rejection of foreign, truncated and
+ *          corrupted files, and replacing an image while it is mapped
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <iterator>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <nfx/containers/ChdHashMap.h>
+#include <nfx/containers/ChdHashMapImage.h>
+
+namespace nfx::containers::test
+{
+	//=====================================================================
+	// ChdHashMapImage Tests
+	//=====================================================================
+
+	namespace
+	{
+		struct Reading
+		{
+			int32_t sensor;
+			double value;
+
+			bool operator==( const Reading& ) const = default;
+		};
+
+		/** @brief Fresh image path per test, removed with its directory afterwards */
+		class ChdHashMapImageTest : public ::testing::Test
+		{
+		protected:
+			void SetUp() override
+			{
+				m_directory = std::filesystem::temp_directory_path() /
+							  ( std::string{ "nfx_chd_image_" } + ::testing::UnitTest::GetInstance()->current_test_info()->name() );
+				std::filesystem::create_directories( m_directory );
+				m_path = m_directory / "map.chd";
+			}
+
+			void TearDown() override
+			{
+				std::error_code ignored;
+				std::filesystem::remove_all( m_directory, ignored );
+			}
+
+			static ChdHashMap<Reading> buildReadings( int count, double scale = 1.0 )
+			{
+				ChdHashMap<Reading>::container_type items;
+				for ( int i = 0; i < count; ++i )
+				{
+					items.emplace_back( "plant/line/sensor_" + std::to_string( i ), Reading{ i, i * scale } );
+				}
+
+				return ChdHashMap<Reading>{ std::move( items ) };
+			}
+
+			void corruptByte( std::streamoff offset ) const
+			{
+				std::fstream file{ m_path, std::ios::binary | std::ios::in | std::ios::out };
+				file.seekg( offset );
+				const char original{ static_cast<char>( file.get() ) };
+				file.seekp( offset );
+				file.put( static_cast<char>( original ^ 0x5A ) );
+			}
+
+			std::filesystem::path m_directory;
+			std::filesystem::path m_path;
+		};
+	} // namespace
+
+	//----------------------------------------------
+	// Round trip
+	//----------------------------------------------
+
+	TEST_F( ChdHashMapImageTest, RoundTripMatchesMap )
+	{
+		auto map{ buildReadings( 10000 ) };
+		map.saveImage( m_path );
+
+		const ChdHashMapImage<Reading> image{ m_path };
+		ASSERT_EQ( image.size(), map.size() );
+		EXPECT_FALSE( image.isEmpty() );
+		EXPECT_EQ( image.mappedBytes(), std::filesystem::file_size( m_path ) );
+
+		for ( const auto& [key, reading] : map )
+		{
+			EXPECT_EQ( image.at( key ), reading );
+		}
+
+		EXPECT_FALSE( image.contains( "plant/line/sensor_10000" ) );
+		EXPECT_FALSE( image.contains( "" ) );
+		EXPECT_THROW( (void)image.at( "missing" ), ChdHashMapImage<Reading>::KeyNotFoundException );
+
+		const Reading* reading{ nullptr };
+		EXPECT_FALSE( image.tryGetValue( "missing", reading ) );
+		EXPECT_EQ( reading, nullptr );
+		ASSERT_TRUE( image.tryGetValue( "plant/line/sensor_42", reading ) );
+		EXPECT_EQ( reading->sensor, 42 );
+	}
+
+	TEST_F( ChdHashMapImageTest, IteratesInInputOrder )
+	{
+		ChdHashMap<uint64_t>::container_type items;
+		for ( uint64_t i = 0; i < 500; ++i )
+		{
+			items.emplace_back( "k" + std::to_string( 499 - i ), i );
+		}
+		items.emplace_back( "", 999 );
+
+		const ChdHashMap<uint64_t> map{ std::move( items ) };
+		map.saveImage( m_path );
+		const ChdHashMapImage<uint64_t> image{ m_path };
+
+		uint64_t expected{ 0 };
+		for ( const auto& [key, value] : image )
+		{
+			if ( expected == 500 )
+			{
+				EXPECT_EQ( key, "" );
+				EXPECT_EQ( value, 999u );
+			}
+			else
+			{
+				EXPECT_EQ( key, "k" + std::to_string( 499 - expected ) );
+				EXPECT_EQ( value, expected );
+			}
+			++expected;
+		}
+		EXPECT_EQ( expected, 501u );
+		EXPECT_EQ( image.at( "" ), 999u );
+	}
+
+	TEST_F( ChdHashMapImageTest, EmptyMap )
+	{
+		ChdHashMap<int> map;
+		map.saveImage( m_path );
+
+		const ChdHashMapImage<int> image{ m_path };
+		EXPECT_TRUE( image.isEmpty() );
+		EXPECT_EQ( image.begin(), image.end() );
+		EXPECT_FALSE( image.contains( "anything" ) );
+
+		const ChdHashMapImage<int> unmapped;
+		EXPECT_TRUE( unmapped.isEmpty() );
+		EXPECT_EQ( unmapped.mappedBytes(), 0u );
+	}
+
+	TEST_F( ChdHashMapImageTest, MoveTransfersMapping )
+	{
+		buildReadings( 100 ).saveImage( m_path );
+
+		ChdHashMapImage<Reading> first{ m_path };
+		ChdHashMapImage<Reading> second{ std::move( first ) };
+		EXPECT_TRUE( first.isEmpty() );
+		EXPECT_EQ( second.at( "plant/line/sensor_7" ).sensor, 7 );
+
+		ChdHashMapImage<Reading> third;
+		third = std::move( second );
+		EXPECT_TRUE( second.isEmpty() );
+		EXPECT_EQ( third.size(), 100u );
+		EXPECT_EQ( third.at( "plant/line/sensor_99" ).sensor, 99 );
+	}
+
+	TEST_F( ChdHashMapImageTest, SaveReplacesImageWhileMapped )
+	{
+		buildReadings( 1000, 1.0 ).saveImage( m_path );
+		const ChdHashMapImage<Reading> before{ m_path };
+
+		buildReadings( 1000, 2.0 ).saveImage( m_path );
+		const ChdHashMapImage<Reading> after{ m_path };
+
+		// The first mapping still sees the file it opened
+		EXPECT_EQ( before.at( "plant/line/sensor_10" ).value, 10.0 );
+		EXPECT_EQ( after.at( "plant/line/sensor_10" ).value, 20.0 );
+		EXPECT_EQ( std::distance( std::filesystem::directory_iterator{ m_directory }, std::filesystem::directory_iterator{} ), 1 );
+	}
+
+	TEST_F( ChdHashMapImageTest, ConcurrentSavesLeaveOneCompleteImage )
+	{
+		// Every save writes its own file next to the destination
+		const std::filesystem::path temporary{ detail::chdImageTemporaryPath( m_path ) };
+		EXPECT_NE( temporary, detail::chdImageTemporaryPath( m_path ) );
+		EXPECT_EQ( temporary.parent_path(), m_directory );
+
+		std::vector<std::thread> writers;
+		for ( int writer = 1; writer <= 4; ++writer )
+		{
+			writers.emplace_back( [this, writer]() { buildReadings( 2000, writer ).saveImage( m_path ); } );
+		}
+		for ( auto& thread : writers )
+		{
+			thread.join();
+		}
+
+		// Whichever rename came last, the image is one writer's complete output
+		const ChdHashMapImage<Reading> image{ m_path };
+		ASSERT_EQ( image.size(), 2000u );
+		const double scale{ image.at( "plant/line/sensor_1" ).value };
+		EXPECT_EQ( image.at( "plant/line/sensor_1999" ).value, 1999 * scale );
+		EXPECT_EQ( std::distance( std::filesystem::directory_iterator{ m_directory }, std::filesystem::directory_iterator{} ), 1 );
+	}
+
+	//----------------------------------------------
+	// Validation
+	//----------------------------------------------
+
+	TEST_F( ChdHashMapImageTest, RejectsMissingFile )
+	{
+		EXPECT_THROW( ( ChdHashMapImage<int>{ m_directory / "absent.chd" } ), std::system_error );
+	}
+
+	TEST_F( ChdHashMapImageTest, RejectsForeignFiles )
+	{
+		{
+			std::ofstream file{ m_path, std::ios::binary };
+			file << "{ \"not\": \"an image\" }" << std::string( 200, ' ' );
+		}
+		EXPECT_THROW( ( ChdHashMapImage<int>{ m_path } ), ChdHashMapImage<int>::InvalidImageException );
+
+		std::ofstream{ m_path, std::ios::binary | std::ios::trunc }.close();
+		EXPECT_THROW( ( ChdHashMapImage<int>{ m_path } ), ChdHashMapImage<int>::InvalidImageException );
+	}
+
+	TEST_F( ChdHashMapImageTest, RejectsOtherValueTypeOrHash )
+	{
+		buildReadings( 100 ).saveImage( m_path );
+
+		EXPECT_THROW( ( ChdHashMapImage<int>{ m_path } ), ChdHashMapImage<int>::InvalidImageException );
+		using OtherBasisImage = ChdHashMapImage<Reading, 0x12345678>;
+		EXPECT_THROW( ( OtherBasisImage{ m_path } ), OtherBasisImage::InvalidImageException );
+		EXPECT_NO_THROW( ( ChdHashMapImage<Reading>{ m_path } ) );
+	}
+
+	TEST_F( ChdHashMapImageTest, RejectsTruncatedImage )
+	{
+		buildReadings( 100 ).saveImage( m_path );
+		std::filesystem::resize_file( m_path, std::filesystem::file_size( m_path ) - 64 );
+
+		EXPECT_THROW( ( ChdHashMapImage<Reading>{ m_path, false } ), ChdHashMapImage<Reading>::InvalidImageException );
+	}
+
+	TEST_F( ChdHashMapImageTest, ChecksumCatchesCorruption )
+	{
+		buildReadings( 100 ).saveImage( m_path );
+		corruptByte( static_cast<std::streamoff>( std::filesystem::file_size( m_path ) - 100 ) );
+
+		EXPECT_THROW( ( ChdHashMapImage<Reading>{ m_path } ), ChdHashMapImage<Reading>::InvalidImageException );
+
+		// Without verification only the header is checked
+		const ChdHashMapImage<Reading> unverified{ m_path, false };
+		EXPECT_EQ( unverified.size(), 100u );
+	}
+} // namespace nfx::containers::test
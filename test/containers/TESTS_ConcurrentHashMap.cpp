@@ -0,0 +1,308 @@
+/**
+ * @file TESTS_ConcurrentHashMap.cpp
+ * @brief Unit tests for ConcurrentHashMap sharded container
+ * @details Test suite validating shard selection, heterogeneous lookup, cross-shard
+ *          aggregation and correctness under concurrent readers and writers
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <nfx/containers/ConcurrentHashMap.h>
+
+namespace nfx::containers::test
+{
+	//=====================================================================
+	// ConcurrentHashMap Tests - Sharded reader/writer locking
+	//=====================================================================
+
+	//----------------------------------------------
+	// Basic construction and operations
+	//----------------------------------------------
+
+	TEST( ConcurrentHashMapBasic, DefaultConstruction )
+	{
+		ConcurrentHashMap<std::string, int> map;
+
+		EXPECT_TRUE( map.isEmpty() );
+		EXPECT_EQ( map.size(), 0 );
+		EXPECT_EQ( map.shardCount(), ( ConcurrentHashMap<std::string, int>::DEFAULT_SHARD_COUNT ) );
+	}
+
+	TEST( ConcurrentHashMapBasic, ShardCountRoundedToPowerOfTwo )
+	{
+		ConcurrentHashMap<int, int> zero( 0 );
+		ConcurrentHashMap<int, int> one( 1 );
+		ConcurrentHashMap<int, int> odd( 20 );
+
+		EXPECT_EQ( zero.shardCount(), 1 );
+		EXPECT_EQ( one.shardCount(), 1 );
+		EXPECT_EQ( odd.shardCount(), 32 );
+
+		// Single shard: every key must still be reachable
+		for ( int i = 0; i < 100; ++i )
+		{
+			one.insertOrAssign( i, i );
+		}
+		for ( int i = 0; i < 100; ++i )
+		{
+			int value = -1;
+			EXPECT_TRUE( one.tryGetValue( i, value ) );
+			EXPECT_EQ( value, i );
+		}
+	}
+
+	TEST( ConcurrentHashMapBasic, InsertLookupEraseAcrossShards )
+	{
+		ConcurrentHashMap<std::string, int> map( 8 );
+
+		for ( int i = 0; i < 1000; ++i )
+		{
+			map.insertOrAssign( "key_" + std::to_string( i ), i );
+		}
+		EXPECT_EQ( map.size(), 1000 );
+
+		map.insertOrAssign( "key_7", -7 );
+		EXPECT_EQ( map.size(), 1000 );
+
+		int value = 0;
+		EXPECT_TRUE( map.tryGetValue( std::string{ "key_7" }, value ) );
+		EXPECT_EQ( value, -7 );
+
+		value = 123;
+		EXPECT_FALSE( map.tryGetValue( std::string{ "missing" }, value ) );
+		EXPECT_EQ( value, 123 ); // Untouched on miss
+
+		EXPECT_TRUE( map.erase( std::string{ "key_7" } ) );
+		EXPECT_FALSE( map.erase( std::string{ "key_7" } ) );
+		EXPECT_FALSE( map.contains( std::string{ "key_7" } ) );
+		EXPECT_EQ( map.size(), 999 );
+	}
+
+	//----------------------------------------------
+	// Heterogeneous lookup operations
+	//----------------------------------------------
+
+	TEST( ConcurrentHashMapHeterogeneousLookup, StringTypes )
+	{
+		ConcurrentHashMap<std::string, int> map;
+
+		map.insertOrAssign( "lookup_test", 42 );
+
+		std::string strKey{ "lookup_test" };
+		std::string_view svKey{ strKey };
+		const char* cstrKey{ strKey.c_str() };
+
+		int value1 = 0;
+		int value2 = 0;
+		int value3 = 0;
+
+		EXPECT_TRUE( map.tryGetValue( strKey, value1 ) );
+		EXPECT_TRUE( map.tryGetValue( svKey, value2 ) );
+		EXPECT_TRUE( map.tryGetValue( cstrKey, value3 ) );
+		EXPECT_EQ( value1, 42 );
+		EXPECT_EQ( value2, 42 );
+		EXPECT_EQ( value3, 42 );
+
+		EXPECT_TRUE( map.contains( svKey ) );
+		EXPECT_TRUE( map.erase( svKey ) );
+		EXPECT_TRUE( map.isEmpty() );
+	}
+
+	//----------------------------------------------
+	// Callbacks and aggregation
+	//----------------------------------------------
+
+	TEST( ConcurrentHashMapCallbacks, VisitAndUpdate )
+	{
+		ConcurrentHashMap<std::string, std::vector<int>> map;
+
+		map.insertOrAssign( "list", std::vector<int>{ 1, 2, 3 } );
+
+		size_t length = 0;
+		EXPECT_TRUE( map.visit( std::string_view{ "list" }, [&length]( const std::vector<int>& v ) { length = v.size(); } ) );
+		EXPECT_EQ( length, 3 );
+
+		EXPECT_TRUE( map.update( std::string_view{ "list" }, []( std::vector<int>& v ) { v.push_back( 4 ); } ) );
+		EXPECT_FALSE( map.update( std::string_view{ "absent" }, []( std::vector<int>& v ) { v.clear(); } ) );
+
+		std::vector<int> copy;
+		EXPECT_TRUE( map.tryGetValue( std::string_view{ "list" }, copy ) );
+		EXPECT_EQ( copy, ( std::vector<int>{ 1, 2, 3, 4 } ) );
+	}
+
+	TEST( ConcurrentHashMapCallbacks, ForEachVisitsEveryElementOnce )
+	{
+		ConcurrentHashMap<int, int> map( 16 );
+
+		for ( int i = 0; i < 5000; ++i )
+		{
+			map.insertOrAssign( i, i * 2 );
+		}
+		for ( int i = 0; i < 5000; i += 5 )
+		{
+			map.erase( i );
+		}
+
+		std::unordered_map<int, int> seen;
+		map.forEach( [&seen]( const int& key, const int& value ) { EXPECT_TRUE( seen.emplace( key, value ).second ); } );
+
+		EXPECT_EQ( seen.size(), map.size() );
+		EXPECT_EQ( seen.size(), 4000 );
+		for ( const auto& [key, value] : seen )
+		{
+			EXPECT_EQ( value, key * 2 );
+			EXPECT_NE( key % 5, 0 );
+		}
+	}
+
+	TEST( ConcurrentHashMapCapacity, ReserveSpreadsOverShards )
+	{
+		ConcurrentHashMap<int, int> map( 4 );
+
+		map.reserve( 4000 );
+		for ( int i = 0; i < 2000; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		EXPECT_EQ( map.size(), 2000 );
+		int value = 0;
+		EXPECT_TRUE( map.tryGetValue( 1999, value ) );
+		EXPECT_EQ( value, 1999 );
+	}
+
+	//----------------------------------------------
+	// Multithreaded correctness
+	//----------------------------------------------
+
+	TEST( ConcurrentHashMapThreads, ParallelDisjointInserts )
+	{
+		ConcurrentHashMap<std::string, int> map;
+		constexpr int threadCount = 8;
+		constexpr int perThread = 2000;
+
+		std::vector<std::thread> threads;
+		for ( int t = 0; t < threadCount; ++t )
+		{
+			threads.emplace_back( [&map, t]() {
+				for ( int i = 0; i < perThread; ++i )
+				{
+					map.insertOrAssign( "t" + std::to_string( t ) + "_" + std::to_string( i ), t * perThread + i );
+				}
+			} );
+		}
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+
+		EXPECT_EQ( map.size(), static_cast<size_t>( threadCount * perThread ) );
+		for ( int t = 0; t < threadCount; ++t )
+		{
+			for ( int i = 0; i < perThread; ++i )
+			{
+				int value = -1;
+				ASSERT_TRUE( map.tryGetValue( "t" + std::to_string( t ) + "_" + std::to_string( i ), value ) );
+				EXPECT_EQ( value, t * perThread + i );
+			}
+		}
+	}
+
+	TEST( ConcurrentHashMapThreads, ConcurrentUpdatesAreAtomic )
+	{
+		ConcurrentHashMap<int, long> map;
+		constexpr int threadCount = 8;
+		constexpr int keyCount = 64;
+		constexpr int rounds = 500;
+
+		for ( int k = 0; k < keyCount; ++k )
+		{
+			map.insertOrAssign( k, 0L );
+		}
+
+		std::vector<std::thread> threads;
+		for ( int t = 0; t < threadCount; ++t )
+		{
+			threads.emplace_back( [&map]() {
+				for ( int r = 0; r < rounds; ++r )
+				{
+					for ( int k = 0; k < keyCount; ++k )
+					{
+						map.update( k, []( long& counter ) { ++counter; } );
+					}
+				}
+			} );
+		}
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+
+		map.forEach( []( const int&, const long& counter ) { EXPECT_EQ( counter, static_cast<long>( threadCount * rounds ) ); } );
+	}
+
+	TEST( ConcurrentHashMapThreads, ReadersObserveConsistentValuesDuringWrites )
+	{
+		ConcurrentHashMap<int, std::string> map( 4 );
+		constexpr int keyCount = 512;
+
+		for ( int k = 0; k < keyCount; ++k )
+		{
+			map.insertOrAssign( k, std::to_string( k ) );
+		}
+
+		std::atomic<bool> stop{ false };
+		std::atomic<int> badReads{ 0 };
+
+		std::vector<std::thread> readers;
+		for ( int r = 0; r < 4; ++r )
+		{
+			readers.emplace_back( [&]() {
+				while ( !stop.load( std::memory_order_relaxed ) )
+				{
+					for ( int k = 0; k < keyCount; ++k )
+					{
+						std::string value;
+						// Stable keys are never erased, only rewritten with the same prefix
+						if ( !map.tryGetValue( k, value ) || value.rfind( std::to_string( k ), 0 ) != 0 )
+						{
+							badReads.fetch_add( 1, std::memory_order_relaxed );
+						}
+					}
+				}
+			} );
+		}
+
+		// Writer churns stable keys and forces resizes with transient keys
+		for ( int round = 0; round < 20; ++round )
+		{
+			for ( int k = 0; k < keyCount; ++k )
+			{
+				map.insertOrAssign( k, std::to_string( k ) + "_r" + std::to_string( round ) );
+			}
+			for ( int k = keyCount; k < keyCount * 4; ++k )
+			{
+				map.insertOrAssign( k, "transient" );
+			}
+			for ( int k = keyCount; k < keyCount * 4; ++k )
+			{
+				map.erase( k );
+			}
+		}
+
+		stop.store( true );
+		for ( auto& reader : readers )
+		{
+			reader.join();
+		}
+
+		EXPECT_EQ( badReads.load(), 0 );
+		EXPECT_EQ( map.size(), static_cast<size_t>( keyCount ) );
+	}
+} // namespace nfx::containers::test
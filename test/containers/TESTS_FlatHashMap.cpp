@@ -0,0 +1,345 @@
+/**
+ * @file TESTS_FlatHashMap.cpp
+ * @brief Unit tests for FlatHashMap control-byte hashing container
+ * @details Test suite validating SIMD group probing, tombstone handling,
+ *          heterogeneous lookup operations and iteration
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <unordered_map>
+
+#include <nfx/containers/FlatHashMap.h>
+
+namespace nfx::containers::test
+{
+	//=====================================================================
+	// FlatHashMap Tests - Control-byte group probing
+	//=====================================================================
+
+	//----------------------------------------------
+	// Basic construction and operations
+	//----------------------------------------------
+
+	TEST( FlatHashMapBasic, DefaultConstruction )
+	{
+		FlatHashMap<std::string, int> map;
+
+		EXPECT_TRUE( map.isEmpty() );
+		EXPECT_EQ( map.size(), 0 );
+		EXPECT_GE( map.capacity(), 32 );
+		EXPECT_EQ( map.begin(), map.end() );
+	}
+
+	TEST( FlatHashMapBasic, CapacityConstruction )
+	{
+		FlatHashMap<std::string, int> map( 100 );
+
+		EXPECT_TRUE( map.isEmpty() );
+		EXPECT_GE( map.capacity(), 100 );
+		EXPECT_EQ( map.capacity() & ( map.capacity() - 1 ), 0 ); // Power of 2
+	}
+
+	TEST( FlatHashMapBasic, BasicInsertionAndLookup )
+	{
+		FlatHashMap<std::string, int> map;
+
+		map.insertOrAssign( "key1", 100 );
+		map.insertOrAssign( "key2", 200 );
+		map.insertOrAssign( "key3", 300 );
+
+		EXPECT_EQ( map.size(), 3 );
+
+		int* value1 = nullptr;
+		int* value2 = nullptr;
+		int* value3 = nullptr;
+		int* valueMissing = nullptr;
+
+		EXPECT_TRUE( map.tryGetValue( "key1", value1 ) );
+		EXPECT_TRUE( map.tryGetValue( "key2", value2 ) );
+		EXPECT_TRUE( map.tryGetValue( "key3", value3 ) );
+		EXPECT_FALSE( map.tryGetValue( "missing", valueMissing ) );
+
+		ASSERT_NE( value1, nullptr );
+		ASSERT_NE( value2, nullptr );
+		ASSERT_NE( value3, nullptr );
+		EXPECT_EQ( valueMissing, nullptr );
+
+		EXPECT_EQ( *value1, 100 );
+		EXPECT_EQ( *value2, 200 );
+		EXPECT_EQ( *value3, 300 );
+	}
+
+	TEST( FlatHashMapBasic, InsertOrAssignUpdate )
+	{
+		FlatHashMap<std::string, std::string> map;
+
+		map.insertOrAssign( "update_key", "initial_value" );
+		map.insertOrAssign( "update_key", "updated_value" );
+
+		std::string* value = nullptr;
+		EXPECT_TRUE( map.tryGetValue( "update_key", value ) );
+		ASSERT_NE( value, nullptr );
+		EXPECT_EQ( *value, "updated_value" );
+		EXPECT_EQ( map.size(), 1 );
+	}
+
+	//----------------------------------------------
+	// Heterogeneous lookup operations
+	//----------------------------------------------
+
+	TEST( FlatHashMapHeterogeneousLookup, StringTypes )
+	{
+		FlatHashMap<std::string, int> map;
+
+		map.insertOrAssign( "lookup_test", 42 );
+
+		std::string strKey{ "lookup_test" };
+		std::string_view svKey{ strKey };
+		const char* cstrKey{ strKey.c_str() };
+
+		int* value1 = nullptr;
+		int* value2 = nullptr;
+		int* value3 = nullptr;
+
+		EXPECT_TRUE( map.tryGetValue( strKey, value1 ) );
+		EXPECT_TRUE( map.tryGetValue( svKey, value2 ) );
+		EXPECT_TRUE( map.tryGetValue( cstrKey, value3 ) );
+
+		ASSERT_NE( value1, nullptr );
+		EXPECT_EQ( value1, value2 );
+		EXPECT_EQ( value1, value3 );
+		EXPECT_EQ( *value1, 42 );
+	}
+
+	//----------------------------------------------
+	// Erase operations
+	//----------------------------------------------
+
+	TEST( FlatHashMapErase, BasicErase )
+	{
+		FlatHashMap<std::string, int> map;
+
+		map.insertOrAssign( "erase1", 1 );
+		map.insertOrAssign( "erase2", 2 );
+		map.insertOrAssign( "erase3", 3 );
+
+		EXPECT_TRUE( map.erase( "erase2" ) );
+		EXPECT_FALSE( map.erase( "erase2" ) );
+		EXPECT_EQ( map.size(), 2 );
+
+		int* value = nullptr;
+		EXPECT_FALSE( map.tryGetValue( "erase2", value ) );
+		EXPECT_TRUE( map.tryGetValue( "erase1", value ) );
+		EXPECT_TRUE( map.tryGetValue( "erase3", value ) );
+	}
+
+	TEST( FlatHashMapErase, HeterogeneousErase )
+	{
+		FlatHashMap<std::string, int> map;
+
+		map.insertOrAssign( "hetero_erase", 999 );
+		EXPECT_TRUE( map.erase( std::string_view{ "hetero_erase" } ) );
+		EXPECT_EQ( map.size(), 0 );
+
+		map.insertOrAssign( "hetero_erase", 999 );
+		EXPECT_TRUE( map.erase( "hetero_erase" ) );
+		EXPECT_EQ( map.size(), 0 );
+	}
+
+	TEST( FlatHashMapErase, ChurnDoesNotGrowTable )
+	{
+		FlatHashMap<int, int> map;
+
+		// Constant live size with continuous churn: tombstones must be recycled
+		for ( int i = 0; i < 10000; ++i )
+		{
+			map.insertOrAssign( i, i );
+			if ( i >= 8 )
+			{
+				EXPECT_TRUE( map.erase( i - 8 ) );
+			}
+		}
+
+		EXPECT_EQ( map.size(), 8 );
+		EXPECT_LE( map.capacity(), 64 );
+
+		for ( int i = 9992; i < 10000; ++i )
+		{
+			int* value = nullptr;
+			EXPECT_TRUE( map.tryGetValue( i, value ) );
+			ASSERT_NE( value, nullptr );
+			EXPECT_EQ( *value, i );
+		}
+	}
+
+	//----------------------------------------------
+	// Capacity and memory management
+	//----------------------------------------------
+
+	TEST( FlatHashMapCapacity, ReserveCapacity )
+	{
+		FlatHashMap<std::string, int> map;
+
+		map.reserve( 1000 );
+		const size_t reserved = map.capacity();
+		EXPECT_GE( reserved, 1000 );
+
+		for ( size_t i = 0; i < 1000; ++i )
+		{
+			map.insertOrAssign( "key_" + std::to_string( i ), static_cast<int>( i ) );
+		}
+
+		// No rehash needed after reserve
+		EXPECT_EQ( map.capacity(), reserved );
+	}
+
+	TEST( FlatHashMapCapacity, AutomaticResize )
+	{
+		FlatHashMap<std::string, int> map;
+
+		const size_t initialCapacity = map.capacity();
+		const size_t itemsToInsert = initialCapacity * 4;
+
+		for ( size_t i = 0; i < itemsToInsert; ++i )
+		{
+			map.insertOrAssign( "key_" + std::to_string( i ), static_cast<int>( i ) );
+		}
+
+		EXPECT_GT( map.capacity(), initialCapacity );
+		EXPECT_EQ( map.size(), itemsToInsert );
+
+		for ( size_t i = 0; i < itemsToInsert; ++i )
+		{
+			int* value = nullptr;
+			EXPECT_TRUE( map.tryGetValue( "key_" + std::to_string( i ), value ) );
+			ASSERT_NE( value, nullptr );
+			EXPECT_EQ( *value, static_cast<int>( i ) );
+		}
+	}
+
+	//----------------------------------------------
+	// Iteration
+	//----------------------------------------------
+
+	TEST( FlatHashMapIteration, VisitsEveryElementOnce )
+	{
+		FlatHashMap<std::string, int> map;
+
+		for ( int i = 0; i < 200; ++i )
+		{
+			map.insertOrAssign( "iter_" + std::to_string( i ), i );
+		}
+		for ( int i = 0; i < 200; i += 3 )
+		{
+			map.erase( "iter_" + std::to_string( i ) );
+		}
+
+		std::unordered_map<std::string, int> seen;
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_TRUE( seen.emplace( key, value ).second );
+		}
+
+		EXPECT_EQ( seen.size(), map.size() );
+		for ( const auto& [key, value] : seen )
+		{
+			EXPECT_EQ( key, "iter_" + std::to_string( value ) );
+			EXPECT_NE( value % 3, 0 );
+		}
+	}
+
+	TEST( FlatHashMapIteration, Equality )
+	{
+		FlatHashMap<std::string, int> a;
+		FlatHashMap<std::string, int> b( 1024 );
+
+		for ( int i = 0; i < 100; ++i )
+		{
+			a.insertOrAssign( std::to_string( i ), i );
+			b.insertOrAssign( std::to_string( 99 - i ), 99 - i );
+		}
+
+		EXPECT_TRUE( a == b );
+
+		b.insertOrAssign( "50", -1 );
+		EXPECT_FALSE( a == b );
+	}
+
+	//----------------------------------------------
+	// Randomized consistency against std::unordered_map
+	//----------------------------------------------
+
+	TEST( FlatHashMapStress, RandomOperationsMatchReference )
+	{
+		FlatHashMap<std::uint64_t, std::uint64_t> map;
+		std::unordered_map<std::uint64_t, std::uint64_t> reference;
+
+		std::mt19937_64 gen( 42 );
+		std::uniform_int_distribution<std::uint64_t> keyDist( 0, 4000 );
+		std::uniform_int_distribution<int> opDist( 0, 9 );
+
+		for ( int i = 0; i < 50000; ++i )
+		{
+			const std::uint64_t key = keyDist( gen );
+			const int op = opDist( gen );
+
+			if ( op < 5 )
+			{
+				map.insertOrAssign( key, key * 3 + static_cast<std::uint64_t>( i ) );
+				reference.insert_or_assign( key, key * 3 + static_cast<std::uint64_t>( i ) );
+			}
+			else if ( op < 8 )
+			{
+				EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+			}
+			else
+			{
+				std::uint64_t* value = nullptr;
+				auto it = reference.find( key );
+				ASSERT_EQ( map.tryGetValue( key, value ), it != reference.end() );
+				if ( it != reference.end() )
+				{
+					EXPECT_EQ( *value, it->second );
+				}
+			}
+		}
+
+		EXPECT_EQ( map.size(), reference.size() );
+
+		size_t visited = 0;
+		for ( const auto& [key, value] : map )
+		{
+			auto it = reference.find( key );
+			ASSERT_NE( it, reference.end() );
+			EXPECT_EQ( value, it->second );
+			++visited;
+		}
+		EXPECT_EQ( visited, reference.size() );
+	}
+
+	//----------------------------------------------
+	// Value type tests
+	//----------------------------------------------
+
+	TEST( FlatHashMapValueTypes, MoveSemantics )
+	{
+		FlatHashMap<std::string, std::unique_ptr<int>> map;
+
+		for ( int i = 0; i < 100; ++i )
+		{
+			map.insertOrAssign( "unique_" + std::to_string( i ), std::make_unique<int>( i ) );
+		}
+
+		for ( int i = 0; i < 100; ++i )
+		{
+			std::unique_ptr<int>* value = nullptr;
+			EXPECT_TRUE( map.tryGetValue( "unique_" + std::to_string( i ), value ) );
+			ASSERT_NE( value, nullptr );
+			ASSERT_NE( value->get(), nullptr );
+			EXPECT_EQ( **value, i );
+		}
+	}
+} // namespace nfx::containers::test
@@ -7,6 +7,19 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
 #include <nfx/containers/HashMap.h>
 
 namespace nfx::containers::test
@@ -218,6 +231,114 @@ namespace nfx::containers::test
 		EXPECT_EQ( map.size(), 0 );
 	}
 
+	//----------------------------------------------
+	// Heterogeneous insertion
+	//----------------------------------------------
+
+	TEST( HashMapHeterogeneousInsertion, InsertOrAssignWithStringViewAndCString )
+	{
+		HashMap<std::string, std::string> map;
+
+		const std::string storage{ "a_key_long_enough_to_need_a_heap_allocation" };
+		const std::string_view svKey{ storage };
+
+		map.insertOrAssign( svKey, "first" );
+		map.insertOrAssign( storage.c_str(), "second" );
+		map.insertOrAssign( svKey, std::string{ "third" } );
+
+		EXPECT_EQ( map.size(), 1 );
+
+		std::string* value = nullptr;
+		EXPECT_TRUE( map.tryGetValue( storage, value ) );
+		ASSERT_NE( value, nullptr );
+		EXPECT_EQ( *value, "third" );
+
+		for ( const auto& [key, val] : map )
+		{
+			EXPECT_EQ( key, storage );
+		}
+	}
+
+	struct CountedValue
+	{
+		static inline int constructions = 0;
+
+		int value{};
+
+		CountedValue() = default;
+		CountedValue( int a, int b )
+			: value{ a + b }
+		{
+			++constructions;
+		}
+	};
+
+	TEST( HashMapHeterogeneousInsertion, TryEmplaceConstructsOnlyWhenAbsent )
+	{
+		HashMap<std::string, CountedValue> map;
+
+		auto [first, inserted] = map.tryEmplace( std::string_view{ "counter" }, 40, 2 );
+		EXPECT_TRUE( inserted );
+		ASSERT_NE( first, nullptr );
+		EXPECT_EQ( first->value, 42 );
+		EXPECT_EQ( CountedValue::constructions, 1 );
+
+		auto [second, insertedAgain] = map.tryEmplace( "counter", 0, 0 );
+		EXPECT_FALSE( insertedAgain );
+		EXPECT_EQ( second, first );
+		EXPECT_EQ( second->value, 42 );
+		EXPECT_EQ( CountedValue::constructions, 1 ); // Existing value untouched, nothing constructed
+		EXPECT_EQ( map.size(), 1 );
+	}
+
+	TEST( HashMapHeterogeneousInsertion, OtherIntegralTypesHashAsKeyType )
+	{
+		HashMap<std::uint32_t, int> map;
+
+		// -1 converts to 0xFFFFFFFF and must land where a std::uint32_t key does
+		map.insertOrAssign( -1, 7 );
+		int* value = nullptr;
+		ASSERT_TRUE( map.tryGetValue( 0xFFFFFFFFu, value ) );
+		EXPECT_EQ( *value, 7 );
+
+		map.insertOrAssign( 0xFFFFFFFFu, 8 );
+		EXPECT_EQ( map.size(), 1 );
+		EXPECT_EQ( *value, 8 );
+
+		auto [emplaced, inserted] = map.tryEmplace( std::int64_t{ 42 }, 1 );
+		EXPECT_TRUE( inserted );
+		EXPECT_FALSE( map.tryEmplace( std::uint16_t{ 42 }, 2 ).second );
+		ASSERT_TRUE( map.tryGetValue( 42u, value ) );
+		EXPECT_EQ( value, emplaced );
+		EXPECT_EQ( map.size(), 2 );
+	}
+
+	TEST( HashMapHeterogeneousInsertion, CounterUpdatesAcrossResizeAndRehash )
+	{
+		HashMap<std::string, int> map;
+		map.setIncrementalRehash( 4 );
+
+		std::vector<std::string> storage;
+		for ( int i = 0; i < 2000; ++i )
+		{
+			storage.push_back( "counter_key_" + std::to_string( i % 500 ) );
+		}
+
+		for ( const auto& key : storage )
+		{
+			auto [value, inserted] = map.tryEmplace( std::string_view{ key } );
+			++*value;
+		}
+
+		EXPECT_EQ( map.size(), 500 );
+		for ( int i = 0; i < 500; ++i )
+		{
+			int* value = nullptr;
+			ASSERT_TRUE( map.tryGetValue( "counter_key_" + std::to_string( i ), value ) );
+			EXPECT_EQ( *value, 4 );
+		}
+	}
+
 	//----------------------------------------------
 	// Capacity and memory management
 	//----------------------------------------------
@@ -524,4 +645,1534 @@ namespace nfx::containers::test
 		EXPECT_EQ( **value1, 42 );
 		EXPECT_EQ( **value2, 84 );
 	}
+
+	//----------------------------------------------
+	// Split (structure-of-arrays) layout
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue>
+	using SplitHashMap = HashMap<TKey, TValue,
+		core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS,
+		core::hashing::constants::DEFAULT_FNV_PRIME,
+		HashMapLayout::Split>;
+
+	struct LargeValue
+	{
+		std::array<std::uint64_t, 32> payload{};
+
+		bool operator==( const LargeValue& other ) const { return payload == other.payload; }
+		bool operator!=( const LargeValue& other ) const { return !( *this == other ); }
+	};
+
+	TEST( HashMapSplitLayout, BasicOperations )
+	{
+		SplitHashMap<std::string, int> map;
+
+		map.insertOrAssign( "alpha", 1 );
+		map.insertOrAssign( "beta", 2 );
+		map.insertOrAssign( "alpha", 10 );
+
+		EXPECT_EQ( map.size(), 2 );
+
+		int* value = nullptr;
+		EXPECT_TRUE( map.tryGetValue( std::string_view{ "alpha" }, value ) );
+		ASSERT_NE( value, nullptr );
+		EXPECT_EQ( *value, 10 );
+
+		EXPECT_TRUE( map.erase( "alpha" ) );
+		EXPECT_FALSE( map.tryGetValue( "alpha", value ) );
+		EXPECT_EQ( value, nullptr );
+		EXPECT_TRUE( map.tryGetValue( "beta", value ) );
+		EXPECT_EQ( map.size(), 1 );
+	}
+
+	TEST( HashMapSplitLayout, LargeValuesSurviveResizeAndErase )
+	{
+		SplitHashMap<std::string, LargeValue> map;
+
+		for ( std::uint64_t i = 0; i < 500; ++i )
+		{
+			LargeValue v;
+			v.payload.fill( i );
+			map.insertOrAssign( "big_" + std::to_string( i ), v );
+		}
+		for ( std::uint64_t i = 0; i < 500; i += 2 )
+		{
+			EXPECT_TRUE( map.erase( "big_" + std::to_string( i ) ) );
+		}
+
+		EXPECT_EQ( map.size(), 250 );
+		EXPECT_GE( map.capacity(), 500 );
+
+		for ( std::uint64_t i = 0; i < 500; ++i )
+		{
+			LargeValue* value = nullptr;
+			const bool found = map.tryGetValue( "big_" + std::to_string( i ), value );
+			EXPECT_EQ( found, i % 2 == 1 );
+			if ( found )
+			{
+				EXPECT_EQ( value->payload.front(), i );
+				EXPECT_EQ( value->payload.back(), i );
+			}
+		}
+
+		size_t visited = 0;
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( key, "big_" + std::to_string( value.payload[0] ) );
+			++visited;
+		}
+		EXPECT_EQ( visited, map.size() );
+	}
+
+	TEST( HashMapSplitLayout, MatchesInterleavedLayout )
+	{
+		HashMap<std::uint64_t, std::uint64_t> interleaved;
+		SplitHashMap<std::uint64_t, std::uint64_t> split;
+
+		std::mt19937_64 gen( 7 );
+		std::uniform_int_distribution<std::uint64_t> keyDist( 0, 2000 );
+
+		for ( int i = 0; i < 20000; ++i )
+		{
+			const std::uint64_t key = keyDist( gen );
+			if ( gen() % 3 == 0 )
+			{
+				EXPECT_EQ( interleaved.erase( key ), split.erase( key ) );
+			}
+			else
+			{
+				interleaved.insertOrAssign( key, key + static_cast<std::uint64_t>( i ) );
+				split.insertOrAssign( key, key + static_cast<std::uint64_t>( i ) );
+			}
+		}
+
+		ASSERT_EQ( interleaved.size(), split.size() );
+		EXPECT_EQ( interleaved.capacity(), split.capacity() );
+
+		for ( const auto& [key, value] : interleaved )
+		{
+			std::uint64_t* splitValue = nullptr;
+			ASSERT_TRUE( split.tryGetValue( key, splitValue ) );
+			EXPECT_EQ( *splitValue, value );
+		}
+	}
+
+	//----------------------------------------------
+	// Incremental rehash
+	//----------------------------------------------
+
+	TEST( HashMapIncrementalRehash, LookupsSeeBothTablesDuringMigration )
+	{
+		HashMap<std::string, int> map;
+		map.setIncrementalRehash( 4 );
+
+		bool sawRehashing = false;
+		for ( int i = 0; i < 5000; ++i )
+		{
+			map.insertOrAssign( "inc_" + std::to_string( i ), i );
+			sawRehashing = sawRehashing || map.isRehashing();
+
+			// Every previously inserted key stays reachable mid-migration
+			if ( map.isRehashing() )
+			{
+				for ( int j = 0; j <= i; j += 37 )
+				{
+					int* value = nullptr;
+					ASSERT_TRUE( map.tryGetValue( "inc_" + std::to_string( j ), value ) );
+					EXPECT_EQ( *value, j );
+				}
+			}
+		}
+
+		EXPECT_TRUE( sawRehashing );
+		EXPECT_EQ( map.size(), 5000 );
+	}
+
+	TEST( HashMapIncrementalRehash, UpdateAndEraseDuringMigration )
+	{
+		HashMap<std::string, int> map;
+		map.setIncrementalRehash( 2 );
+
+		int i = 0;
+		while ( !map.isRehashing() )
+		{
+			map.insertOrAssign( "key_" + std::to_string( i ), i );
+			++i;
+		}
+		const int inserted = i;
+
+		// Keys still in the old table must be updated in place, not duplicated
+		map.insertOrAssign( "key_" + std::to_string( inserted - 2 ), -1 );
+		EXPECT_EQ( map.size(), static_cast<size_t>( inserted ) );
+
+		int* value = nullptr;
+		ASSERT_TRUE( map.tryGetValue( "key_" + std::to_string( inserted - 2 ), value ) );
+		EXPECT_EQ( *value, -1 );
+
+		EXPECT_TRUE( map.erase( "key_0" ) );
+		EXPECT_FALSE( map.erase( "key_0" ) );
+		EXPECT_FALSE( map.tryGetValue( "key_0", value ) );
+		EXPECT_EQ( map.size(), static_cast<size_t>( inserted - 1 ) );
+
+		// Iteration spans both tables and visits each element once
+		std::unordered_map<std::string, int> seen;
+		for ( const auto& [key, v] : map )
+		{
+			EXPECT_TRUE( seen.emplace( key, v ).second );
+		}
+		EXPECT_EQ( seen.size(), map.size() );
+	}
+
+	TEST( HashMapIncrementalRehash, CompleteAndDisableDrainOldTable )
+	{
+		HashMap<int, int> map;
+		map.setIncrementalRehash( 2 );
+
+		int i = 0;
+		while ( !map.isRehashing() )
+		{
+			map.insertOrAssign( i, i );
+			++i;
+		}
+
+		map.completeRehash();
+		EXPECT_FALSE( map.isRehashing() );
+
+		while ( !map.isRehashing() )
+		{
+			map.insertOrAssign( i, i );
+			++i;
+		}
+
+		map.setIncrementalRehash( 0 );
+		EXPECT_FALSE( map.isRehashing() );
+
+		for ( int j = 0; j < i; ++j )
+		{
+			int* value = nullptr;
+			ASSERT_TRUE( map.tryGetValue( j, value ) );
+			EXPECT_EQ( *value, j );
+		}
+	}
+
+	TEST( HashMapIncrementalRehash, RandomOperationsMatchReference )
+	{
+		HashMap<std::uint64_t, std::uint64_t> map;
+		SplitHashMap<std::uint64_t, std::uint64_t> splitMap;
+		std::unordered_map<std::uint64_t, std::uint64_t> reference;
+
+		map.setIncrementalRehash( 2 );
+		splitMap.setIncrementalRehash( 3 );
+
+		std::mt19937_64 gen( 11 );
+		std::uniform_int_distribution<std::uint64_t> keyDist( 0, 50000 );
+
+		for ( int i = 0; i < 100000; ++i )
+		{
+			const std::uint64_t key = keyDist( gen );
+			const std::uint64_t op = gen() % 10;
+
+			if ( op < 6 )
+			{
+				map.insertOrAssign( key, key ^ static_cast<std::uint64_t>( i ) );
+				splitMap.insertOrAssign( key, key ^ static_cast<std::uint64_t>( i ) );
+				reference.insert_or_assign( key, key ^ static_cast<std::uint64_t>( i ) );
+			}
+			else if ( op < 8 )
+			{
+				const bool expected = reference.erase( key ) == 1;
+				EXPECT_EQ( map.erase( key ), expected );
+				EXPECT_EQ( splitMap.erase( key ), expected );
+			}
+			else
+			{
+				auto it = reference.find( key );
+				std::uint64_t* value = nullptr;
+				std::uint64_t* splitValue = nullptr;
+				ASSERT_EQ( map.tryGetValue( key, value ), it != reference.end() );
+				ASSERT_EQ( splitMap.tryGetValue( key, splitValue ), it != reference.end() );
+				if ( it != reference.end() )
+				{
+					EXPECT_EQ( *value, it->second );
+					EXPECT_EQ( *splitValue, it->second );
+				}
+			}
+		}
+
+		EXPECT_EQ( map.size(), reference.size() );
+		EXPECT_EQ( splitMap.size(), reference.size() );
+
+		size_t visited = 0;
+		for ( const auto& [key, value] : map )
+		{
+			auto it = reference.find( key );
+			ASSERT_NE( it, reference.end() );
+			EXPECT_EQ( value, it->second );
+			++visited;
+		}
+		EXPECT_EQ( visited, reference.size() );
+	}
+
+	//----------------------------------------------
+	// Batch lookup
+	//----------------------------------------------
+
+	TEST( HashMapBatch, TryGetValuesMatchesSingleLookups )
+	{
+		HashMap<std::string, int> map;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			map.insertOrAssign( "batch_" + std::to_string( i ), i );
+		}
+
+		std::vector<std::string> keys;
+		for ( int i = 0; i < 1100; i += 3 )
+		{
+			keys.push_back( "batch_" + std::to_string( i ) );
+		}
+
+		std::vector<int*> values( keys.size(), nullptr );
+		const size_t found = map.tryGetValues( keys, values );
+
+		EXPECT_EQ( found, 334u );
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			int* single = nullptr;
+			map.tryGetValue( keys[i], single );
+			EXPECT_EQ( values[i], single ) << keys[i];
+		}
+	}
+
+	TEST( HashMapBatch, HeterogeneousKeysDuringIncrementalRehash )
+	{
+		SplitHashMap<std::string, int> map;
+		map.setIncrementalRehash( 2 );
+
+		int i = 0;
+		while ( !map.isRehashing() )
+		{
+			map.insertOrAssign( "key_" + std::to_string( i ), i );
+			++i;
+		}
+
+		std::vector<std::string> storage;
+		for ( int j = 0; j < i + 10; ++j )
+		{
+			storage.push_back( "key_" + std::to_string( j ) );
+		}
+		std::vector<std::string_view> keys( storage.begin(), storage.end() );
+		std::vector<int*> values( keys.size(), nullptr );
+
+		EXPECT_EQ( map.tryGetValues<std::string_view>( keys, values ), static_cast<size_t>( i ) );
+		for ( int j = 0; j < i + 10; ++j )
+		{
+			if ( j < i )
+			{
+				ASSERT_NE( values[j], nullptr );
+				EXPECT_EQ( *values[j], j );
+			}
+			else
+			{
+				EXPECT_EQ( values[j], nullptr );
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Polymorphic allocator support
+	//----------------------------------------------
+
+	/**
+	 * @brief Makes any allocation from the default memory resource throw while in scope
+	 */
+	struct NoDefaultResource
+	{
+		std::pmr::memory_resource* previous{ std::pmr::set_default_resource( std::pmr::null_memory_resource() ) };
+
+		~NoDefaultResource() { std::pmr::set_default_resource( previous ); }
+	};
+
+	/**
+	 * @brief Fixed buffer arena that cannot fall back to the heap
+	 */
+	struct BufferArena
+	{
+		std::vector<std::byte> buffer = std::vector<std::byte>( 1 << 20 );
+		std::pmr::monotonic_buffer_resource resource{ buffer.data(), buffer.size(), std::pmr::null_memory_resource() };
+
+		bool owns( const void* ptr ) const
+		{
+			const auto* byte{ static_cast<const std::byte*>( ptr ) };
+			return byte >= buffer.data() && byte < buffer.data() + buffer.size();
+		}
+	};
+
+	TEST( HashMapPmr, BucketsAndKeysComeFromArena )
+	{
+		BufferArena arena;
+		NoDefaultResource guard;
+
+		pmr::HashMap<std::pmr::string, int> map( &arena.resource );
+		EXPECT_EQ( map.allocator().resource(), &arena.resource );
+
+		for ( int i = 0; i < 500; ++i )
+		{
+			const std::string key{ "per_request_key_longer_than_sso_" + std::to_string( i ) };
+			map.insertOrAssign( std::string_view{ key }, i );
+		}
+		EXPECT_EQ( map.size(), 500 );
+
+		int* value = nullptr;
+		ASSERT_TRUE( map.tryGetValue( std::string_view{ "per_request_key_longer_than_sso_42" }, value ) );
+		EXPECT_EQ( *value, 42 );
+		EXPECT_TRUE( map.erase( std::string_view{ "per_request_key_longer_than_sso_42" } ) );
+		EXPECT_FALSE( map.tryGetValue( std::string_view{ "per_request_key_longer_than_sso_42" }, value ) );
+
+		for ( const auto& [key, val] : map )
+		{
+			EXPECT_TRUE( arena.owns( key.data() ) ) << key;
+			EXPECT_TRUE( arena.owns( &val ) );
+		}
+	}
+
+	TEST( HashMapPmr, SplitLayoutIncrementalRehashStaysInArena )
+	{
+		BufferArena arena;
+		NoDefaultResource guard;
+
+		pmr::HashMap<std::pmr::string, std::pmr::string, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS,
+			core::hashing::constants::DEFAULT_FNV_PRIME, HashMapLayout::Split>
+			map( &arena.resource );
+		map.setIncrementalRehash( 4 );
+
+		for ( int i = 0; i < 300; ++i )
+		{
+			const std::string key{ "split_layout_key_longer_than_sso_" + std::to_string( i ) };
+			auto [value, inserted] = map.tryEmplace( std::string_view{ key }, "value_longer_than_small_string_buffer" );
+			EXPECT_TRUE( inserted );
+			EXPECT_TRUE( arena.owns( value->data() ) );
+		}
+		map.completeRehash();
+
+		for ( const auto& [key, val] : map )
+		{
+			EXPECT_TRUE( arena.owns( key.data() ) ) << key;
+			EXPECT_TRUE( arena.owns( val.data() ) ) << val;
+		}
+	}
+
+	TEST( HashMapPmr, AllocatorExtendedCopyAndMove )
+	{
+		BufferArena source;
+		BufferArena target;
+
+		pmr::HashMap<std::pmr::string, int> original( &source.resource );
+		for ( int i = 0; i < 100; ++i )
+		{
+			original.insertOrAssign( std::pmr::string{ "copied_key_longer_than_sso_" + std::to_string( i ), &source.resource }, i );
+		}
+
+		pmr::HashMap<std::pmr::string, int> copy( original, &target.resource );
+		EXPECT_EQ( copy.allocator().resource(), &target.resource );
+		EXPECT_TRUE( copy == original );
+		for ( const auto& [key, val] : copy )
+		{
+			EXPECT_TRUE( target.owns( key.data() ) ) << key;
+		}
+
+		// Equal allocators: storage is stolen, nothing is reallocated
+		const auto* firstKey{ original.begin()->first.data() };
+		pmr::HashMap<std::pmr::string, int> moved( std::move( original ), &source.resource );
+		EXPECT_EQ( moved.size(), 100 );
+		EXPECT_EQ( moved.begin()->first.data(), firstKey );
+	}
+
+	//----------------------------------------------
+	// Hash policies
+	//----------------------------------------------
+
+	/**
+	 * @brief Deterministic key bytes shared by the reference vectors
+	 */
+	static std::string patternKey( size_t length )
+	{
+		std::string key( length, '\0' );
+		for ( size_t i = 0; i < length; ++i )
+		{
+			key[i] = static_cast<char>( ( i * 31 + 7 ) & 0xFF );
+		}
+		return key;
+	}
+
+	/**
+	 * @brief Insert, look up and erase string and integer keys through a given policy
+	 */
+	template <typename Hasher>
+	static void exerciseHashPolicy()
+	{
+		using Map = HashMap<std::string, size_t, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Interleaved, std::allocator<std::pair<const std::string, size_t>>, Hasher>;
+		static_assert( std::is_same_v<typename Map::hasher, Hasher> );
+
+		Map map;
+		std::vector<std::string> keys;
+		for ( size_t i = 0; i < 3000; ++i )
+		{
+			// Lengths 1-1023 exercise every short, medium and long path of the algorithms
+			keys.push_back( "/srv/" + std::to_string( i ) + std::string( i % 1019, 'p' ) );
+			map.insertOrAssign( std::string_view{ keys.back() }, i );
+		}
+		EXPECT_EQ( map.size(), keys.size() );
+
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			size_t* value = nullptr;
+			ASSERT_TRUE( map.tryGetValue( std::string_view{ keys[i] }, value ) ) << keys[i].size();
+			EXPECT_EQ( *value, i );
+		}
+		for ( size_t i = 0; i < keys.size(); i += 2 )
+		{
+			EXPECT_TRUE( map.erase( keys[i] ) );
+		}
+		EXPECT_EQ( map.size(), keys.size() / 2 );
+		size_t* remaining = nullptr;
+		EXPECT_TRUE( map.tryGetValue( keys[1].c_str(), remaining ) );
+		EXPECT_FALSE( map.tryGetValue( keys[0].c_str(), remaining ) );
+
+		HashMap<int, int, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Split, std::allocator<std::pair<const int, int>>, Hasher>
+			integers;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			integers.insertOrAssign( i, -i );
+		}
+		int* value = nullptr;
+		ASSERT_TRUE( integers.tryGetValue( 999, value ) );
+		EXPECT_EQ( *value, -999 );
+	}
+
+	/**
+	 * @brief Hashes agree across string types and react to every byte
+	 */
+	template <typename Hasher>
+	static void checkHashPolicyConsistency()
+	{
+		const Hasher hasher{};
+
+		for ( size_t length : { 0, 1, 3, 4, 7, 8, 9, 16, 17, 23, 24, 25, 48, 128, 129, 240, 241, 1024 } )
+		{
+			std::string key{ patternKey( length ) };
+			const size_t hash{ hasher( key ) };
+			EXPECT_EQ( hash, hasher( std::string_view{ key } ) );
+
+			if ( length > 0 )
+			{
+				key.back() ^= 0x01;
+				EXPECT_NE( hash, hasher( key ) ) << "last byte ignored at length " << length;
+				key.back() ^= 0x01;
+				key.front() ^= 0x01;
+				EXPECT_NE( hash, hasher( key ) ) << "first byte ignored at length " << length;
+			}
+			EXPECT_NE( hash, hasher( patternKey( length + 1 ) ) );
+		}
+
+		EXPECT_EQ( hasher( "file.txt" ), hasher( std::string_view{ "file.txt" } ) );
+	}
+
+	TEST( HashMapHashPolicy, Xxh3MatchesReferenceVectors )
+	{
+		// Produced with XXH3_64bits() from xxHash 0.8.2
+		constexpr std::pair<size_t, std::uint64_t> vectors[]{
+			{ 0, 0x2d06800538d394c2ull },
+			{ 3, 0x15f7093b173d005cull },
+			{ 8, 0xdec6a9a43575982eull },
+			{ 16, 0x7e484c18d74895d0ull },
+			{ 100, 0x8c97158042fbf926ull },
+			{ 200, 0x12fdb864685f344dull },
+			{ 1500, 0x486b334c5917c521ull } };
+
+		for ( const auto& [length, expected] : vectors )
+		{
+			const std::string key{ patternKey( length ) };
+			EXPECT_EQ( detail::Xxh3Algorithm::hash( key.data(), key.size() ), expected ) << "length " << length;
+		}
+	}
+
+	TEST( HashMapHashPolicy, PoliciesAreConsistentAndByteSensitive )
+	{
+		checkHashPolicyConsistency<Crc32Hash>();
+		checkHashPolicyConsistency<WyHash>();
+		checkHashPolicyConsistency<Xxh3Hash>();
+	}
+
+	TEST( HashMapHashPolicy, Crc32Policy )
+	{
+		exerciseHashPolicy<Crc32Hash>();
+	}
+
+	TEST( HashMapHashPolicy, WyHashPolicy )
+	{
+		exerciseHashPolicy<WyHash>();
+	}
+
+	TEST( HashMapHashPolicy, Xxh3Policy )
+	{
+		exerciseHashPolicy<Xxh3Hash>();
+	}
+
+	TEST( HashMapHashPolicy, PmrAliasAcceptsPolicy )
+	{
+		std::pmr::monotonic_buffer_resource arena;
+		pmr::HashMap<std::pmr::string, int, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Interleaved, WyHash>
+			map( &arena );
+
+		map.insertOrAssign( std::string_view{ "a/rather/long/path/that/does/not/fit/sso" }, 1 );
+		int* value = nullptr;
+		ASSERT_TRUE( map.tryGetValue( std::string_view{ "a/rather/long/path/that/does/not/fit/sso" }, value ) );
+		EXPECT_EQ( *value, 1 );
+	}
+
+	//----------------------------------------------
+	// Seeded hashing and collision-attack guard
+	//----------------------------------------------
+
+	/**
+	 * @brief Reseedable hasher whose initial key sends every integer to the same bucket
+	 * @details Stands in for a deterministic hash whose collisions an attacker has precomputed
+	 */
+	struct CollidingUntilReseeded
+	{
+		std::uint64_t seed{ 0 };
+		int reseeds{ 0 };
+
+		void reseed()
+		{
+			seed = 0x9E3779B97F4A7C15ull * static_cast<std::uint64_t>( ++reseeds );
+		}
+
+		size_t operator()( int value ) const noexcept
+		{
+			return seed == 0 ? 0x2A : static_cast<size_t>( core::hashing::hashInteger( static_cast<std::uint64_t>( value ) ^ seed ) );
+		}
+	};
+
+	TEST( HashMapSeededHash, SipHashMatchesReferenceVectors )
+	{
+		// CPython 3.11 hash() of the same bytes with PYTHONHASHSEED=0 (SipHash-1-3, zero key)
+		constexpr std::pair<std::string_view, std::uint64_t> vectors[]{
+			{ "a", 0x407448d2b89b1813ull },
+			{ "abcdefg", 0x6db12aae9070f506ull },
+			{ "abcdefgh", 0x3f7b849c0b8e35eaull },
+			{ "hello world, this is siphash13 test!", 0xe79df9727ce0db2cull } };
+
+		for ( const auto& [input, expected] : vectors )
+		{
+			EXPECT_EQ( detail::SipHash13Algorithm::hash( input.data(), input.size(), 0, 0 ), expected ) << input;
+		}
+
+		const SipHash13 zeroKey{ 0, 0 };
+		EXPECT_EQ( zeroKey( "abcdefgh" ), 0x3f7b849c0b8e35eaull );
+	}
+
+	TEST( HashMapSeededHash, KeysArePerInstanceAndSharedByCopies )
+	{
+		static_assert( ReseedableHasher<SipHash13> );
+		static_assert( !ReseedableHasher<WyHash> );
+
+		const SipHash13 first;
+		const SipHash13 second;
+		EXPECT_FALSE( first.key0() == second.key0() && first.key1() == second.key1() );
+		EXPECT_NE( first( "Content-Type" ), second( "Content-Type" ) );
+
+		SipHash13 copy{ first };
+		EXPECT_EQ( copy( "Content-Type" ), first( "Content-Type" ) );
+		copy.reseed();
+		EXPECT_NE( copy( "Content-Type" ), first( "Content-Type" ) );
+
+		checkHashPolicyConsistency<SipHash13>();
+	}
+
+	TEST( HashMapSeededHash, SipHashPolicy )
+	{
+		exerciseHashPolicy<SipHash13>();
+
+		// A copied map keeps the key its stored hashes were computed with
+		HashMap<std::string, int, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Interleaved, std::allocator<std::pair<const std::string, int>>, SipHash13>
+			original;
+		for ( int i = 0; i < 500; ++i )
+		{
+			original.insertOrAssign( "field_" + std::to_string( i ), i );
+		}
+
+		const auto copy{ original };
+		const auto reallocated{ decltype( original ){ original, original.allocator() } };
+		EXPECT_EQ( copy.hashFunction().key0(), original.hashFunction().key0() );
+		EXPECT_EQ( reallocated.hashFunction().key1(), original.hashFunction().key1() );
+		EXPECT_TRUE( copy == original );
+
+		auto mutableCopy{ reallocated };
+		int* value = nullptr;
+		ASSERT_TRUE( mutableCopy.tryGetValue( std::string_view{ "field_321" }, value ) );
+		EXPECT_EQ( *value, 321 );
+	}
+
+	TEST( HashMapSeededHash, LongProbeSequenceTriggersReseed )
+	{
+		HashMap<int, int, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Interleaved, std::allocator<std::pair<const int, int>>, CollidingUntilReseeded>
+			map;
+
+		for ( int i = 0; i < 5000; ++i )
+		{
+			auto [value, inserted] = map.tryEmplace( i, i * 7 );
+			ASSERT_TRUE( inserted );
+			ASSERT_NE( value, nullptr );
+			EXPECT_EQ( *value, i * 7 );
+		}
+
+		// One reseed breaks the flood; without it every lookup would scan thousands of buckets
+		EXPECT_EQ( map.hashFunction().reseeds, 1 );
+		EXPECT_EQ( map.size(), 5000 );
+		for ( int i = 0; i < 5000; ++i )
+		{
+			int* value = nullptr;
+			ASSERT_TRUE( map.tryGetValue( i, value ) ) << i;
+			EXPECT_EQ( *value, i * 7 );
+		}
+	}
+
+	TEST( HashMapSeededHash, GuardRunsDuringIncrementalRehash )
+	{
+		HashMap<int, int, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Split, std::allocator<std::pair<const int, int>>, CollidingUntilReseeded>
+			map;
+		map.setIncrementalRehash( 2 );
+
+		for ( int i = 0; i < 3000; ++i )
+		{
+			map.insertOrAssign( i, -i );
+		}
+		for ( int i = 0; i < 3000; i += 3 )
+		{
+			EXPECT_TRUE( map.erase( i ) );
+		}
+
+		EXPECT_GE( map.hashFunction().reseeds, 1 );
+		EXPECT_EQ( map.size(), 2000 );
+		for ( int i = 0; i < 3000; ++i )
+		{
+			int* value = nullptr;
+			EXPECT_EQ( map.tryGetValue( i, value ), i % 3 != 0 ) << i;
+		}
+	}
+
+	TEST( HashMapSeededHash, PrecomputedCollisionsAreDefeated )
+	{
+		using Map = HashMap<std::string, int, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Interleaved, std::allocator<std::pair<const std::string, int>>, SipHash13>;
+
+		Map map;
+		map.reserve( 1024 );
+		const SipHash13 leaked{ map.hashFunction() };
+
+		// Attacker who learned the key: find 200 keys sharing one home bucket
+		std::vector<std::string> flood;
+		for ( int i = 0; flood.size() < 200; ++i )
+		{
+			std::string key{ "k" + std::to_string( i ) };
+			if ( ( leaked( key ) & 1023 ) == 0 )
+			{
+				flood.push_back( std::move( key ) );
+			}
+		}
+
+		for ( size_t i = 0; i < flood.size(); ++i )
+		{
+			map.insertOrAssign( flood[i], static_cast<int>( i ) );
+		}
+
+		EXPECT_NE( map.hashFunction().key0(), leaked.key0() );
+		EXPECT_EQ( map.capacity(), 1024 );
+		for ( size_t i = 0; i < flood.size(); ++i )
+		{
+			int* value = nullptr;
+			ASSERT_TRUE( map.tryGetValue( std::string_view{ flood[i] }, value ) );
+			EXPECT_EQ( *value, static_cast<int>( i ) );
+		}
+	}
+
+	//----------------------------------------------
+	// Statistics
+	//----------------------------------------------
+
+	/**
+	 * @brief Degenerate hasher sending every key to the same home bucket
+	 */
+	struct ConstantHash
+	{
+		size_t operator()( int ) const noexcept
+		{
+			return 7;
+		}
+	};
+
+	TEST( HashMapStatistics, ShapeOfHealthyTable )
+	{
+		HashMap<int, int> map;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		const HashMapStats stats{ map.stats() };
+		EXPECT_EQ( stats.size, 1000 );
+		EXPECT_EQ( stats.capacity, map.capacity() );
+		EXPECT_DOUBLE_EQ( stats.loadFactor, 1000.0 / static_cast<double>( map.capacity() ) );
+		EXPECT_EQ( stats.emptyBuckets, map.capacity() - 1000 );
+
+		size_t histogramTotal{ 0 };
+		for ( size_t count : stats.distanceHistogram )
+		{
+			histogramTotal += count;
+		}
+		EXPECT_EQ( histogramTotal, 1000 );
+		ASSERT_FALSE( stats.distanceHistogram.empty() );
+		EXPECT_EQ( stats.maxDistance, stats.distanceHistogram.size() - 1 );
+		EXPECT_GT( stats.distanceHistogram.back(), 0 );
+		EXPECT_LT( stats.maxDistance, 32 );
+		EXPECT_DOUBLE_EQ( stats.expectedSuccessfulProbes, stats.meanDistance + 1.0 );
+		EXPECT_GE( stats.expectedUnsuccessfulProbes, 1.0 );
+		EXPECT_LT( stats.expectedUnsuccessfulProbes, 8.0 );
+
+		const HashMapStats empty{ HashMap<int, int>{}.stats() };
+		EXPECT_EQ( empty.maxDistance, 0 );
+		EXPECT_TRUE( empty.distanceHistogram.empty() );
+		EXPECT_DOUBLE_EQ( empty.expectedUnsuccessfulProbes, 1.0 );
+	}
+
+	TEST( HashMapStatistics, ShapeOfDegenerateTable )
+	{
+		HashMap<int, int, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Split, std::allocator<std::pair<const int, int>>, ConstantHash>
+			map{ 128 };
+		for ( int i = 0; i < 50; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		// One cluster starting at bucket 7: distances 0..49, one element each
+		const HashMapStats stats{ map.stats() };
+		EXPECT_EQ( stats.maxDistance, 49 );
+		EXPECT_EQ( stats.distanceHistogram, std::vector<size_t>( 50, 1 ) );
+		EXPECT_DOUBLE_EQ( stats.meanDistance, 24.5 );
+		EXPECT_GT( stats.expectedUnsuccessfulProbes, 1.0 );
+	}
+
+	TEST( HashMapStatistics, RecordedCounters )
+	{
+		HashMap<int, int> map;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+		map.resetStats();
+
+		int* value = nullptr;
+		for ( int i = 0; i < 1500; ++i )
+		{
+			static_cast<void>( map.tryGetValue( i, value ) );
+		}
+		map.reserve( 8192 );
+
+		const HashMapStats stats{ map.stats() };
+#if NFX_META_HASHMAP_STATS
+		EXPECT_TRUE( stats.recorded );
+		EXPECT_EQ( stats.lookups, 1500 );
+		EXPECT_EQ( stats.hits, 1000 );
+		EXPECT_GE( stats.meanSuccessfulProbes, 1.0 );
+		EXPECT_GE( stats.meanUnsuccessfulProbes, 1.0 );
+		EXPECT_EQ( stats.resizes, 1 );
+		EXPECT_GT( stats.rehashTime.count(), 0 );
+
+		map.resetStats();
+		EXPECT_EQ( map.stats().lookups, 0 );
+#else
+		EXPECT_FALSE( stats.recorded );
+		EXPECT_EQ( stats.lookups, 0 );
+		EXPECT_EQ( stats.resizes, 0 );
+		EXPECT_EQ( stats.rehashTime.count(), 0 );
+#endif
+	}
+
+	//----------------------------------------------
+	// Occupancy bitmap
+	//----------------------------------------------
+
+	TEST( HashMapOccupancy, SparseIterationAfterMassErase )
+	{
+		HashMap<int, int> map;
+		map.reserve( 100000 );
+		for ( int i = 0; i < 20000; ++i )
+		{
+			map.insertOrAssign( i, i * 3 );
+		}
+		for ( int i = 0; i < 20000; ++i )
+		{
+			if ( i % 97 != 0 )
+			{
+				EXPECT_TRUE( map.erase( i ) );
+			}
+		}
+
+		std::vector<int> keys;
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( value, key * 3 );
+			keys.push_back( key );
+		}
+		std::sort( keys.begin(), keys.end() );
+
+		std::vector<int> expected;
+		for ( int i = 0; i < 20000; i += 97 )
+		{
+			expected.push_back( i );
+		}
+		EXPECT_EQ( keys, expected );
+		EXPECT_EQ( map.size(), expected.size() );
+
+		// Occupied buckets at both ends of the array and across word boundaries
+		HashMap<int, int> small{ 128 };
+		for ( int i = 0; i < 64; ++i )
+		{
+			small.insertOrAssign( i, i );
+		}
+		size_t visited = 0;
+		for ( auto it = small.begin(); it != small.end(); ++it )
+		{
+			++visited;
+		}
+		EXPECT_EQ( visited, 64 );
+	}
+
+	TEST( HashMapOccupancy, ClearKeepsCapacityAndAllowsReuse )
+	{
+		HashMap<std::string, std::string, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME, HashMapLayout::Split> split;
+		HashMap<std::string, std::string> interleaved;
+		for ( int i = 0; i < 3000; ++i )
+		{
+			const std::string key{ "flush_" + std::to_string( i ) };
+			split.insertOrAssign( key, std::string( 40, 'v' ) );
+			interleaved.insertOrAssign( key, std::string( 40, 'v' ) );
+		}
+		const size_t capacity{ split.capacity() };
+
+		split.clear();
+		interleaved.clear();
+		EXPECT_TRUE( split.isEmpty() );
+		EXPECT_TRUE( interleaved.isEmpty() );
+		EXPECT_EQ( split.capacity(), capacity );
+		EXPECT_EQ( split.begin(), split.end() );
+		EXPECT_EQ( interleaved.begin(), interleaved.end() );
+		EXPECT_EQ( split.stats().emptyBuckets, capacity );
+
+		std::string* value = nullptr;
+		EXPECT_FALSE( split.tryGetValue( "flush_10", value ) );
+
+		split.insertOrAssign( "again", "v" );
+		interleaved.insertOrAssign( "again", "v" );
+		ASSERT_TRUE( split.tryGetValue( "again", value ) );
+		EXPECT_EQ( *value, "v" );
+		EXPECT_EQ( split.size(), 1 );
+		EXPECT_EQ( std::distance( interleaved.begin(), interleaved.end() ), 1 );
+	}
+
+	TEST( HashMapOccupancy, ClearDuringIncrementalRehash )
+	{
+		HashMap<std::string, int> map;
+		map.setIncrementalRehash( 2 );
+
+		int i = 0;
+		while ( !map.isRehashing() )
+		{
+			map.insertOrAssign( "key_" + std::to_string( i ), i );
+			++i;
+		}
+
+		map.clear();
+		EXPECT_FALSE( map.isRehashing() );
+		EXPECT_TRUE( map.isEmpty() );
+		EXPECT_EQ( map.begin(), map.end() );
+
+		// The map keeps working, including later incremental resizes
+		std::unordered_map<std::string, int> reference;
+		for ( int j = 0; j < 5000; ++j )
+		{
+			const std::string key{ "after_" + std::to_string( j ) };
+			map.insertOrAssign( key, j );
+			reference[key] = j;
+			if ( j % 5 == 0 )
+			{
+				EXPECT_TRUE( map.erase( key ) );
+				reference.erase( key );
+			}
+		}
+
+		ASSERT_EQ( map.size(), reference.size() );
+		size_t visited = 0;
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( reference.at( key ), value );
+			++visited;
+		}
+		EXPECT_EQ( visited, reference.size() );
+	}
+
+	//----------------------------------------------
+	// Bulk erase
+	//----------------------------------------------
+
+	TEST( HashMapBulkErase, EraseIfMatchesReference )
+	{
+		HashMap<int, std::string> map;
+		std::unordered_map<int, std::string> reference;
+		std::mt19937 rng{ 2024 };
+		for ( int i = 0; i < 20000; ++i )
+		{
+			const int key{ static_cast<int>( rng() % 50000 ) };
+			map.insertOrAssign( key, "value_" + std::to_string( key ) );
+			reference[key] = "value_" + std::to_string( key );
+		}
+
+		const auto expired{ []( const int& key, const std::string& ) { return key % 5 < 2; } };
+		const size_t expected{ std::erase_if( reference, [&]( const auto& pair ) { return expired( pair.first, pair.second ); } ) };
+		EXPECT_EQ( map.eraseIf( expired ), expected );
+		ASSERT_EQ( map.size(), reference.size() );
+
+		for ( const auto& [key, value] : reference )
+		{
+			std::string* found = nullptr;
+			ASSERT_TRUE( map.tryGetValue( key, found ) );
+			EXPECT_EQ( *found, value );
+		}
+		size_t visited = 0;
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( reference.at( key ), value );
+			++visited;
+		}
+		EXPECT_EQ( visited, reference.size() );
+		EXPECT_EQ( map.eraseIf( expired ), 0 );
+
+		// Single-key operations still agree after the compaction
+		for ( int key = 0; key < 50000; key += 3 )
+		{
+			EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+		}
+		map.insertOrAssign( 1, "one" );
+		EXPECT_EQ( map.size(), reference.size() + 1 );
+	}
+
+	TEST( HashMapBulkErase, CompactsWrappingClusterToHome )
+	{
+		struct NearEndHash
+		{
+			size_t operator()( int ) const noexcept
+			{
+				return 60;
+			}
+		};
+
+		HashMap<int, int, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Split, std::allocator<std::pair<const int, int>>, NearEndHash>
+			map{ 64 };
+		for ( int i = 0; i < 40; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		// One cluster from bucket 60 wrapping to bucket 35
+		EXPECT_EQ( map.eraseIf( []( const int& key, const int& ) { return key % 2 == 0; } ), 20 );
+		EXPECT_EQ( map.size(), 20 );
+		EXPECT_EQ( map.stats().distanceHistogram, std::vector<size_t>( 20, 1 ) );
+
+		for ( int i = 0; i < 40; ++i )
+		{
+			int* value = nullptr;
+			EXPECT_EQ( map.tryGetValue( i, value ), i % 2 == 1 );
+		}
+	}
+
+	TEST( HashMapBulkErase, RetainDuringIncrementalRehash )
+	{
+		HashMap<std::string, int> map;
+		map.setIncrementalRehash( 2 );
+		int inserted = 0;
+		while ( !map.isRehashing() || inserted < 200 )
+		{
+			map.insertOrAssign( "ttl_" + std::to_string( inserted ), inserted );
+			++inserted;
+		}
+		ASSERT_TRUE( map.isRehashing() );
+
+		const size_t removed{ map.retain( []( const std::string&, const int& value ) { return value % 10 >= 4; } ) };
+		EXPECT_FALSE( map.isRehashing() );
+		EXPECT_EQ( removed + map.size(), static_cast<size_t>( inserted ) );
+
+		for ( int i = 0; i < inserted; ++i )
+		{
+			int* value = nullptr;
+			EXPECT_EQ( map.tryGetValue( "ttl_" + std::to_string( i ), value ), i % 10 >= 4 );
+		}
+	}
+
+	TEST( HashMapBulkErase, ThrowingPredicateLeavesMapConsistent )
+	{
+		HashMap<int, int> map;
+		for ( int i = 0; i < 5000; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		int calls = 0;
+		EXPECT_THROW( map.eraseIf( [&calls]( const int&, const int& ) {
+			if ( ++calls == 1000 )
+			{
+				throw std::runtime_error{ "predicate failed" };
+			}
+			return calls % 2 == 0;
+		} ),
+			std::runtime_error );
+
+		EXPECT_EQ( map.size(), 5000u - 499u );
+		size_t found = 0;
+		for ( int i = 0; i < 5000; ++i )
+		{
+			int* value = nullptr;
+			found += map.tryGetValue( i, value ) ? 1 : 0;
+		}
+		EXPECT_EQ( found, map.size() );
+		EXPECT_EQ( static_cast<size_t>( std::distance( map.begin(), map.end() ) ), map.size() );
+	}
+
+	//----------------------------------------------
+	// Set algebra
+	//----------------------------------------------
+
+	TEST( HashMapSetAlgebra, EqualityIgnoresOrderCapacityAndMigration )
+	{
+		HashMap<std::string, int> a;
+		HashMap<std::string, int> b{ 1 << 16 };
+		for ( int i = 0; i < 100000; ++i )
+		{
+			a.insertOrAssign( "cfg." + std::to_string( i ), i );
+			b.insertOrAssign( "cfg." + std::to_string( 99999 - i ), 99999 - i );
+		}
+		EXPECT_NE( a.capacity(), 1u << 16 );
+		EXPECT_TRUE( a == b );
+		EXPECT_TRUE( b == a );
+
+		b.insertOrAssign( "cfg.500", -1 );
+		EXPECT_FALSE( a == b );
+		b.insertOrAssign( "cfg.500", 500 );
+		EXPECT_TRUE( b.erase( "cfg.7" ) );
+		b.insertOrAssign( "cfg.extra", 7 );
+		EXPECT_FALSE( a == b );
+
+		// Elements still waiting in the old table of an incremental resize
+		HashMap<std::string, int> migrating;
+		migrating.setIncrementalRehash( 2 );
+		HashMap<std::string, int> settled;
+		int i = 0;
+		while ( !migrating.isRehashing() )
+		{
+			migrating.insertOrAssign( "m" + std::to_string( i ), i );
+			settled.insertOrAssign( "m" + std::to_string( i ), i );
+			++i;
+		}
+		EXPECT_TRUE( migrating == settled );
+		EXPECT_TRUE( settled == migrating );
+	}
+
+	TEST( HashMapSetAlgebra, MergeIntersectDifference )
+	{
+		HashMap<int, std::string> base;
+		HashMap<int, std::string> overlay;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			base.insertOrAssign( i, "base" );
+			overlay.insertOrAssign( i + 600, "overlay" );
+		}
+
+		auto onlyBase{ base.difference( overlay ) };
+		EXPECT_EQ( onlyBase.size(), 600 );
+		std::string* value = nullptr;
+		EXPECT_FALSE( onlyBase.tryGetValue( 600, value ) );
+		ASSERT_TRUE( onlyBase.tryGetValue( 599, value ) );
+		EXPECT_EQ( *value, "base" );
+
+		HashMap<int, std::string> merged{ base };
+		merged.mergeFrom( overlay );
+		merged.mergeFrom( merged );
+		EXPECT_EQ( merged.size(), 1600 );
+		ASSERT_TRUE( merged.tryGetValue( 700, value ) );
+		EXPECT_EQ( *value, "overlay" );
+		ASSERT_TRUE( merged.tryGetValue( 100, value ) );
+		EXPECT_EQ( *value, "base" );
+
+		HashMap<int, std::string> common{ base };
+		EXPECT_EQ( common.intersectWith( overlay ), 600 );
+		EXPECT_EQ( common.size(), 400 );
+		for ( const auto& [key, text] : common )
+		{
+			EXPECT_GE( key, 600 );
+			EXPECT_EQ( text, "base" );
+		}
+		EXPECT_EQ( common.intersectWith( common ), 0 );
+		EXPECT_EQ( base.size(), 1000 );
+	}
+
+	TEST( HashMapSetAlgebra, DiffReportsAddedRemovedChanged )
+	{
+		HashMap<std::string, std::string> before;
+		for ( int i = 0; i < 5000; ++i )
+		{
+			before.insertOrAssign( "key" + std::to_string( i ), "v" + std::to_string( i ) );
+		}
+
+		HashMap<std::string, std::string> after{ before };
+		EXPECT_TRUE( before.diff( after ).isEmpty() );
+
+		after.insertOrAssign( "key42", "v42-new" );
+		after.insertOrAssign( "brand-new", "v" );
+		EXPECT_TRUE( after.erase( "key7" ) );
+		EXPECT_TRUE( after.erase( "key4999" ) );
+
+		auto changes{ before.diff( after ) };
+		std::sort( changes.removed.begin(), changes.removed.end() );
+		EXPECT_EQ( changes.added, std::vector<std::string>{ "brand-new" } );
+		EXPECT_EQ( changes.removed, ( std::vector<std::string>{ "key4999", "key7" } ) );
+		EXPECT_EQ( changes.changed, std::vector<std::string>{ "key42" } );
+
+		const auto reverse{ after.diff( before ) };
+		EXPECT_EQ( reverse.added.size(), 2 );
+		EXPECT_EQ( reverse.removed, std::vector<std::string>{ "brand-new" } );
+		EXPECT_EQ( reverse.changed, std::vector<std::string>{ "key42" } );
+	}
+
+	TEST( HashMapSetAlgebra, SeededMapsWithDifferentKeysRehash )
+	{
+		using SeededMap = HashMap<std::string, int, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Interleaved, std::allocator<std::pair<const std::string, int>>, SipHash13>;
+
+		// Independently keyed: cached hashes of one map are meaningless in the other
+		SeededMap a;
+		SeededMap b;
+		ASSERT_FALSE( a.hashFunction() == b.hashFunction() );
+		for ( int i = 0; i < 2000; ++i )
+		{
+			a.insertOrAssign( "h" + std::to_string( i ), i );
+			b.insertOrAssign( "h" + std::to_string( i + 1000 ), i + 1000 );
+		}
+
+		EXPECT_FALSE( a == b );
+		const auto changes{ a.diff( b ) };
+		EXPECT_EQ( changes.added.size(), 1000 );
+		EXPECT_EQ( changes.removed.size(), 1000 );
+		EXPECT_TRUE( changes.changed.empty() );
+		EXPECT_EQ( a.difference( b ).size(), 1000 );
+
+		SeededMap merged{ a };
+		EXPECT_TRUE( merged.hashFunction() == a.hashFunction() );
+		merged.mergeFrom( b );
+		EXPECT_EQ( merged.size(), 3000 );
+		for ( int i = 0; i < 3000; ++i )
+		{
+			int* value = nullptr;
+			ASSERT_TRUE( merged.tryGetValue( "h" + std::to_string( i ), value ) );
+			EXPECT_EQ( *value, i );
+		}
+		EXPECT_EQ( merged.intersectWith( b ), 1000 );
+		EXPECT_TRUE( merged == b );
+	}
+
+	//----------------------------------------------
+	// Growth policy
+	//----------------------------------------------
+
+	/** @brief Hit test through tryGetValue */
+	template <typename Map, typename KeyType>
+	static bool containsKey( Map& map, const KeyType& key )
+	{
+		typename Map::mapped_type* value = nullptr;
+		return map.tryGetValue( key, value );
+	}
+
+	TEST( HashMapGrowthPolicy, PolicyIsClampedAndCopied )
+	{
+		HashMap<int, int> map;
+		EXPECT_EQ( map.growthPolicy(), HashMapGrowthPolicy{} );
+		EXPECT_EQ( map.growthPolicy().maxLoadFactorPercent, 75 );
+		EXPECT_EQ( map.growthPolicy().growthPercent, 200 );
+
+		map.setGrowthPolicy( { 99, 500 } );
+		EXPECT_EQ( map.growthPolicy(), ( HashMapGrowthPolicy{ 95, 200 } ) );
+		map.setGrowthPolicy( { 10, 100 } );
+		EXPECT_EQ( map.growthPolicy(), ( HashMapGrowthPolicy{ 50, 125 } ) );
+
+		map.setGrowthPolicy( { 90, 150 } );
+		const HashMap<int, int> copy{ map };
+		EXPECT_EQ( copy.growthPolicy(), ( HashMapGrowthPolicy{ 90, 150 } ) );
+	}
+
+	TEST( HashMapGrowthPolicy, HighLoadFactorWithFractionalGrowth )
+	{
+		HashMap<std::uint64_t, std::uint64_t> map{ 4 };
+		map.setGrowthPolicy( { 90, 150 } );
+		std::unordered_map<std::uint64_t, std::uint64_t> reference;
+
+		std::mt19937_64 rng{ 42 };
+		bool sawOddCapacity{ false };
+		for ( std::uint64_t i = 0; i < 60000; ++i )
+		{
+			const std::uint64_t key{ rng() % 20000 };
+			if ( i % 4 == 0 )
+			{
+				EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+			}
+			else
+			{
+				map.insertOrAssign( key, i );
+				reference[key] = i;
+			}
+			// The insert that reaches the threshold is the last one before growing
+			ASSERT_LT( map.size() * 100, map.capacity() * 90 + 100 );
+			sawOddCapacity = sawOddCapacity || ( map.capacity() & ( map.capacity() - 1 ) ) != 0;
+		}
+		EXPECT_TRUE( sawOddCapacity );
+
+		ASSERT_EQ( map.size(), reference.size() );
+		for ( const auto& [key, expected] : reference )
+		{
+			std::uint64_t* value = nullptr;
+			ASSERT_TRUE( map.tryGetValue( key, value ) );
+			EXPECT_EQ( *value, expected );
+		}
+		EXPECT_EQ( static_cast<size_t>( std::distance( map.begin(), map.end() ) ), reference.size() );
+
+		const size_t removed{ map.eraseIf( []( const std::uint64_t& key, const std::uint64_t& ) { return key % 3 == 0; } ) };
+		std::erase_if( reference, []( const auto& entry ) { return entry.first % 3 == 0; } );
+		EXPECT_EQ( map.size(), reference.size() );
+		EXPECT_GT( removed, 0 );
+		for ( const auto& [key, expected] : reference )
+		{
+			EXPECT_TRUE( containsKey( map, key ) );
+		}
+	}
+
+	TEST( HashMapGrowthPolicy, FractionalGrowthDuringIncrementalRehash )
+	{
+		HashMap<std::string, int> map;
+		map.setGrowthPolicy( { 85, 150 } );
+		map.setIncrementalRehash( 2 );
+
+		size_t capacity{ map.capacity() };
+		for ( int i = 0; i < 20000; ++i )
+		{
+			map.insertOrAssign( "k" + std::to_string( i ), i );
+			if ( map.capacity() != capacity )
+			{
+				// Every growth is 1.5x, not a doubling
+				EXPECT_EQ( map.capacity(), capacity * 3 / 2 );
+				capacity = map.capacity();
+			}
+			if ( i % 97 == 0 )
+			{
+				int* value = nullptr;
+				ASSERT_TRUE( map.tryGetValue( "k" + std::to_string( i / 2 ), value ) );
+				EXPECT_EQ( *value, i / 2 );
+			}
+		}
+
+		for ( int i = 0; i < 20000; i += 2 )
+		{
+			EXPECT_TRUE( map.erase( "k" + std::to_string( i ) ) );
+		}
+		EXPECT_EQ( map.size(), 10000 );
+		for ( int i = 1; i < 20000; i += 2 )
+		{
+			EXPECT_TRUE( containsKey( map, "k" + std::to_string( i ) ) );
+		}
+	}
+
+	TEST( HashMapGrowthPolicy, ShrinkToFitReleasesBuckets )
+	{
+		HashMap<int, int> doubling;
+		HashMap<int, int> fractional;
+		fractional.setGrowthPolicy( { 75, 150 } );
+		for ( int i = 0; i < 10000; ++i )
+		{
+			doubling.insertOrAssign( i, i );
+			fractional.insertOrAssign( i, i );
+		}
+		for ( int i = 1000; i < 10000; ++i )
+		{
+			doubling.erase( i );
+			fractional.erase( i );
+		}
+
+		doubling.shrinkToFit();
+		fractional.shrinkToFit();
+		EXPECT_EQ( doubling.capacity(), 2048 );
+		EXPECT_EQ( fractional.capacity(), 1334 );
+		for ( int i = 0; i < 1000; ++i )
+		{
+			EXPECT_TRUE( containsKey( doubling, i ) );
+			EXPECT_TRUE( containsKey( fractional, i ) );
+		}
+
+		// Already small enough: nothing to do
+		fractional.shrinkToFit();
+		EXPECT_EQ( fractional.capacity(), 1334 );
+
+		// An empty map shrinks to a single bucket and still grows from there
+		HashMap<std::string, int> empty;
+		empty.setIncrementalRehash( 2 );
+		empty.shrinkToFit();
+		EXPECT_EQ( empty.capacity(), 1 );
+		for ( int i = 0; i < 100; ++i )
+		{
+			empty.insertOrAssign( std::to_string( i ), i );
+		}
+		EXPECT_EQ( empty.size(), 100 );
+		EXPECT_TRUE( containsKey( empty, "57" ) );
+	}
+
+	TEST( HashMapGrowthPolicy, LoweringLoadFactorRebuilds )
+	{
+		HashMap<int, int> map{ 1024 };
+		for ( int i = 0; i < 700; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+		ASSERT_EQ( map.capacity(), 1024 );
+
+		map.setGrowthPolicy( { 50, 200 } );
+		EXPECT_EQ( map.capacity(), 2048 );
+		EXPECT_LT( map.stats().loadFactor, 0.5 );
+		for ( int i = 0; i < 700; ++i )
+		{
+			EXPECT_TRUE( containsKey( map, i ) );
+		}
+	}
+
+	//----------------------------------------------
+	// 64-bit cached hashes
+	//----------------------------------------------
+
+	/** @brief Key that counts how often the map compares it */
+	struct CountedKey
+	{
+		std::uint64_t id{};
+
+		static inline size_t comparisons{ 0 };
+
+		friend bool operator==( const CountedKey& a, const CountedKey& b ) noexcept
+		{
+			++comparisons;
+			return a.id == b.id;
+		}
+	};
+
+	/** @brief Only 64 home buckets in the low bits, the id in the high bits */
+	struct HighBitsHash
+	{
+		size_t operator()( const CountedKey& key ) const noexcept
+		{
+			return static_cast<size_t>( ( key.id << 32 ) | ( key.id % 64 ) );
+		}
+	};
+
+	TEST( HashMapWideHash, MatchesReferenceWithFractionalGrowth )
+	{
+		HashMap64<std::string, int> map;
+		static_assert( sizeof( decltype( map )::cached_hash_type ) == 8 );
+		map.setGrowthPolicy( { 90, 150 } );
+		map.setIncrementalRehash( 2 );
+		std::unordered_map<std::string, int> reference;
+
+		std::mt19937 rng{ 7 };
+		for ( int i = 0; i < 40000; ++i )
+		{
+			const std::string key{ "wide_" + std::to_string( rng() % 15000 ) };
+			if ( i % 5 == 0 )
+			{
+				EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+			}
+			else
+			{
+				map.insertOrAssign( key, i );
+				reference[key] = i;
+			}
+		}
+
+		ASSERT_EQ( map.size(), reference.size() );
+		for ( const auto& [key, expected] : reference )
+		{
+			int* value = nullptr;
+			ASSERT_TRUE( map.tryGetValue( std::string_view{ key }, value ) );
+			EXPECT_EQ( *value, expected );
+		}
+
+		HashMap64<std::string, int> copy{ map };
+		EXPECT_TRUE( copy == map );
+		copy.eraseIf( []( const std::string&, const int& value ) { return value % 2 == 0; } );
+		const auto changes{ map.diff( copy ) };
+		EXPECT_EQ( changes.removed.size(), map.size() - copy.size() );
+
+		map.shrinkToFit();
+		EXPECT_EQ( map.size(), reference.size() );
+		EXPECT_EQ( map.stats().maxDistance, map.stats().distanceHistogram.size() - 1 );
+	}
+
+	TEST( HashMapWideHash, HighBitsFilterKeyComparisons )
+	{
+		HashMap<CountedKey, int, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Split, std::allocator<std::pair<const CountedKey, int>>, HighBitsHash>
+			narrow;
+		HashMap<CountedKey, int, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Split, std::allocator<std::pair<const CountedKey, int>>, HighBitsHash, std::uint64_t>
+			wide;
+		for ( std::uint64_t id = 0; id < 1024; ++id )
+		{
+			narrow.insertOrAssign( CountedKey{ id }, static_cast<int>( id ) );
+			wide.insertOrAssign( CountedKey{ id }, static_cast<int>( id ) );
+		}
+
+		// The 32-bit cache only keeps the 64 home buckets: every probe step compares keys
+		CountedKey::comparisons = 0;
+		for ( std::uint64_t id = 0; id < 1024; ++id )
+		{
+			int* value = nullptr;
+			ASSERT_TRUE( narrow.tryGetValue( CountedKey{ id }, value ) );
+		}
+		EXPECT_GT( CountedKey::comparisons, 1024u * 4 );
+
+		// The 64-bit cache keeps the id: only the matching bucket compares its key
+		CountedKey::comparisons = 0;
+		for ( std::uint64_t id = 0; id < 1024; ++id )
+		{
+			int* value = nullptr;
+			ASSERT_TRUE( wide.tryGetValue( CountedKey{ id }, value ) );
+			EXPECT_EQ( *value, static_cast<int>( id ) );
+		}
+		for ( std::uint64_t id = 1024; id < 2048; ++id )
+		{
+			int* value = nullptr;
+			EXPECT_FALSE( wide.tryGetValue( CountedKey{ id }, value ) );
+		}
+		EXPECT_EQ( CountedKey::comparisons, 1024u );
+	}
 } // namespace nfx::containers::test
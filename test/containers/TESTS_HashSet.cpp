@@ -0,0 +1,193 @@
+/**
+ * @file TESTS_HashSet.cpp
+ * @brief Unit tests for HashSet Robin Hood set
+ * @details Test suite validating heterogeneous insertion and lookup, bulk insertion,
+ *          backward-shift erase, set algebra and allocator support
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <list>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include <nfx/containers/HashSet.h>
+
+namespace nfx::containers::test
+{
+	//=====================================================================
+	// HashSet Tests - Robin Hood set
+	//=====================================================================
+
+	//----------------------------------------------
+	// Basic operations
+	//----------------------------------------------
+
+	TEST( HashSetBasic, InsertContainsErase )
+	{
+		HashSet<std::string> set;
+		EXPECT_TRUE( set.isEmpty() );
+		EXPECT_EQ( set.begin(), set.end() );
+
+		EXPECT_TRUE( set.insert( std::string{ "alpha" } ) );
+		EXPECT_TRUE( set.insert( std::string_view{ "beta" } ) );
+		EXPECT_TRUE( set.insert( "gamma" ) );
+		EXPECT_FALSE( set.insert( "alpha" ) );
+		EXPECT_EQ( set.size(), 3 );
+
+		EXPECT_TRUE( set.contains( std::string_view{ "beta" } ) );
+		EXPECT_TRUE( set.contains( "gamma" ) );
+		EXPECT_TRUE( set.contains( std::string{ "alpha" } ) );
+		EXPECT_FALSE( set.contains( "delta" ) );
+
+		EXPECT_TRUE( set.erase( std::string_view{ "beta" } ) );
+		EXPECT_FALSE( set.erase( "beta" ) );
+		EXPECT_FALSE( set.contains( "beta" ) );
+		EXPECT_EQ( set.size(), 2 );
+
+		set.clear();
+		EXPECT_TRUE( set.isEmpty() );
+		EXPECT_FALSE( set.contains( "alpha" ) );
+	}
+
+	TEST( HashSetBasic, InsertConvertsOtherIntegralTypes )
+	{
+		HashSet<std::uint32_t> set;
+
+		EXPECT_TRUE( set.insert( -1 ) );
+		EXPECT_FALSE( set.insert( 0xFFFFFFFFu ) );
+		EXPECT_TRUE( set.contains( 0xFFFFFFFFu ) );
+		EXPECT_EQ( set.size(), 1 );
+	}
+
+	TEST( HashSetBasic, MatchesUnorderedSetAcrossRehashAndErase )
+	{
+		HashSet<std::uint64_t> set( 4 );
+		std::unordered_set<std::uint64_t> reference;
+
+		for ( std::uint64_t i = 0; i < 20000; ++i )
+		{
+			const std::uint64_t key{ ( i * 2654435761u ) % 5000 };
+			if ( i % 3 == 0 )
+			{
+				EXPECT_EQ( set.erase( key ), reference.erase( key ) == 1 );
+			}
+			else
+			{
+				EXPECT_EQ( set.insert( key ), reference.insert( key ).second );
+			}
+		}
+
+		ASSERT_EQ( set.size(), reference.size() );
+		size_t visited = 0;
+		for ( const std::uint64_t key : set )
+		{
+			EXPECT_TRUE( reference.contains( key ) );
+			++visited;
+		}
+		EXPECT_EQ( visited, reference.size() );
+	}
+
+	//----------------------------------------------
+	// Bulk insertion
+	//----------------------------------------------
+
+	TEST( HashSetBulk, InsertRangeReservesOnceAndCountsNewKeys )
+	{
+		std::vector<std::string> words;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			words.push_back( "word_" + std::to_string( i % 700 ) );
+		}
+
+		HashSet<std::string> set;
+		EXPECT_EQ( set.insertRange( words ), 700 );
+		const size_t capacity{ set.capacity() };
+		EXPECT_GE( capacity * 3, 1000u * 4 );
+
+		// Already present keys are skipped and do not grow the table
+		EXPECT_EQ( set.insertRange( words.begin(), words.begin() + 100 ), 0 );
+		EXPECT_EQ( set.capacity(), capacity );
+
+		// Views and non-sized ranges
+		const std::vector<std::string_view> views{ "x", "y", "word_3" };
+		EXPECT_EQ( set.insertRange( views ), 2 );
+		const std::list<std::string> listed{ "p", "q", "p" };
+		EXPECT_EQ( set.insertRange( listed ), 2 );
+		EXPECT_EQ( set.size(), 704 );
+
+		const HashSet<int> listInit{ 3, 1, 4, 1, 5, 9, 2, 6 };
+		EXPECT_EQ( listInit.size(), 7 );
+	}
+
+	//----------------------------------------------
+	// Set algebra
+	//----------------------------------------------
+
+	TEST( HashSetAlgebra, UnionIntersectionDifference )
+	{
+		const HashSet<int> evens{ 0, 2, 4, 6, 8, 10 };
+		const HashSet<int> small{ 4, 5, 6, 7 };
+
+		EXPECT_EQ( evens.unionWith( small ), ( HashSet<int>{ 0, 2, 4, 5, 6, 7, 8, 10 } ) );
+		EXPECT_EQ( evens.intersectionWith( small ), ( HashSet<int>{ 4, 6 } ) );
+		EXPECT_EQ( small.intersectionWith( evens ), ( HashSet<int>{ 4, 6 } ) );
+		EXPECT_EQ( evens.differenceWith( small ), ( HashSet<int>{ 0, 2, 8, 10 } ) );
+		EXPECT_EQ( small.differenceWith( evens ), ( HashSet<int>{ 5, 7 } ) );
+
+		EXPECT_TRUE( ( HashSet<int>{ 2, 8 } ).isSubsetOf( evens ) );
+		EXPECT_FALSE( small.isSubsetOf( evens ) );
+		EXPECT_TRUE( HashSet<int>{}.isSubsetOf( small ) );
+		EXPECT_FALSE( evens == small );
+
+		// Operands are left untouched
+		EXPECT_EQ( evens.size(), 6 );
+		EXPECT_EQ( small.size(), 4 );
+	}
+
+	TEST( HashSetAlgebra, StringSetsAtScale )
+	{
+		HashSet<std::string> a;
+		HashSet<std::string> b;
+		for ( int i = 0; i < 3000; ++i )
+		{
+			a.insert( "id-" + std::to_string( i ) );
+			b.insert( "id-" + std::to_string( i + 2000 ) );
+		}
+
+		EXPECT_EQ( a.unionWith( b ).size(), 5000 );
+		const auto common{ a.intersectionWith( b ) };
+		EXPECT_EQ( common.size(), 1000 );
+		EXPECT_TRUE( common.contains( "id-2500" ) );
+		EXPECT_EQ( a.differenceWith( b ).size(), 2000 );
+		EXPECT_TRUE( common.isSubsetOf( a ) );
+		EXPECT_TRUE( common.isSubsetOf( b ) );
+	}
+
+	//----------------------------------------------
+	// Allocator support
+	//----------------------------------------------
+
+	TEST( HashSetAllocator, PmrSetDrawsFromResource )
+	{
+		std::vector<std::byte> buffer( 1 << 20 );
+		std::pmr::monotonic_buffer_resource resource{ buffer.data(), buffer.size(), std::pmr::null_memory_resource() };
+
+		pmr::HashSet<std::pmr::string> set{ &resource };
+		for ( int i = 0; i < 200; ++i )
+		{
+			set.insert( std::string_view{ "a fairly long key that defeats SSO #" } );
+			set.insert( std::pmr::string{ "key_" + std::to_string( i ), &resource } );
+		}
+		EXPECT_EQ( set.size(), 201 );
+		EXPECT_EQ( set.allocator().resource(), &resource );
+
+		const auto other{ set.differenceWith( pmr::HashSet<std::pmr::string>{ &resource } ) };
+		EXPECT_EQ( other, set );
+		EXPECT_EQ( other.allocator().resource(), &resource );
+	}
+} // namespace nfx::containers::test
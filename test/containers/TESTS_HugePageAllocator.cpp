@@ -0,0 +1,120 @@
+/**
+ * @file TESTS_HugePageAllocator.cpp
+ * @brief Unit tests for HugePageAllocator
+ * @details Test suite validating huge page eligibility, mapping alignment, small allocation
+ *          fallback and use as the allocator of HashMap and ChdHashMap
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nfx/containers/ChdHashMap.h>
+#include <nfx/containers/HashMap.h>
+#include <nfx/containers/HugePageAllocator.h>
+
+namespace nfx::containers::test
+{
+	//=====================================================================
+	// HugePageAllocator Tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Allocation
+	//----------------------------------------------
+
+	TEST( HugePageAllocatorBasic, SmallAllocationsUseRegularHeap )
+	{
+		HugePageAllocator<std::uint64_t> allocator;
+		EXPECT_FALSE( HugePageAllocator<std::uint64_t>::usesHugePages( 16 ) );
+
+		std::uint64_t* values{ allocator.allocate( 16 ) };
+		ASSERT_NE( values, nullptr );
+		for ( std::uint64_t i = 0; i < 16; ++i )
+		{
+			values[i] = i * i;
+		}
+		EXPECT_EQ( values[15], 225u );
+		allocator.deallocate( values, 16 );
+	}
+
+	TEST( HugePageAllocatorBasic, LargeAllocationIsHugePageAligned )
+	{
+		constexpr size_t count{ ( 3 * HugePageAllocator<std::uint32_t>::HUGE_PAGE_SIZE ) / sizeof( std::uint32_t ) + 5 };
+
+		HugePageAllocator<std::uint32_t> allocator;
+		std::uint32_t* values{ allocator.allocate( count ) };
+		ASSERT_NE( values, nullptr );
+
+		if ( HugePageAllocator<std::uint32_t>::usesHugePages( count ) )
+		{
+			const auto address{ reinterpret_cast<std::uintptr_t>( values ) };
+			EXPECT_EQ( address % HugePageAllocator<std::uint32_t>::HUGE_PAGE_SIZE, 0u );
+		}
+
+		// Anonymous mappings start zeroed; touch both ends and the page boundaries
+		std::memset( values, 0xAB, count * sizeof( std::uint32_t ) );
+		EXPECT_EQ( values[0], 0xABABABABu );
+		EXPECT_EQ( values[count - 1], 0xABABABABu );
+		allocator.deallocate( values, count );
+	}
+
+	TEST( HugePageAllocatorBasic, RebindingAndEquality )
+	{
+		const HugePageAllocator<int> ints;
+		const HugePageAllocator<double> doubles{ ints };
+		EXPECT_TRUE( ints == doubles );
+
+		std::vector<std::string, HugePageAllocator<std::string>> strings;
+		strings.emplace_back( "a string longer than the small buffer" );
+		strings.resize( 1000 );
+		EXPECT_EQ( strings.front(), "a string longer than the small buffer" );
+	}
+
+	//----------------------------------------------
+	// Container backing
+	//----------------------------------------------
+
+	TEST( HugePageAllocatorContainers, HashMapBucketsOnHugePages )
+	{
+		using Map = HashMap<std::uint64_t, std::uint64_t,
+			core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, core::hashing::constants::DEFAULT_FNV_PRIME,
+			HashMapLayout::Interleaved, HugePageAllocator<std::pair<const std::uint64_t, std::uint64_t>>>;
+
+		Map map( 1 << 17 );
+		for ( std::uint64_t i = 0; i < 100000; ++i )
+		{
+			map.insertOrAssign( i * 31, i );
+		}
+		ASSERT_EQ( map.size(), 100000u );
+
+		std::uint64_t* value{ nullptr };
+		for ( std::uint64_t i = 0; i < 100000; i += 101 )
+		{
+			ASSERT_TRUE( map.tryGetValue( i * 31, value ) );
+			EXPECT_EQ( *value, i );
+		}
+		EXPECT_FALSE( map.tryGetValue( std::uint64_t{ 7 }, value ) );
+	}
+
+	TEST( HugePageAllocatorContainers, ChdHashMapTableOnHugePages )
+	{
+		using Map = ChdHashMap<int, core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, HugePageAllocator<std::pair<std::string, int>>>;
+
+		Map::container_type items;
+		for ( int i = 0; i < 50000; ++i )
+		{
+			items.emplace_back( "sensor/" + std::to_string( i ), i );
+		}
+
+		Map map{ std::move( items ) };
+		for ( int i = 0; i < 50000; i += 499 )
+		{
+			EXPECT_EQ( map.at( "sensor/" + std::to_string( i ) ), i );
+		}
+	}
+} // namespace nfx::containers::test
@@ -0,0 +1,280 @@
+/**
+ * @file TESTS_IntHashMap.cpp
+ * @brief Unit tests for IntHashMap integer-keyed container
+ * @details Test suite validating sentinel-encoded empty slots, Robin Hood insertion,
+ *          backward-shift deletion, custom sentinels and slot footprint
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <nfx/containers/IntHashMap.h>
+
+namespace nfx::containers::test
+{
+	//=====================================================================
+	// IntHashMap Tests - Sentinel-keyed Robin Hood map
+	//=====================================================================
+
+	//----------------------------------------------
+	// Basic operations
+	//----------------------------------------------
+
+	TEST( IntHashMapBasic, InsertLookupErase )
+	{
+		IntHashMap<std::uint64_t, std::string> map;
+		EXPECT_TRUE( map.isEmpty() );
+		EXPECT_EQ( map.begin(), map.end() );
+
+		map.insertOrAssign( 42, std::string{ "answer" } );
+		map.insertOrAssign( 0, "zero" );
+		map.insertOrAssign( 42, "updated" );
+		EXPECT_EQ( map.size(), 2 );
+
+		std::string* value = nullptr;
+		ASSERT_TRUE( map.tryGetValue( 42, value ) );
+		EXPECT_EQ( *value, "updated" );
+		EXPECT_TRUE( map.contains( 0 ) );
+		EXPECT_FALSE( map.tryGetValue( 7, value ) );
+		EXPECT_EQ( value, nullptr );
+
+		auto [emplaced, inserted] = map.tryEmplace( 7, 3, 'x' );
+		ASSERT_TRUE( inserted );
+		EXPECT_EQ( *emplaced, "xxx" );
+		auto [existing, insertedAgain] = map.tryEmplace( 7, 5, 'y' );
+		EXPECT_FALSE( insertedAgain );
+		EXPECT_EQ( existing, emplaced );
+
+		EXPECT_TRUE( map.erase( 42 ) );
+		EXPECT_FALSE( map.erase( 42 ) );
+		EXPECT_EQ( map.size(), 2 );
+
+		const auto& constMap = map;
+		const std::string* constValue = nullptr;
+		ASSERT_TRUE( constMap.tryGetValue( 0, constValue ) );
+		EXPECT_EQ( *constValue, "zero" );
+
+		map.clear();
+		EXPECT_TRUE( map.isEmpty() );
+		EXPECT_FALSE( map.contains( 0 ) );
+		EXPECT_EQ( map.begin(), map.end() );
+	}
+
+	TEST( IntHashMapBasic, SentinelKeyIsReserved )
+	{
+		IntHashMap<std::uint32_t, int> map;
+		constexpr std::uint32_t sentinel{ IntHashMap<std::uint32_t, int>::EMPTY_KEY };
+		EXPECT_EQ( sentinel, 0xFFFFFFFFu );
+
+		EXPECT_THROW( map.insertOrAssign( sentinel, 1 ), std::invalid_argument );
+		EXPECT_THROW( (void)map.tryEmplace( sentinel, 1 ), std::invalid_argument );
+		EXPECT_TRUE( map.isEmpty() );
+
+		// Lookups of the sentinel must not match an empty slot
+		int* value = nullptr;
+		EXPECT_FALSE( map.tryGetValue( sentinel, value ) );
+		EXPECT_FALSE( map.contains( sentinel ) );
+		EXPECT_FALSE( map.erase( sentinel ) );
+	}
+
+	TEST( IntHashMapBasic, CustomSentinelAndSignedKeys )
+	{
+		IntHashMap<std::int64_t, int, 0> map;
+
+		for ( std::int64_t key = -500; key <= 500; ++key )
+		{
+			if ( key != 0 )
+			{
+				map.insertOrAssign( key, static_cast<int>( key * 2 ) );
+			}
+		}
+		map.insertOrAssign( INT64_MAX, 1 );
+		map.insertOrAssign( INT64_MIN, -1 );
+		EXPECT_THROW( map.insertOrAssign( 0, 0 ), std::invalid_argument );
+
+		EXPECT_EQ( map.size(), 1002 );
+		int* value = nullptr;
+		ASSERT_TRUE( map.tryGetValue( -321, value ) );
+		EXPECT_EQ( *value, -642 );
+		ASSERT_TRUE( map.tryGetValue( INT64_MIN, value ) );
+		EXPECT_EQ( *value, -1 );
+		EXPECT_FALSE( map.contains( 0 ) );
+	}
+
+	//----------------------------------------------
+	// Probing and deletion
+	//----------------------------------------------
+
+	TEST( IntHashMapProbing, MatchesUnorderedMapUnderRandomOperations )
+	{
+		IntHashMap<std::uint64_t, std::uint64_t> map{ 4 };
+		std::unordered_map<std::uint64_t, std::uint64_t> reference;
+
+		std::mt19937_64 rng{ 12345 };
+		std::uniform_int_distribution<std::uint64_t> keyDist{ 0, 4095 };
+
+		for ( int i = 0; i < 50000; ++i )
+		{
+			const std::uint64_t key{ keyDist( rng ) };
+			if ( rng() % 3 == 0 )
+			{
+				EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+			}
+			else
+			{
+				map.insertOrAssign( key, static_cast<std::uint64_t>( i ) );
+				reference[key] = static_cast<std::uint64_t>( i );
+			}
+		}
+
+		ASSERT_EQ( map.size(), reference.size() );
+		for ( const auto& [key, expected] : reference )
+		{
+			const std::uint64_t* value = nullptr;
+			ASSERT_TRUE( std::as_const( map ).tryGetValue( key, value ) );
+			EXPECT_EQ( *value, expected );
+		}
+
+		size_t visited = 0;
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( reference.at( key ), value );
+			++visited;
+		}
+		EXPECT_EQ( visited, reference.size() );
+	}
+
+	TEST( IntHashMapProbing, SequentialAndStridedIds )
+	{
+		// Fibonacci hashing must spread keys that differ only in high or only in low bits
+		IntHashMap<std::uint64_t, std::uint32_t> map;
+		for ( std::uint32_t i = 0; i < 10000; ++i )
+		{
+			map.insertOrAssign( i, i );
+			map.insertOrAssign( static_cast<std::uint64_t>( i ) << 40, i );
+		}
+
+		EXPECT_EQ( map.size(), 19999 ); // 0 << 40 == 0
+		EXPECT_LE( map.capacity(), 32768 );
+
+		for ( std::uint32_t i = 1; i < 10000; ++i )
+		{
+			std::uint32_t* value = nullptr;
+			ASSERT_TRUE( map.tryGetValue( static_cast<std::uint64_t>( i ) << 40, value ) );
+			EXPECT_EQ( *value, i );
+		}
+
+		for ( std::uint32_t i = 0; i < 10000; i += 2 )
+		{
+			EXPECT_TRUE( map.erase( i ) );
+		}
+		for ( std::uint32_t i = 1; i < 10000; i += 2 )
+		{
+			EXPECT_TRUE( map.contains( i ) );
+		}
+	}
+
+	TEST( IntHashMapProbing, ReserveAndEquality )
+	{
+		IntHashMap<int, int> a;
+		a.reserve( 1000 );
+		const size_t reserved{ a.capacity() };
+		EXPECT_GE( reserved * 3, 1000u * 4 );
+
+		IntHashMap<int, int> b;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			a.insertOrAssign( i, i * i );
+			b.insertOrAssign( 999 - i, ( 999 - i ) * ( 999 - i ) );
+		}
+		EXPECT_EQ( a.capacity(), reserved );
+		EXPECT_EQ( a, b );
+
+		b.insertOrAssign( 5, 0 );
+		EXPECT_FALSE( a == b );
+
+		IntHashMap<int, int> copy{ a };
+		EXPECT_EQ( copy, a );
+	}
+
+	namespace
+	{
+		/** @brief Value whose move may throw, so growth copies it; copies throw once the budget runs out */
+		struct Fragile
+		{
+			static inline int copiesLeft{ std::numeric_limits<int>::max() };
+
+			int value{};
+
+			Fragile() = default;
+			Fragile( int v ) : value{ v } {}
+			Fragile( const Fragile& other ) : value{ other.value }
+			{
+				if ( --copiesLeft < 0 )
+				{
+					throw std::runtime_error{ "copy budget exhausted" };
+				}
+			}
+			Fragile( Fragile&& other ) noexcept( false ) : value{ other.value } {}
+			Fragile& operator=( const Fragile& ) = default;
+			Fragile& operator=( Fragile&& ) noexcept( false ) = default;
+		};
+	} // namespace
+
+	TEST( IntHashMapProbing, ThrowingCopyDuringGrowthKeepsMap )
+	{
+		IntHashMap<int, Fragile> map{ 32 };
+		for ( int i = 0; i < 24; ++i )
+		{
+			map.insertOrAssign( i, i * 3 );
+		}
+		ASSERT_EQ( map.capacity(), 32 );
+
+		Fragile::copiesLeft = 10;
+		EXPECT_THROW( map.insertOrAssign( 24, 72 ), std::runtime_error );
+		Fragile::copiesLeft = std::numeric_limits<int>::max();
+
+		EXPECT_EQ( map.capacity(), 32 );
+		EXPECT_EQ( map.size(), 24 );
+		for ( int i = 0; i < 24; ++i )
+		{
+			const Fragile* value{ nullptr };
+			ASSERT_TRUE( map.tryGetValue( i, value ) );
+			EXPECT_EQ( value->value, i * 3 );
+		}
+		EXPECT_FALSE( map.contains( 24 ) );
+	}
+
+	//----------------------------------------------
+	// Memory footprint
+	//----------------------------------------------
+
+	TEST( IntHashMapMemory, SlotIsKeyPlusValue )
+	{
+		std::array<std::byte, 1 << 16> buffer{};
+		std::pmr::monotonic_buffer_resource resource{ buffer.data(), buffer.size(), std::pmr::null_memory_resource() };
+
+		pmr::IntHashMap<std::uint64_t, std::uint64_t> map{ 1024, &resource };
+		for ( std::uint64_t i = 0; i < 700; ++i )
+		{
+			map.insertOrAssign( i * 7919, i );
+		}
+
+		EXPECT_EQ( map.capacity(), 1024 );
+		EXPECT_EQ( map.allocator().resource(), &resource );
+
+		// One array of 1024 sixteen-byte slots, no side tables
+		std::pmr::polymorphic_allocator<std::byte> probe{ &resource };
+		const std::byte* next{ probe.allocate( 1 ) };
+		EXPECT_LE( static_cast<size_t>( next - buffer.data() ), 1024 * 16 + alignof( std::max_align_t ) );
+	}
+} // namespace nfx::containers::test
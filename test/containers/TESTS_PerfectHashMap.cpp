@@ -0,0 +1,270 @@
+/**
+ * @file TESTS_PerfectHashMap.cpp
+ * @brief Unit tests for PerfectHashMap and its minimal perfect hash engines
+ * @details Test suite run against every engine: bijectivity of the engines, hits, misses,
+ *          duplicate rejection, empty maps and engine parameters
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/containers/PerfectHashMap.h>
+
+namespace nfx::containers::test
+{
+	//=====================================================================
+	// PerfectHashMap Tests
+	//=====================================================================
+
+	namespace
+	{
+		/** @brief `count` distinct keys "key0".."key<count-1>" with value i * 7 */
+		PerfectHashMap<size_t>::container_type makeItems( size_t count )
+		{
+			PerfectHashMap<size_t>::container_type items;
+			items.reserve( count );
+			for ( size_t i{ 0 }; i < count; ++i )
+			{
+				items.emplace_back( "key" + std::to_string( i ), i * 7 );
+			}
+
+			return items;
+		}
+
+		/** @brief Pseudo-random distinct 64-bit hashes */
+		std::vector<std::uint64_t> makeHashes( size_t count )
+		{
+			std::vector<std::uint64_t> hashes( count );
+			std::uint64_t state{ 0x243F6A8885A308D3ull };
+			for ( auto& hash : hashes )
+			{
+				state += 0x9E3779B97F4A7C15ull;
+				hash = detail::mphf::mix( state );
+			}
+
+			return hashes;
+		}
+
+		/** @brief String hash policy with a 32-bit result */
+		struct NarrowHash
+		{
+			std::uint32_t operator()( std::string_view key ) const noexcept
+			{
+				return static_cast<std::uint32_t>( key.size() );
+			}
+		};
+	} // namespace
+
+	template <typename TEngine>
+	class PerfectHashMapTest : public ::testing::Test
+	{
+	};
+
+	using Engines = ::testing::Types<PtHashEngine, BbHashEngine>;
+	TYPED_TEST_SUITE( PerfectHashMapTest, Engines );
+
+	//----------------------------------------------
+	// Engines
+	//----------------------------------------------
+
+	TYPED_TEST( PerfectHashMapTest, EngineIsBijective )
+	{
+		for ( const size_t count : { size_t{ 1 }, size_t{ 2 }, size_t{ 63 }, size_t{ 1000 }, size_t{ 200000 } } )
+		{
+			const std::vector<std::uint64_t> hashes{ makeHashes( count ) };
+			TypeParam engine;
+			engine.build( hashes );
+			ASSERT_EQ( engine.size(), count );
+
+			std::vector<bool> used( count, false );
+			for ( const std::uint64_t hash : hashes )
+			{
+				const size_t position{ engine.position( hash ) };
+				ASSERT_LT( position, count );
+				ASSERT_FALSE( used[position] ) << "count " << count;
+				used[position] = true;
+			}
+		}
+	}
+
+	TYPED_TEST( PerfectHashMapTest, EngineSizeIsCompact )
+	{
+		const std::vector<std::uint64_t> hashes{ makeHashes( 1000000 ) };
+		TypeParam engine;
+		engine.build( hashes );
+
+		// Both engines stay well below one byte per key
+		EXPECT_LT( engine.sizeInBytes() * 8.0 / hashes.size(), 6.0 );
+	}
+
+	TYPED_TEST( PerfectHashMapTest, EmptyEngine )
+	{
+		TypeParam built;
+		built.build( {} );
+		const TypeParam defaulted;
+
+		for ( const TypeParam* engine : std::initializer_list<const TypeParam*>{ &built, &defaulted } )
+		{
+			EXPECT_EQ( engine->size(), 0 );
+			for ( const std::uint64_t hash : makeHashes( 100 ) )
+			{
+				ASSERT_EQ( engine->position( hash ), 0 );
+			}
+		}
+
+		// Rebuilding an engine as empty drops the previous index
+		TypeParam rebuilt;
+		rebuilt.build( makeHashes( 1000 ) );
+		rebuilt.build( {} );
+		EXPECT_EQ( rebuilt.size(), 0 );
+		EXPECT_EQ( rebuilt.position( makeHashes( 1 )[0] ), 0 );
+	}
+
+	TYPED_TEST( PerfectHashMapTest, EngineRejectsEqualHashes )
+	{
+		std::vector<std::uint64_t> hashes{ makeHashes( 500 ) };
+		hashes.push_back( hashes[123] );
+
+		TypeParam engine;
+		EXPECT_THROW( engine.build( hashes ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// Map
+	//----------------------------------------------
+
+	TYPED_TEST( PerfectHashMapTest, LookupHitsAndMisses )
+	{
+		constexpr size_t count{ 50000 };
+		PerfectHashMap<size_t, TypeParam> map{ makeItems( count ) };
+		ASSERT_EQ( map.size(), count );
+		EXPECT_FALSE( map.isEmpty() );
+
+		for ( size_t i{ 0 }; i < count; ++i )
+		{
+			const std::string key{ "key" + std::to_string( i ) };
+			const size_t* value{ nullptr };
+			ASSERT_TRUE( map.tryGetValue( key, value ) ) << key;
+			EXPECT_EQ( *value, i * 7 );
+			EXPECT_EQ( map.at( key ), i * 7 );
+			EXPECT_FALSE( map.contains( "miss" + std::to_string( i ) ) );
+		}
+
+		const size_t* value{ nullptr };
+		EXPECT_FALSE( map.tryGetValue( "key", value ) );
+		EXPECT_EQ( value, nullptr );
+		EXPECT_THROW( (void)map.at( "key50000" ), typename decltype( map )::KeyNotFoundException );
+	}
+
+	TYPED_TEST( PerfectHashMapTest, MutableAccess )
+	{
+		PerfectHashMap<size_t, TypeParam> map{ makeItems( 100 ) };
+		map["key42"] = 1;
+
+		size_t* value{ nullptr };
+		ASSERT_TRUE( map.tryGetValue( "key42", value ) );
+		EXPECT_EQ( *value, 1 );
+		EXPECT_THROW( (void)map["key100"], typename decltype( map )::KeyNotFoundException );
+	}
+
+	TYPED_TEST( PerfectHashMapTest, IteratesEveryEntryOnce )
+	{
+		constexpr size_t count{ 1000 };
+		const PerfectHashMap<size_t, TypeParam> map{ makeItems( count ) };
+
+		std::vector<bool> seen( count, false );
+		for ( const auto& [key, value] : map )
+		{
+			ASSERT_EQ( value % 7, 0 );
+			ASSERT_FALSE( seen[value / 7] );
+			seen[value / 7] = true;
+			EXPECT_EQ( key, "key" + std::to_string( value / 7 ) );
+		}
+		EXPECT_EQ( std::count( seen.begin(), seen.end(), true ), static_cast<std::ptrdiff_t>( count ) );
+	}
+
+	TYPED_TEST( PerfectHashMapTest, DuplicateKeysThrow )
+	{
+		auto items{ makeItems( 100 ) };
+		items.emplace_back( "key17", 0 );
+
+		EXPECT_THROW( ( PerfectHashMap<size_t, TypeParam>{ std::move( items ) } ), std::invalid_argument );
+	}
+
+	TYPED_TEST( PerfectHashMapTest, EmptyMap )
+	{
+		using Map = PerfectHashMap<size_t, TypeParam>;
+		const Map built{ {} };
+		const Map defaulted;
+
+		for ( const auto* map : { &built, &defaulted } )
+		{
+			EXPECT_TRUE( map->isEmpty() );
+			EXPECT_EQ( map->size(), 0 );
+			EXPECT_FALSE( map->contains( "" ) );
+			EXPECT_EQ( map->begin(), map->end() );
+			EXPECT_THROW( (void)map->at( "key0" ), typename Map::KeyNotFoundException );
+		}
+	}
+
+	TYPED_TEST( PerfectHashMapTest, OtherHashPolicies )
+	{
+		PerfectHashMap<size_t, TypeParam, WyHash> wyMap{ makeItems( 5000 ) };
+		PerfectHashMap<size_t, TypeParam, SipHash13> sipMap{ makeItems( 5000 ) };
+
+		EXPECT_EQ( wyMap.at( "key4999" ), 4999 * 7 );
+		EXPECT_EQ( sipMap.at( "key4999" ), 4999 * 7 );
+		EXPECT_FALSE( sipMap.contains( "key5000" ) );
+	}
+
+	TEST( PerfectHashMap, HashPolicyMustBe64Bit )
+	{
+		// Fingerprints are the top 16 bits of the hash; a 32-bit policy would leave them all 0
+		static_assert( PerfectHashKeyHasher<Xxh3Hash> && PerfectHashKeyHasher<WyHash> && PerfectHashKeyHasher<SipHash13> );
+		static_assert( !PerfectHashKeyHasher<NarrowHash> );
+	}
+
+	//----------------------------------------------
+	// Engine parameters
+	//----------------------------------------------
+
+	TEST( PerfectHashMap, EngineParameters )
+	{
+		const std::vector<std::uint64_t> hashes{ makeHashes( 100000 ) };
+
+		PtHashEngine denser{ 8.0, 0.9 };
+		PtHashEngine sparser{ 3.0, 0.99 };
+		denser.build( hashes );
+		sparser.build( hashes );
+		EXPECT_GT( denser.sizeInBytes(), sparser.sizeInBytes() );
+
+		BbHashEngine fast{ 5.0 };
+		BbHashEngine small{ 1.0 };
+		fast.build( hashes );
+		small.build( hashes );
+		EXPECT_GT( fast.sizeInBytes(), small.sizeInBytes() );
+		EXPECT_LT( fast.levelCount(), small.levelCount() );
+
+		// A single level leaves most keys to the fallback list, which must still be a bijection
+		BbHashEngine shallow{ 2.0, 1 };
+		shallow.build( hashes );
+		std::vector<bool> used( hashes.size(), false );
+		for ( const std::uint64_t hash : hashes )
+		{
+			const size_t position{ shallow.position( hash ) };
+			ASSERT_LT( position, hashes.size() );
+			ASSERT_FALSE( used[position] );
+			used[position] = true;
+		}
+
+		const PerfectHashMap<size_t, BbHashEngine> map{ makeItems( 1000 ), BbHashEngine{ 3.0 } };
+		EXPECT_EQ( map.at( "key999" ), 999 * 7 );
+		EXPECT_GT( map.indexSizeInBytes(), map.engine().sizeInBytes() );
+	}
+} // namespace nfx::containers::test
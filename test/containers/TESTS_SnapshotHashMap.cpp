@@ -0,0 +1,236 @@
+/**
+ * @file TESTS_SnapshotHashMap.cpp
+ * @brief Unit tests for SnapshotHashMap read-mostly container
+ * @details Test suite validating copy-on-write publication, snapshot isolation,
+ *          epoch-based reclamation and lock-free readers under concurrent writes
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nfx/containers/SnapshotHashMap.h>
+
+namespace nfx::containers::test
+{
+	//=====================================================================
+	// SnapshotHashMap Tests - Copy-on-write publication
+	//=====================================================================
+
+	//----------------------------------------------
+	// Basic construction and operations
+	//----------------------------------------------
+
+	TEST( SnapshotHashMapBasic, DefaultConstruction )
+	{
+		SnapshotHashMap<std::string, int> map;
+
+		EXPECT_TRUE( map.isEmpty() );
+		EXPECT_EQ( map.size(), 0 );
+		EXPECT_EQ( map.retiredCount(), 0 );
+	}
+
+	TEST( SnapshotHashMapBasic, InsertLookupErase )
+	{
+		SnapshotHashMap<std::string, int> map;
+
+		map.insertOrAssign( "a", 1 );
+		map.insertOrAssign( "b", 2 );
+		map.insertOrAssign( "a", 10 );
+
+		EXPECT_EQ( map.size(), 2 );
+
+		int value = 0;
+		EXPECT_TRUE( map.tryGetValue( std::string_view{ "a" }, value ) );
+		EXPECT_EQ( value, 10 );
+
+		value = -1;
+		EXPECT_FALSE( map.tryGetValue( std::string_view{ "missing" }, value ) );
+		EXPECT_EQ( value, -1 );
+
+		EXPECT_TRUE( map.erase( std::string_view{ "a" } ) );
+		EXPECT_FALSE( map.erase( std::string_view{ "a" } ) );
+		EXPECT_EQ( map.size(), 1 );
+	}
+
+	TEST( SnapshotHashMapBasic, BatchedUpdateAndAssign )
+	{
+		SnapshotHashMap<int, int> map;
+
+		map.update( []( auto& table ) {
+			for ( int i = 0; i < 1000; ++i )
+			{
+				table.insertOrAssign( i, i * i );
+			}
+		} );
+		EXPECT_EQ( map.size(), 1000 );
+
+		HashMap<int, int> replacement;
+		replacement.insertOrAssign( 7, 7 );
+		map.assign( std::move( replacement ) );
+
+		EXPECT_EQ( map.size(), 1 );
+		int value = 0;
+		EXPECT_FALSE( map.tryGetValue( 8, value ) );
+		EXPECT_TRUE( map.tryGetValue( 7, value ) );
+		EXPECT_EQ( value, 7 );
+	}
+
+	//----------------------------------------------
+	// Snapshot isolation and reclamation
+	//----------------------------------------------
+
+	TEST( SnapshotHashMapSnapshot, SeesPointInTimeView )
+	{
+		SnapshotHashMap<std::string, std::string> map;
+		map.insertOrAssign( "config", "v1" );
+
+		auto before = map.snapshot();
+
+		map.insertOrAssign( "config", "v2" );
+		map.insertOrAssign( "extra", "x" );
+
+		const std::string* value = nullptr;
+		ASSERT_TRUE( before.tryGetValue( std::string_view{ "config" }, value ) );
+		EXPECT_EQ( *value, "v1" );
+		EXPECT_FALSE( before.tryGetValue( std::string_view{ "extra" }, value ) );
+		EXPECT_EQ( value, nullptr );
+		EXPECT_EQ( before.size(), 1 );
+
+		auto after = map.snapshot();
+		ASSERT_TRUE( after.tryGetValue( std::string_view{ "config" }, value ) );
+		EXPECT_EQ( *value, "v2" );
+
+		size_t visited = 0;
+		for ( const auto& [key, val] : after.table() )
+		{
+			EXPECT_FALSE( key.empty() );
+			EXPECT_FALSE( val.empty() );
+			++visited;
+		}
+		EXPECT_EQ( visited, 2 );
+	}
+
+	TEST( SnapshotHashMapSnapshot, RetiredTablesFreedAfterRelease )
+	{
+		SnapshotHashMap<int, int> map;
+		map.insertOrAssign( 1, 1 );
+
+		{
+			auto pinned = map.snapshot();
+
+			map.insertOrAssign( 2, 2 );
+			map.insertOrAssign( 3, 3 );
+
+			// The table pinned above and everything retired after it must stay alive
+			EXPECT_EQ( map.retiredCount(), 2 );
+			EXPECT_EQ( map.reclaim(), 0 );
+
+			const int* value = nullptr;
+			EXPECT_TRUE( pinned.tryGetValue( 1, value ) );
+			EXPECT_FALSE( pinned.tryGetValue( 2, value ) );
+		}
+
+		EXPECT_EQ( map.reclaim(), 2 );
+		EXPECT_EQ( map.retiredCount(), 0 );
+
+		// Without readers, publication frees the previous table immediately
+		map.insertOrAssign( 4, 4 );
+		EXPECT_EQ( map.retiredCount(), 0 );
+	}
+
+	TEST( SnapshotHashMapSnapshot, MoveTransfersPin )
+	{
+		SnapshotHashMap<int, int> map( 2 );
+		map.insertOrAssign( 1, 1 );
+
+		auto first = map.snapshot();
+		auto moved = std::move( first );
+
+		map.insertOrAssign( 1, 2 );
+		EXPECT_EQ( map.retiredCount(), 1 );
+		EXPECT_EQ( map.reclaim(), 0 ); // Still pinned through moved
+
+		moved = map.snapshot(); // Pins the current table, then releases the old pin
+		EXPECT_EQ( map.reclaim(), 1 );
+
+		const int* value = nullptr;
+		ASSERT_TRUE( moved.tryGetValue( 1, value ) );
+		EXPECT_EQ( *value, 2 );
+	}
+
+	//----------------------------------------------
+	// Multithreaded correctness
+	//----------------------------------------------
+
+	TEST( SnapshotHashMapThreads, ReadersSeeCompleteVersions )
+	{
+		SnapshotHashMap<int, int> map( 16 );
+		constexpr int keyCount = 256;
+		constexpr int versions = 200;
+
+		map.update( []( auto& table ) {
+			for ( int k = 0; k < keyCount; ++k )
+			{
+				table.insertOrAssign( k, 0 );
+			}
+		} );
+
+		std::atomic<bool> stop{ false };
+		std::atomic<int> tornReads{ 0 };
+
+		std::vector<std::thread> readers;
+		for ( int r = 0; r < 4; ++r )
+		{
+			readers.emplace_back( [&]() {
+				while ( !stop.load( std::memory_order_relaxed ) )
+				{
+					// Every published version holds the same value for all keys
+					auto pinned = map.snapshot();
+					const int* first = nullptr;
+					if ( !pinned.tryGetValue( 0, first ) )
+					{
+						tornReads.fetch_add( 1 );
+						continue;
+					}
+					for ( int k = 1; k < keyCount; ++k )
+					{
+						const int* value = nullptr;
+						if ( !pinned.tryGetValue( k, value ) || *value != *first )
+						{
+							tornReads.fetch_add( 1 );
+							break;
+						}
+					}
+				}
+			} );
+		}
+
+		for ( int v = 1; v <= versions; ++v )
+		{
+			map.update( [v]( auto& table ) {
+				for ( int k = 0; k < keyCount; ++k )
+				{
+					table.insertOrAssign( k, v );
+				}
+			} );
+		}
+
+		stop.store( true );
+		for ( auto& reader : readers )
+		{
+			reader.join();
+		}
+
+		EXPECT_EQ( tornReads.load(), 0 );
+		map.reclaim(); // No reader left: nothing can stay pending
+		EXPECT_EQ( map.retiredCount(), 0 );
+
+		int value = 0;
+		EXPECT_TRUE( map.tryGetValue( keyCount - 1, value ) );
+		EXPECT_EQ( value, versions );
+	}
+} // namespace nfx::containers::test
@@ -0,0 +1,161 @@
+/**
+ * @file TESTS_StaticChdHashMap.cpp
+ * @brief Unit tests for the compile-time StaticChdHashMap
+ * @details Test suite validating constant-evaluated construction and lookups, run-time
+ *          lookups on the same tables, and generated key sets
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <nfx/containers/StaticChdHashMap.h>
+
+namespace nfx::containers::test
+{
+	//=====================================================================
+	// StaticChdHashMap Tests
+	//=====================================================================
+
+	namespace
+	{
+		enum class Unit
+		{
+			Metre,
+			Kilogram,
+			Second,
+			Ampere,
+			Kelvin,
+			Mole,
+			Candela
+		};
+
+		constexpr auto UNITS{ makeStaticChdHashMap<Unit>( {
+			{ "m", Unit::Metre },
+			{ "kg", Unit::Kilogram },
+			{ "s", Unit::Second },
+			{ "A", Unit::Ampere },
+			{ "K", Unit::Kelvin },
+			{ "mol", Unit::Mole },
+			{ "cd", Unit::Candela } } ) };
+
+		constexpr size_t GENERATED_COUNT = 1000;
+
+		/** @brief Key characters for "key0000".."key0999", with static storage for the views below */
+		constexpr auto GENERATED_KEY_CHARS{ [] {
+			std::array<std::array<char, 7>, GENERATED_COUNT> chars{};
+			for ( size_t i = 0; i < GENERATED_COUNT; ++i )
+			{
+				chars[i] = { 'k', 'e', 'y',
+					static_cast<char>( '0' + i / 1000 % 10 ),
+					static_cast<char>( '0' + i / 100 % 10 ),
+					static_cast<char>( '0' + i / 10 % 10 ),
+					static_cast<char>( '0' + i % 10 ) };
+			}
+
+			return chars;
+		}() };
+
+		constexpr auto GENERATED_ITEMS{ [] {
+			std::array<std::pair<std::string_view, size_t>, GENERATED_COUNT> items{};
+			for ( size_t i = 0; i < GENERATED_COUNT; ++i )
+			{
+				items[i] = { std::string_view{ GENERATED_KEY_CHARS[i].data(), GENERATED_KEY_CHARS[i].size() }, i * 3 };
+			}
+
+			return items;
+		}() };
+
+		constexpr StaticChdHashMap GENERATED{ GENERATED_ITEMS };
+	} // namespace
+
+	//----------------------------------------------
+	// Compile-time lookups
+	//----------------------------------------------
+
+	static_assert( UNITS.size() == 7 );
+	static_assert( !UNITS.isEmpty() );
+	static_assert( UNITS.at( "kg" ) == Unit::Kilogram );
+	static_assert( UNITS.at( "mol" ) == Unit::Mole );
+	static_assert( UNITS.contains( "cd" ) );
+	static_assert( !UNITS.contains( "g" ) );
+	static_assert( !UNITS.contains( "" ) );
+	static_assert( StaticChdHashMap<Unit, 7>::SLOT_COUNT == 16 );
+	static_assert( GENERATED.at( "key0999" ) == 2997 );
+	static_assert( !GENERATED.contains( "key1000" ) );
+
+	TEST( StaticChdHashMap, ConstantEvaluatedTryGetValue )
+	{
+		constexpr bool found{ [] {
+			const Unit* unit{ nullptr };
+			return UNITS.tryGetValue( "K", unit ) && *unit == Unit::Kelvin;
+		}() };
+		constexpr bool missing{ [] {
+			const Unit* unit{ nullptr };
+			return !UNITS.tryGetValue( "k", unit ) && unit == nullptr;
+		}() };
+
+		EXPECT_TRUE( found );
+		EXPECT_TRUE( missing );
+	}
+
+	//----------------------------------------------
+	// Run-time lookups
+	//----------------------------------------------
+
+	TEST( StaticChdHashMap, RuntimeKeys )
+	{
+		// Keys built at run time go through the same hash as the compiler used
+		const std::string kilogram{ std::string{ "k" } + "g" };
+		EXPECT_EQ( UNITS.at( kilogram ), Unit::Kilogram );
+
+		const Unit* unit{ nullptr };
+		EXPECT_TRUE( UNITS.tryGetValue( std::string{ "cd" }, unit ) );
+		EXPECT_EQ( *unit, Unit::Candela );
+
+		EXPECT_FALSE( UNITS.tryGetValue( std::string{ "lm" }, unit ) );
+		EXPECT_EQ( unit, nullptr );
+		EXPECT_THROW( (void)UNITS.at( std::string{ "lx" } ), decltype( UNITS )::KeyNotFoundException );
+	}
+
+	TEST( StaticChdHashMap, IteratesInInputOrder )
+	{
+		constexpr std::array<std::string_view, 7> expected{ "m", "kg", "s", "A", "K", "mol", "cd" };
+
+		size_t index{ 0 };
+		for ( const auto& [key, unit] : UNITS )
+		{
+			EXPECT_EQ( key, expected[index] );
+			EXPECT_EQ( unit, static_cast<Unit>( index ) );
+			++index;
+		}
+		EXPECT_EQ( index, UNITS.size() );
+	}
+
+	TEST( StaticChdHashMap, GeneratedKeys )
+	{
+		EXPECT_EQ( GENERATED.size(), GENERATED_COUNT );
+
+		for ( size_t i = 0; i < GENERATED_COUNT; ++i )
+		{
+			const std::string key{ std::string{ GENERATED_ITEMS[i].first } };
+			const size_t* value{ nullptr };
+			ASSERT_TRUE( GENERATED.tryGetValue( key, value ) ) << key;
+			EXPECT_EQ( *value, i * 3 );
+			EXPECT_FALSE( GENERATED.contains( key + "x" ) );
+		}
+	}
+
+	TEST( StaticChdHashMap, CustomOffsetBasis )
+	{
+		constexpr auto map{ makeStaticChdHashMap<int, 0x01234567>( { { "alpha", 1 }, { "beta", 2 }, { "gamma", 3 } } ) };
+
+		static_assert( map.at( "gamma" ) == 3 );
+		EXPECT_NE( decltype( map )::hash( "alpha" ), decltype( UNITS )::hash( "alpha" ) );
+		EXPECT_EQ( map.at( std::string{ "beta" } ), 2 );
+	}
+} // namespace nfx::containers::test
@@ -6,10 +6,12 @@
  */
 
 #include <algorithm>
+#include <memory_resource>
 
 #include <gtest/gtest.h>
 
 #include <nfx/containers/StringMap.h>
+#include <nfx/containers/functors/HashPolicies.h>
 
 namespace nfx::containers::test
 {
@@ -691,4 +693,59 @@ namespace nfx::containers::test
 		config.insert_or_assign( dynamic_key, "dynamic_value" );
 		EXPECT_EQ( config[std::string_view{ "dynamic_setting" }], "dynamic_value" );
 	}
+
+	//----------------------------------------------
+	// Polymorphic allocator support
+	//----------------------------------------------
+
+	TEST( StringMapPmr, NodesAndKeysComeFromResource )
+	{
+		std::pmr::monotonic_buffer_resource arena;
+		std::pmr::memory_resource* previous{ std::pmr::set_default_resource( std::pmr::null_memory_resource() ) };
+
+		{
+			pmr::StringMap<int> map( &arena );
+			EXPECT_EQ( map.get_allocator().resource(), &arena );
+
+			map[std::string_view{ "request_header_name_longer_than_sso" }] = 1;
+			map.try_emplace( "content_type_header_longer_than_sso", 2 );
+			map.insert_or_assign( std::string_view{ "request_header_name_longer_than_sso" }, 3 );
+
+			EXPECT_EQ( map.size(), 2 );
+			EXPECT_EQ( map.at( "request_header_name_longer_than_sso" ), 3 );
+			EXPECT_EQ( map.at( std::string_view{ "content_type_header_longer_than_sso" } ), 2 );
+			EXPECT_EQ( map.begin()->first.get_allocator().resource(), &arena );
+		}
+
+		std::pmr::set_default_resource( previous );
+	}
+
+	//----------------------------------------------
+	// Seeded hashing
+	//----------------------------------------------
+
+	TEST( StringMapSeededHash, EachMapDrawsItsOwnKey )
+	{
+		using SeededMap = StringMap<int, std::allocator<std::pair<const std::string, int>>, SipHash13>;
+
+		SeededMap first;
+		SeededMap second;
+		EXPECT_NE( first.hash_function()( "Accept-Encoding" ), second.hash_function()( "Accept-Encoding" ) );
+
+		first["Accept-Encoding"] = 1;
+		first.try_emplace( std::string_view{ "Content-Length" }, 2 );
+		first.insert_or_assign( "Accept-Encoding", 3 );
+		EXPECT_EQ( first.at( std::string_view{ "Accept-Encoding" } ), 3 );
+		EXPECT_EQ( first.at( "Content-Length" ), 2 );
+
+		// Copies keep the key their buckets were laid out with
+		const SeededMap copy{ first };
+		EXPECT_EQ( copy.hash_function()( "x" ), first.hash_function()( "x" ) );
+		EXPECT_EQ( copy.at( "Content-Length" ), 2 );
+
+		std::pmr::monotonic_buffer_resource arena;
+		pmr::StringMap<int, SipHash13> pooled( &arena );
+		pooled[std::string_view{ "request_header_name_longer_than_sso" }] = 4;
+		EXPECT_EQ( pooled.at( "request_header_name_longer_than_sso" ), 4 );
+	}
 } // namespace nfx::containers::test
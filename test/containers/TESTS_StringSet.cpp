@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <memory_resource>
 
 #include <nfx/containers/StringSet.h>
 
@@ -266,4 +267,30 @@ namespace nfx::containers::test
 		auto found{ std::find( set.begin(), set.end(), "item2" ) };
 		EXPECT_NE( found, set.end() );
 	}
+
+	//----------------------------------------------
+	// Polymorphic allocator support
+	//----------------------------------------------
+
+	TEST( StringSetPmr, NodesAndElementsComeFromResource )
+	{
+		std::pmr::monotonic_buffer_resource arena;
+		std::pmr::memory_resource* previous{ std::pmr::set_default_resource( std::pmr::null_memory_resource() ) };
+
+		{
+			pmr::StringSet set( &arena );
+			EXPECT_EQ( set.get_allocator().resource(), &arena );
+
+			EXPECT_TRUE( set.insert( "tag_name_longer_than_small_string_buffer" ).second );
+			EXPECT_TRUE( set.emplace( std::string_view{ "another_tag_longer_than_small_string_buffer" } ).second );
+			EXPECT_FALSE( set.insert( std::string_view{ "tag_name_longer_than_small_string_buffer" } ).second );
+
+			EXPECT_EQ( set.size(), 2 );
+			EXPECT_TRUE( set.contains( "another_tag_longer_than_small_string_buffer" ) );
+			EXPECT_FALSE( set.contains( std::string_view{ "missing" } ) );
+			EXPECT_EQ( set.begin()->get_allocator().resource(), &arena );
+		}
+
+		std::pmr::set_default_resource( previous );
+	}
 } // namespace nfx::containers::test
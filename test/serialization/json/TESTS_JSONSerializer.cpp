@@ -13,6 +13,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <set>
 #include <string>
@@ -307,6 +308,18 @@ namespace nfx::serialization::json::test
 			testRoundTrip( customChdMap );
 		}
 
+		// Test ChdHashMap with a polymorphic allocator
+		{
+			using nfx::containers::pmr::ChdHashMap;
+			std::pmr::monotonic_buffer_resource resource;
+			ChdHashMap<int>::container_type items{ &resource };
+			items.emplace_back( "pmr1", 10 );
+			items.emplace_back( "pmr2", 20 );
+			items.emplace_back( "pmr3", 30 );
+			ChdHashMap<int> pmrChdMap( std::move( items ) );
+			testRoundTrip( pmrChdMap );
+		}
+
 		// Test using convenience functions with ChdHashMap
 		{
 			std::vector<std::pair<std::string, std::string>> items{
@@ -343,6 +356,14 @@ namespace nfx::serialization::json::test
 
 		// Test empty HashMap
 		testRoundTrip( HashMap<std::string, int>() );
+
+		// Test HashMap64 (64-bit cached hashes)
+		nfx::containers::HashMap64<std::string, int> hashMap64;
+		hashMap64.insertOrAssign( "alpha", 1 );
+		hashMap64.insertOrAssign( "beta", 2 );
+		hashMap64.insertOrAssign( "gamma", 3 );
+		testRoundTrip( hashMap64 );
+		testRoundTrip( nfx::containers::HashMap64<std::string, int>() );
 	}
 
 	TEST_F( JSONSerializerTest, NfxStringMapTypes )